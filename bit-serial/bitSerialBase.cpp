@@ -23,11 +23,45 @@ bitSerialBase::deleteDevice()
   assert(status == PIM_OK);
 }
 
+//! @brief  Start recording a micro-program as a micro-kernel for peephole optimization.
+//!         Return false if micro ops are issued directly
+bool
+bitSerialBase::beginMicroProgram(const std::vector<PimObjId>& objIds)
+{
+  // SIMDRAM micro-programs use AP/AAP which are not supported by micro-kernels
+  PimDeviceEnum deviceType = getDeviceType();
+  if (!m_usePeepholeOpt || (deviceType != PIM_DEVICE_BITSIMD_V && deviceType != PIM_DEVICE_BITSIMD_V_AP)) {
+    return false;
+  }
+  return pimBeginMicroKernel(objIds) == PIM_OK;
+}
+
+//! @brief  End recording, and run the peephole optimized micro-kernel
+void
+bitSerialBase::endMicroProgram(const std::vector<PimObjId>& objIds)
+{
+  // row regs are scratch in bit-serial micro-programs
+  PimMicroKernelId kernelId = pimEndMicroKernel(PIM_MICRO_KERNEL_OPT_PEEPHOLE_SCRATCH);
+  if (kernelId == -1) {
+    std::cout << "Error: Failed to record micro-program" << std::endl;
+    return;
+  }
+  PimMicroKernelStats stats;
+  pimGetMicroKernelStats(kernelId, &stats);
+  std::cout << "INFO: Peephole optimized Num Read, Write, Logic : "
+            << stats.numRecordedRead << ", " << stats.numRecordedWrite << ", " << stats.numRecordedLogic << " -> "
+            << stats.numRead << ", " << stats.numWrite << ", " << stats.numLogic << std::endl;
+  pimRunMicroKernel(kernelId, objIds);
+  pimDeleteMicroKernel(kernelId);
+}
+
 //! @brief  Run tests
 bool
 bitSerialBase::runTests(const std::vector<std::string>& testList)
 {
   bool ok = true;
+  unsigned numBits = 0;
+  bool isSigned = false;
 
   createDevice();
 
@@ -50,6 +84,16 @@ bitSerialBase::runTests(const std::vector<std::string>& testList)
       ok &= testInt<uint64_t>(testName, PIM_UINT64);
     } else if (testName == "fp32") {
       ok &= testFp<float>(testName, PIM_FP32);
+    } else if (parseCustomIntTest(testName, numBits, isSigned)) {
+      if (numBits <= 8) {
+        ok &= (isSigned ? testInt<int8_t>(testName, PIM_INT8, numBits) : testInt<uint8_t>(testName, PIM_UINT8, numBits));
+      } else if (numBits <= 16) {
+        ok &= (isSigned ? testInt<int16_t>(testName, PIM_INT16, numBits) : testInt<uint16_t>(testName, PIM_UINT16, numBits));
+      } else if (numBits <= 32) {
+        ok &= (isSigned ? testInt<int32_t>(testName, PIM_INT32, numBits) : testInt<uint32_t>(testName, PIM_UINT32, numBits));
+      } else {
+        ok &= (isSigned ? testInt<int64_t>(testName, PIM_INT64, numBits) : testInt<uint64_t>(testName, PIM_UINT64, numBits));
+      }
     } else {
       std::cout << "Error: Unknown test " << testName << std::endl;
     }
@@ -60,3 +104,16 @@ bitSerialBase::runTests(const std::vector<std::string>& testList)
   return ok;
 }
 
+//! @brief  Parse a test of custom bit-width integers, e.g., int5 or uint12
+bool
+bitSerialBase::parseCustomIntTest(const std::string& testName, unsigned& numBits, bool& isSigned)
+{
+  isSigned = (testName.rfind("int", 0) == 0);
+  std::string prefix = (isSigned ? "int" : "uint");
+  if (testName.rfind(prefix, 0) != 0 || testName.size() == prefix.size()
+      || testName.find_first_not_of("0123456789", prefix.size()) != std::string::npos) {
+    return false;
+  }
+  numBits = std::stoul(testName.substr(prefix.size()));
+  return numBits >= (isSigned ? 2 : 1) && numBits < 64;
+}
@@ -14,6 +14,8 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <tuple>
+#include <algorithm>
 
 //! @class  bitSerialBase
 //! @brief  Bit-serial perf base class
@@ -24,8 +26,11 @@ public:
   virtual ~bitSerialBase() {}
 
   bool runTests(const std::vector<std::string>& testList);
+  void setPeepholeOpt(bool usePeepholeOpt) { m_usePeepholeOpt = usePeepholeOpt; }
 
   const std::map<std::string, std::pair<int, int>>& getStats() const { return m_stats; }
+  const std::map<std::string, std::vector<std::tuple<std::string, unsigned, unsigned, unsigned>>>& getPerfTable() const { return m_perfTable; }
+  static bool parseCustomIntTest(const std::string& testName, unsigned& numBits, bool& isSigned);
 
 protected:
 
@@ -99,15 +104,19 @@ protected:
   // helper functions
   void createDevice();
   void deleteDevice();
+  bool beginMicroProgram(const std::vector<PimObjId>& objIds);
+  void endMicroProgram(const std::vector<PimObjId>& objIds);
   bool getBit(uint64_t val, int nth) const { return (val >> nth) & 1; }
 
   template <typename T> std::vector<T> getRandInt(uint64_t numElements, T min, T max, bool allowZero = true);
   template <typename T> std::vector<T> getRandFp(uint64_t numElements, T min, T max, bool allowZero = true);
-  template <typename T> bool testInt(const std::string& category, PimDataType dataType);
+  template <typename T> bool testInt(const std::string& category, PimDataType dataType, unsigned numBits = sizeof(T) * 8);
   template <typename T> bool testFp(const std::string& category, PimDataType dataType);
 
   std::map<std::string, std::pair<int, int>> m_stats; // data type category -> (numPassed, numTests)
+  std::map<std::string, std::vector<std::tuple<std::string, unsigned, unsigned, unsigned>>> m_perfTable; // data type category -> list of (test, #R, #W, #L) of passed tests
   std::string m_deviceName;
+  bool m_usePeepholeOpt = true;
 };
 
 
@@ -155,13 +164,14 @@ bitSerialBase::getRandFp(uint64_t numElements, T min, T max, bool allowZero)
 }
 
 
-//! @brief  Test integer bit-serial micro-programs
+//! @brief  Test integer bit-serial micro-programs. With numBits less than the bits of T, test custom bit-width
+//!         integers of numBits bits, which are stored in T on host side
 template <typename T> bool
-bitSerialBase::testInt(const std::string& category, PimDataType dataType)
+bitSerialBase::testInt(const std::string& category, PimDataType dataType, unsigned numBits)
 {
   int numPassed = 0;
   uint64_t numElements = 4000;
-  unsigned numBits = sizeof(T) * 8;
+  bool isCustomInt = (numBits < sizeof(T) * 8);
   T maxVal = 0;
   T minVal = 0;
   bool isSigned = true;
@@ -202,6 +212,19 @@ bitSerialBase::testInt(const std::string& category, PimDataType dataType)
       std::cout << "Error: Unsupported data type." << std::endl;
       return false;
   };
+  // scalar value uses this type to represent bits for now
+  uint64_t scalarVal = 123;
+  if (isCustomInt) {
+    // keep values and the scalar within range of custom bit-width integers. like int8, skip the most negative
+    // value, which has no positive counterpart for abs and div
+    if (isSigned) {
+      minVal = static_cast<T>(std::max<int64_t>(static_cast<int64_t>(minVal), -(1LL << (numBits - 1)) + 1));
+      maxVal = static_cast<T>(std::min<int64_t>(static_cast<int64_t>(maxVal), (1LL << (numBits - 1)) - 1));
+    } else {
+      maxVal = static_cast<T>(std::min<uint64_t>(static_cast<uint64_t>(maxVal), (1ULL << numBits) - 1));
+    }
+    scalarVal = std::min<uint64_t>(scalarVal, static_cast<uint64_t>(maxVal));
+  }
 
   std::cout << "================================================================" << std::endl;
   std::cout << "INFO: Evaluating bit-serial micro-programs for [" << m_deviceName << ":" << category << "]" << std::endl;
@@ -221,18 +244,19 @@ bitSerialBase::testInt(const std::string& category, PimDataType dataType)
   // create EQ cases
   vecSrc2[100] = vecSrc1[100];
   vecSrc2[3000] = vecSrc1[3000];
-  // scalar value uses this type to represent bits for now
-  uint64_t scalarVal = 123;
   vecSrc1[500] = static_cast<T>(scalarVal); // cover scalar EQ
   vecSrc1[501] = static_cast<T>(scalarVal - 1); // cover scalar LT
 
   // allocate PIM objects
-  PimObjId src1 = pimAlloc(PIM_ALLOC_V1, numElements, dataType);
-  PimObjId src2 = pimAllocAssociated(src1, dataType);
-  PimObjId srcNonZero = pimAllocAssociated(src1, dataType);
-  PimObjId dest1 = pimAllocAssociated(src1, dataType);
-  PimObjId dest2 = pimAllocAssociated(src1, dataType);
-  PimObjId src3 = pimAllocAssociated(src1, dataType);  // alloc at last for oob check
+  auto allocAssociated = [&](PimObjId assocId) {
+    return isCustomInt ? pimAllocAssociatedCustomInt(assocId, numBits, isSigned) : pimAllocAssociated(assocId, dataType);
+  };
+  PimObjId src1 = isCustomInt ? pimAllocCustomInt(PIM_ALLOC_V1, numElements, numBits, isSigned) : pimAlloc(PIM_ALLOC_V1, numElements, dataType);
+  PimObjId src2 = allocAssociated(src1);
+  PimObjId srcNonZero = allocAssociated(src1);
+  PimObjId dest1 = allocAssociated(src1);
+  PimObjId dest2 = allocAssociated(src1);
+  PimObjId src3 = allocAssociated(src1);  // alloc at last for oob check
 
   // for printing. keep in sync with switch case below
   const std::vector<std::string> testNames = {
@@ -293,6 +317,7 @@ bitSerialBase::testInt(const std::string& category, PimDataType dataType)
     }
 
     pimResetStats();
+    bool isRecording = beginMicroProgram({src1, src2, srcNonZero, src3, dest2});
 
     if (isSigned) {
       switch (testId) {
@@ -364,7 +389,13 @@ bitSerialBase::testInt(const std::string& category, PimDataType dataType)
       }
     }
 
+    if (isRecording) {
+      endMicroProgram({src1, src2, srcNonZero, src3, dest2});
+    }
+
     pimShowStats();
+    unsigned numR = 0, numW = 0, numL = 0;
+    pimGetMicroOpStats(&numR, &numW, &numL);
 
     pimCopyDeviceToHost(dest1, (void*)vecDestVerify.data());
     pimCopyDeviceToHost(dest2, (void*)vecDest.data());
@@ -407,6 +438,7 @@ bitSerialBase::testInt(const std::string& category, PimDataType dataType)
     std::cout << tag << " End " << (ok ? " -- Succeeded" : " -- Failed!") << std::endl;
     if (ok) {
       numPassed++;
+      m_perfTable[category].emplace_back(testNames[testId], numR, numW, numL);
     }
   }
 
@@ -495,6 +527,7 @@ bitSerialBase::testFp(const std::string& category, PimDataType dataType)
     }
 
     pimResetStats();
+    bool isRecording = beginMicroProgram({src1, src2, srcNonZero, src3, dest2});
 
     if (numBits == 32) {
       switch (testId) {
@@ -508,7 +541,13 @@ bitSerialBase::testFp(const std::string& category, PimDataType dataType)
       }
     }
 
+    if (isRecording) {
+      endMicroProgram({src1, src2, srcNonZero, src3, dest2});
+    }
+
     pimShowStats();
+    unsigned numR = 0, numW = 0, numL = 0;
+    pimGetMicroOpStats(&numR, &numW, &numL);
 
     pimCopyDeviceToHost(dest1, (void*)vecDestVerify.data());
     pimCopyDeviceToHost(dest2, (void*)vecDest.data());
@@ -546,6 +585,7 @@ bitSerialBase::testFp(const std::string& category, PimDataType dataType)
     std::cout << tag << " End " << (ok ? " -- Succeeded" : " -- Failed!") << std::endl;
     if (ok) {
       numPassed++;
+      m_perfTable[category].emplace_back(testNames[testId], numR, numW, numL);
     }
   }
 
@@ -9,6 +9,15 @@
 #include "bitSerialBitsimdAp.h"
 #include "bitSerialSimdram.h"
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <unistd.h>
+#include <sys/wait.h>
 
 bitSerialMain::bitSerialMain()
 {
@@ -28,43 +37,177 @@ bitSerialMain::bitSerialMain()
     "uint64",
     "fp32",
   };
+  m_customIntDeviceList = {
+    "bitsimd_v",
+    "bitsimd_v_ap",
+  };
+}
+
+//! @brief  Get tests of a device, including custom bit-width integers of all non-standard widths if enabled
+std::vector<std::string>
+bitSerialMain::getDeviceTestList(const std::string& device, const std::vector<std::string>& testList) const
+{
+  std::vector<std::string> deviceTestList = testList;
+  if (!m_useCustomInt || std::find(m_customIntDeviceList.begin(), m_customIntDeviceList.end(), device) == m_customIntDeviceList.end()) {
+    return deviceTestList;
+  }
+  for (const std::string prefix : { "int", "uint" }) {
+    for (unsigned numBits = (prefix == "int" ? 2 : 1); numBits < 64; ++numBits) {
+      if (numBits != 8 && numBits != 16 && numBits != 32) {
+        deviceTestList.push_back(prefix + std::to_string(numBits));
+      }
+    }
+  }
+  return deviceTestList;
 }
 
+//! @brief  Run tests of a device, and collect stats and perf of passed micro-programs
+bool
+bitSerialMain::runTest(const std::string& device, const std::vector<std::string>& testList)
+{
+  std::unique_ptr<bitSerialBase> model;
+  if (device == "bitsimd_v") {
+    model = std::make_unique<bitSerialBitsimd>();
+  } else if (device == "bitsimd_v_ap") {
+    model = std::make_unique<bitSerialBitsimdAp>();
+  } else if (device == "simdram") {
+    model = std::make_unique<bitSerialSimdram>();
+  }
+  if (!model) {
+    return false;
+  }
+  model->setPeepholeOpt(m_usePeepholeOpt);
+  bool ok = model->runTests(testList);
+  for (const auto& [test, stat] : model->getStats()) {
+    m_stats[device][test] = stat;
+  }
+  for (const auto& [test, perf] : model->getPerfTable()) {
+    m_perfTable[device][test] = perf;
+  }
+  return ok;
+}
+
+//! @brief  Run each (device, test) pair in a child process, as the PIMeval simulator is a singleton.
+//!         Outputs of child processes are shown in the same order as a sequential run
 void
-bitSerialMain::runTests(const std::vector<std::string>& deviceList, const std::vector<std::string>& testList)
+bitSerialMain::runTestsParallel(const std::vector<std::string>& deviceList, const std::vector<std::string>& testList)
 {
-  const auto& myDeviceList = deviceList.empty() ? m_deviceList : deviceList;
-  const auto& myTestList = testList.empty() ? m_testList : testList;
+  struct job {
+    std::string m_device;
+    std::string m_test;
+    std::string m_logFile;
+    std::string m_resultFile;
+    bool m_ok = false;
+  };
+  std::vector<job> jobs;
+  std::string prefix = (std::filesystem::temp_directory_path() / ("bitSerial." + std::to_string(getpid()) + ".")).string();
+  for (const auto& device : deviceList) {
+    for (const auto& test : getDeviceTestList(device, testList)) {
+      std::string name = prefix + std::to_string(jobs.size());
+      jobs.push_back({device, test, name + ".log", name + ".result"});
+    }
+  }
 
-  // device -> test -> numPassed/numTests
-  std::map<std::string, std::map<std::string, std::pair<int, int>>> stats;
+  // launch at most m_numJobs child processes at a time
+  std::map<pid_t, size_t> running;
+  size_t nextJob = 0;
+  std::cout.flush();
+  std::fflush(stdout);
+  while (nextJob < jobs.size() || !running.empty()) {
+    if (nextJob < jobs.size() && running.size() < m_numJobs) {
+      pid_t pid = fork();
+      if (pid == 0) {
+        // child: redirect outputs to log file, and save stats and perf to result file
+        const job& myJob = jobs[nextJob];
+        if (!std::freopen(myJob.m_logFile.c_str(), "w", stdout)) {
+          std::_Exit(1);
+        }
+        bool ok = runTest(myJob.m_device, {myJob.m_test});
+        std::ofstream result(myJob.m_resultFile);
+        const auto& stat = m_stats[myJob.m_device][myJob.m_test];
+        result << stat.first << " " << stat.second << std::endl;
+        for (const auto& [op, numR, numW, numL] : m_perfTable[myJob.m_device][myJob.m_test]) {
+          result << op << " " << numR << " " << numW << " " << numL << std::endl;
+        }
+        result.close();
+        std::cout.flush();
+        std::fflush(stdout);
+        std::_Exit(ok ? 0 : 1);
+      }
+      if (pid < 0) {
+        std::cout << "Error: Failed to create child process for " << jobs[nextJob].m_device << ":" << jobs[nextJob].m_test << std::endl;
+        nextJob++;
+        continue;
+      }
+      running[pid] = nextJob++;
+      continue;
+    }
+    int status = 0;
+    pid_t pid = wait(&status);
+    if (pid < 0) {
+      break;
+    }
+    auto it = running.find(pid);
+    if (it != running.end()) {
+      jobs[it->second].m_ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+      running.erase(it);
+    }
+  }
 
-  for (const auto& device : myDeviceList) {
+  // collect outputs, stats and perf
+  for (const auto& device : deviceList) {
     std::cout << "INFO: Bit Serial Performance Modeling for " << device << std::endl;
-    std::unique_ptr<bitSerialBase> model;
-    if (device == "bitsimd_v") {
-      model = std::make_unique<bitSerialBitsimd>();
-    } else if (device == "bitsimd_v_ap") {
-      model = std::make_unique<bitSerialBitsimdAp>();
-    } else if (device == "simdram") {
-      model = std::make_unique<bitSerialSimdram>();
-    }
-    bool ok = false;
-    if (model) {
-      ok = model->runTests(myTestList);
-      stats[device] = model->getStats();
+    bool ok = true;
+    for (const auto& myJob : jobs) {
+      if (myJob.m_device != device) {
+        continue;
+      }
+      ok &= myJob.m_ok;
+      std::ifstream log(myJob.m_logFile);
+      if (log.is_open()) {
+        std::cout << log.rdbuf();
+      }
+      std::ifstream result(myJob.m_resultFile);
+      std::pair<int, int> stat;
+      if (result >> stat.first >> stat.second) {
+        m_stats[device][myJob.m_test] = stat;
+        std::string op;
+        unsigned numR = 0, numW = 0, numL = 0;
+        while (result >> op >> numR >> numW >> numL) {
+          m_perfTable[device][myJob.m_test].emplace_back(op, numR, numW, numL);
+        }
+      }
+      std::remove(myJob.m_logFile.c_str());
+      std::remove(myJob.m_resultFile.c_str());
     }
     std::cout << "INFO: Bit Serial Performance Modeling for " << device << (ok ? " -- Succeed" : " -- Failed!") << std::endl;
   }
+}
+
+void
+bitSerialMain::runTests(const std::vector<std::string>& deviceList, const std::vector<std::string>& testList)
+{
+  const auto& myDeviceList = deviceList.empty() ? m_deviceList : deviceList;
+  const auto& myTestList = testList.empty() ? m_testList : testList;
+
+  if (m_numJobs > 1) {
+    runTestsParallel(myDeviceList, myTestList);
+  } else {
+    for (const auto& device : myDeviceList) {
+      std::cout << "INFO: Bit Serial Performance Modeling for " << device << std::endl;
+      bool ok = runTest(device, getDeviceTestList(device, myTestList));
+      std::cout << "INFO: Bit Serial Performance Modeling for " << device << (ok ? " -- Succeed" : " -- Failed!") << std::endl;
+    }
+  }
 
   // show stats
   std::cout << "----------------------------------------" << std::endl;
   std::cout << "Summary (passed / total):" << std::endl;
   for (const auto& device : myDeviceList) {
     std::cout << "    " << device << std::endl;
-    auto it = stats.find(device);
-    if (it != stats.end()) {
-      for (const auto& test : myTestList) {
+    auto it = m_stats.find(device);
+    if (it != m_stats.end()) {
+      for (const auto& test : getDeviceTestList(device, myTestList)) {
         auto it2 = it->second.find(test);
         if (it2 != it->second.end()) {
           std::cout << "        " << test << " : " << it2->second.first << " / " << it2->second.second << std::endl;
@@ -75,10 +218,138 @@ bitSerialMain::runTests(const std::vector<std::string>& deviceList, const std::v
   std::cout << "----------------------------------------" << std::endl;
 }
 
-int main()
+//! @brief  Generate the C++ perf table of passed bit-serial micro-programs for libpimeval
+bool
+bitSerialMain::generatePerfTable(const std::string& fileName) const
+{
+  auto toUpper = [](std::string str) {
+    std::transform(str.begin(), str.end(), str.begin(), ::toupper);
+    return str;
+  };
+
+  std::ostringstream oss;
+  oss << "// File: " << std::filesystem::path(fileName).filename().string() << "\n"
+      << "// PIMeval Simulator - Performance and Energy Tables\n"
+      << "// Copyright (c) 2024 University of Virginia\n"
+      << "// This file is licensed under the MIT License.\n"
+      << "// See the LICENSE file in the root of this repository for more details.\n"
+      << "//\n"
+      << "// Generated by the bit-serial micro-program framework. Do not edit manually.\n"
+      << "// To regenerate: cd bit-serial && make tables\n"
+      << "\n"
+      << "#include \"pimPerfEnergyTables.h\"\n"
+      << "#include \"pimCmd.h\"\n"
+      << "#include <unordered_map>\n"
+      << "#include <map>\n"
+      << "#include <tuple>\n"
+      << "#include <utility>\n"
+      << "\n"
+      << "\n"
+      << "//! @brief  BitSIMD performance table of passed bit-serial micro-programs (Tuple: #R, #W, #L)\n"
+      << "const std::unordered_map<PimDeviceEnum, std::unordered_map<PimDataType,\n"
+      << "    std::unordered_map<PimCmdEnum, std::tuple<unsigned, unsigned, unsigned>>>>\n"
+      << "pimPerfEnergyTables::bitsimdPerfTableGenerated = {\n";
+  for (const auto& device : m_deviceList) {
+    auto it = m_perfTable.find(device);
+    if (it == m_perfTable.end()) {
+      continue;
+    }
+    bool isEmpty = true;
+    for (const auto& test : m_testList) {
+      auto it2 = it->second.find(test);
+      if (it2 == it->second.end() || it2->second.empty()) {
+        continue;
+      }
+      if (isEmpty) {
+        oss << "  { PIM_DEVICE_" << toUpper(device) << ", {\n";
+        isEmpty = false;
+      }
+      oss << "    { PIM_" << toUpper(test) << ", {\n";
+      for (const auto& [op, numR, numW, numL] : it2->second) {
+        oss << "      { PimCmdEnum::" << std::left << std::setw(13) << (toUpper(op) + ",") << std::right
+            << " { " << std::setw(4) << numR << ", " << std::setw(4) << numW << ", " << std::setw(4) << numL << " } },\n";
+      }
+      oss << "    }},\n";
+    }
+    if (!isEmpty) {
+      oss << "  }},\n";
+    }
+  }
+  oss << "};\n";
+
+  oss << "\n"
+      << "//! @brief  BitSIMD performance table of passed bit-serial micro-programs on custom bit-width integers\n"
+      << "//!         (Key: is signed, number of bits. Tuple: #R, #W, #L)\n"
+      << "const std::unordered_map<PimDeviceEnum, std::map<std::pair<bool, unsigned>,\n"
+      << "    std::unordered_map<PimCmdEnum, std::tuple<unsigned, unsigned, unsigned>>>>\n"
+      << "pimPerfEnergyTables::bitsimdPerfTableCustomIntGenerated = {\n";
+  for (const auto& device : m_customIntDeviceList) {
+    auto it = m_perfTable.find(device);
+    if (it == m_perfTable.end()) {
+      continue;
+    }
+    bool isEmpty = true;
+    for (const auto& test : getDeviceTestList(device, {})) {
+      auto it2 = it->second.find(test);
+      unsigned numBits = 0;
+      bool isSigned = false;
+      if (it2 == it->second.end() || it2->second.empty() || !bitSerialBase::parseCustomIntTest(test, numBits, isSigned)) {
+        continue;
+      }
+      if (isEmpty) {
+        oss << "  { PIM_DEVICE_" << toUpper(device) << ", {\n";
+        isEmpty = false;
+      }
+      oss << "    { { " << (isSigned ? "true" : "false") << ", " << numBits << " }, {\n";
+      for (const auto& [op, numR, numW, numL] : it2->second) {
+        oss << "      { PimCmdEnum::" << std::left << std::setw(13) << (toUpper(op) + ",") << std::right
+            << " { " << std::setw(4) << numR << ", " << std::setw(4) << numW << ", " << std::setw(4) << numL << " } },\n";
+      }
+      oss << "    }},\n";
+    }
+    if (!isEmpty) {
+      oss << "  }},\n";
+    }
+  }
+  oss << "};\n";
+
+  std::ofstream file(fileName);
+  if (!file.is_open()) {
+    std::cout << "Error: Cannot open " << fileName << " for writing" << std::endl;
+    return false;
+  }
+  file << oss.str();
+  std::cout << "INFO: Generated bit-serial perf table " << fileName << std::endl;
+  return true;
+}
+
+int main(int argc, char* argv[])
 {
   bitSerialMain app;
+  std::string tableFile;
+  int opt = 0;
+  while ((opt = getopt(argc, argv, "j:o:nch")) != -1) {
+    switch (opt) {
+    case 'j':
+      app.setNumJobs(std::atoi(optarg));
+      break;
+    case 'o':
+      tableFile = optarg;
+      break;
+    case 'n':
+      app.setPeepholeOpt(false);
+      break;
+    case 'c':
+      app.setCustomInt(true);
+      break;
+    default:
+      std::cout << "Usage: " << argv[0] << " [-j <num-jobs>] [-o <generated-perf-table-cpp-file>] [-n] [-c]" << std::endl;
+      return opt == 'h' ? 0 : 1;
+    }
+  }
   app.runTests();
+  if (!tableFile.empty() && !app.generatePerfTable(tableFile)) {
+    return 1;
+  }
   return 0;
 }
-
@@ -8,6 +8,8 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <tuple>
 
 //! @class  bitSerialMain
 //! @brief  Bit-serial performance tests main entry
@@ -18,13 +20,29 @@ public:
   ~bitSerialMain() {}
 
   void runTests(const std::vector<std::string>& deviceList = {}, const std::vector<std::string>& testList = {});
+  bool generatePerfTable(const std::string& fileName) const;
 
   const std::vector<std::string>& getDeviceList() const { return m_deviceList; }
   const std::vector<std::string>& getTestList() const { return m_testList; }
+  void setNumJobs(unsigned numJobs) { m_numJobs = (numJobs > 0 ? numJobs : 1); }
+  void setPeepholeOpt(bool usePeepholeOpt) { m_usePeepholeOpt = usePeepholeOpt; }
+  void setCustomInt(bool useCustomInt) { m_useCustomInt = useCustomInt; }
 
 private:
+  typedef std::vector<std::tuple<std::string, unsigned, unsigned, unsigned>> perfList; // list of (test, #R, #W, #L)
+
+  bool runTest(const std::string& device, const std::vector<std::string>& testList);
+  std::vector<std::string> getDeviceTestList(const std::string& device, const std::vector<std::string>& testList) const;
+  void runTestsParallel(const std::vector<std::string>& deviceList, const std::vector<std::string>& testList);
+
   std::vector<std::string> m_deviceList;
   std::vector<std::string> m_testList;
+  std::vector<std::string> m_customIntDeviceList; // devices that model custom bit-width integers
+  unsigned m_numJobs = 1;
+  bool m_usePeepholeOpt = true;
+  bool m_useCustomInt = false;
+  std::map<std::string, std::map<std::string, std::pair<int, int>>> m_stats; // device -> test -> numPassed/numTests
+  std::map<std::string, std::map<std::string, perfList>> m_perfTable; // device -> test -> perf of passed micro-programs
 };
 
 #endif
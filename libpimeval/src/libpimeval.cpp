@@ -6,13 +6,21 @@
 
 #include "libpimeval.h"
 #include "pimSim.h"
+#include "pimTrace.h"
 #include "pimUtils.h"
+#include <string>
 
 //! @brief  Create a PIM device
 PimStatus
 pimCreateDevice(PimDeviceEnum deviceType, unsigned numRanks, unsigned numBankPerRank, unsigned numSubarrayPerBank, unsigned numRows, unsigned numCols, unsigned bufferSize)
 {
   bool ok = pimSim::get()->createDevice(deviceType, numRanks, numBankPerRank, numSubarrayPerBank, numRows, numCols, bufferSize);
+  if (ok && pimTraceWriter::isOn()) {
+    // record derived simulation target and dimensions for replay
+    const pimSimConfig& config = pimSim::get()->getConfig();
+    pimTraceWriter::record(PimTraceApiEnum::CREATE_DEVICE, deviceType, config.getSimTarget(), config.getNumRanks(), config.getNumBankPerRank(),
+        config.getNumSubarrayPerBank(), config.getNumRowPerSubarray(), config.getNumColPerSubarray(), config.getBufferSize());
+  }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -21,6 +29,14 @@ PimStatus
 pimCreateDeviceFromConfig(PimDeviceEnum deviceType, const char* configFileName)
 {
   bool ok = pimSim::get()->createDeviceFromConfig(deviceType, configFileName);
+  if (ok && pimTraceWriter::isOn()) {
+    const pimSimConfig& config = pimSim::get()->getConfig();
+    std::string configFile = config.getSimConfigFile();
+    pimTraceWriter::record(PimTraceApiEnum::CREATE_DEVICE_FROM_CONFIG,
+        { static_cast<uint64_t>(deviceType), static_cast<uint64_t>(config.getSimTarget()), config.getNumRanks(), config.getNumBankPerRank(),
+          config.getNumSubarrayPerBank(), config.getNumRowPerSubarray(), config.getNumColPerSubarray(), config.getBufferSize() },
+        configFile.data(), configFile.size());
+  }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -37,13 +53,45 @@ PimStatus
 pimDeleteDevice()
 {
   bool ok = pimSim::get()->deleteDevice();
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::DELETE_DEVICE); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
+//! @brief  Create a new PIM context
+PimContext
+pimCreateContext()
+{
+  return pimSim::createContext();
+}
+
+//! @brief  Delete a PIM context and its device
+PimStatus
+pimDeleteContext(PimContext context)
+{
+  bool ok = pimSim::deleteContext(context);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Set the current PIM context of the calling thread
+PimStatus
+pimSetCurrentContext(PimContext context)
+{
+  bool ok = pimSim::setCurrentContext(context);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Get the current PIM context of the calling thread
+PimContext
+pimGetCurrentContext()
+{
+  return pimSim::get();
+}
+
 PimStatus
 pimPrefixSum(PimObjId src, PimObjId dest)
 {
   bool ok = pimSim::get()->pimPrefixSum(src, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::PREFIX_SUM, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -52,6 +100,16 @@ void
 pimStartTimer()
 {
   pimSim::get()->startKernelTimer();
+  pimTraceWriter::record(PimTraceApiEnum::START_TIMER);
+}
+
+//! @brief  Start timer for a named PIM kernel region, which is nested in the running kernel timer if any
+void
+pimStartTimer(const char* tag)
+{
+  std::string tagStr = (tag ? tag : "");
+  pimSim::get()->startKernelTimer(tagStr);
+  pimTraceWriter::record(PimTraceApiEnum::START_TIMER, {}, tagStr.data(), tagStr.size());
 }
 
 //! @brief  End timer for a PIM kernel to measure CPU runtime and DRAM refresh
@@ -59,6 +117,7 @@ void
 pimEndTimer()
 {
   pimSim::get()->endKernelTimer();
+  pimTraceWriter::record(PimTraceApiEnum::END_TIMER);
 }
 
 //! @brief  Show PIM command stats
@@ -66,6 +125,7 @@ void
 pimShowStats()
 {
   pimSim::get()->showStats();
+  pimTraceWriter::record(PimTraceApiEnum::SHOW_STATS);
 }
 
 //! @brief  Reset PIM command stats
@@ -73,6 +133,31 @@ void
 pimResetStats()
 {
   pimSim::get()->resetStats();
+  pimTraceWriter::record(PimTraceApiEnum::RESET_STATS);
+}
+
+//! @brief  Get number of row read, row write and logic micro ops since last stats reset
+PimStatus
+pimGetMicroOpStats(unsigned* numRead, unsigned* numWrite, unsigned* numLogic)
+{
+  bool ok = pimSim::get()->getMicroOpStats(numRead, numWrite, numLogic);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Get summary of estimated runtime and energy since last stats reset
+PimStatus
+pimGetStatsSummary(PimStatsSummary* summary)
+{
+  bool ok = pimSim::get()->getStatsSummary(summary);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Export stats since last stats reset to a JSON or CSV file
+PimStatus
+pimExportStats(const char* filePath, PimStatsFormatEnum format)
+{
+  bool ok = pimSim::get()->exportStats(filePath, format);
+  return ok ? PIM_OK : PIM_ERROR;
 }
 
 //! @brief  Is analysis mode. Call this after device creation
@@ -86,21 +171,45 @@ pimIsAnalysisMode()
 PimObjId
 pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataType)
 {
-  return pimSim::get()->pimAlloc(allocType, numElements, dataType);
+  PimObjId objId = pimSim::get()->pimAlloc(allocType, numElements, dataType);
+  if (objId != -1) { pimTraceWriter::record(PimTraceApiEnum::ALLOC, allocType, numElements, dataType, objId); }
+  return objId;
 }
 
 //! @brief  Allocate a PIM resource, with an associated object as reference
 PimObjId
 pimAllocAssociated(PimObjId assocId, PimDataType dataType)
 {
-  return pimSim::get()->pimAllocAssociated(assocId, dataType);
+  PimObjId objId = pimSim::get()->pimAllocAssociated(assocId, dataType);
+  if (objId != -1) { pimTraceWriter::record(PimTraceApiEnum::ALLOC_ASSOCIATED, assocId, dataType, objId); }
+  return objId;
 }
 
 //! @brief  Allocate a global buffer for broadcasting data to all PIM cores
 PimObjId
 pimAllocBuffer(uint32_t numElements, PimDataType dataType)
 {
-  return pimSim::get()->pimAllocBuffer(numElements, dataType);
+  PimObjId objId = pimSim::get()->pimAllocBuffer(numElements, dataType);
+  if (objId != -1) { pimTraceWriter::record(PimTraceApiEnum::ALLOC_BUFFER, numElements, dataType, objId); }
+  return objId;
+}
+
+//! @brief  Allocate a PIM resource of custom bit-width integers
+PimObjId
+pimAllocCustomInt(PimAllocEnum allocType, uint64_t numElements, unsigned numBits, bool isSigned)
+{
+  PimObjId objId = pimSim::get()->pimAllocCustomInt(allocType, numElements, numBits, isSigned);
+  if (objId != -1) { pimTraceWriter::record(PimTraceApiEnum::ALLOC_CUSTOM_INT, allocType, numElements, numBits, isSigned, objId); }
+  return objId;
+}
+
+//! @brief  Allocate a PIM resource of custom bit-width integers, with an associated object as reference
+PimObjId
+pimAllocAssociatedCustomInt(PimObjId assocId, unsigned numBits, bool isSigned)
+{
+  PimObjId objId = pimSim::get()->pimAllocAssociatedCustomInt(assocId, numBits, isSigned);
+  if (objId != -1) { pimTraceWriter::record(PimTraceApiEnum::ALLOC_ASSOCIATED_CUSTOM_INT, assocId, numBits, isSigned, objId); }
+  return objId;
 }
 
 //! @brief  Free a PIM resource
@@ -108,6 +217,7 @@ PimStatus
 pimFree(PimObjId obj)
 {
   bool ok = pimSim::get()->pimFree(obj);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::FREE, obj); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -115,14 +225,18 @@ pimFree(PimObjId obj)
 PimObjId
 pimCreateRangedRef(PimObjId refId, uint64_t idxBegin, uint64_t idxEnd)
 {
-  return pimSim::get()->pimCreateRangedRef(refId, idxBegin, idxEnd);
+  PimObjId objId = pimSim::get()->pimCreateRangedRef(refId, idxBegin, idxEnd);
+  if (objId != -1) { pimTraceWriter::record(PimTraceApiEnum::CREATE_RANGED_REF, refId, idxBegin, idxEnd, objId); }
+  return objId;
 }
 
 //! @brief  Create an obj referencing to negation of an existing obj based on dual-contact memory cells
 PimObjId
 pimCreateDualContactRef(PimObjId refId)
 {
-  return pimSim::get()->pimCreateDualContactRef(refId);
+  PimObjId objId = pimSim::get()->pimCreateDualContactRef(refId);
+  if (objId != -1) { pimTraceWriter::record(PimTraceApiEnum::CREATE_DUAL_CONTACT_REF, refId, objId); }
+  return objId;
 }
 
 //! @brief  Copy data from main memory to PIM device for a range of elements within the PIM object
@@ -130,6 +244,11 @@ PimStatus
 pimCopyHostToDevice(void* src, PimObjId dest, uint64_t idxBegin, uint64_t idxEnd)
 {
   bool ok = pimSim::get()->pimCopyMainToDevice(src, dest, idxBegin, idxEnd);
+  if (ok && pimTraceWriter::isOn()) {
+    uint64_t numBytes = pimSim::get()->getNumHostBytes(dest, idxBegin, idxEnd);
+    pimTraceWriter::record(PimTraceApiEnum::COPY_H2D, { static_cast<uint64_t>(dest), idxBegin, idxEnd, numBytes },
+        pimTraceWriter::isPayloadOn() ? src : nullptr, numBytes);
+  }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -138,6 +257,9 @@ PimStatus
 pimCopyDeviceToHost(PimObjId src, void* dest, uint64_t idxBegin, uint64_t idxEnd)
 {
   bool ok = pimSim::get()->pimCopyDeviceToMain(src, dest, idxBegin, idxEnd);
+  if (ok && pimTraceWriter::isOn()) {
+    pimTraceWriter::record(PimTraceApiEnum::COPY_D2H, src, idxBegin, idxEnd, pimSim::get()->getNumHostBytes(src, idxBegin, idxEnd));
+  }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -146,6 +268,11 @@ PimStatus
 pimCopyHostToDeviceWithType(PimCopyEnum copyType, void* src, PimObjId dest, uint64_t idxBegin, uint64_t idxEnd)
 {
   bool ok = pimSim::get()->pimCopyMainToDeviceWithType(copyType, src, dest, idxBegin, idxEnd);
+  if (ok && pimTraceWriter::isOn()) {
+    uint64_t numBytes = pimSim::get()->getNumHostBytes(dest, idxBegin, idxEnd);
+    pimTraceWriter::record(PimTraceApiEnum::COPY_H2D_WITH_TYPE, { static_cast<uint64_t>(copyType), static_cast<uint64_t>(dest), idxBegin, idxEnd, numBytes },
+        pimTraceWriter::isPayloadOn() ? src : nullptr, numBytes);
+  }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -154,6 +281,9 @@ PimStatus
 pimCopyDeviceToHostWithType(PimCopyEnum copyType, PimObjId src, void* dest, uint64_t idxBegin, uint64_t idxEnd)
 {
   bool ok = pimSim::get()->pimCopyDeviceToMainWithType(copyType, src, dest, idxBegin, idxEnd);
+  if (ok && pimTraceWriter::isOn()) {
+    pimTraceWriter::record(PimTraceApiEnum::COPY_D2H_WITH_TYPE, copyType, src, idxBegin, idxEnd, pimSim::get()->getNumHostBytes(src, idxBegin, idxEnd));
+  }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -162,12 +292,14 @@ PimStatus
 pimCopyDeviceToDevice(PimObjId src, PimObjId dest, uint64_t idxBegin, uint64_t idxEnd)
 {
   bool ok = pimSim::get()->pimCopyDeviceToDevice(src, dest, idxBegin, idxEnd);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::COPY_D2D, src, dest, idxBegin, idxEnd); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimCopyObjectToObject(PimObjId src, PimObjId dest)
 {
   bool ok = pimSim::get()->pimCopyObjectToObject(src, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::COPY_O2O, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -175,6 +307,7 @@ PimStatus pimCopyObjectToObject(PimObjId src, PimObjId dest)
 PimStatus pimConvertType(PimObjId src, PimObjId dest)
 {
   bool ok = pimSim::get()->pimConvertType(src, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::CONVERT_TYPE, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -183,6 +316,7 @@ PimStatus
 pimBroadcastInt(PimObjId dest, int64_t value)
 {
   bool ok = pimSim::get()->pimBroadcast(dest, value);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::BROADCAST_INT, dest, value); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -191,6 +325,7 @@ PimStatus
 pimBroadcastUInt(PimObjId dest, uint64_t value)
 {
   bool ok = pimSim::get()->pimBroadcast(dest, value);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::BROADCAST_UINT, dest, value); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -199,6 +334,7 @@ PimStatus
 pimBroadcastFP(PimObjId dest, float value)
 {
   bool ok = pimSim::get()->pimBroadcast(dest, value);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::BROADCAST_FP, dest, value); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -207,6 +343,7 @@ PimStatus
 pimAdd(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimAdd(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::ADD, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -215,6 +352,7 @@ PimStatus
 pimSub(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimSub(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::SUB, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -223,6 +361,7 @@ PimStatus
 pimDiv(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimDiv(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::DIV, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -231,6 +370,7 @@ PimStatus
 pimNot(PimObjId src, PimObjId dest)
 {
   bool ok = pimSim::get()->pimNot(src, dest);;
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::NOT, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -239,6 +379,7 @@ PimStatus
 pimOr(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimOr(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OR, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -247,6 +388,7 @@ PimStatus
 pimAnd(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimAnd(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::AND, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -255,6 +397,7 @@ PimStatus
 pimXor(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimXor(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::XOR, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -263,6 +406,7 @@ PimStatus
 pimXnor(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimXnor(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::XNOR, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -271,6 +415,7 @@ PimStatus
 pimAbs(PimObjId src, PimObjId dest)
 {
   bool ok = pimSim::get()->pimAbs(src, dest);;
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::ABS, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -279,6 +424,7 @@ PimStatus
 pimMul(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimMul(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::MUL, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -287,6 +433,7 @@ PimStatus
 pimGT(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimGT(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::GT, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -295,6 +442,7 @@ PimStatus
 pimLT(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimLT(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::LT, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -303,6 +451,7 @@ PimStatus
 pimEQ(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimEQ(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::EQ, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -311,6 +460,7 @@ PimStatus
 pimNE(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimNE(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::NE, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -319,6 +469,7 @@ PimStatus
 pimMin(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimMin(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::MIN, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -327,96 +478,112 @@ PimStatus
 pimMax(PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimMax(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::MAX, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimAddScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimAdd(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::ADD_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimSubScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimSub(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::SUB_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimMulScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimMul(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::MUL_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimDivScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimDiv(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::DIV_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimAndScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimAnd(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::AND_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimOrScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimOr(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OR_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimXorScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimXor(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::XOR_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimXnorScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimXnor(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::XNOR_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimGTScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimGT(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::GT_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimLTScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimLT(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::LT_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimEQScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimEQ(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::EQ_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimNEScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimNE(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::NE_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimMinScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimMin(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::MIN_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimMaxScalar(PimObjId src, PimObjId dest, uint64_t scalarValue)
 {
   bool ok = pimSim::get()->pimMax(src, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::MAX_SCALAR, src, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 PimStatus pimScaledAdd(PimObjId src1, PimObjId src2, PimObjId dest, uint64_t scalarValue) 
 {
   bool ok = pimSim::get()->pimScaledAdd(src1, src2, dest, scalarValue);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::SCALED_ADD, src1, src2, dest, scalarValue); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -425,6 +592,7 @@ PimStatus
 pimPopCount(PimObjId src, PimObjId dest)
 {
   bool ok = pimSim::get()->pimPopCount(src, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::POPCOUNT, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -433,6 +601,7 @@ PimStatus
 pimBitSliceExtract(PimObjId src, PimObjId destBool, unsigned bitIdx)
 {
   bool ok = pimSim::get()->pimBitSliceExtract(src, destBool, bitIdx);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::BIT_SLICE_EXTRACT, src, destBool, bitIdx); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -441,6 +610,7 @@ PimStatus
 pimBitSliceInsert(PimObjId srcBool, PimObjId dest, unsigned bitIdx)
 {
   bool ok = pimSim::get()->pimBitSliceInsert(srcBool, dest, bitIdx);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::BIT_SLICE_INSERT, srcBool, dest, bitIdx); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -449,6 +619,7 @@ PimStatus
 pimCondCopy(PimObjId condBool, PimObjId src, PimObjId dest)
 {
   bool ok = pimSim::get()->pimCondCopy(condBool, src, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::COND_COPY, condBool, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -457,6 +628,7 @@ PimStatus
 pimCondBroadcast(PimObjId condBool, uint64_t scalarBits, PimObjId dest)
 {
   bool ok = pimSim::get()->pimCondBroadcast(condBool, scalarBits, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::COND_BROADCAST, condBool, scalarBits, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -465,6 +637,7 @@ PimStatus
 pimCondSelect(PimObjId condBool, PimObjId src1, PimObjId src2, PimObjId dest)
 {
   bool ok = pimSim::get()->pimCondSelect(condBool, src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::COND_SELECT, condBool, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -473,6 +646,7 @@ PimStatus
 pimCondSelectScalar(PimObjId condBool, PimObjId src1, uint64_t scalarBits, PimObjId dest)
  {
   bool ok = pimSim::get()->pimCondSelectScalar(condBool, src1, scalarBits, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::COND_SELECT_SCALAR, condBool, src1, scalarBits, dest); }
   return ok ? PIM_OK : PIM_ERROR;
  }
 
@@ -481,6 +655,7 @@ PimStatus
 pimAesSbox(PimObjId src, PimObjId dest, const std::vector<uint8_t>& lut)
 {
   bool ok = pimSim::get()->pimAesSbox(src, dest, lut);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::AES_SBOX, { static_cast<uint64_t>(src), static_cast<uint64_t>(dest) }, lut.data(), lut.size()); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -489,18 +664,21 @@ PimStatus
 pimAesInverseSbox(PimObjId src, PimObjId dest, const std::vector<uint8_t>& lut)
 {
   bool ok = pimSim::get()->pimAesInverseSbox(src, dest, lut);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::AES_INVERSE_SBOX, { static_cast<uint64_t>(src), static_cast<uint64_t>(dest) }, lut.data(), lut.size()); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
 // Implementation of min reduction
 PimStatus pimRedMin(PimObjId src, void* min, uint64_t idxBegin, uint64_t idxEnd) {
     bool ok = pimSim::get()->pimRedMin(src, min, idxBegin, idxEnd);
+    if (ok) { pimTraceWriter::record(PimTraceApiEnum::REDMIN, src, idxBegin, idxEnd); }
     return ok ? PIM_OK : PIM_ERROR;
 }
 
 // Implementation of max reduction
 PimStatus pimRedMax(PimObjId src, void* max, uint64_t idxBegin, uint64_t idxEnd) {
     bool ok = pimSim::get()->pimRedMax(src, max, idxBegin, idxEnd);
+    if (ok) { pimTraceWriter::record(PimTraceApiEnum::REDMAX, src, idxBegin, idxEnd); }
     return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -508,6 +686,7 @@ PimStatus pimRedMax(PimObjId src, void* max, uint64_t idxBegin, uint64_t idxEnd)
 PimStatus pimMAC(PimObjId src1, PimObjId src2, void *dest)
 {
   bool ok = pimSim::get()->pimMAC(src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::MAC, src1, src2); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -516,6 +695,7 @@ PimStatus
 pimRedSum(PimObjId src, void* sum, uint64_t idxBegin, uint64_t idxEnd)
 {
   bool ok = pimSim::get()->pimRedSum(src, sum, idxBegin, idxEnd);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::REDSUM, src, idxBegin, idxEnd); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -524,6 +704,7 @@ PimStatus
 pimRotateElementsRight(PimObjId src)
 {
   bool ok = pimSim::get()->pimRotateElementsRight(src);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::ROTATE_ELEM_R, src); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -532,6 +713,7 @@ PimStatus
 pimRotateElementsLeft(PimObjId src)
 {
   bool ok = pimSim::get()->pimRotateElementsLeft(src);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::ROTATE_ELEM_L, src); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -540,6 +722,7 @@ PimStatus
 pimShiftElementsRight(PimObjId src)
 {
   bool ok = pimSim::get()->pimShiftElementsRight(src);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::SHIFT_ELEM_R, src); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -548,6 +731,7 @@ PimStatus
 pimShiftElementsLeft(PimObjId src)
 {
   bool ok = pimSim::get()->pimShiftElementsLeft(src);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::SHIFT_ELEM_L, src); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -556,6 +740,7 @@ PimStatus
 pimShiftBitsRight(PimObjId src, PimObjId dest, unsigned shiftAmount)
 {
   bool ok = pimSim::get()->pimShiftBitsRight(src, dest, shiftAmount);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::SHIFT_BITS_R, src, dest, shiftAmount); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -564,6 +749,7 @@ PimStatus
 pimShiftBitsLeft(PimObjId src, PimObjId dest, unsigned shiftAmount)
 {
   bool ok = pimSim::get()->pimShiftBitsLeft(src, dest, shiftAmount);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::SHIFT_BITS_L, src, dest, shiftAmount); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -575,11 +761,137 @@ pimFuse(PimProg prog)
   return ok ? PIM_OK : PIM_ERROR;
 }
 
+//! @brief  Create a PIM stream for async API calls
+PimStreamId
+pimCreateStream()
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  return streamMgr ? streamMgr->createStream() : -1;
+}
+
+//! @brief  Delete a PIM stream after its pending API calls are done
+PimStatus
+pimDeleteStream(PimStreamId stream)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->deleteStream(stream);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Wait for all API calls issued to a PIM stream
+PimStatus
+pimStreamSynchronize(PimStreamId stream)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->synchronizeStream(stream);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Wait for all PIM streams
+PimStatus
+pimDeviceSynchronize()
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->synchronizeAll();
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Create a PIM event
+PimEventId
+pimCreateEvent()
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  return streamMgr ? streamMgr->createEvent() : -1;
+}
+
+//! @brief  Delete a PIM event
+PimStatus
+pimDeleteEvent(PimEventId event)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->deleteEvent(event);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Record a PIM event at the current position of a PIM stream
+PimStatus
+pimRecordEvent(PimEventId event, PimStreamId stream)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->recordEvent(event, stream);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Wait for a PIM event
+PimStatus
+pimEventSynchronize(PimEventId event)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->synchronizeEvent(event);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Let later API calls of a PIM stream wait for a PIM event
+PimStatus
+pimStreamWaitEvent(PimStreamId stream, PimEventId event)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->streamWaitEvent(stream, event);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Get modeled runtime between two completed PIM events
+PimStatus
+pimGetEventElapsedTime(PimEventId start, PimEventId end, double* msRuntime)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->getEventElapsedTime(start, end, msRuntime);
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Copy data from main memory to PIM device asynchronously on a PIM stream
+PimStatus
+pimCopyHostToDeviceAsync(void* src, PimObjId dest, PimStreamId stream, uint64_t idxBegin, uint64_t idxEnd)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->enqueue(stream, pimStreamMgr::taskEnum::COPY,
+      [=]() { return pimCopyHostToDevice(src, dest, idxBegin, idxEnd) == PIM_OK; });
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Copy data from PIM device to main memory asynchronously on a PIM stream
+PimStatus
+pimCopyDeviceToHostAsync(PimObjId src, void* dest, PimStreamId stream, uint64_t idxBegin, uint64_t idxEnd)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->enqueue(stream, pimStreamMgr::taskEnum::COPY,
+      [=]() { return pimCopyDeviceToHost(src, dest, idxBegin, idxEnd) == PIM_OK; });
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Run the APIs of a PIM program in order asynchronously on a PIM stream
+PimStatus
+pimLaunchAsync(PimProg prog, PimStreamId stream)
+{
+  pimStreamMgr* streamMgr = pimSim::get()->getStreamMgr();
+  bool ok = streamMgr && streamMgr->enqueue(stream, pimStreamMgr::taskEnum::COMPUTE,
+      [prog]() {
+        for (const auto& api : prog.m_apis) {
+          if (api() != PIM_OK) {
+            return false;
+          }
+        }
+        return true;
+      });
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
 //! @brief  BitSIMD-V: Read a row to SA
 PimStatus
 pimOpReadRowToSa(PimObjId src, unsigned ofst)
 {
   bool ok = pimSim::get()->pimOpReadRowToSa(src, ofst);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_READ_ROW_TO_SA, src, ofst); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -588,6 +900,7 @@ PimStatus
 pimOpWriteSaToRow(PimObjId src, unsigned ofst)
 {
   bool ok = pimSim::get()->pimOpWriteSaToRow(src, ofst);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_WRITE_SA_TO_ROW, src, ofst); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -596,6 +909,7 @@ PimStatus
 pimOpTRA(PimObjId src1, unsigned ofst1, PimObjId src2, unsigned ofst2, PimObjId src3, unsigned ofst3)
 {
   bool ok = pimSim::get()->pimOpTRA(src1, ofst1, src2, ofst2, src3, ofst3);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_TRA, src1, ofst1, src2, ofst2, src3, ofst3); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -604,6 +918,7 @@ PimStatus
 pimOpMove(PimObjId objId, PimRowReg src, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpMove(objId, src, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_MOVE, objId, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -612,6 +927,7 @@ PimStatus
 pimOpSet(PimObjId objId, PimRowReg src, bool val)
 {
   bool ok = pimSim::get()->pimOpSet(objId, src, val);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_SET, objId, src, val); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -620,6 +936,7 @@ PimStatus
 pimOpNot(PimObjId objId, PimRowReg src, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpNot(objId, src, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_NOT, objId, src, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -628,6 +945,7 @@ PimStatus
 pimOpAnd(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpAnd(objId, src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_AND, objId, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -636,6 +954,7 @@ PimStatus
 pimOpOr(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpOr(objId, src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_OR, objId, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -644,6 +963,7 @@ PimStatus
 pimOpNand(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpNand(objId, src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_NAND, objId, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -652,6 +972,7 @@ PimStatus
 pimOpNor(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpNor(objId, src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_NOR, objId, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -660,6 +981,7 @@ PimStatus
 pimOpXor(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpXor(objId, src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_XOR, objId, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -668,6 +990,7 @@ PimStatus
 pimOpXnor(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpXnor(objId, src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_XNOR, objId, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -676,6 +999,7 @@ PimStatus
 pimOpMaj(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg src3, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpMaj(objId, src1, src2, src3, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_MAJ, objId, src1, src2, src3, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -684,6 +1008,7 @@ PimStatus
 pimOpSel(PimObjId objId, PimRowReg cond, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   bool ok = pimSim::get()->pimOpSel(objId, cond, src1, src2, dest);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_SEL, objId, cond, src1, src2, dest); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -692,6 +1017,7 @@ PimStatus
 pimOpRotateRH(PimObjId objId, PimRowReg src)
 {
   bool ok = pimSim::get()->pimOpRotateRH(objId, src);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_ROTATE_RH, objId, src); }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -700,6 +1026,74 @@ PimStatus
 pimOpRotateLH(PimObjId objId, PimRowReg src)
 {
   bool ok = pimSim::get()->pimOpRotateLH(objId, src);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::OP_ROTATE_LH, objId, src); }
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  BitSIMD-V: Execute a batch of micro ops
+PimStatus
+pimOpBatch(const PimMicroOp* ops, unsigned numOps)
+{
+  bool ok = pimSim::get()->pimOpBatch(ops, numOps);
+  if (ok && pimTraceWriter::isOn()) {
+    std::vector<uint64_t> args;
+    for (unsigned i = 0; i < numOps; ++i) {
+      const PimMicroOp& op = ops[i];
+      args.insert(args.end(), { static_cast<uint64_t>(op.opType), static_cast<uint64_t>(op.objId), op.ofst, static_cast<uint64_t>(op.dest),
+                                static_cast<uint64_t>(op.src1), static_cast<uint64_t>(op.src2), static_cast<uint64_t>(op.src3), op.val });
+    }
+    pimTraceWriter::record(PimTraceApiEnum::OP_BATCH, args);
+  }
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  BitSIMD-V: Start recording micro ops into a micro-kernel with a list of parameter objects
+PimStatus
+pimBeginMicroKernel(const std::vector<PimObjId>& params)
+{
+  bool ok = pimSim::get()->pimBeginMicroKernel(params);
+  if (ok && pimTraceWriter::isOn()) {
+    pimTraceWriter::record(PimTraceApiEnum::BEGIN_MICRO_KERNEL, std::vector<uint64_t>(params.begin(), params.end()));
+  }
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  BitSIMD-V: End recording. Return micro-kernel ID, or -1 on error
+PimMicroKernelId
+pimEndMicroKernel(PimMicroKernelOptEnum opt)
+{
+  PimMicroKernelId kernelId = pimSim::get()->pimEndMicroKernel(opt);
+  if (kernelId != -1) { pimTraceWriter::record(PimTraceApiEnum::END_MICRO_KERNEL, opt, kernelId); }
+  return kernelId;
+}
+
+//! @brief  BitSIMD-V: Replay a micro-kernel on a list of objects
+PimStatus
+pimRunMicroKernel(PimMicroKernelId kernelId, const std::vector<PimObjId>& objIds, unsigned ofstShift)
+{
+  bool ok = pimSim::get()->pimRunMicroKernel(kernelId, objIds, ofstShift);
+  if (ok && pimTraceWriter::isOn()) {
+    std::vector<uint64_t> args = { static_cast<uint64_t>(kernelId), ofstShift };
+    args.insert(args.end(), objIds.begin(), objIds.end());
+    pimTraceWriter::record(PimTraceApiEnum::RUN_MICRO_KERNEL, args);
+  }
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  BitSIMD-V: Delete a micro-kernel
+PimStatus
+pimDeleteMicroKernel(PimMicroKernelId kernelId)
+{
+  bool ok = pimSim::get()->pimDeleteMicroKernel(kernelId);
+  if (ok) { pimTraceWriter::record(PimTraceApiEnum::DELETE_MICRO_KERNEL, kernelId); }
+  return ok ? PIM_OK : PIM_ERROR;
+}
+
+//! @brief  Get micro op counts of a micro-kernel, as recorded and after optimization
+PimStatus
+pimGetMicroKernelStats(PimMicroKernelId kernelId, PimMicroKernelStats* stats)
+{
+  bool ok = pimSim::get()->pimGetMicroKernelStats(kernelId, stats);
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -709,8 +1103,22 @@ pimOpAP(int numSrc, ...)
 {
   va_list args;
   va_start(args, numSrc);
-  bool ok = pimSim::get()->pimOpAP(numSrc, args);
+  std::vector<std::pair<PimObjId, unsigned>> srcRows;
+  for (int i = 0; i < numSrc; ++i) {
+    PimObjId objId = va_arg(args, PimObjId);
+    unsigned ofst = va_arg(args, unsigned);
+    srcRows.emplace_back(objId, ofst);
+  }
   va_end(args);
+
+  bool ok = pimSim::get()->pimOpAP(srcRows);
+  if (ok && pimTraceWriter::isOn()) {
+    std::vector<uint64_t> traceArgs = { static_cast<uint64_t>(numSrc) };
+    for (const auto& [objId, ofst] : srcRows) {
+      traceArgs.insert(traceArgs.end(), { static_cast<uint64_t>(objId), ofst });
+    }
+    pimTraceWriter::record(PimTraceApiEnum::OP_AP, traceArgs);
+  }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
@@ -720,8 +1128,44 @@ pimOpAAP(int numSrc, int numDest, ...)
 {
   va_list args;
   va_start(args, numDest);
-  bool ok = pimSim::get()->pimOpAAP(numSrc, numDest, args);
+  std::vector<std::pair<PimObjId, unsigned>> srcRows;
+  for (int i = 0; i < numSrc; ++i) {
+    PimObjId objId = va_arg(args, PimObjId);
+    unsigned ofst = va_arg(args, unsigned);
+    srcRows.emplace_back(objId, ofst);
+  }
+  std::vector<std::pair<PimObjId, unsigned>> destRows;
+  for (int i = 0; i < numDest; ++i) {
+    PimObjId objId = va_arg(args, PimObjId);
+    unsigned ofst = va_arg(args, unsigned);
+    destRows.emplace_back(objId, ofst);
+  }
   va_end(args);
+
+  bool ok = pimSim::get()->pimOpAAP(srcRows, destRows);
+  if (ok && pimTraceWriter::isOn()) {
+    std::vector<uint64_t> traceArgs = { static_cast<uint64_t>(numSrc), static_cast<uint64_t>(numDest) };
+    for (const auto& [objId, ofst] : srcRows) {
+      traceArgs.insert(traceArgs.end(), { static_cast<uint64_t>(objId), ofst });
+    }
+    for (const auto& [objId, ofst] : destRows) {
+      traceArgs.insert(traceArgs.end(), { static_cast<uint64_t>(objId), ofst });
+    }
+    pimTraceWriter::record(PimTraceApiEnum::OP_AAP, traceArgs);
+  }
   return ok ? PIM_OK : PIM_ERROR;
 }
 
+
+
+//! @brief  Replay a PIM API trace recorded with PIMEVAL_TRACE_OUT
+PimStatus
+pimReplayTrace(const char* traceFileName, PimDeviceEnum deviceType, const char* configFileName, bool keepDevice)
+{
+  if (!traceFileName) {
+    return PIM_ERROR;
+  }
+  pimTraceReplayer replayer(deviceType, configFileName ? configFileName : "", keepDevice);
+  bool ok = replayer.replay(traceFileName);
+  return ok ? PIM_OK : PIM_ERROR;
+}
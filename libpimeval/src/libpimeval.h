@@ -74,6 +74,12 @@ enum PimCopyEnum {
   PIM_COPY_H,
 };
 
+//! @brief  PIM stats export formats
+enum PimStatsFormatEnum {
+  PIM_STATS_JSON = 0,
+  PIM_STATS_CSV,
+};
+
 //! @brief  PIM datatypes
 enum PimDataType {
   PIM_BOOL = 0,
@@ -106,14 +112,53 @@ struct PimDeviceProperties {
 
 typedef int PimCoreId;
 typedef int PimObjId;
+typedef int PimStreamId;
+typedef int PimEventId;
+
+//! @brief  Handle of a PIM context, i.e., an independent simulator instance with its own device, config and stats
+class pimSim;
+typedef pimSim* PimContext;
 
 // PIMeval simulation
 // CPU runtime between start/end timer will be measured for modeling DRAM refresh
 void pimStartTimer();
+// Start a named kernel timer region, which can be nested, e.g., per layer or per round. pimEndTimer ends the innermost one.
+// Runtime, energy and command mix of named regions are accumulated per tag path and shown as a tree in stats
+void pimStartTimer(const char* tag);
 void pimEndTimer();
 void pimShowStats();
 void pimResetStats();
 bool pimIsAnalysisMode();
+// Number of row read, row write and logic micro ops since last stats reset, e.g., for generating bit-serial perf tables
+PimStatus pimGetMicroOpStats(unsigned* numRead, unsigned* numWrite, unsigned* numLogic);
+
+//! @brief  Summary of estimated PIM runtime and energy since last stats reset
+struct PimStatsSummary {
+  uint64_t numBytesCopied = 0;  // host-to-device and device-to-host
+  double copyMsRuntime = 0.0;
+  double copyMjEnergy = 0.0;
+  uint64_t numCmds = 0;
+  double cmdMsRuntime = 0.0;
+  double cmdMjEnergy = 0.0;
+  double cmdMsMakespan = 0.0;  // commands on disjoint cores overlapped on modeled cores
+  double criticalPathMsRuntime = 0.0;  // copies and commands overlapped on modeled channel and cores
+  double refreshMsRuntime = 0.0;  // refresh stalls of PIM commands, not included in cmdMsRuntime
+  double refreshMjEnergy = 0.0;  // refresh energy of PIM commands, not included in cmdMjEnergy
+};
+PimStatus pimGetStatsSummary(PimStatsSummary* summary);
+// Export stats since last stats reset to a file, e.g., for joining results of a parameter sweep
+// - Device params, API timing, data copy, per-command runtime, energy, R/W/compute splits and op counts,
+//   summary, kernel timer and named kernel timer region results
+// - With extra simulation targets, runtime and energy of each target, the primary device being target 0
+// - JSON: an object per section. CSV: one row per stat as section,name,metric,value
+// - With env var PIMEVAL_STATS_OUT=<file>, stats are exported at device deletion, as CSV if the file ends with .csv
+PimStatus pimExportStats(const char* filePath, PimStatsFormatEnum format = PIM_STATS_JSON);
+// Replay a PIM API trace recorded with env var PIMEVAL_TRACE_OUT=<trace-file>
+// - Without overrides, devices are created with the recorded simulation target and dimensions
+// - deviceType overrides the simulation target, and configFileName overrides the recorded device config
+// - Host data is replayed only if recorded with PIMEVAL_TRACE_PAYLOAD=1. Use PIMEVAL_ANALYSIS_MODE=1 otherwise
+// - If keepDevice is true, device deletion is skipped so that stats can be queried after replay
+PimStatus pimReplayTrace(const char* traceFileName, PimDeviceEnum deviceType = PIM_DEVICE_NONE, const char* configFileName = nullptr, bool keepDevice = false);
 
 // Device creation and deletion
 /**
@@ -133,6 +178,22 @@ PimStatus pimCreateDeviceFromConfig(PimDeviceEnum deviceType, const char* config
 PimStatus pimGetDeviceProperties(PimDeviceProperties* deviceProperties);
 PimStatus pimDeleteDevice();
 
+// PIM contexts
+// All other APIs operate on the current context of the calling thread, which is the default context unless changed.
+// Use one context per host thread to run independent simulations concurrently. See below for sharing a context among threads.
+PimContext pimCreateContext();
+PimStatus pimDeleteContext(PimContext context);
+PimStatus pimSetCurrentContext(PimContext context);  // nullptr for the default context
+PimContext pimGetCurrentContext();
+
+// Thread safety and ordering
+// - Host threads can call APIs concurrently on the same context if the calls access disjoint PIM objects.
+//   The host orders calls on the same object, e.g., by joining threads. No ordering is implied across threads.
+// - Object allocation and deletion are serialized within a context. Other API calls run concurrently.
+// - Stats include all threads, and are accumulated as API calls complete. An API trace records calls in completion order.
+// - Device creation and deletion, stats reset and kernel timers must not race with other API calls on the same context.
+// - BitSIMD-V and SIMDRAM micro ops and micro-kernels use per-core row registers and must be issued by one thread at a time.
+
 // Resource allocation and deletion
 PimObjId pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataType);
 PimObjId pimAllocAssociated(PimObjId assocId, PimDataType dataType);
@@ -141,6 +202,12 @@ PimObjId pimAllocAssociated(PimObjId assocId, PimDataType dataType);
 // Please note that each chip/device will hold the same data in their respective buffers.
 // TODO: Support per-core buffers (like UPMEM)
 PimObjId pimAllocBuffer(uint32_t numElements, PimDataType dataType);
+// Custom bit-width integers for bit-serial PIM devices, with 1 to 64 bits per element.
+// Values wrap around at numBits bits. On host side, each element is stored in the narrowest
+// standard integer type that holds numBits bits, e.g., int8_t for a signed 5-bit integer.
+// Bit-serial performance and energy are scaled with the actual number of bits.
+PimObjId pimAllocCustomInt(PimAllocEnum allocType, uint64_t numElements, unsigned numBits, bool isSigned);
+PimObjId pimAllocAssociatedCustomInt(PimObjId assocId, unsigned numBits, bool isSigned);
 PimStatus pimFree(PimObjId obj);
 
 // Data transfer
@@ -252,6 +319,31 @@ struct PimProg {
 };
 PimStatus pimFuse(PimProg prog);
 
+////////////////////////////////////////////////////////////////////////////////
+// Asynchronous Execution: PIM Streams and Events                             //
+////////////////////////////////////////////////////////////////////////////////
+// - A stream runs its async API calls in issue order on a background thread, so that host code overlaps simulation
+// - Different streams run concurrently under the thread safety rules above. Use events to order streams
+// - Host buffers of async copies must stay valid and unchanged until the stream is synchronized
+// - An async API call that fails is reported by the next synchronization of its stream
+// - Async API calls are recorded in stats and API traces as regular API calls when they run
+// - Stats show the serialized and the overlapped runtime of async API calls. Host-device copies are modeled on a
+//   shared memory channel and computation on the PIM device, so that copies and computation of different streams overlap
+PimStreamId pimCreateStream();
+PimStatus pimDeleteStream(PimStreamId stream);  // wait for pending API calls of the stream
+PimStatus pimStreamSynchronize(PimStreamId stream);
+PimStatus pimDeviceSynchronize();  // synchronize all streams
+PimEventId pimCreateEvent();
+PimStatus pimDeleteEvent(PimEventId event);
+PimStatus pimRecordEvent(PimEventId event, PimStreamId stream);
+PimStatus pimEventSynchronize(PimEventId event);
+PimStatus pimStreamWaitEvent(PimStreamId stream, PimEventId event);  // later API calls of the stream wait for the event
+PimStatus pimGetEventElapsedTime(PimEventId start, PimEventId end, double* msRuntime);  // modeled runtime between two events
+PimStatus pimCopyHostToDeviceAsync(void* src, PimObjId dest, PimStreamId stream, uint64_t idxBegin = 0, uint64_t idxEnd = 0);
+PimStatus pimCopyDeviceToHostAsync(PimObjId src, void* dest, PimStreamId stream, uint64_t idxBegin = 0, uint64_t idxEnd = 0);
+// Run the APIs of a PIM program in order on a stream, e.g., prog.add(pimAdd, src1, src2, dest)
+PimStatus pimLaunchAsync(PimProg prog, PimStreamId stream);
+
 ////////////////////////////////////////////////////////////////////////////////
 // Warning: Avoid using below customized APIs for functional simulation       //
 //          Some are PIM architecture dependent, some are in progress         //
@@ -317,6 +409,76 @@ PimStatus pimOpSel(PimObjId objId, PimRowReg cond, PimRowReg src1, PimRowReg src
 PimStatus pimOpRotateRH(PimObjId objId, PimRowReg src);
 PimStatus pimOpRotateLH(PimObjId objId, PimRowReg src);
 
+//! @brief  BitSIMD-V micro op types for batched submission
+enum PimMicroOpEnum {
+  PIM_MICRO_OP_READ_ROW_TO_SA = 0,  // SA = row ofst of objId
+  PIM_MICRO_OP_WRITE_SA_TO_ROW,     // row ofst of objId = SA
+  PIM_MICRO_OP_MOV,                 // dest = src1
+  PIM_MICRO_OP_SET,                 // dest = val
+  PIM_MICRO_OP_NOT,                 // dest = ~src1
+  PIM_MICRO_OP_AND,                 // dest = src1 & src2
+  PIM_MICRO_OP_OR,                  // dest = src1 | src2
+  PIM_MICRO_OP_NAND,                // dest = ~(src1 & src2)
+  PIM_MICRO_OP_NOR,                 // dest = ~(src1 | src2)
+  PIM_MICRO_OP_XOR,                 // dest = src1 ^ src2
+  PIM_MICRO_OP_XNOR,                // dest = ~(src1 ^ src2)
+  PIM_MICRO_OP_MAJ,                 // dest = MAJ(src1, src2, src3)
+  PIM_MICRO_OP_SEL,                 // dest = src1 ? src2 : src3
+  PIM_MICRO_OP_ROTATE_R,            // rotate dest right by one element across objId
+  PIM_MICRO_OP_ROTATE_L,            // rotate dest left by one element across objId
+};
+
+//! @brief  A BitSIMD-V micro op for batched submission
+struct PimMicroOp {
+  PimMicroOpEnum opType = PIM_MICRO_OP_MOV;
+  PimObjId objId = -1;
+  unsigned ofst = 0;
+  PimRowReg dest = PIM_RREG_NONE;
+  PimRowReg src1 = PIM_RREG_NONE;
+  PimRowReg src2 = PIM_RREG_NONE;
+  PimRowReg src3 = PIM_RREG_NONE;
+  bool val = false;
+};
+
+// Batched BitSIMD-V micro ops
+//   - Execute an array of micro ops in order with one API call, same as calling the pimOp* APIs one by one
+//   - Micro op counts are aggregated into the same stats as individual pimOp* APIs
+//   - If all objects are associated and there is no rotation, cores run the batch in parallel
+PimStatus pimOpBatch(const PimMicroOp* ops, unsigned numOps);
+
+typedef int PimMicroKernelId;
+
+//! @brief  Micro-kernel optimization levels
+enum PimMicroKernelOptEnum {
+  PIM_MICRO_KERNEL_OPT_NONE = 0,         // replay micro ops as recorded
+  PIM_MICRO_KERNEL_OPT_PEEPHOLE,         // remove redundant micro ops. Row regs keep their values after a run
+  PIM_MICRO_KERNEL_OPT_PEEPHOLE_SCRATCH, // same as above, and row regs are scratch, i.e., not used after a run
+};
+
+//! @brief  Micro op counts of a micro-kernel, as recorded and after optimization
+struct PimMicroKernelStats {
+  unsigned numRecordedRead = 0;
+  unsigned numRecordedWrite = 0;
+  unsigned numRecordedLogic = 0;
+  unsigned numRead = 0;
+  unsigned numWrite = 0;
+  unsigned numLogic = 0;
+};
+
+// BitSIMD-V micro-kernel recording and replay
+//   - Between pimBeginMicroKernel and pimEndMicroKernel, BitSIMD-V micro ops are recorded instead of executed
+//   - Recorded micro ops can only access the parameter objects. Other PIM APIs are executed as usual
+//   - Objects allocated by pimAllocAssociated during recording are kernel-local, allocated and freed by each run
+//   - Peephole optimization removes redundant row reads and writes, coalesces move chains, and reuses row regs.
+//     It requires distinct and associated objects
+//   - pimRunMicroKernel binds objects to parameters in the same order, and adds ofstShift to all row offsets
+//   - Replay is validated once per run, and all micro ops run with pre-resolved row indices
+PimStatus pimBeginMicroKernel(const std::vector<PimObjId>& params);
+PimMicroKernelId pimEndMicroKernel(PimMicroKernelOptEnum opt = PIM_MICRO_KERNEL_OPT_NONE);
+PimStatus pimRunMicroKernel(PimMicroKernelId kernelId, const std::vector<PimObjId>& objIds, unsigned ofstShift = 0);
+PimStatus pimDeleteMicroKernel(PimMicroKernelId kernelId);
+PimStatus pimGetMicroKernelStats(PimMicroKernelId kernelId, PimMicroKernelStats* stats);
+
 // SIMDRAM micro ops
 // AP:
 //   - Functionality: {srcRows} = MAJ(srcRows)
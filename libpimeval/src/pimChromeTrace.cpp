@@ -0,0 +1,241 @@
+// File: pimChromeTrace.cpp
+// PIMeval Simulator - Chrome Trace of Modeled and Simulator Execution
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "pimChromeTrace.h"
+#include "pimSim.h"
+#include "pimCmd.h"
+#include "pimResMgr.h"
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+
+//! @brief  Open a Chrome trace file. Keep the current trace file open if it is the same file
+bool
+pimChromeTrace::open(const std::string& fileName, PimContext context)
+{
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+  if (s_file && s_fileName == fileName && s_context == context) {
+    return true;
+  }
+  if (s_file && s_context != context) {
+    std::printf("PIM-Warning: Chrome trace %s is being recorded by another PIM context\n", s_fileName.c_str());
+    return false;
+  }
+  close();
+  s_file = std::fopen(fileName.c_str(), "wb");
+  if (!s_file) {
+    std::printf("PIM-Error: Cannot open Chrome trace file %s for writing\n", fileName.c_str());
+    return false;
+  }
+  s_fileName = fileName;
+  s_context = context;
+  s_hasEvents = false;
+  s_isClosed = false;
+  s_devicePid = 0;
+  s_threadTids.clear();
+  s_startTime = std::chrono::high_resolution_clock::now();
+  std::fputs("[", s_file);
+  writeMetadata("process_name", s_simPid, 0, "PIMeval Simulator");
+  std::printf("PIM-Info: Recording Chrome trace to %s\n", fileName.c_str());
+  return true;
+}
+
+//! @brief  Close the Chrome trace file
+void
+pimChromeTrace::close()
+{
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+  if (s_file) {
+    flush();
+    std::fclose(s_file);
+    s_file = nullptr;
+  }
+  s_context = nullptr;
+  s_fileName.clear();
+}
+
+//! @brief  Close the event array so that the trace file is valid JSON. The next event reopens it
+void
+pimChromeTrace::flush()
+{
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+  if (s_file && !s_isClosed) {
+    std::fputs("\n]\n", s_file);
+    std::fflush(s_file);
+    s_isClosed = true;
+  }
+}
+
+//! @brief  Check if the current PIM context is being recorded
+bool
+pimChromeTrace::isOn()
+{
+  return s_file != nullptr && s_context == pimSim::get();
+}
+
+//! @brief  Start a process of modeled execution for a new PIM device
+void
+pimChromeTrace::beginDevice(const std::string& deviceName, unsigned numRanks, unsigned numCoresPerRank)
+{
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+  if (!s_file) {
+    return;
+  }
+  ++s_devicePid;
+  s_numCoresPerRank = std::max(1u, numCoresPerRank);
+  s_nextTid = s_channelTid + 1;
+  s_rankTracks.assign(std::max(1u, numRanks), std::vector<track>());
+  writeMetadata("process_name", s_devicePid, 0, "Modeled PIM Device " + std::to_string(s_devicePid) + " (" + deviceName + ")");
+  writeMetadata("thread_name", s_devicePid, s_channelTid, "Host Channel");
+  writeMetadata("thread_sort_index", s_devicePid, s_channelTid, "0");
+}
+
+//! @brief  Record a PIM command or data copy at its start time on the modeled timeline
+void
+pimChromeTrace::recordModeled(const pimCmd& cmd, const pimResMgr& resMgr, double msStart, double msRuntime)
+{
+  std::vector<PimObjId> srcObjIds;
+  std::vector<PimObjId> destObjIds;
+  cmd.getObjIds(srcObjIds, destObjIds);
+  std::vector<const pimObjInfo*> objs;
+  destObjIds.insert(destObjIds.end(), srcObjIds.begin(), srcObjIds.end());
+  for (PimObjId objId : destObjIds) {
+    if (resMgr.isValidObjId(objId) && std::find_if(objs.begin(), objs.end(),
+        [objId](const pimObjInfo* obj) { return obj->getObjId() == objId; }) == objs.end()) {
+      objs.push_back(&resMgr.getObjInfo(objId));
+    }
+  }
+
+  // the first destination object, or the first source object if none, determines the shape of a command
+  std::string name = cmd.getName();
+  std::string args;
+  if (!objs.empty()) {
+    const pimObjInfo& obj = *objs.front();
+    name = cmd.getName(obj);
+    std::string objIds;
+    for (const pimObjInfo* item : objs) {
+      objIds += (objIds.empty() ? "" : ",") + std::to_string(item->getObjId());
+    }
+    args = "\"objIds\":[" + objIds + "],\"numElements\":" + std::to_string(obj.getNumElements())
+         + ",\"numRegions\":" + std::to_string(obj.getRegions().size())
+         + ",\"numPass\":" + std::to_string(obj.getMaxNumRegionsPerCore())
+         + ",\"numCores\":" + std::to_string(obj.getNumCoresUsed());
+  }
+
+  uint64_t nsStart = static_cast<uint64_t>(std::llround(msStart * 1e6));
+  uint64_t nsEnd = static_cast<uint64_t>(std::llround((msStart + msRuntime) * 1e6));
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+  if (!s_file || s_devicePid == 0) {
+    return;
+  }
+  if (cmd.getCmdType() == PimCmdEnum::COPY_H2D || cmd.getCmdType() == PimCmdEnum::COPY_D2H) {
+    writeSlice(name, "copy", s_devicePid, s_channelTid, nsStart, nsEnd, args);
+    return;
+  }
+  // items without PIM objects wait for all previous items, and are shown on all ranks
+  std::set<unsigned> ranks;
+  for (const pimObjInfo* obj : objs) {
+    for (const pimRegion& region : obj->getRegions()) {
+      ranks.insert(std::min<unsigned>(region.getCoreId() / s_numCoresPerRank, s_rankTracks.size() - 1));
+    }
+  }
+  if (objs.empty()) {
+    for (unsigned rank = 0; rank < s_rankTracks.size(); ++rank) {
+      ranks.insert(rank);
+    }
+  }
+  for (unsigned rank : ranks) {
+    writeSlice(name, "cmd", s_devicePid, getRankTid(rank, nsStart, nsEnd), nsStart, nsEnd, args);
+  }
+}
+
+//! @brief  Record a PIM API scope of the calling thread in wall-clock time
+void
+pimChromeTrace::recordApi(const std::string& tag, std::chrono::high_resolution_clock::time_point startTime,
+                          std::chrono::high_resolution_clock::time_point endTime)
+{
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+  if (!s_file) {
+    return;
+  }
+  auto toNs = [](std::chrono::high_resolution_clock::duration val) {
+    return static_cast<uint64_t>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(val).count()));
+  };
+  auto [it, isNew] = s_threadTids.emplace(std::this_thread::get_id(), static_cast<unsigned>(s_threadTids.size()));
+  if (isNew) {
+    writeMetadata("thread_name", s_simPid, it->second, "Host Thread " + std::to_string(it->second));
+  }
+  writeSlice(tag, "api", s_simPid, it->second, toNs(startTime - s_startTime), toNs(endTime - s_startTime), "");
+}
+
+//! @brief  Get a track of a rank for a slice. Use an extra track if the slice overlaps with all tracks of the rank
+unsigned
+pimChromeTrace::getRankTid(unsigned rank, uint64_t nsStart, uint64_t nsEnd)
+{
+  std::vector<track>& tracks = s_rankTracks[rank];
+  for (track& item : tracks) {
+    if (item.m_nsEnd <= nsStart) {
+      item.m_nsEnd = nsEnd;
+      return item.m_tid;
+    }
+  }
+  track item;
+  item.m_tid = s_nextTid++;
+  item.m_nsEnd = nsEnd;
+  tracks.push_back(item);
+  std::string trackName = "Rank " + std::to_string(rank);
+  if (tracks.size() > 1) {
+    trackName += " (" + std::to_string(tracks.size() - 1) + ")";
+  }
+  writeMetadata("thread_name", s_devicePid, item.m_tid, trackName);
+  writeMetadata("thread_sort_index", s_devicePid, item.m_tid, std::to_string(static_cast<uint64_t>(rank + 1) * 1000 + tracks.size()));
+  return item.m_tid;
+}
+
+//! @brief  Write a complete event. Timestamps are in microseconds with nanosecond precision
+void
+pimChromeTrace::writeSlice(const std::string& name, const char* category, unsigned pid, unsigned tid,
+                           uint64_t nsStart, uint64_t nsEnd, const std::string& args)
+{
+  auto toUs = [](uint64_t ns) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%llu.%03llu", static_cast<unsigned long long>(ns / 1000), static_cast<unsigned long long>(ns % 1000));
+    return std::string(buf);
+  };
+  std::string escaped;
+  for (char ch : name) {
+    if (ch == '"' || ch == '\\') {
+      escaped += '\\';
+    }
+    escaped += ch;
+  }
+  writeEvent("{\"name\":\"" + escaped + "\",\"cat\":\"" + category + "\",\"ph\":\"X\",\"pid\":" + std::to_string(pid)
+      + ",\"tid\":" + std::to_string(tid) + ",\"ts\":" + toUs(nsStart) + ",\"dur\":" + toUs(std::max(nsStart, nsEnd) - nsStart)
+      + ",\"args\":{" + args + "}}");
+}
+
+//! @brief  Write a metadata event. Sort indices are numbers, and names are strings
+void
+pimChromeTrace::writeMetadata(const char* metaName, unsigned pid, unsigned tid, const std::string& arg)
+{
+  bool isSortIndex = std::string(metaName).find("sort_index") != std::string::npos;
+  writeEvent(std::string("{\"name\":\"") + metaName + "\",\"ph\":\"M\",\"pid\":" + std::to_string(pid)
+      + ",\"tid\":" + std::to_string(tid) + ",\"args\":{" + (isSortIndex ? "\"sort_index\":" + arg : "\"name\":\"" + arg + "\"") + "}}");
+}
+
+//! @brief  Append an event to the event array, and reopen the array if it was closed by a flush
+void
+pimChromeTrace::writeEvent(const std::string& event)
+{
+  if (s_isClosed) {
+    std::fseek(s_file, -3, SEEK_END);
+    s_isClosed = false;
+  }
+  std::fputs(s_hasEvents ? ",\n" : "\n", s_file);
+  std::fputs(event.c_str(), s_file);
+  s_hasEvents = true;
+}
@@ -0,0 +1,81 @@
+// File: pimChromeTrace.h
+// PIMeval Simulator - Chrome Trace of Modeled and Simulator Execution
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#ifndef LAVA_PIM_CHROME_TRACE_H
+#define LAVA_PIM_CHROME_TRACE_H
+
+#include "libpimeval.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class pimCmd;
+class pimResMgr;
+
+
+//! @class  pimChromeTrace
+//! @brief  Emit Chrome trace events in JSON array format, e.g., for viewing in Perfetto or chrome://tracing
+//! * Each PIM device has a process of modeled execution. PIM commands are slices on the tracks of the ranks of their
+//!   cores at their start time on the modeled timeline, and host-device copies are slices on the host channel track.
+//!   Commands on disjoint cores of a rank may overlap, and an overlapping slice moves to an extra track of the rank.
+//!   Args are object IDs, number of elements, regions, passes and cores of the command
+//! * The simulator process has a track for each host thread, with a slice for each PIM API scope in wall-clock time
+//! The trace file stays open across PIM devices until a different trace file is requested, and it is valid JSON
+//! after each device deletion. Only the PIM context that opened the trace is recorded
+class pimChromeTrace
+{
+public:
+  static bool open(const std::string& fileName, PimContext context);
+  static void close();
+  static void flush();
+  static bool isOn();
+  static PimContext getContext() { return s_context; }
+
+  static void beginDevice(const std::string& deviceName, unsigned numRanks, unsigned numCoresPerRank);
+  static void recordModeled(const pimCmd& cmd, const pimResMgr& resMgr, double msStart, double msRuntime);
+  static void recordApi(const std::string& tag, std::chrono::high_resolution_clock::time_point startTime,
+                        std::chrono::high_resolution_clock::time_point endTime);
+
+private:
+  //! @struct  pimChromeTrace::track
+  //! @brief  A track of a rank, and the end time of its last slice
+  struct track {
+    unsigned m_tid = 0;
+    uint64_t m_nsEnd = 0;
+  };
+
+  static unsigned getRankTid(unsigned rank, uint64_t nsStart, uint64_t nsEnd);
+  static void writeSlice(const std::string& name, const char* category, unsigned pid, unsigned tid,
+                         uint64_t nsStart, uint64_t nsEnd, const std::string& args);
+  static void writeMetadata(const char* metaName, unsigned pid, unsigned tid, const std::string& arg);
+  static void writeEvent(const std::string& event);
+
+  static constexpr unsigned s_simPid = 0;  // process of simulator threads. Devices are numbered from 1
+  static constexpr unsigned s_channelTid = 0;  // track of host channel of a device
+
+  // checked without the mutex by isOn and getContext for every PIM command
+  inline static std::atomic<std::FILE*> s_file = nullptr;
+  inline static std::atomic<PimContext> s_context = nullptr;
+  inline static std::string s_fileName;
+  inline static bool s_hasEvents = false;
+  inline static bool s_isClosed = false;  // the event array is closed at the end of file
+  inline static unsigned s_devicePid = 0;
+  inline static unsigned s_numCoresPerRank = 1;
+  inline static unsigned s_nextTid = 0;
+  inline static std::vector<std::vector<track>> s_rankTracks;
+  inline static std::map<std::thread::id, unsigned> s_threadTids;
+  inline static std::chrono::high_resolution_clock::time_point s_startTime;
+  inline static std::recursive_mutex s_mutex;
+};
+
+#endif
+
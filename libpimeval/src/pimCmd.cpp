@@ -10,6 +10,7 @@
 #include "pimDevice.h"       // for pimDevice
 #include "pimCore.h"         // for pimCore
 #include "pimResMgr.h"       // for pimResMgr
+#include "pimCmdMicroKernel.h" // for pimMicroKernel
 #include "libpimeval.h"      // for PimObjId
 #include <cstdio>
 #include <cmath>
@@ -101,16 +102,76 @@ pimCmd::getName(PimCmdEnum cmdType, const std::string& suffix)
     { PimCmdEnum::RREG_ROTATE_L, "rreg.rotate_l" },
     { PimCmdEnum::ROW_AP, "row_ap" },
     { PimCmdEnum::ROW_AAP, "row_aap" },
+    { PimCmdEnum::OP_BATCH, "op_batch" },
+    { PimCmdEnum::MICRO_KERNEL, "micro_kernel" },
   };
   auto it = cmdNames.find(cmdType);
   return it != cmdNames.end() ? it->second + suffix : "unknown";
 }
 
-//! @brief  pimCmd constructor
+//! @brief  pimCmd constructor. A command belongs to the current PIM context of the calling thread
 pimCmd::pimCmd(PimCmdEnum cmdType)
-  : m_cmdType(cmdType)
+  : m_cmdType(cmdType),
+    m_sim(pimSim::get())
 {
-  m_debugCmds = pimSim::get()->isDebug(pimSimConfig::DEBUG_CMDS);
+  m_debugCmds = m_sim->isDebug(pimSimConfig::DEBUG_CMDS);
+}
+
+//! @brief  Model perf and energy of an executed command on another device, e.g., an extra simulation target
+bool
+pimCmd::updateStatsOnDevice(pimDevice* device, pimStatsMgr* statsMgr)
+{
+  pimDevice* origDevice = m_device;
+  m_device = device;
+  m_statsMgr = statsMgr;
+  bool ok = updateStats();
+  m_device = origDevice;
+  m_statsMgr = nullptr;
+  return ok;
+}
+
+//! @brief  Get the perf energy model of the device being modeled
+pimPerfEnergyBase*
+pimCmd::getPerfEnergyModel() const
+{
+  return m_device->getPerfEnergyModel();
+}
+
+//! @brief  Get the stats manager of the device being modeled
+pimStatsMgr*
+pimCmd::getStatsMgr() const
+{
+  return m_statsMgr ? m_statsMgr : m_sim->getStatsMgr();
+}
+
+//! @brief  Check if this is a bit-serial micro op or a sequence of micro ops
+bool
+pimCmd::isMicroOp() const
+{
+  switch (m_cmdType) {
+  case PimCmdEnum::ROW_R:
+  case PimCmdEnum::ROW_W:
+  case PimCmdEnum::RREG_MOV:
+  case PimCmdEnum::RREG_SET:
+  case PimCmdEnum::RREG_NOT:
+  case PimCmdEnum::RREG_AND:
+  case PimCmdEnum::RREG_OR:
+  case PimCmdEnum::RREG_NAND:
+  case PimCmdEnum::RREG_NOR:
+  case PimCmdEnum::RREG_XOR:
+  case PimCmdEnum::RREG_XNOR:
+  case PimCmdEnum::RREG_MAJ:
+  case PimCmdEnum::RREG_SEL:
+  case PimCmdEnum::RREG_ROTATE_R:
+  case PimCmdEnum::RREG_ROTATE_L:
+  case PimCmdEnum::ROW_AP:
+  case PimCmdEnum::ROW_AAP:
+  case PimCmdEnum::OP_BATCH:
+  case PimCmdEnum::MICRO_KERNEL:
+    return true;
+  default:
+    return false;
+  }
 }
 
 //! @brief  Check if an obj ID is valid
@@ -166,15 +227,15 @@ bool
 pimCmd::computeAllRegions(unsigned numRegions)
 {
   // skip PIM computation in analysis mode
-  if (pimSim::get()->isAnalysisMode()) {
+  if (m_sim->isAnalysisMode()) {
     return true;
   }
-  if (pimSim::get()->getNumThreads() > 1) { // MT
+  if (m_sim->getNumThreads() > 1) { // MT
     std::vector<pimUtils::threadWorker*> workers;
     for (unsigned i = 0; i < numRegions; ++i) {
       workers.push_back(new regionWorker(this, i));
     }
-    pimSim::get()->getThreadPool()->doWork(workers);
+    m_sim->getThreadPool()->doWork(workers);
     for (unsigned i = 0; i < numRegions; ++i) {
       delete workers[i];
     }
@@ -196,14 +257,24 @@ pimCmdCopy::execute()
   }
 
   // for non-functional simulation, sync src data from simulated memory
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     if (m_cmdType == PimCmdEnum::COPY_D2H || m_cmdType == PimCmdEnum::COPY_D2D) {
       pimObjInfo &objSrc = m_device->getResMgr()->getObjInfo(m_src);
       objSrc.syncFromSimulatedMem();
     }
   }
 
-  if (!pimSim::get()->isAnalysisMode()) {
+  // for non-functional simulation, sync dest data from simulated memory if it is partially overwritten
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
+    if (m_cmdType == PimCmdEnum::COPY_H2D || m_cmdType == PimCmdEnum::COPY_D2D) {
+      pimObjInfo &objDest = m_device->getResMgr()->getObjInfo(m_dest);
+      if (m_idxBegin != 0 || (m_idxEnd != 0 && m_idxEnd != objDest.getNumElements())) {
+        objDest.syncFromSimulatedMem();
+      }
+    }
+  }
+
+  if (!m_sim->isAnalysisMode()) {
     if (m_cmdType == PimCmdEnum::COPY_H2D) {
       pimObjInfo &objDest = m_device->getResMgr()->getObjInfo(m_dest);
       objDest.copyFromHost(m_ptr, m_idxBegin, m_idxEnd);
@@ -219,11 +290,11 @@ pimCmdCopy::execute()
     }
   }
 
-  // for non-functional simulation, sync dest data to simulated memory
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  // for non-functional simulation, dest data will be synced to simulated memory on demand
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     if (m_cmdType == PimCmdEnum::COPY_H2D || m_cmdType == PimCmdEnum::COPY_D2D) {
       const pimObjInfo &objDest = m_device->getResMgr()->getObjInfo(m_dest);
-      objDest.syncToSimulatedMem();
+      objDest.markDataHolderModified();
     }
   }
 
@@ -317,8 +388,10 @@ pimCmdCopy::updateStats() const
       numElements = m_idxEnd - m_idxBegin;
     }
     unsigned bitsPerElement = objDest.getBitsPerElement(PimBitWidth::ACTUAL);
-    pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForBytesTransfer(m_cmdType, numElements * bitsPerElement / 8);
-    pimSim::get()->getStatsMgr()->recordCopyMainToDevice(numElements * bitsPerElement, mPerfEnergy);
+    uint64_t idxBegin = (m_copyFullRange ? 0 : m_idxBegin);
+    pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForObjTransfer(m_cmdType, objDest, idxBegin, idxBegin + numElements);
+    getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, nullptr, nullptr);
+    getStatsMgr()->recordCopyMainToDevice(numElements * bitsPerElement, mPerfEnergy);
 
     if (m_debugCmds) {
       std::printf("PIM-Cmd: Copied %" PRIu64 " elements of %u bits from host to PIM obj %d\n",
@@ -331,8 +404,10 @@ pimCmdCopy::updateStats() const
       numElements = m_idxEnd - m_idxBegin;
     }
     unsigned bitsPerElement = objSrc.getBitsPerElement(PimBitWidth::ACTUAL);
-    pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForBytesTransfer(m_cmdType, numElements * bitsPerElement / 8);
-    pimSim::get()->getStatsMgr()->recordCopyDeviceToMain(numElements * bitsPerElement, mPerfEnergy);
+    uint64_t idxBegin = (m_copyFullRange ? 0 : m_idxBegin);
+    pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForObjTransfer(m_cmdType, objSrc, idxBegin, idxBegin + numElements);
+    getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, nullptr, nullptr);
+    getStatsMgr()->recordCopyDeviceToMain(numElements * bitsPerElement, mPerfEnergy);
 
     if (m_debugCmds) {
       std::printf("PIM-Cmd: Copied %" PRIu64 " elements of %u bits from PIM obj %d to host\n",
@@ -345,8 +420,9 @@ pimCmdCopy::updateStats() const
       numElements = m_idxEnd - m_idxBegin;
     }
     unsigned bitsPerElement = objSrc.getBitsPerElement(PimBitWidth::ACTUAL);
-    pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForBytesTransfer(m_cmdType, numElements * bitsPerElement / 8);
-    pimSim::get()->getStatsMgr()->recordCopyDeviceToDevice(numElements * bitsPerElement, mPerfEnergy);
+    pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForBytesTransfer(m_cmdType, numElements * bitsPerElement / 8);
+    getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, nullptr, nullptr);
+    getStatsMgr()->recordCopyDeviceToDevice(numElements * bitsPerElement, mPerfEnergy);
 
     if (m_debugCmds) {
       std::printf("PIM-Cmd: Copied %" PRIu64 " elements of %u bits from PIM obj %d to PIM obj %d\n",
@@ -371,7 +447,7 @@ pimCmdFunc1::execute()
     return false;
   }
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     pimObjInfo &objSrc = m_device->getResMgr()->getObjInfo(m_src);
     objSrc.syncFromSimulatedMem();
     if (m_cmdType == PimCmdEnum::BIT_SLICE_INSERT) {  // require dest data to be synced
@@ -384,9 +460,9 @@ pimCmdFunc1::execute()
   unsigned numRegions = objSrc.getRegions().size();
   computeAllRegions(numRegions);
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     const pimObjInfo &objDest = m_device->getResMgr()->getObjInfo(m_dest);
-    objDest.syncToSimulatedMem();
+    objDest.markDataHolderModified();
   }
 
   updateStats();
@@ -592,11 +668,10 @@ pimCmdFunc1::updateStats() const
   bool useDestAsSrc = (m_cmdType == PimCmdEnum::BIT_SLICE_INSERT);
   const pimObjInfo& objSrc = (useDestAsSrc? m_device->getResMgr()->getObjInfo(m_dest) : m_device->getResMgr()->getObjInfo(m_src));
   const pimObjInfo& objDest = m_device->getResMgr()->getObjInfo(m_dest);
-  PimDataType dataType = objSrc.getDataType();
-  bool isVLayout = objSrc.isVLayout();
 
-  pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForFunc1(m_cmdType, objSrc, objDest);
-  pimSim::get()->getStatsMgr()->recordCmd(getName(dataType, isVLayout), mPerfEnergy);
+  pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForFunc1(m_cmdType, objSrc, objDest);
+  getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, &objSrc, &objDest);
+  getStatsMgr()->recordCmd(getName(objSrc), mPerfEnergy);
   return true;
 }
 
@@ -612,7 +687,7 @@ pimCmdFunc2::execute()
     return false;
   }
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     pimObjInfo &objSrc1 = m_device->getResMgr()->getObjInfo(m_src1);
     pimObjInfo &objSrc2 = m_device->getResMgr()->getObjInfo(m_src2);
     objSrc1.syncFromSimulatedMem();
@@ -623,9 +698,9 @@ pimCmdFunc2::execute()
   unsigned numRegions = objSrc1.getRegions().size();
   computeAllRegions(numRegions);
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     const pimObjInfo &objDest = m_device->getResMgr()->getObjInfo(m_dest);
-    objDest.syncToSimulatedMem();
+    objDest.markDataHolderModified();
   }
 
   updateStats();
@@ -770,11 +845,10 @@ pimCmdFunc2::updateStats() const
   const pimObjInfo& objSrc1 = m_device->getResMgr()->getObjInfo(m_src1);
   const pimObjInfo& objSrc2 = m_device->getResMgr()->getObjInfo(m_src2);
   const pimObjInfo& objDest = m_device->getResMgr()->getObjInfo(m_dest);
-  PimDataType dataType = objSrc1.getDataType();
-  bool isVLayout = objSrc1.isVLayout();
 
-  pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForFunc2(m_cmdType, objSrc1, objSrc2, objDest);
-  pimSim::get()->getStatsMgr()->recordCmd(getName(dataType, isVLayout), mPerfEnergy);
+  pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForFunc2(m_cmdType, objSrc1, objSrc2, objDest);
+  getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, &objSrc1, &objDest);
+  getStatsMgr()->recordCmd(getName(objSrc1), mPerfEnergy);
   return true;
 }
 
@@ -791,7 +865,7 @@ pimCmdCond::execute()
     return false;
   }
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     pimObjInfo &objBool = m_device->getResMgr()->getObjInfo(m_condBool);
     objBool.syncFromSimulatedMem();
     if (m_cmdType == PimCmdEnum::COND_COPY || m_cmdType == PimCmdEnum::COND_SELECT || m_cmdType == PimCmdEnum::COND_SELECT_SCALAR) {
@@ -812,9 +886,9 @@ pimCmdCond::execute()
   unsigned numRegions = objDest.getRegions().size();
   computeAllRegions(numRegions);
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     const pimObjInfo &objDest = m_device->getResMgr()->getObjInfo(m_dest);
-    objDest.syncToSimulatedMem();
+    objDest.markDataHolderModified();
   }
 
   updateStats();
@@ -939,13 +1013,13 @@ pimCmdCond::computeRegion(unsigned index)
 bool
 pimCmdCond::updateStats() const
 {
+  const pimObjInfo& objCond = m_device->getResMgr()->getObjInfo(m_condBool);
   const pimObjInfo& objDest = m_device->getResMgr()->getObjInfo(m_dest);
-  PimDataType dataType = objDest.getDataType();
-  bool isVLayout = objDest.isVLayout();
 
   // Reuse func2 to calculate performance and energy
-  pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForFunc2(m_cmdType, objDest, objDest, objDest);
-  pimSim::get()->getStatsMgr()->recordCmd(getName(dataType, isVLayout), mPerfEnergy);
+  pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForFunc2(m_cmdType, objDest, objDest, objDest);
+  getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, &objCond, &objDest);
+  getStatsMgr()->recordCmd(getName(objDest), mPerfEnergy);
   return true;
 }
  
@@ -982,7 +1056,7 @@ pimCmdReduction<T>::execute()
   }
 
   pimObjInfo &objSrc = m_device->getResMgr()->getObjInfo(m_src);
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     objSrc.syncFromSimulatedMem();
   }
 
@@ -1101,8 +1175,6 @@ template <typename T> bool
 pimCmdReduction<T>::updateStats() const
 {
   const pimObjInfo& objSrc = m_device->getResMgr()->getObjInfo(m_src);
-  PimDataType dataType = objSrc.getDataType();
-  bool isVLayout = objSrc.isVLayout();
 
   unsigned numPass = 0;
   if (m_cmdType == PimCmdEnum::REDSUM_RANGE || m_cmdType == PimCmdEnum::REDMIN_RANGE || m_cmdType == PimCmdEnum::REDMAX_RANGE) {
@@ -1127,8 +1199,9 @@ pimCmdReduction<T>::updateStats() const
     numPass = objSrc.getMaxNumRegionsPerCore();
   }
 
-  pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForReduction(m_cmdType, objSrc, numPass);
-  pimSim::get()->getStatsMgr()->recordCmd(getName(dataType, isVLayout), mPerfEnergy);
+  pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForReduction(m_cmdType, objSrc, numPass);
+  getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, &objSrc, &objSrc);
+  getStatsMgr()->recordCmd(getName(objSrc), mPerfEnergy);
   return true;
 }
 
@@ -1148,9 +1221,9 @@ pimCmdBroadcast::execute()
   unsigned numRegions = objDest.getRegions().size();
   computeAllRegions(numRegions);
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     const pimObjInfo &objDest = m_device->getResMgr()->getObjInfo(m_dest);
-    objDest.syncToSimulatedMem();
+    objDest.markDataHolderModified();
   }
 
   updateStats();
@@ -1189,11 +1262,10 @@ bool
 pimCmdBroadcast::updateStats() const
 {
   const pimObjInfo& objDest = m_device->getResMgr()->getObjInfo(m_dest);
-  PimDataType dataType = objDest.getDataType();
-  bool isVLayout = objDest.isVLayout();
 
-  pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForBroadcast(m_cmdType, objDest);
-  pimSim::get()->getStatsMgr()->recordCmd(getName(dataType, isVLayout), mPerfEnergy);
+  pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForBroadcast(m_cmdType, objDest);
+  getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, nullptr, &objDest);
+  getStatsMgr()->recordCmd(getName(objDest), mPerfEnergy);
   return true;
 }
 
@@ -1210,7 +1282,7 @@ pimCmdRotate::execute()
     return false;
   }
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     pimObjInfo &objSrc = m_device->getResMgr()->getObjInfo(m_src);
     objSrc.syncFromSimulatedMem();
   }
@@ -1251,9 +1323,9 @@ pimCmdRotate::execute()
     assert(0);
   }
 
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     const pimObjInfo &objSrc = m_device->getResMgr()->getObjInfo(m_src);
-    objSrc.syncToSimulatedMem();
+    objSrc.markDataHolderModified();
   }
 
   updateStats();
@@ -1320,11 +1392,10 @@ bool
 pimCmdRotate::updateStats() const
 {
   const pimObjInfo& objSrc = m_device->getResMgr()->getObjInfo(m_src);
-  PimDataType dataType = objSrc.getDataType();
-  bool isVLayout = objSrc.isVLayout();
 
-  pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForRotate(m_cmdType, objSrc);
-  pimSim::get()->getStatsMgr()->recordCmd(getName(dataType, isVLayout), mPerfEnergy);
+  pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForRotate(m_cmdType, objSrc);
+  getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, &objSrc, &objSrc);
+  getStatsMgr()->recordCmd(getName(objSrc), mPerfEnergy);
   return true;
 }
 
@@ -1355,12 +1426,18 @@ pimCmdPrefixSum::execute()
   }
 
   pimObjInfo &objSrc = m_device->getResMgr()->getObjInfo(m_src);
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     objSrc.syncFromSimulatedMem();
   }
 
   unsigned numRegions = objSrc.getRegions().size();
   computeAllRegions(numRegions);
+
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
+    const pimObjInfo &objDst = m_device->getResMgr()->getObjInfo(m_dst);
+    objDst.markDataHolderModified();
+  }
+
   updateStats();
   return true;
 }
@@ -1417,10 +1494,9 @@ bool
 pimCmdPrefixSum::updateStats() const
 {
   const pimObjInfo& objSrc = m_device->getResMgr()->getObjInfo(m_src);
-  PimDataType dataType = objSrc.getDataType();
-  bool isVLayout = objSrc.isVLayout();
-  pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForPrefixSum(m_cmdType, objSrc);
-  pimSim::get()->getStatsMgr()->recordCmd(getName(dataType, isVLayout), mPerfEnergy);
+  pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForPrefixSum(m_cmdType, objSrc);
+  getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, &objSrc, &objSrc);
+  getStatsMgr()->recordCmd(getName(objSrc), mPerfEnergy);
   return true;
 }
 
@@ -1464,7 +1540,7 @@ pimCmdMAC<T>::execute()
 
   pimObjInfo &objSrc1 = m_device->getResMgr()->getObjInfo(m_src1);
   pimObjInfo &objSrc2 = m_device->getResMgr()->getObjInfo(m_src2);
-  if (pimSim::get()->getDeviceType() != PIM_FUNCTIONAL) {
+  if (m_sim->getDeviceType() != PIM_FUNCTIONAL) {
     objSrc1.syncFromSimulatedMem();
     objSrc2.syncFromSimulatedMem();
   }
@@ -1567,10 +1643,9 @@ template <typename T> bool
 pimCmdMAC<T>::updateStats() const
 {
   const pimObjInfo& objSrc = m_device->getResMgr()->getObjInfo(m_src1);
-  PimDataType dataType = objSrc.getDataType();
-  bool isVLayout = objSrc.isVLayout();
-  pimeval::perfEnergy mPerfEnergy = pimSim::get()->getPerfEnergyModel()->getPerfEnergyForMac(m_cmdType, objSrc);
-  pimSim::get()->getStatsMgr()->recordCmd(getName(dataType, isVLayout), mPerfEnergy);
+  pimeval::perfEnergy mPerfEnergy = getPerfEnergyModel()->getPerfEnergyForMac(m_cmdType, objSrc);
+  getPerfEnergyModel()->applyRowBufferLocality(mPerfEnergy, &objSrc, &objSrc);
+  getStatsMgr()->recordCmd(getName(objSrc), mPerfEnergy);
   return true;
 }
 
@@ -1584,6 +1659,7 @@ pimCmdReadRowToSa::execute()
 
   pimResMgr* resMgr = m_device->getResMgr();
   const pimObjInfo& objSrc = resMgr->getObjInfo(m_objId);
+  objSrc.syncToSimulatedMem();
   for (unsigned i = 0; i < objSrc.getRegions().size(); ++i) {
     const pimRegion& srcRegion = objSrc.getRegions()[i];
     if (m_ofst >= srcRegion.getNumAllocRows()) {
@@ -1596,7 +1672,7 @@ pimCmdReadRowToSa::execute()
 
   // Update stats
   pimeval::perfEnergy prfEnrgy;
-  pimSim::get()->getStatsMgr()->recordCmd(getName(), prfEnrgy);
+  getStatsMgr()->recordCmd(getName(), prfEnrgy);
   return true;
 }
 
@@ -1610,6 +1686,7 @@ pimCmdWriteSaToRow::execute()
 
   pimResMgr* resMgr = m_device->getResMgr();
   const pimObjInfo& objSrc = resMgr->getObjInfo(m_objId);
+  objSrc.syncToSimulatedMem();
   for (unsigned i = 0; i < objSrc.getRegions().size(); ++i) {
     const pimRegion& srcRegion = objSrc.getRegions()[i];
     if (m_ofst >= srcRegion.getNumAllocRows()) {
@@ -1619,10 +1696,11 @@ pimCmdWriteSaToRow::execute()
     PimCoreId coreId = srcRegion.getCoreId();
     m_device->getCore(coreId).writeRow(srcRegion.getRowIdx() + m_ofst);
   }
+  objSrc.markSimulatedMemModified();
 
   // Update stats
   pimeval::perfEnergy prfEnrgy;
-  pimSim::get()->getStatsMgr()->recordCmd(getName(), prfEnrgy);
+  getStatsMgr()->recordCmd(getName(), prfEnrgy);
   return true;
 }
 
@@ -1637,100 +1715,71 @@ pimCmdRRegOp::execute()
 
   pimResMgr* resMgr = m_device->getResMgr();
   const pimObjInfo& refObj = resMgr->getObjInfo(m_objId);
-  for (unsigned i = 0; i < refObj.getRegions().size(); ++i) {
-    const pimRegion& refRegion = refObj.getRegions()[i];
-    PimCoreId coreId = refRegion.getCoreId();
-    for (unsigned j = 0; j < m_device->getNumCols(); j++) {
-      switch (m_cmdType) {
-      case PimCmdEnum::RREG_MOV:
-      {
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        break;
-      }
-      case PimCmdEnum::RREG_SET:
-      {
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = m_val;
-        break;
-      }
-      case PimCmdEnum::RREG_NOT:
-      {
-        bool src = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = !src;
-        break;
-      }
-      case PimCmdEnum::RREG_AND:
-      {
-        bool src1 = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        bool src2 = m_device->getCore(coreId).getRowReg(m_src2)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = (src1 & src2);
-        break;
-      }
-      case PimCmdEnum::RREG_OR:
-      {
-        bool src1 = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        bool src2 = m_device->getCore(coreId).getRowReg(m_src2)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = src1 | src2;
-        break;
-      }
-      case PimCmdEnum::RREG_NAND:
-      {
-        bool src1 = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        bool src2 = m_device->getCore(coreId).getRowReg(m_src2)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = !(src1 & src2);
-        break;
-      }
-      case PimCmdEnum::RREG_NOR:
-      {
-        bool src1 = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        bool src2 = m_device->getCore(coreId).getRowReg(m_src2)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = !(src1 | src2);
-        break;
-      }
-      case PimCmdEnum::RREG_XOR:
-      {
-        bool src1 = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        bool src2 = m_device->getCore(coreId).getRowReg(m_src2)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = src1 ^ src2;
-        break;
-      }
-      case PimCmdEnum::RREG_XNOR:
-      {
-        bool src1 = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        bool src2 = m_device->getCore(coreId).getRowReg(m_src2)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = !(src1 ^ src2);
-        break;
-      }
-      case PimCmdEnum::RREG_MAJ:
-      {
-        bool src1 = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        bool src2 = m_device->getCore(coreId).getRowReg(m_src2)[j];
-        bool src3 = m_device->getCore(coreId).getRowReg(m_src3)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] =
-            ((src1 & src2) || (src1 & src3) || (src2 & src3));
-        break;
-      }
-      case PimCmdEnum::RREG_SEL:
-      {
-        bool cond = m_device->getCore(coreId).getRowReg(m_src1)[j];
-        bool src2 = m_device->getCore(coreId).getRowReg(m_src2)[j];
-        bool src3 = m_device->getCore(coreId).getRowReg(m_src3)[j];
-        m_device->getCore(coreId).getRowReg(m_dest)[j] = (cond ? src2 : src3);
-        break;
-      }
-      default:
-        std::printf("PIM-Error: Unexpected cmd type %d\n", static_cast<int>(m_cmdType));
-        assert(0);
-      }
-    }
+  // row regs are per core, so operate once per core on packed words
+  for (const auto& regionIdxs : refObj.getRegionIdxsPerCore()) {
+    PimCoreId coreId = refObj.getRegions()[regionIdxs[0]].getCoreId();
+    computeCore(m_device->getCore(coreId), m_cmdType, m_dest, m_src1, m_src2, m_src3, m_val);
   }
 
   // Update stats
   pimeval::perfEnergy prfEnrgy;
-  pimSim::get()->getStatsMgr()->recordCmd(getName(), prfEnrgy);
+  getStatsMgr()->recordCmd(getName(), prfEnrgy);
   return true;
 }
 
 
+//! @brief  Pim CMD: BitSIMD-V: Row reg operation on packed words of a core
+void
+pimCmdRRegOp::computeCore(pimCore& core, PimCmdEnum cmdType, PimRowReg destReg,
+                          PimRowReg src1Reg, PimRowReg src2Reg, PimRowReg src3Reg, bool val)
+{
+  uint64_t* dest = core.getRowReg(destReg).data();
+  const uint64_t* src1 = (src1Reg != PIM_RREG_NONE ? core.getRowReg(src1Reg).data() : nullptr);
+  const uint64_t* src2 = (src2Reg != PIM_RREG_NONE ? core.getRowReg(src2Reg).data() : nullptr);
+  const uint64_t* src3 = (src3Reg != PIM_RREG_NONE ? core.getRowReg(src3Reg).data() : nullptr);
+  unsigned numWords = core.getNumWordsPerRow();
+  switch (cmdType) {
+  case PimCmdEnum::RREG_MOV:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = src1[w]; }
+    break;
+  case PimCmdEnum::RREG_SET:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = val ? ~0ULL : 0ULL; }
+    break;
+  case PimCmdEnum::RREG_NOT:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = ~src1[w]; }
+    break;
+  case PimCmdEnum::RREG_AND:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = src1[w] & src2[w]; }
+    break;
+  case PimCmdEnum::RREG_OR:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = src1[w] | src2[w]; }
+    break;
+  case PimCmdEnum::RREG_NAND:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = ~(src1[w] & src2[w]); }
+    break;
+  case PimCmdEnum::RREG_NOR:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = ~(src1[w] | src2[w]); }
+    break;
+  case PimCmdEnum::RREG_XOR:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = src1[w] ^ src2[w]; }
+    break;
+  case PimCmdEnum::RREG_XNOR:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = ~(src1[w] ^ src2[w]); }
+    break;
+  case PimCmdEnum::RREG_MAJ:
+    for (unsigned w = 0; w < numWords; ++w) {
+      dest[w] = (src1[w] & src2[w]) | (src1[w] & src3[w]) | (src2[w] & src3[w]);
+    }
+    break;
+  case PimCmdEnum::RREG_SEL:
+    for (unsigned w = 0; w < numWords; ++w) { dest[w] = (src1[w] & src2[w]) | (~src1[w] & src3[w]); }
+    break;
+  default:
+    std::printf("PIM-Error: Unexpected cmd type %d\n", static_cast<int>(cmdType));
+    assert(0);
+  }
+}
+
 //! @brief  Pim CMD: BitSIMD-V: row reg rotate right/left by one step
 bool
 pimCmdRRegRotate::execute()
@@ -1740,16 +1789,27 @@ pimCmdRRegRotate::execute()
   }
 
   pimResMgr* resMgr = m_device->getResMgr();
-  const pimObjInfo& objSrc = resMgr->getObjInfo(m_objId);
-  if (m_cmdType == PimCmdEnum::RREG_ROTATE_R) {  // Right Rotate
+  rotateRowReg(m_device, resMgr->getObjInfo(m_objId), m_cmdType, m_dest);
+
+  // Update stats
+  pimeval::perfEnergy prfEnrgy;
+  getStatsMgr()->recordCmd(getName(), prfEnrgy);
+  return true;
+}
+
+//! @brief  Pim CMD: BitSIMD-V: Rotate a row reg by one step across all regions of an object
+void
+pimCmdRRegRotate::rotateRowReg(pimDevice* device, const pimObjInfo& objSrc, PimCmdEnum cmdType, PimRowReg reg)
+{
+  if (cmdType == PimCmdEnum::RREG_ROTATE_R) {  // Right Rotate
     bool prevVal = 0;
     for (unsigned i = 0; i < objSrc.getRegions().size(); ++i) {
       const pimRegion &srcRegion = objSrc.getRegions()[i];
       PimCoreId coreId = srcRegion.getCoreId();
       for (unsigned j = 0; j < srcRegion.getNumAllocCols(); ++j) {
         unsigned colIdx = srcRegion.getColIdx() + j;
-        bool tmp = m_device->getCore(coreId).getRowReg(m_dest)[colIdx];
-        m_device->getCore(coreId).getRowReg(m_dest)[colIdx] = prevVal;
+        bool tmp = device->getCore(coreId).getRowRegBit(reg, colIdx);
+        device->getCore(coreId).setRowRegBit(reg, colIdx, prevVal);
         prevVal = tmp;
       }
     }
@@ -1757,16 +1817,16 @@ pimCmdRRegRotate::execute()
     const pimRegion &firstRegion = objSrc.getRegions().front();
     PimCoreId firstCoreId = firstRegion.getCoreId();
     unsigned firstColIdx = firstRegion.getColIdx();
-    m_device->getCore(firstCoreId).getRowReg(m_dest)[firstColIdx] = prevVal;
-  } else if (m_cmdType == PimCmdEnum::RREG_ROTATE_L) {  // Left Rotate
+    device->getCore(firstCoreId).setRowRegBit(reg, firstColIdx, prevVal);
+  } else if (cmdType == PimCmdEnum::RREG_ROTATE_L) {  // Left Rotate
     bool prevVal = 0;
     for (unsigned i = objSrc.getRegions().size(); i > 0; --i) {
       const pimRegion &srcRegion = objSrc.getRegions()[i - 1];
       PimCoreId coreId = srcRegion.getCoreId();
       for (unsigned j = srcRegion.getNumAllocCols(); j > 0; --j) {
         unsigned colIdx = srcRegion.getColIdx() + j - 1;
-        bool tmp = m_device->getCore(coreId).getRowReg(m_dest)[colIdx];
-        m_device->getCore(coreId).getRowReg(m_dest)[colIdx] = prevVal;
+        bool tmp = device->getCore(coreId).getRowRegBit(reg, colIdx);
+        device->getCore(coreId).setRowRegBit(reg, colIdx, prevVal);
         prevVal = tmp;
       }
     }
@@ -1774,13 +1834,8 @@ pimCmdRRegRotate::execute()
     const pimRegion &lastRegion = objSrc.getRegions().back();
     PimCoreId lastCoreId = lastRegion.getCoreId();
     unsigned lastColIdx = lastRegion.getColIdx() + lastRegion.getNumAllocCols() - 1;
-    m_device->getCore(lastCoreId).getRowReg(m_dest)[lastColIdx] = prevVal;
+    device->getCore(lastCoreId).setRowRegBit(reg, lastColIdx, prevVal);
   }
-
-  // Update stats
-  pimeval::perfEnergy prfEnrgy;
-  pimSim::get()->getStatsMgr()->recordCmd(getName(), prfEnrgy);
-  return true;
 }
 
 //! @brief  Pim CMD: SIMDRAM: Analog based multi-row AP and AAP
@@ -1798,76 +1853,93 @@ pimCmdAnalogAAP::execute()
   pimResMgr* resMgr = m_device->getResMgr();
   const pimObjInfo& objSrc = resMgr->getObjInfo(m_srcRows[0].first);
 
-  // 1st activate: compute majority
+  // sanity check
   std::unordered_set<unsigned> visitedRows;
-  for (unsigned i = 0; i < objSrc.getRegions().size(); ++i) {
-    const pimRegion& srcRegion = objSrc.getRegions()[i];
-    PimCoreId coreId = srcRegion.getCoreId();
+  for (const auto& objOfst : m_srcRows) {
+    if (!isValidObjId(resMgr, objOfst.first)) {
+      return false;
+    }
+    const pimObjInfo& obj = resMgr->getObjInfo(objOfst.first);
+    if (!isAssociated(objSrc, obj)) {
+      return false;
+    }
+    unsigned idx = obj.getRegions()[0].getRowIdx() + objOfst.second;
+    if (!visitedRows.insert(idx).second) {
+      std::printf("PIM-Error: Cannot access same src row multiple times during AP/AAP\n");
+      return false;
+    }
+  }
+  for (const auto& objOfst : m_destRows) {
+    if (!isValidObjId(resMgr, objOfst.first)) {
+      return false;
+    }
+    const pimObjInfo& obj = resMgr->getObjInfo(objOfst.first);
+    if (!isAssociated(objSrc, obj)) {
+      return false;
+    }
+    unsigned idx = obj.getRegions()[0].getRowIdx() + objOfst.second;
+    if (!visitedRows.insert(idx).second) {
+      std::printf("PIM-Error: Cannot access same src/dest row multiple times during AP/AAP\n");
+      return false;
+    }
+  }
+
+  // all involved rows are overwritten. sync other rows of these objects before that
+  for (const auto& objOfst : m_srcRows) {
+    resMgr->getObjInfo(objOfst.first).syncToSimulatedMem();
+  }
+  for (const auto& objOfst : m_destRows) {
+    resMgr->getObjInfo(objOfst.first).syncToSimulatedMem();
+  }
+
+  // regions on the same core share row SAs, so process cores in parallel and regions of a core in order
+  m_regionIdxsPerCore = objSrc.getRegionIdxsPerCore();
+  computeAllRegions(m_regionIdxsPerCore.size());
+
+  for (const auto& objOfst : m_srcRows) {
+    resMgr->getObjInfo(objOfst.first).markSimulatedMemModified();
+  }
+  for (const auto& objOfst : m_destRows) {
+    resMgr->getObjInfo(objOfst.first).markSimulatedMemModified();
+  }
+
+  // Update stats
+  std::string cmdName = getName();
+  cmdName += "@" + std::to_string(m_srcRows.size()) + "," + std::to_string(m_destRows.size());
+  pimeval::perfEnergy prfEnrgy;
+  getStatsMgr()->recordCmd(cmdName, prfEnrgy);
+  return true;
+}
+
+//! @brief  Pim CMD: SIMDRAM: AP/AAP on all regions of a core
+bool
+pimCmdAnalogAAP::computeRegion(unsigned index)
+{
+  pimResMgr* resMgr = m_device->getResMgr();
+  const pimObjInfo& objSrc = resMgr->getObjInfo(m_srcRows[0].first);
+  std::vector<std::pair<unsigned, bool>> rowIdxs;
+  for (size_t i : m_regionIdxsPerCore[index]) {
+    PimCoreId coreId = objSrc.getRegions()[i].getCoreId();
     pimCore &core = m_device->getCore(coreId);
 
-    std::vector<std::pair<unsigned, bool>> rowIdxs;
+    // 1st activate: compute majority
+    rowIdxs.clear();
     for (const auto& objOfst : m_srcRows) {
-      if (!isValidObjId(resMgr, objOfst.first)) {
-        return false;
-      }
       const pimObjInfo& obj = resMgr->getObjInfo(objOfst.first);
-      if (!isAssociated(objSrc, obj)) {
-        return false;
-      }
-      unsigned ofst = objOfst.second;
-      unsigned idx = obj.getRegions()[i].getRowIdx() + ofst;
-      bool isDCCN = obj.isDualContactRef();
-      rowIdxs.emplace_back(idx, isDCCN);
-      if (i == 0) { // sanity check
-        if (visitedRows.find(idx) == visitedRows.end()) {
-          visitedRows.insert(idx);
-        } else {
-          std::printf("PIM-Error: Cannot access same src row multiple times during AP/AAP\n");
-          return false;
-        }
-      }
+      rowIdxs.emplace_back(obj.getRegions()[i].getRowIdx() + objOfst.second, obj.isDualContactRef());
     }
     core.readMultiRows(rowIdxs);
-  }
 
-  // 2nd activate: write multiple rows
-  if (!m_destRows.empty()) {
-    for (unsigned i = 0; i < objSrc.getRegions().size(); ++i) {
-      const pimRegion& srcRegion = objSrc.getRegions()[i];
-      PimCoreId coreId = srcRegion.getCoreId();
-      pimCore &core = m_device->getCore(coreId);
-
-      std::vector<std::pair<unsigned, bool>> rowIdxs;
+    // 2nd activate: write multiple rows
+    if (!m_destRows.empty()) {
+      rowIdxs.clear();
       for (const auto& objOfst : m_destRows) {
-        if (!isValidObjId(resMgr, objOfst.first)) {
-          return false;
-        }
         const pimObjInfo& obj = resMgr->getObjInfo(objOfst.first);
-        if (!isAssociated(objSrc, obj)) {
-          return false;
-        }
-        unsigned ofst = objOfst.second;
-        unsigned idx = obj.getRegions()[i].getRowIdx() + ofst;
-        bool isDCCN = obj.isDualContactRef();
-        rowIdxs.emplace_back(idx, isDCCN);
-        if (i == 0) { // sanity check
-          if (visitedRows.find(idx) == visitedRows.end()) {
-            visitedRows.insert(idx);
-          } else {
-            std::printf("PIM-Error: Cannot access same src/dest row multiple times during AP/AAP\n");
-            return false;
-          }
-        }
+        rowIdxs.emplace_back(obj.getRegions()[i].getRowIdx() + objOfst.second, obj.isDualContactRef());
       }
       core.writeMultiRows(rowIdxs);
     }
   }
-
-  // Update stats
-  std::string cmdName = getName();
-  cmdName += "@" + std::to_string(m_srcRows.size()) + "," + std::to_string(m_destRows.size());
-  pimeval::perfEnergy prfEnrgy;
-  pimSim::get()->getStatsMgr()->recordCmd(cmdName, prfEnrgy);
   return true;
 }
 
@@ -1889,6 +1961,49 @@ pimCmdAnalogAAP::printDebugInfo() const
               getName().c_str(), m_srcRows.size(), m_destRows.size(), msg.c_str());
 }
 
+//! @brief  Pim CMD: BitSIMD-V: Sanity check of all micro ops in a batch
+bool
+pimCmdOpBatch::sanityCheck() const
+{
+  pimResMgr* resMgr = m_device->getResMgr();
+  for (size_t i = 0; i < m_ops.size(); ++i) {
+    if (!pimMicroKernel::isValidOp(m_ops[i], resMgr)) {
+      std::printf("PIM-Error: Invalid micro op at index %lu of the batch\n", i);
+      return false;
+    }
+  }
+  return true;
+}
+
+//! @brief  Pim CMD: BitSIMD-V: Execute a batch of micro ops as a one-time micro-kernel
+bool
+pimCmdOpBatch::execute()
+{
+  if (m_debugCmds) {
+    std::printf("PIM-MicroOp: BitSIMD-V %s (#ops = %lu)\n", getName().c_str(), m_ops.size());
+  }
+
+  if (!sanityCheck()) {
+    return false;
+  }
+
+  // all objects in the batch are kernel parameters in the order of first use
+  std::vector<PimObjId> objIds;
+  std::unordered_set<PimObjId> visitedObjIds;
+  for (const PimMicroOp& op : m_ops) {
+    if (visitedObjIds.insert(op.objId).second) {
+      objIds.push_back(op.objId);
+    }
+  }
+  pimMicroKernel kernel(objIds);
+  for (const PimMicroOp& op : m_ops) {
+    kernel.addOp(op, m_device->getResMgr());
+  }
+  pimCmdMicroKernel cmd(PimCmdEnum::MICRO_KERNEL, kernel, objIds, 0);
+  cmd.setDevice(m_device);
+  return cmd.execute();
+}
+
 template class pimCmdReduction<int8_t>;
 template class pimCmdReduction<int16_t>;
 template class pimCmdReduction<int32_t>;
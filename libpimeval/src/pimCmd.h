@@ -19,6 +19,8 @@
 #include <variant>
 
 class pimDevice;
+class pimStatsMgr;
+class pimPerfEnergyBase;
 
 
 enum class PimCmdEnum {
@@ -107,6 +109,8 @@ enum class PimCmdEnum {
   // SIMDRAM
   ROW_AP,
   ROW_AAP,
+  OP_BATCH,
+  MICRO_KERNEL,
 };
 
 
@@ -119,7 +123,13 @@ public:
   virtual ~pimCmd() {}
 
   void setDevice(pimDevice* device) { m_device = device; }
+  pimSim* getSim() const { return m_sim; }
   virtual bool execute() = 0;
+  bool updateStatsOnDevice(pimDevice* device, pimStatsMgr* statsMgr);
+  bool isMicroOp() const;
+  PimCmdEnum getCmdType() const { return m_cmdType; }
+  //! @brief  Get PIM objects read and written by this command, for modeling dependencies between commands
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const {}
 
   std::string getName() const {
     return getName(m_cmdType, "");
@@ -129,6 +139,15 @@ public:
     suffix += isVLayout ? ".v" : ".h";
     return getName(m_cmdType, suffix);
   }
+  std::string getName(const pimObjInfo& obj) const {
+    if (!obj.isCustomInt()) {
+      return getName(obj.getDataType(), obj.isVLayout());
+    }
+    std::string suffix = pimUtils::isSigned(obj.getDataType()) ? ".int" : ".uint";
+    suffix += std::to_string(obj.getNumCustomBits());
+    suffix += obj.isVLayout() ? ".v" : ".h";
+    return getName(m_cmdType, suffix);
+  }
   static std::string getName(PimCmdEnum cmdType, const std::string& suffix);
 
 protected:
@@ -143,6 +162,8 @@ protected:
   virtual bool computeRegion(unsigned index) { return false; }
   virtual bool updateStats() const { return false; }
   bool computeAllRegions(unsigned numRegions);
+  pimPerfEnergyBase* getPerfEnergyModel() const;
+  pimStatsMgr* getStatsMgr() const;
 
   //! @brief  Utility: Get bits of an element from a region. The bits are stored as uint64_t without sign extension
   inline uint64_t getBits(const pimCore& core, bool isVLayout, unsigned rowLoc, unsigned colLoc, unsigned numBits) const
@@ -161,7 +182,9 @@ protected:
   }
 
   PimCmdEnum m_cmdType;
+  pimSim* m_sim = nullptr;
   pimDevice* m_device = nullptr;
+  pimStatsMgr* m_statsMgr = nullptr;  // stats of an extra simulation target while it is being modeled
   bool m_debugCmds;
 
   //! @class  pimCmd::regionWorker
@@ -195,6 +218,10 @@ public:
   virtual bool execute() override;
   virtual bool sanityCheck() const override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    if (m_src != -1) { srcObjIds.push_back(m_src); }
+    if (m_dest != -1) { destObjIds.push_back(m_dest); }
+  }
 protected:
   PimCopyEnum m_copyType;
   void* m_ptr = nullptr;
@@ -219,6 +246,10 @@ public:
   virtual bool sanityCheck() const override;
   virtual bool computeRegion(unsigned index) override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_src };
+    destObjIds = { m_dest };
+  }
 protected:
   PimObjId m_src;
   PimObjId m_dest;
@@ -258,6 +289,11 @@ private:
         case 32: result = std::bitset<32>(operand).count(); break;
         case 64: result = std::bitset<64>(operand).count(); break;
         default:
+            // custom bit-width integers
+            if (bitsPerElementSrc > 0 && bitsPerElementSrc < 64) {
+              result = std::bitset<64>(static_cast<uint64_t>(operand) & ((1ULL << bitsPerElementSrc) - 1)).count();
+              break;
+            }
             std::printf("PIM-Error: Unsupported bits per element %u\n", bitsPerElementSrc);
             return false;
         }
@@ -349,6 +385,10 @@ public:
   virtual bool sanityCheck() const override;
   virtual bool computeRegion(unsigned index) override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_src1, m_src2 };
+    destObjIds = { m_dest };
+  }
 protected:
   PimObjId m_src1;
   PimObjId m_src2;
@@ -454,6 +494,10 @@ public:
   virtual bool sanityCheck() const override;
   virtual bool computeRegion(unsigned index) override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_condBool, m_src1, m_src2 };
+    destObjIds = { m_dest };
+  }
 protected:
   PimObjId m_condBool;
   PimObjId m_src1 = -1;
@@ -484,6 +528,9 @@ public:
   virtual bool sanityCheck() const override;
   virtual bool computeRegion(unsigned index) override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_src };
+  }
 protected:
   PimObjId m_src;
   void* m_result;
@@ -507,6 +554,10 @@ public:
   virtual bool sanityCheck() const override;
   virtual bool computeRegion(unsigned index) override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_src };
+    destObjIds = { m_dst };
+  }
 protected:
   PimObjId m_src, m_dst;
 };
@@ -527,6 +578,9 @@ public:
   virtual bool sanityCheck() const override;
   virtual bool computeRegion(unsigned index) override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_src1, m_src2 };
+  }
 protected:
   std::vector<T> m_regionResult;
   PimObjId m_src1, m_src2;
@@ -549,6 +603,9 @@ public:
   virtual bool sanityCheck() const override;
   virtual bool computeRegion(unsigned index) override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    destObjIds = { m_dest };
+  }
 protected:
   PimObjId m_dest;
   uint64_t m_signExtBits;
@@ -570,6 +627,10 @@ public:
   virtual bool sanityCheck() const override;
   virtual bool computeRegion(unsigned index) override;
   virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_src };
+    destObjIds = { m_src };
+  }
 protected:
   PimObjId m_src;
   std::vector<uint64_t> m_regionBoundary;
@@ -584,6 +645,9 @@ public:
     : pimCmd(cmdType), m_objId(objId), m_ofst(ofst) {}
   virtual ~pimCmdReadRowToSa() {}
   virtual bool execute() override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_objId };
+  }
 protected:
   PimObjId m_objId;
   unsigned m_ofst;
@@ -598,6 +662,9 @@ public:
     : pimCmd(cmdType), m_objId(objId), m_ofst(ofst) {}
   virtual ~pimCmdWriteSaToRow() {}
   virtual bool execute() override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    destObjIds = { m_objId };
+  }
 protected:
   PimObjId m_objId;
   unsigned m_ofst;
@@ -629,6 +696,11 @@ public:
   }
   virtual ~pimCmdRRegOp() {}
   virtual bool execute() override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_objId };
+  }
+  static void computeCore(pimCore& core, PimCmdEnum cmdType, PimRowReg destReg,
+                          PimRowReg src1Reg, PimRowReg src2Reg, PimRowReg src3Reg, bool val);
 protected:
   PimObjId m_objId;
   PimRowReg m_dest;
@@ -647,6 +719,10 @@ public:
     : pimCmd(cmdType), m_objId(objId), m_dest(dest) {}
   virtual ~pimCmdRRegRotate() {}
   virtual bool execute() override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = { m_objId };
+  }
+  static void rotateRowReg(pimDevice* device, const pimObjInfo& objSrc, PimCmdEnum cmdType, PimRowReg reg);
 protected:
   PimObjId m_objId;
   PimRowReg m_dest;
@@ -666,11 +742,37 @@ public:
   }
   virtual ~pimCmdAnalogAAP() {}
   virtual bool execute() override;
+  virtual bool computeRegion(unsigned index) override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    for (const auto& [objId, ofst] : m_srcRows) { srcObjIds.push_back(objId); }
+    for (const auto& [objId, ofst] : m_destRows) { destObjIds.push_back(objId); }
+  }
 protected:
   void printDebugInfo() const;
   std::vector<std::pair<PimObjId, unsigned>> m_srcRows;
   std::vector<std::pair<PimObjId, unsigned>> m_destRows;
+  std::vector<std::vector<size_t>> m_regionIdxsPerCore;
 };
 
-#endif
+//! @class  pimCmdOpBatch
+//! @brief  Pim CMD: BitSIMD-V: A batch of micro ops executed in one command
+class pimCmdOpBatch : public pimCmd
+{
+public:
+  pimCmdOpBatch(PimCmdEnum cmdType, const PimMicroOp* ops, unsigned numOps)
+    : pimCmd(cmdType), m_ops(ops, ops + numOps)
+  {
+    assert(cmdType == PimCmdEnum::OP_BATCH);
+  }
+  virtual ~pimCmdOpBatch() {}
+  virtual bool execute() override;
+  virtual bool sanityCheck() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    for (const PimMicroOp& op : m_ops) { srcObjIds.push_back(op.objId); }
+    destObjIds = srcObjIds;
+  }
+protected:
+  std::vector<PimMicroOp> m_ops;
+};
 
+#endif
@@ -0,0 +1,571 @@
+// File: pimCmdMicroKernel.cpp
+// PIMeval Simulator - PIM Micro-Kernel Recording and Replay
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "pimCmdMicroKernel.h"
+#include "pimSim.h"
+#include "pimDevice.h"
+#include "pimCore.h"
+#include <cstdio>
+#include <algorithm>
+#include <tuple>
+#include <unordered_set>
+
+
+//! @brief  pimMicroKernel ctor
+pimMicroKernel::pimMicroKernel(const std::vector<PimObjId>& params)
+  : m_params(params),
+    m_numRowsUsed(params.size()),
+    m_isParamWritten(params.size())
+{
+  for (unsigned i = 0; i < m_params.size(); ++i) {
+    m_paramIdxs[m_params[i]] = i;
+  }
+}
+
+//! @brief  Map a micro op type to a PIM command type
+PimCmdEnum
+pimMicroKernel::getCmdType(PimMicroOpEnum opType)
+{
+  switch (opType) {
+  case PIM_MICRO_OP_READ_ROW_TO_SA: return PimCmdEnum::ROW_R;
+  case PIM_MICRO_OP_WRITE_SA_TO_ROW: return PimCmdEnum::ROW_W;
+  case PIM_MICRO_OP_MOV: return PimCmdEnum::RREG_MOV;
+  case PIM_MICRO_OP_SET: return PimCmdEnum::RREG_SET;
+  case PIM_MICRO_OP_NOT: return PimCmdEnum::RREG_NOT;
+  case PIM_MICRO_OP_AND: return PimCmdEnum::RREG_AND;
+  case PIM_MICRO_OP_OR: return PimCmdEnum::RREG_OR;
+  case PIM_MICRO_OP_NAND: return PimCmdEnum::RREG_NAND;
+  case PIM_MICRO_OP_NOR: return PimCmdEnum::RREG_NOR;
+  case PIM_MICRO_OP_XOR: return PimCmdEnum::RREG_XOR;
+  case PIM_MICRO_OP_XNOR: return PimCmdEnum::RREG_XNOR;
+  case PIM_MICRO_OP_MAJ: return PimCmdEnum::RREG_MAJ;
+  case PIM_MICRO_OP_SEL: return PimCmdEnum::RREG_SEL;
+  case PIM_MICRO_OP_ROTATE_R: return PimCmdEnum::RREG_ROTATE_R;
+  case PIM_MICRO_OP_ROTATE_L: return PimCmdEnum::RREG_ROTATE_L;
+  }
+  return PimCmdEnum::NOOP;
+}
+
+//! @brief  Check if a micro op is valid, i.e., known op type, valid object, row offset and row regs
+bool
+pimMicroKernel::isValidOp(const PimMicroOp& op, pimResMgr* resMgr)
+{
+  PimCmdEnum cmdType = getCmdType(op.opType);
+  if (cmdType == PimCmdEnum::NOOP) {
+    std::printf("PIM-Error: Unknown micro op type %d\n", static_cast<int>(op.opType));
+    return false;
+  }
+  if (!resMgr->isValidObjId(op.objId)) {
+    std::printf("PIM-Error: Invalid object id %d\n", op.objId);
+    return false;
+  }
+  const pimObjInfo& obj = resMgr->getObjInfo(op.objId);
+  unsigned numSrcRegs = 0;
+  switch (cmdType) {
+  case PimCmdEnum::ROW_R:
+  case PimCmdEnum::ROW_W:
+    if (op.ofst >= obj.getRegions()[0].getNumAllocRows()) {
+      std::printf("PIM-Error: Row offset %u out of range [0, %u)\n", op.ofst, obj.getRegions()[0].getNumAllocRows());
+      return false;
+    }
+    return true;
+  case PimCmdEnum::RREG_MOV: case PimCmdEnum::RREG_NOT:
+    numSrcRegs = 1; break;
+  case PimCmdEnum::RREG_MAJ: case PimCmdEnum::RREG_SEL:
+    numSrcRegs = 3; break;
+  case PimCmdEnum::RREG_SET: case PimCmdEnum::RREG_ROTATE_R: case PimCmdEnum::RREG_ROTATE_L:
+    numSrcRegs = 0; break;
+  default:
+    numSrcRegs = 2;
+  }
+  auto isValidReg = [](PimRowReg reg) { return reg > PIM_RREG_NONE && reg < PIM_RREG_MAX; };
+  if (!isValidReg(op.dest) || (numSrcRegs >= 1 && !isValidReg(op.src1)) ||
+      (numSrcRegs >= 2 && !isValidReg(op.src2)) || (numSrcRegs >= 3 && !isValidReg(op.src3))) {
+    std::printf("PIM-Error: Invalid row reg of %s\n", pimCmd::getName(cmdType, "").c_str());
+    return false;
+  }
+  return true;
+}
+
+//! @brief  Append a micro op to the kernel. The object of the micro op must be a kernel parameter
+bool
+pimMicroKernel::addOp(const PimMicroOp& op, pimResMgr* resMgr)
+{
+  if (!isValidOp(op, resMgr)) {
+    m_hasError = true;
+    return false;
+  }
+  auto it = m_paramIdxs.find(op.objId);
+  if (it == m_paramIdxs.end()) {
+    std::printf("PIM-Error: Object id %d is not a parameter of the micro-kernel\n", op.objId);
+    m_hasError = true;
+    return false;
+  }
+  m_ops.push_back({getCmdType(op.opType), it->second, op.ofst, op.dest, op.src1, op.src2, op.src3, op.val});
+  const microOp& newOp = m_ops.back();
+  if (newOp.m_cmdType == PimCmdEnum::ROW_R || newOp.m_cmdType == PimCmdEnum::ROW_W) {
+    m_numRowsUsed[newOp.m_paramIdx] = std::max(m_numRowsUsed[newOp.m_paramIdx], newOp.m_ofst + 1);
+  }
+  if (newOp.m_cmdType == PimCmdEnum::ROW_W) {
+    m_isParamWritten[newOp.m_paramIdx] = true;
+  }
+  if (newOp.m_cmdType == PimCmdEnum::RREG_ROTATE_R || newOp.m_cmdType == PimCmdEnum::RREG_ROTATE_L) {
+    m_hasRotate = true;
+  }
+  m_numCmds[newOp.m_cmdType]++;
+  return true;
+}
+
+//! @brief  Add an object allocated during recording as a kernel-local object.
+//!         Each run allocates it associated with the same parameter, and frees it afterwards
+bool
+pimMicroKernel::addLocal(PimObjId objId, PimObjId assocId, PimDataType dataType, unsigned numCustomBits)
+{
+  auto it = m_paramIdxs.find(assocId);
+  if (it == m_paramIdxs.end()) {
+    std::printf("PIM-Error: Object id %d allocated during micro-kernel recording is not associated with a parameter\n", objId);
+    m_hasError = true;
+    return false;
+  }
+  m_locals.push_back({it->second, dataType, numCustomBits});
+  m_paramIdxs[objId] = static_cast<unsigned>(getNumObjs() - 1);
+  m_numRowsUsed.push_back(0);
+  m_isParamWritten.push_back(false);
+  return true;
+}
+
+//! @brief  Count row reads, row writes and logic micro ops
+void
+pimMicroKernel::countOps(const std::vector<microOp>& ops, unsigned& numR, unsigned& numW, unsigned& numL)
+{
+  numR = 0;
+  numW = 0;
+  numL = 0;
+  for (const auto& op : ops) {
+    if (op.m_cmdType == PimCmdEnum::ROW_R) {
+      numR++;
+    } else if (op.m_cmdType == PimCmdEnum::ROW_W) {
+      numW++;
+    } else {
+      numL++;
+    }
+  }
+}
+
+//! @brief  Get micro op counts, as recorded and after optimization
+PimMicroKernelStats
+pimMicroKernel::getStats() const
+{
+  PimMicroKernelStats stats;
+  countOps(m_ops, stats.numRead, stats.numWrite, stats.numLogic);
+  if (m_isOptimized) {
+    stats.numRecordedRead = m_numRecordedR;
+    stats.numRecordedWrite = m_numRecordedW;
+    stats.numRecordedLogic = m_numRecordedL;
+  } else {
+    stats.numRecordedRead = stats.numRead;
+    stats.numRecordedWrite = stats.numWrite;
+    stats.numRecordedLogic = stats.numLogic;
+  }
+  return stats;
+}
+
+//! @brief  Peephole optimization of recorded micro ops. This assumes all objects are distinct and
+//!         associated, i.e., all micro ops run on the same cores. Rows of parameters are live after
+//!         a run, while rows of kernel-local objects are not. Row regs are live after a run if isRegLiveOut
+void
+pimMicroKernel::optimize(bool isRegLiveOut)
+{
+  if (!m_isOptimized) {
+    countOps(m_ops, m_numRecordedR, m_numRecordedW, m_numRecordedL);
+    m_isOptimized = true;
+  }
+  // each pass may expose more opportunities to the other
+  const int maxIters = 8;
+  for (int iter = 0; iter < maxIters; ++iter) {
+    bool changed = peepholeForward();
+    changed |= peepholeBackward(isRegLiveOut);
+    if (!changed) {
+      break;
+    }
+  }
+  updateOpInfo();
+}
+
+//! @brief  Forward peephole pass with value numbering of row regs and rows:
+//!         - Remove micro ops which assign a value already held by the destination, e.g., re-reading a resident row
+//!         - Replace a row read with a move if a row reg holds the same row
+//!         - Read sources from the row reg where a value is first produced, so that move chains become dead
+bool
+pimMicroKernel::peepholeForward()
+{
+  bool changed = false;
+  int numVals = 0;
+  std::vector<int> regVals(PIM_RREG_MAX);
+  for (auto& val : regVals) {
+    val = numVals++;  // unknown initial values
+  }
+  std::map<std::pair<unsigned, unsigned>, int> rowVals;
+  std::map<std::tuple<PimCmdEnum, int, int, int, bool>, int> exprVals;
+  std::unordered_map<int, PimRowReg> origins;  // value -> a row reg holding it, preferably where it is produced
+
+  auto getRowVal = [&](unsigned paramIdx, unsigned ofst) {
+    auto [it, isNew] = rowVals.try_emplace({paramIdx, ofst}, numVals);
+    if (isNew) {
+      numVals++;
+    }
+    return it->second;
+  };
+  auto findHolder = [&](int val, PimRowReg exclude) {
+    for (int reg = PIM_RREG_SA; reg < PIM_RREG_MAX; ++reg) {
+      if (reg != exclude && regVals[reg] == val) {
+        return static_cast<PimRowReg>(reg);
+      }
+    }
+    return PIM_RREG_NONE;
+  };
+  auto setRegVal = [&](PimRowReg reg, int val) {
+    int oldVal = regVals[reg];
+    regVals[reg] = val;
+    auto it = origins.find(oldVal);
+    if (it != origins.end() && it->second == reg) {
+      PimRowReg holder = findHolder(oldVal, reg);
+      if (holder == PIM_RREG_NONE) {
+        origins.erase(it);
+      } else {
+        it->second = holder;
+      }
+    }
+    origins.try_emplace(val, reg);
+  };
+  auto getSrcReg = [&](PimRowReg reg) {
+    auto it = origins.find(regVals[reg]);
+    return it == origins.end() ? reg : it->second;
+  };
+
+  std::vector<microOp> newOps;
+  for (microOp op : m_ops) {
+    switch (op.m_cmdType) {
+    case PimCmdEnum::ROW_R:
+    {
+      int val = getRowVal(op.m_paramIdx, op.m_ofst);
+      if (regVals[PIM_RREG_SA] == val) {
+        changed = true;
+        continue;
+      }
+      PimRowReg holder = findHolder(val, PIM_RREG_SA);
+      if (holder != PIM_RREG_NONE) {
+        op = {PimCmdEnum::RREG_MOV, op.m_paramIdx, 0, PIM_RREG_SA, holder, PIM_RREG_NONE, PIM_RREG_NONE, false};
+        changed = true;
+      }
+      setRegVal(PIM_RREG_SA, val);
+      break;
+    }
+    case PimCmdEnum::ROW_W:
+    {
+      int val = regVals[PIM_RREG_SA];
+      if (getRowVal(op.m_paramIdx, op.m_ofst) == val) {
+        changed = true;
+        continue;
+      }
+      rowVals[{op.m_paramIdx, op.m_ofst}] = val;
+      break;
+    }
+    case PimCmdEnum::RREG_ROTATE_R:
+    case PimCmdEnum::RREG_ROTATE_L:
+      setRegVal(op.m_dest, numVals++);
+      break;
+    default:
+    {
+      PimRowReg* srcs[3] = { &op.m_src1, &op.m_src2, &op.m_src3 };
+      int srcVals[3] = { -1, -1, -1 };
+      for (int i = 0; i < 3; ++i) {
+        if (*srcs[i] != PIM_RREG_NONE) {
+          srcVals[i] = regVals[*srcs[i]];
+          PimRowReg srcReg = getSrcReg(*srcs[i]);
+          changed |= (srcReg != *srcs[i]);
+          *srcs[i] = srcReg;
+        }
+      }
+      int val = 0;
+      if (op.m_cmdType == PimCmdEnum::RREG_MOV) {
+        val = srcVals[0];
+      } else {
+        switch (op.m_cmdType) {
+        case PimCmdEnum::RREG_AND: case PimCmdEnum::RREG_OR: case PimCmdEnum::RREG_NAND:
+        case PimCmdEnum::RREG_NOR: case PimCmdEnum::RREG_XOR: case PimCmdEnum::RREG_XNOR:
+          std::sort(srcVals, srcVals + 2);
+          break;
+        case PimCmdEnum::RREG_MAJ:
+          std::sort(srcVals, srcVals + 3);
+          break;
+        default:
+          break;
+        }
+        auto [it, isNew] = exprVals.try_emplace({op.m_cmdType, srcVals[0], srcVals[1], srcVals[2], op.m_val}, numVals);
+        if (isNew) {
+          numVals++;
+        }
+        val = it->second;
+      }
+      if (regVals[op.m_dest] == val) {
+        changed = true;
+        continue;
+      }
+      setRegVal(op.m_dest, val);
+    }
+    }
+    newOps.push_back(op);
+  }
+  m_ops.swap(newOps);
+  return changed;
+}
+
+//! @brief  Backward peephole pass: remove micro ops whose results are never used, e.g.,
+//!         row writes overwritten before being read, and dead moves
+bool
+pimMicroKernel::peepholeBackward(bool isRegLiveOut)
+{
+  bool changed = false;
+  std::vector<bool> isRegLive(PIM_RREG_MAX, isRegLiveOut);
+  std::map<std::pair<unsigned, unsigned>, bool> isRowLive;
+  auto getRowLive = [&](unsigned paramIdx, unsigned ofst) {
+    auto it = isRowLive.find({paramIdx, ofst});
+    return it == isRowLive.end() ? paramIdx < getNumParams() : it->second;
+  };
+
+  std::vector<microOp> newOps;
+  for (auto it = m_ops.rbegin(); it != m_ops.rend(); ++it) {
+    const microOp& op = *it;
+    switch (op.m_cmdType) {
+    case PimCmdEnum::ROW_W:
+      if (!getRowLive(op.m_paramIdx, op.m_ofst)) {
+        changed = true;
+        continue;
+      }
+      isRowLive[{op.m_paramIdx, op.m_ofst}] = false;
+      isRegLive[PIM_RREG_SA] = true;
+      break;
+    case PimCmdEnum::ROW_R:
+      if (!isRegLive[PIM_RREG_SA]) {
+        changed = true;
+        continue;
+      }
+      isRegLive[PIM_RREG_SA] = false;
+      isRowLive[{op.m_paramIdx, op.m_ofst}] = true;
+      break;
+    case PimCmdEnum::RREG_ROTATE_R:
+    case PimCmdEnum::RREG_ROTATE_L:
+      if (!isRegLive[op.m_dest]) {
+        changed = true;
+        continue;
+      }
+      break;
+    default:
+      if (!isRegLive[op.m_dest]) {
+        changed = true;
+        continue;
+      }
+      isRegLive[op.m_dest] = false;
+      for (PimRowReg src : { op.m_src1, op.m_src2, op.m_src3 }) {
+        if (src != PIM_RREG_NONE) {
+          isRegLive[src] = true;
+        }
+      }
+    }
+    newOps.push_back(op);
+  }
+  std::reverse(newOps.begin(), newOps.end());
+  m_ops.swap(newOps);
+  return changed;
+}
+
+//! @brief  Update row usage and micro op counts after optimization
+void
+pimMicroKernel::updateOpInfo()
+{
+  std::fill(m_numRowsUsed.begin(), m_numRowsUsed.end(), 0);
+  std::fill(m_isParamWritten.begin(), m_isParamWritten.end(), false);
+  m_hasRotate = false;
+  m_numCmds.clear();
+  for (const auto& op : m_ops) {
+    if (op.m_cmdType == PimCmdEnum::ROW_R || op.m_cmdType == PimCmdEnum::ROW_W) {
+      m_numRowsUsed[op.m_paramIdx] = std::max(m_numRowsUsed[op.m_paramIdx], op.m_ofst + 1);
+    }
+    if (op.m_cmdType == PimCmdEnum::ROW_W) {
+      m_isParamWritten[op.m_paramIdx] = true;
+    }
+    if (op.m_cmdType == PimCmdEnum::RREG_ROTATE_R || op.m_cmdType == PimCmdEnum::RREG_ROTATE_L) {
+      m_hasRotate = true;
+    }
+    m_numCmds[op.m_cmdType]++;
+  }
+}
+
+//! @brief  Pim CMD: BitSIMD-V: Check if objects can be bound to micro-kernel parameters
+bool
+pimCmdMicroKernel::sanityCheck() const
+{
+  pimResMgr* resMgr = m_device->getResMgr();
+  if (m_objIds.size() != m_kernel.getNumObjs()) {
+    std::printf("PIM-Error: Micro-kernel expects %lu objects but %lu are given\n", m_kernel.getNumObjs(), m_objIds.size());
+    return false;
+  }
+  for (unsigned i = 0; i < m_objIds.size(); ++i) {
+    if (!isValidObjId(resMgr, m_objIds[i])) {
+      return false;
+    }
+    const pimObjInfo& obj = resMgr->getObjInfo(m_objIds[i]);
+    unsigned numAllocRows = obj.getRegions()[0].getNumAllocRows();
+    if (m_kernel.isParamRowAccessed(i) && m_kernel.getNumRowsUsed(i) + m_ofstShift > numAllocRows) {
+      std::printf("PIM-Error: Row offset %u out of range [0, %u) for object id %d\n",
+                  m_kernel.getNumRowsUsed(i) - 1 + m_ofstShift, numAllocRows, m_objIds[i]);
+      return false;
+    }
+  }
+  // optimized micro ops assume distinct objects on the same cores.
+  // A reference shares rows with its ref object, so it is distinct only if its ref object is not bound
+  if (m_kernel.isOptimized()) {
+    std::unordered_set<PimObjId> visitedObjIds;
+    for (PimObjId objId : m_objIds) {
+      PimObjId refObjId = resMgr->getObjInfo(objId).getRefObjId();
+      PimObjId baseObjId = (refObjId != -1 ? refObjId : objId);
+      if (!visitedObjIds.insert(baseObjId).second) {
+        std::printf("PIM-Error: Optimized micro-kernel cannot bind object id %d or its references to multiple parameters\n", baseObjId);
+        return false;
+      }
+      if (resMgr->getObjInfo(objId).getAssocObjId() != resMgr->getObjInfo(m_objIds[0]).getAssocObjId()) {
+        std::printf("PIM-Error: Optimized micro-kernel requires associated objects\n");
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//! @brief  Pim CMD: BitSIMD-V: Replay a micro-kernel
+bool
+pimCmdMicroKernel::execute()
+{
+  if (m_debugCmds) {
+    std::printf("PIM-MicroOp: BitSIMD-V %s (#ops = %lu, #objs = %lu, ofst-shift = %u)\n",
+                getName().c_str(), m_kernel.getOps().size(), m_objIds.size(), m_ofstShift);
+  }
+
+  if (!sanityCheck()) {
+    return false;
+  }
+  if (m_objIds.empty()) {
+    return updateStats();
+  }
+
+  // bind objects and pre-resolve row indices, so that replay has no per-op lookup
+  pimResMgr* resMgr = m_device->getResMgr();
+  bool isPerCore = !m_kernel.hasRotate();
+  m_objs.clear();
+  m_rowBases.assign(m_objIds.size(), {});
+  for (unsigned i = 0; i < m_objIds.size(); ++i) {
+    const pimObjInfo& obj = resMgr->getObjInfo(m_objIds[i]);
+    m_objs.push_back(&obj);
+    if (obj.getAssocObjId() != m_objs[0]->getAssocObjId()) {
+      isPerCore = false;
+    }
+    if (m_kernel.isParamRowAccessed(i)) {
+      for (const pimRegion& region : obj.getRegions()) {
+        m_rowBases[i].push_back(region.getRowIdx() + m_ofstShift);
+      }
+      // row reads and writes access simulated memory directly
+      obj.syncToSimulatedMem();
+    }
+  }
+
+  if (isPerCore) {
+    // associated objects share the same cores, so each core runs the whole kernel independently
+    m_regionIdxsPerCore = m_objs[0]->getRegionIdxsPerCore();
+    if (m_sim->getNumThreads() > 1 && m_regionIdxsPerCore.size() > 1) { // MT
+      std::vector<pimUtils::threadWorker*> workers;
+      for (unsigned i = 0; i < m_regionIdxsPerCore.size(); ++i) {
+        workers.push_back(new regionWorker(this, i));
+      }
+      m_sim->getThreadPool()->doWork(workers);
+      for (auto worker : workers) {
+        delete worker;
+      }
+    } else { // single thread
+      for (unsigned i = 0; i < m_regionIdxsPerCore.size(); ++i) {
+        computeRegion(i);
+      }
+    }
+  } else {
+    // rotation moves bits across cores, so replay micro ops one by one
+    std::vector<std::vector<std::vector<size_t>>> regionIdxsPerCoreOfParam(m_objs.size());
+    for (unsigned i = 0; i < m_objs.size(); ++i) {
+      regionIdxsPerCoreOfParam[i] = m_objs[i]->getRegionIdxsPerCore();
+    }
+    for (const auto& op : m_kernel.getOps()) {
+      const pimObjInfo& obj = *m_objs[op.m_paramIdx];
+      if (op.m_cmdType == PimCmdEnum::RREG_ROTATE_R || op.m_cmdType == PimCmdEnum::RREG_ROTATE_L) {
+        pimCmdRRegRotate::rotateRowReg(m_device, obj, op.m_cmdType, op.m_dest);
+        continue;
+      }
+      for (const auto& regionIdxs : regionIdxsPerCoreOfParam[op.m_paramIdx]) {
+        executeOp(op, m_device->getCore(obj.getRegions()[regionIdxs[0]].getCoreId()), regionIdxs);
+      }
+    }
+  }
+
+  for (unsigned i = 0; i < m_objs.size(); ++i) {
+    if (m_kernel.isParamWritten(i)) {
+      m_objs[i]->markSimulatedMemModified();
+    }
+  }
+
+  return updateStats();
+}
+
+//! @brief  Pim CMD: BitSIMD-V: Replay the whole micro-kernel on all regions of a core
+bool
+pimCmdMicroKernel::computeRegion(unsigned index)
+{
+  const std::vector<size_t>& regionIdxs = m_regionIdxsPerCore[index];
+  pimCore& core = m_device->getCore(m_objs[0]->getRegions()[regionIdxs[0]].getCoreId());
+  for (const auto& op : m_kernel.getOps()) {
+    executeOp(op, core, regionIdxs);
+  }
+  return true;
+}
+
+//! @brief  Pim CMD: BitSIMD-V: Execute a non-rotation micro op on a list of regions of a core
+void
+pimCmdMicroKernel::executeOp(const pimMicroKernel::microOp& op, pimCore& core, const std::vector<size_t>& regionIdxs)
+{
+  switch (op.m_cmdType) {
+  case PimCmdEnum::ROW_R:
+    for (size_t i : regionIdxs) {
+      core.readRow(m_rowBases[op.m_paramIdx][i] + op.m_ofst);
+    }
+    break;
+  case PimCmdEnum::ROW_W:
+    for (size_t i : regionIdxs) {
+      core.writeRow(m_rowBases[op.m_paramIdx][i] + op.m_ofst);
+    }
+    break;
+  default:
+    pimCmdRRegOp::computeCore(core, op.m_cmdType, op.m_dest, op.m_src1, op.m_src2, op.m_src3, op.m_val);
+  }
+}
+
+//! @brief  Pim CMD: BitSIMD-V: Record aggregated micro op counts of a micro-kernel
+bool
+pimCmdMicroKernel::updateStats() const
+{
+  pimeval::perfEnergy prfEnrgy;
+  for (const auto& [cmdType, num] : m_kernel.getNumCmds()) {
+    getStatsMgr()->recordCmd(getName(cmdType, ""), prfEnrgy, num);
+  }
+  return true;
+}
+
@@ -0,0 +1,120 @@
+// File: pimCmdMicroKernel.h
+// PIMeval Simulator - PIM Micro-Kernel Recording and Replay
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#ifndef LAVA_PIM_CMD_MICRO_KERNEL_H
+#define LAVA_PIM_CMD_MICRO_KERNEL_H
+
+#include "libpimeval.h"
+#include "pimCmd.h"
+#include "pimResMgr.h"
+#include <vector>
+#include <map>
+#include <unordered_map>
+
+
+//! @class  pimMicroKernel
+//! @brief  A recorded sequence of BitSIMD-V micro ops. PIM objects are kernel parameters,
+//!         followed by kernel-local objects which are allocated during recording
+class pimMicroKernel
+{
+public:
+  pimMicroKernel(const std::vector<PimObjId>& params);
+  ~pimMicroKernel() {}
+
+  //! @struct  pimMicroKernel::microOp
+  //! @brief  A micro op with PIM object resolved to a parameter index
+  struct microOp {
+    PimCmdEnum m_cmdType;
+    unsigned m_paramIdx;
+    unsigned m_ofst;
+    PimRowReg m_dest;
+    PimRowReg m_src1;
+    PimRowReg m_src2;
+    PimRowReg m_src3;
+    bool m_val;
+  };
+
+  //! @struct  pimMicroKernel::localObj
+  //! @brief  A kernel-local object, allocated associated with another parameter for each run
+  struct localObj {
+    unsigned m_assocParamIdx;
+    PimDataType m_dataType;
+    unsigned m_numCustomBits;
+  };
+
+  bool addOp(const PimMicroOp& op, pimResMgr* resMgr);
+  bool addLocal(PimObjId objId, PimObjId assocId, PimDataType dataType, unsigned numCustomBits = 0);
+  void optimize(bool isRegLiveOut);
+
+  const std::vector<PimObjId>& getParams() const { return m_params; }
+  size_t getNumParams() const { return m_params.size(); }
+  size_t getNumObjs() const { return m_params.size() + m_locals.size(); }
+  const std::vector<localObj>& getLocals() const { return m_locals; }
+  const std::vector<microOp>& getOps() const { return m_ops; }
+  unsigned getNumRowsUsed(unsigned paramIdx) const { return m_numRowsUsed[paramIdx]; }
+  bool isParamRowAccessed(unsigned paramIdx) const { return m_numRowsUsed[paramIdx] > 0; }
+  bool isParamWritten(unsigned paramIdx) const { return m_isParamWritten[paramIdx]; }
+  bool hasRotate() const { return m_hasRotate; }
+  bool hasError() const { return m_hasError; }
+  bool isOptimized() const { return m_isOptimized; }
+  const std::map<PimCmdEnum, int>& getNumCmds() const { return m_numCmds; }
+  PimMicroKernelStats getStats() const;
+
+  static PimCmdEnum getCmdType(PimMicroOpEnum opType);
+  static bool isValidOp(const PimMicroOp& op, pimResMgr* resMgr);
+
+private:
+  bool peepholeForward();
+  bool peepholeBackward(bool isRegLiveOut);
+  void updateOpInfo();
+  static void countOps(const std::vector<microOp>& ops, unsigned& numR, unsigned& numW, unsigned& numL);
+
+  std::vector<PimObjId> m_params;
+  std::vector<localObj> m_locals;
+  std::unordered_map<PimObjId, unsigned> m_paramIdxs;
+  std::vector<microOp> m_ops;
+  std::vector<unsigned> m_numRowsUsed;  // max row offset + 1 of each parameter, 0 if no row access
+  std::vector<bool> m_isParamWritten;
+  bool m_hasRotate = false;
+  bool m_hasError = false;
+  bool m_isOptimized = false;
+  std::map<PimCmdEnum, int> m_numCmds;
+  unsigned m_numRecordedR = 0;
+  unsigned m_numRecordedW = 0;
+  unsigned m_numRecordedL = 0;
+};
+
+//! @class  pimCmdMicroKernel
+//! @brief  Pim CMD: BitSIMD-V: Replay a micro-kernel on a list of PIM objects
+class pimCmdMicroKernel : public pimCmd
+{
+public:
+  pimCmdMicroKernel(PimCmdEnum cmdType, const pimMicroKernel& kernel, const std::vector<PimObjId>& objIds, unsigned ofstShift)
+    : pimCmd(cmdType), m_kernel(kernel), m_objIds(objIds), m_ofstShift(ofstShift)
+  {
+    assert(cmdType == PimCmdEnum::MICRO_KERNEL);
+  }
+  virtual ~pimCmdMicroKernel() {}
+  virtual bool execute() override;
+  virtual bool sanityCheck() const override;
+  virtual bool computeRegion(unsigned index) override;
+  virtual bool updateStats() const override;
+  virtual void getObjIds(std::vector<PimObjId>& srcObjIds, std::vector<PimObjId>& destObjIds) const override {
+    srcObjIds = m_objIds;
+    destObjIds = m_objIds;
+  }
+protected:
+  void executeOp(const pimMicroKernel::microOp& op, pimCore& core, const std::vector<size_t>& regionIdxs);
+  const pimMicroKernel& m_kernel;
+  std::vector<PimObjId> m_objIds;
+  unsigned m_ofstShift;
+  std::vector<const pimObjInfo*> m_objs;
+  std::vector<std::vector<unsigned>> m_rowBases;  // pre-resolved row index of each parameter and region
+  std::vector<std::vector<size_t>> m_regionIdxsPerCore;
+};
+
+#endif
+
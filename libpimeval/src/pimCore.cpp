@@ -5,17 +5,20 @@
 // See the LICENSE file in the root of this repository for more details.
 
 #include "pimCore.h"
+#include "pimUtils.h"
 #include <random>
 #include <cstdio>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
 
 
 //! @brief  pimCore ctor
 pimCore::pimCore(unsigned numRows, unsigned numCols)
   : m_numRows(numRows),
     m_numCols(numCols),
-    m_array(numRows, std::vector<bool>(numCols)),
+    m_numWordsPerRow((numCols + 63) / 64),
+    m_lastWordMask(getLowBitsMask(numCols % 64 == 0 ? 64 : numCols % 64)),
     m_senseAmpCol(numRows)
 {
   // Initialize memory contents with random 0/1
@@ -25,14 +28,10 @@ pimCore::pimCore(unsigned numRows, unsigned numCols)
     std::uniform_int_distribution<int> dist(0, 1);
     for (unsigned row = 0; row < m_numRows; ++row) {
       for (unsigned col = 0; col < m_numCols; ++col) {
-        m_array[row][col] = dist(gen);
+        setBit(row, col, dist(gen));
       }
     }
   }
-
-  for (int reg = PIM_RREG_SA; reg < PIM_RREG_MAX; ++reg) {
-    declareRowReg(static_cast<PimRowReg>(reg));
-  }
 }
 
 //! @brief  pimCore dtor
@@ -40,11 +39,19 @@ pimCore::~pimCore()
 {
 }
 
+//! @brief  Release simulated memory and row regs, e.g., when no PIM object is allocated on this core
+void
+pimCore::releaseMemory()
+{
+  std::vector<uint64_t>().swap(m_array);
+  m_rowRegs.clear();
+}
+
 //! @brief  Initialize a row reg
 bool
 pimCore::declareRowReg(PimRowReg reg)
 {
-  m_rowRegs[reg].resize(m_numCols);
+  m_rowRegs[reg].resize(m_numWordsPerRow);
   return true;
 }
 
@@ -56,7 +63,13 @@ pimCore::readRow(unsigned rowIndex)
     std::printf("PIM-Error: Out-of-boundary subarray row read: index = %u, numRows = %u\n", rowIndex, m_numRows);
     return false;
   }
-  m_rowRegs[PIM_RREG_SA] = m_array[rowIndex];
+  std::vector<uint64_t>& sa = getRowReg(PIM_RREG_SA);
+  if (m_array.empty()) {
+    std::fill(sa.begin(), sa.end(), 0);
+  } else {
+    const uint64_t* row = &m_array[getWordIdx(rowIndex, 0)];
+    std::copy(row, row + m_numWordsPerRow, sa.begin());
+  }
   return true;
 }
 
@@ -69,7 +82,7 @@ pimCore::readCol(unsigned colIndex)
     return false;
   }
   for (unsigned row = 0; row < m_numRows; ++row) {
-    m_senseAmpCol[row] = m_array[row][colIndex];
+    m_senseAmpCol[row] = getBit(row, colIndex);
   }
   return true;
 }
@@ -90,23 +103,48 @@ pimCore::readMultiRows(const std::vector<std::pair<unsigned, bool>>& rowIdxs)
       return false;
     }
   }
-  // compute majority
-  for (unsigned col = 0; col < m_numCols; ++col) {
-    unsigned sum = 0;
-    for (const auto& kv : rowIdxs) {
-      unsigned idx = kv.first;
-      bool isDCCN = kv.second;
-      bool val = (isDCCN ? !m_array[idx][col] : m_array[idx][col]);
-      sum += val ? 1 : 0;
+  // compute majority word by word. Dual-contact negation is applied as XOR masks
+  allocateMemoryOnWrite();
+  std::vector<uint64_t>& sa = getRowReg(PIM_RREG_SA);
+  size_t numSrc = rowIdxs.size();
+  std::vector<uint64_t*> rows(numSrc);
+  std::vector<uint64_t> negMasks(numSrc);
+  for (size_t k = 0; k < numSrc; ++k) {
+    rows[k] = &m_array[getWordIdx(rowIdxs[k].first, 0)];
+    negMasks[k] = rowIdxs[k].second ? ~0ULL : 0ULL;
+  }
+  // for more than three rows, counts[t] collects bits that are set in more than t rows
+  std::vector<uint64_t> counts(numSrc / 2 + 1);
+  for (unsigned w = 0; w < m_numWordsPerRow; ++w) {
+    uint64_t maj = 0;
+    if (numSrc == 1) {
+      maj = rows[0][w] ^ negMasks[0];
+    } else if (numSrc == 3) {
+      uint64_t a = rows[0][w] ^ negMasks[0];
+      uint64_t b = rows[1][w] ^ negMasks[1];
+      uint64_t c = rows[2][w] ^ negMasks[2];
+      maj = (a & b) | (a & c) | (b & c);
+    } else {
+      std::fill(counts.begin(), counts.end(), 0);
+      for (size_t k = 0; k < numSrc; ++k) {
+        uint64_t val = rows[k][w] ^ negMasks[k];
+        for (size_t t = counts.size() - 1; t > 0; --t) {
+          counts[t] |= counts[t - 1] & val;
+        }
+        counts[0] |= val;
+      }
+      maj = counts.back();
     }
-    bool maj = (sum > rowIdxs.size() / 2);
-    for (const auto& kv : rowIdxs) {
-      unsigned idx = kv.first;
-      bool isDCCN = kv.second;
-      m_array[idx][col] = (isDCCN ? !maj : maj);
+    for (size_t k = 0; k < numSrc; ++k) {
+      rows[k][w] = maj ^ negMasks[k];
     }
-    m_rowRegs[PIM_RREG_SA][col] = maj;
+    sa[w] = maj;
   }
+  // keep unused bits of the last word cleared
+  for (size_t k = 0; k < numSrc; ++k) {
+    rows[k][m_numWordsPerRow - 1] &= m_lastWordMask;
+  }
+  sa[m_numWordsPerRow - 1] &= m_lastWordMask;
   return true;
 }
 
@@ -122,14 +160,16 @@ pimCore::writeMultiRows(const std::vector<std::pair<unsigned, bool>>& rowIdxs)
       return false;
     }
   }
-  // write
-  for (unsigned col = 0; col < m_numCols; ++col) {
-    bool val = m_rowRegs[PIM_RREG_SA][col];
-    for (const auto& kv : rowIdxs) {
-      unsigned idx = kv.first;
-      bool isDCCN = kv.second;
-      m_array[idx][col] = (isDCCN ? !val :val);
+  // write word by word. Dual-contact negation is applied as XOR masks
+  allocateMemoryOnWrite();
+  const std::vector<uint64_t>& sa = getRowReg(PIM_RREG_SA);
+  for (const auto& kv : rowIdxs) {
+    uint64_t* row = &m_array[getWordIdx(kv.first, 0)];
+    uint64_t negMask = kv.second ? ~0ULL : 0ULL;
+    for (unsigned w = 0; w < m_numWordsPerRow; ++w) {
+      row[w] = sa[w] ^ negMask;
     }
+    row[m_numWordsPerRow - 1] &= m_lastWordMask;
   }
   return true;
 }
@@ -142,7 +182,11 @@ pimCore::writeRow(unsigned rowIndex)
     std::printf("PIM-Error: Out-of-boundary subarray row write: index = %u, numRows = %u\n", rowIndex, m_numRows);
     return false;
   }
-  m_array[rowIndex] = m_rowRegs[PIM_RREG_SA];
+  allocateMemoryOnWrite();
+  const std::vector<uint64_t>& sa = getRowReg(PIM_RREG_SA);
+  uint64_t* row = &m_array[getWordIdx(rowIndex, 0)];
+  std::copy(sa.begin(), sa.end(), row);
+  row[m_numWordsPerRow - 1] &= m_lastWordMask;
   return true;
 }
 
@@ -155,7 +199,7 @@ pimCore::writeCol(unsigned colIndex)
     return false;
   }
   for (unsigned row = 0; row < m_numRows; ++row) {
-    m_array[row][colIndex] = m_senseAmpCol[row];
+    setBit(row, colIndex, m_senseAmpCol[row]);
   }
   return true;
 }
@@ -168,7 +212,9 @@ pimCore::setSenseAmpRow(const std::vector<bool>& vals)
     std::printf("PIM-Error: Incorrect data size write to row SAs: size = %lu, numCols = %u\n", vals.size(), m_numCols);
     return false;
   }
-  m_rowRegs[PIM_RREG_SA] = vals;
+  for (unsigned col = 0; col < m_numCols; ++col) {
+    setRowRegBit(PIM_RREG_SA, col, vals[col]);
+  }
   return true;
 }
 
@@ -184,6 +230,37 @@ pimCore::setSenseAmpCol(const std::vector<bool>& vals)
   return true;
 }
 
+//! @brief  Get #numElems (at most 64) consecutive V-layout elements starting from column colIdx.
+//!         Each bit row is fetched as one packed word, and a 64x64 bit-matrix transposition
+//!         turns the bit rows into element values
+void
+pimCore::getBitsVBlock(unsigned rowIdx, unsigned colIdx, unsigned numBits, unsigned numElems, uint64_t* vals) const
+{
+  assert(numBits > 0 && numBits <= 64 && numElems > 0 && numElems <= 64);
+  assert(rowIdx + (numBits - 1) < m_numRows && colIdx + (numElems - 1) < m_numCols);
+  uint64_t block[64] = {0};
+  for (unsigned i = 0; i < numBits; ++i) {
+    block[i] = getBitsH(rowIdx + i, colIdx, numElems);
+  }
+  pimUtils::transposeBits64x64(block);
+  std::copy(block, block + numElems, vals);
+}
+
+//! @brief  Set #numElems (at most 64) consecutive V-layout elements starting from column colIdx.
+//!         Element values are transposed into bit rows which are written as packed words
+void
+pimCore::setBitsVBlock(unsigned rowIdx, unsigned colIdx, unsigned numBits, unsigned numElems, const uint64_t* vals)
+{
+  assert(numBits > 0 && numBits <= 64 && numElems > 0 && numElems <= 64);
+  assert(rowIdx + (numBits - 1) < m_numRows && colIdx + (numElems - 1) < m_numCols);
+  uint64_t block[64] = {0};
+  std::copy(vals, vals + numElems, block);
+  pimUtils::transposeBits64x64(block);
+  for (unsigned i = 0; i < numBits; ++i) {
+    setBitsH(rowIdx + i, colIdx, block[i], numElems);
+  }
+}
+
 //! @brief  Print out memory subarray contents
 void
 pimCore::print() const
@@ -191,31 +268,33 @@ pimCore::print() const
   std::ostringstream oss;
   // header
   oss << "  Row S ";
-  for (unsigned col = 0; col < m_array[0].size(); ++col) {
+  for (unsigned col = 0; col < m_numCols; ++col) {
     oss << (col % 8 == 0 ? '+' : '-');
   }
   oss << std::endl;
-  for (unsigned row = 0; row < m_array.size(); ++row) {
+  for (unsigned row = 0; row < m_numRows; ++row) {
     // row index
     oss << std::setw(5) << row << ' ';
     // col SA
     oss << m_senseAmpCol[row] << ' ';
     // row contents
-    for (unsigned col = 0; col < m_array[0].size(); ++col) {
-      oss << m_array[row][col];
+    for (unsigned col = 0; col < m_numCols; ++col) {
+      oss << getBit(row, col);
     }
     oss << std::endl;
   }
   // footer
   oss << "        ";
-  for (unsigned col = 0; col < m_array[0].size(); ++col) {
+  for (unsigned col = 0; col < m_numCols; ++col) {
     oss << (col % 8 == 0 ? '+' : '-');
   }
   oss << std::endl;
   // row SA
   oss << "     SA ";
-  for (unsigned col = 0; col < m_array[0].size(); ++col) {
-    oss << m_rowRegs.at(PIM_RREG_SA)[col];
+  auto it = m_rowRegs.find(PIM_RREG_SA);
+  for (unsigned col = 0; col < m_numCols; ++col) {
+    bool val = (it != m_rowRegs.end() && !it->second.empty() ? (it->second[col / 64] >> (col % 64)) & 1 : false);
+    oss << val;
   }
   oss << std::endl;
   std::printf("%s\n", oss.str().c_str());
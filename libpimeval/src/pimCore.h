@@ -30,7 +30,7 @@ public:
   // Row-based operations
   bool readRow(unsigned rowIndex);
   bool writeRow(unsigned rowIndex);
-  std::vector<bool>& getSenseAmpRow() { return m_rowRegs[PIM_RREG_SA]; }
+  std::vector<uint64_t>& getSenseAmpRow() { return getRowReg(PIM_RREG_SA); }
   bool setSenseAmpRow(const std::vector<bool>& vals);
   bool readMultiRows(const std::vector<std::pair<unsigned, bool>>& rowIdxs);
   bool writeMultiRows(const std::vector<std::pair<unsigned, bool>>& rowIdxs);
@@ -41,8 +41,29 @@ public:
   std::vector<bool>& getSenseAmpCol() { return m_senseAmpCol; }
   bool setSenseAmpCol(const std::vector<bool>& vals);
 
-  // Reg access
-  std::vector<bool>& getRowReg(PimRowReg reg) { return m_rowRegs[reg]; }
+  // Reg access. A row reg is packed as 64 columns per word, and is allocated on first touch
+  std::vector<uint64_t>& getRowReg(PimRowReg reg) {
+    std::vector<uint64_t>& words = m_rowRegs[reg];
+    if (words.empty()) {
+      words.resize(m_numWordsPerRow);
+    }
+    return words;
+  }
+  bool getRowRegBit(PimRowReg reg, unsigned colIdx) {
+    assert(colIdx < m_numCols);
+    return (getRowReg(reg)[colIdx / 64] >> (colIdx % 64)) & 1;
+  }
+  void setRowRegBit(PimRowReg reg, unsigned colIdx, bool val) {
+    assert(colIdx < m_numCols);
+    uint64_t& word = getRowReg(reg)[colIdx / 64];
+    uint64_t mask = 1ULL << (colIdx % 64);
+    word = val ? (word | mask) : (word & ~mask);
+  }
+  unsigned getNumWordsPerRow() const { return m_numWordsPerRow; }
+
+  // Simulated memory is allocated on first write. Untouched memory reads as zeros
+  bool isMemoryAllocated() const { return !m_array.empty(); }
+  void releaseMemory();
 
   // Utilities
   bool declareRowReg(PimRowReg reg);
@@ -53,12 +74,18 @@ public:
   //! @brief  Directly set a bit for functional simulation
   inline void setBit(unsigned rowIdx, unsigned colIdx, bool val) {
     assert(rowIdx < m_numRows && colIdx < m_numCols);
-    m_array[rowIdx][colIdx] = val;
+    allocateMemoryOnWrite();
+    uint64_t& word = m_array[getWordIdx(rowIdx, colIdx)];
+    uint64_t mask = 1ULL << (colIdx % 64);
+    word = val ? (word | mask) : (word & ~mask);
   }
   //! @brief  Directly get a bit for functional simulation
   inline bool getBit(unsigned rowIdx, unsigned colIdx) const {
     assert(rowIdx < m_numRows && colIdx < m_numCols);
-    return m_array[rowIdx][colIdx];
+    if (m_array.empty()) {
+      return false;
+    }
+    return (m_array[getWordIdx(rowIdx, colIdx)] >> (colIdx % 64)) & 1;
   }
   //! @brief  Directly set #numBits bits for V-layout functional simulation
   inline void setBitsV(unsigned rowIdx, unsigned colIdx, uint64_t val, unsigned numBits) {
@@ -85,33 +112,63 @@ public:
   inline void setBitsH(unsigned rowIdx, unsigned colIdx, uint64_t val, unsigned numBits) {
     assert(numBits > 0 && numBits <= 64);
     assert(rowIdx < m_numRows && colIdx + (numBits - 1) < m_numCols);
-    for (unsigned i = 0; i < numBits; ++i) {
-      bool bitVal = val & 1;
-      setBit(rowIdx, colIdx + i, bitVal);
-      val = val >> 1;
+    allocateMemoryOnWrite();
+    uint64_t* words = &m_array[getWordIdx(rowIdx, colIdx)];
+    unsigned offset = colIdx % 64;
+    uint64_t mask = getLowBitsMask(numBits);
+    val &= mask;
+    words[0] = (words[0] & ~(mask << offset)) | (val << offset);
+    if (offset + numBits > 64) {
+      unsigned shift = 64 - offset;
+      words[1] = (words[1] & ~(mask >> shift)) | (val >> shift);
     }
   }
   //! @brief  Directly get #numBits bits for H-layout functional simulation
   inline uint64_t getBitsH(unsigned rowIdx, unsigned colIdx, unsigned numBits) const {
     assert(numBits > 0 && numBits <= 64);
     assert(rowIdx < m_numRows && colIdx + (numBits - 1) < m_numCols);
-    uint64_t val = 0;
-    for (int i = (numBits - 1); i >= 0; --i) {
-      bool bitVal = getBit(rowIdx, colIdx + i);
-      val = (val << 1) | bitVal;
+    if (m_array.empty()) {
+      return 0;
     }
-    return val;
+    const uint64_t* words = &m_array[getWordIdx(rowIdx, colIdx)];
+    unsigned offset = colIdx % 64;
+    uint64_t val = words[0] >> offset;
+    if (offset + numBits > 64) {
+      val |= words[1] << (64 - offset);
+    }
+    return val & getLowBitsMask(numBits);
   }
 
+  // Block access of up to 64 consecutive V-layout elements with bit-matrix transposition
+  void getBitsVBlock(unsigned rowIdx, unsigned colIdx, unsigned numBits, unsigned numElems, uint64_t* vals) const;
+  void setBitsVBlock(unsigned rowIdx, unsigned colIdx, unsigned numBits, unsigned numElems, const uint64_t* vals);
+
 private:
   PimCoreId m_coreId;
   unsigned m_numRows;
   unsigned m_numCols;
 
-  std::vector<std::vector<bool>> m_array;
+  //! @brief  Index of the 64-bit word containing a bit in the packed memory array
+  inline size_t getWordIdx(unsigned rowIdx, unsigned colIdx) const {
+    return static_cast<size_t>(rowIdx) * m_numWordsPerRow + colIdx / 64;
+  }
+  //! @brief  Allocate zero-initialized memory array before the first write
+  inline void allocateMemoryOnWrite() {
+    if (m_array.empty()) {
+      m_array.resize(static_cast<size_t>(m_numRows) * m_numWordsPerRow);
+    }
+  }
+  //! @brief  A mask with the lowest #numBits bits set
+  static inline uint64_t getLowBitsMask(unsigned numBits) {
+    return numBits >= 64 ? ~0ULL : ((1ULL << numBits) - 1);
+  }
+
+  unsigned m_numWordsPerRow;
+  uint64_t m_lastWordMask;  // valid columns in the last word of a row
+  std::vector<uint64_t> m_array;  // packed memory array, 64 columns per word, row by row. Empty if untouched
   std::vector<bool> m_senseAmpCol;
 
-  std::map<PimRowReg, std::vector<bool>> m_rowRegs;
+  std::map<PimRowReg, std::vector<uint64_t>> m_rowRegs;
   std::map<std::string, std::vector<bool>> m_colRegs;
 };
 
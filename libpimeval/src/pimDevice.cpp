@@ -13,11 +13,14 @@
 #include <memory>
 #include <cassert>
 #include <string>
+#include <unordered_set>
 
 
 //! @brief  pimDevice ctor
-pimDevice::pimDevice(const pimSimConfig& config)
-  : m_config(config)
+pimDevice::pimDevice(pimSim* sim, const pimSimConfig& config, const pimParamsDram& paramsDram)
+  : m_sim(sim),
+    m_config(config),
+    m_paramsDram(paramsDram)
 {
   init();
 }
@@ -114,19 +117,6 @@ pimDevice::init()
     return false;
   }
 
-#ifdef DRAMSIM3_INTEG
-  std::string configFile = m_config.getSimConfigFile();
-  //TODO: DRAMSim3 requires an output directory but for our purpose we do not need it so sending empty string
-  m_deviceMemory = new dramsim3::PIMCPU(configFile, "");
-  m_deviceMemoryConfig = m_deviceMemory->getMemorySystem()->getConfig();
-  u_int64_t rowsPerBank = m_deviceMemoryConfig->rows, columnPerRow = m_deviceMemoryConfig->columns * m_deviceMemoryConfig->device_width;
-
-  // todo: adjust for sim target
-  m_numCores = 16;
-  m_numRows = rowsPerBank/m_numCores;
-  m_numCols = columnPerRow;
-#endif
-
   m_isValid = (m_numCores > 0 && m_numRows > 0 && m_numCols > 0);
   if (m_numCols % 8 != 0) {
     std::printf("PIM-Error: Number of columns %u is not a multiple of 8\n", m_numCols);
@@ -138,11 +128,21 @@ pimDevice::init()
   }
 
   m_resMgr = std::make_unique<pimResMgr>(this);
-  const pimParamsDram& paramsDram = pimSim::get()->getParamsDram(); // created before pimDevice ctor
-  pimPerfEnergyModelParams params(getSimTarget(), getNumRanks(), paramsDram);
+  pimPerfEnergyModelParams params(getSimTarget(), getNumRanks(), m_paramsDram, m_config.isOpenPagePolicy());
   m_perfEnergyModel = pimPerfEnergyFactory::createPerfEnergyModel(params);
 
+#ifdef DRAMSIM3_INTEG
+  // Cycle-level timing with DRAMsim3 on the bank topology of the memory config, alongside the analytical model
+  if (m_config.getMemConfigFile().empty()) {
+    std::printf("PIM-Warning: DRAMsim3 timing requires a memory config file\n");
+  } else {
+    m_dramSim = std::make_unique<pimDramSim>(m_config.getMemConfigFile(), m_numCores, m_numRows, getNumRanks(),
+                                             m_config.getDramSimSampleInterval());
+  }
+#endif
+
   // Disable simulated memory creation for functional simulation
+  // Memory array of each core is allocated on first write
   if (getDeviceType() != PIM_FUNCTIONAL) {
     m_cores.resize(m_numCores, pimCore(m_numRows, m_numCols));
   }
@@ -191,7 +191,61 @@ pimDevice::pimAllocBuffer(uint32_t numElements, PimDataType dataType)
 PimObjId
 pimDevice::pimAllocAssociated(PimObjId assocId, PimDataType dataType)
 {
-  return m_resMgr->pimAllocAssociated(assocId, dataType);
+  PimObjId objId = m_resMgr->pimAllocAssociated(assocId, dataType);
+  // objects allocated during micro-kernel recording are kernel-local
+  if (objId != -1 && m_recordingMicroKernel) {
+    m_recordingMicroKernel->addLocal(objId, assocId, dataType);
+  }
+  return objId;
+}
+
+//! @brief  Check if custom bit-width integers are supported, i.e., bit-serial targets only
+bool
+pimDevice::isValidCustomInt(unsigned numBits, bool isSigned) const
+{
+  if (!isVLayoutDevice() && getSimTarget() != PIM_DEVICE_BITSIMD_H) {
+    std::printf("PIM-Error: Custom bit-width integers are only supported on bit-serial PIM devices\n");
+    return false;
+  }
+  if (numBits == 0 || numBits > 64) {
+    std::printf("PIM-Error: Invalid custom integer bit width %u, which must be in [1, 64]\n", numBits);
+    return false;
+  }
+  if (isSigned && numBits < 2) {
+    std::printf("PIM-Error: Signed custom integers require at least 2 bits\n");
+    return false;
+  }
+  return true;
+}
+
+//! @brief  Alloc a PIM object of custom bit-width integers
+PimObjId
+pimDevice::pimAllocCustomInt(PimAllocEnum allocType, uint64_t numElements, unsigned numBits, bool isSigned)
+{
+  if (!isValidCustomInt(numBits, isSigned)) {
+    return -1;
+  }
+  if (allocType == PIM_ALLOC_AUTO) {
+    allocType = (isVLayoutDevice() ? PIM_ALLOC_V : PIM_ALLOC_H);
+  }
+  PimDataType dataType = pimUtils::getCustomIntContainerType(numBits, isSigned);
+  return m_resMgr->pimAlloc(allocType, numElements, dataType, numBits);
+}
+
+//! @brief  Allocate a PIM object of custom bit-width integers associated with another PIM object
+PimObjId
+pimDevice::pimAllocAssociatedCustomInt(PimObjId assocId, unsigned numBits, bool isSigned)
+{
+  if (!isValidCustomInt(numBits, isSigned)) {
+    return -1;
+  }
+  PimDataType dataType = pimUtils::getCustomIntContainerType(numBits, isSigned);
+  PimObjId objId = m_resMgr->pimAllocAssociated(assocId, dataType, numBits);
+  // objects allocated during micro-kernel recording are kernel-local
+  if (objId != -1 && m_recordingMicroKernel) {
+    m_recordingMicroKernel->addLocal(objId, assocId, dataType, numBits);
+  }
+  return objId;
 }
 
 //! @brief  Free a PIM object
@@ -260,13 +314,152 @@ pimDevice::pimCopyDeviceToDevice(PimObjId src, PimObjId dest, uint64_t idxBegin,
   return executeCmd(std::move(cmd));
 }
 
+//! @brief  Start recording BitSIMD-V micro ops into a micro-kernel
+bool
+pimDevice::pimBeginMicroKernel(const std::vector<PimObjId>& params)
+{
+  if (m_recordingMicroKernel) {
+    std::printf("PIM-Error: Micro-kernel recording has already started\n");
+    return false;
+  }
+  std::unordered_set<PimObjId> visitedObjIds;
+  for (PimObjId objId : params) {
+    if (!m_resMgr->isValidObjId(objId)) {
+      std::printf("PIM-Error: Invalid object id %d\n", objId);
+      return false;
+    }
+    if (!visitedObjIds.insert(objId).second) {
+      std::printf("PIM-Error: Duplicated micro-kernel parameter object id %d\n", objId);
+      return false;
+    }
+  }
+  m_recordingMicroKernel = std::make_unique<pimMicroKernel>(params);
+  return true;
+}
+
+//! @brief  End recording, optionally optimize the micro-kernel, and return the micro-kernel ID
+PimMicroKernelId
+pimDevice::pimEndMicroKernel(PimMicroKernelOptEnum opt)
+{
+  if (!m_recordingMicroKernel) {
+    std::printf("PIM-Error: Micro-kernel recording has not started\n");
+    return -1;
+  }
+  std::unique_ptr<pimMicroKernel> kernel = std::move(m_recordingMicroKernel);
+  if (kernel->hasError()) {
+    std::printf("PIM-Error: Micro-kernel recording failed due to invalid micro ops or objects\n");
+    return -1;
+  }
+  if (opt != PIM_MICRO_KERNEL_OPT_NONE) {
+    // peephole optimization assumes all micro ops run on the same cores
+    const std::vector<PimObjId>& params = kernel->getParams();
+    for (PimObjId objId : params) {
+      if (!m_resMgr->isValidObjId(objId) ||
+          m_resMgr->getObjInfo(objId).getAssocObjId() != m_resMgr->getObjInfo(params[0]).getAssocObjId()) {
+        std::printf("PIM-Error: Micro-kernel optimization requires associated parameter objects\n");
+        return -1;
+      }
+    }
+    kernel->optimize(opt == PIM_MICRO_KERNEL_OPT_PEEPHOLE);
+  }
+  PimMicroKernelId kernelId = m_nextMicroKernelId++;
+  m_microKernels[kernelId] = std::move(kernel);
+  return kernelId;
+}
+
+//! @brief  Replay a micro-kernel on a list of objects. Kernel-local objects are allocated for this run
+bool
+pimDevice::pimRunMicroKernel(PimMicroKernelId kernelId, const std::vector<PimObjId>& objIds, unsigned ofstShift)
+{
+  if (m_recordingMicroKernel) {
+    std::printf("PIM-Error: Cannot run a micro-kernel during micro-kernel recording\n");
+    return false;
+  }
+  auto it = m_microKernels.find(kernelId);
+  if (it == m_microKernels.end()) {
+    std::printf("PIM-Error: Invalid micro-kernel id %d\n", kernelId);
+    return false;
+  }
+  const pimMicroKernel& kernel = *it->second;
+  if (objIds.size() != kernel.getNumParams()) {
+    std::printf("PIM-Error: Micro-kernel expects %lu objects but %lu are given\n", kernel.getNumParams(), objIds.size());
+    return false;
+  }
+  std::vector<PimObjId> allObjIds = objIds;
+  bool ok = true;
+  for (const auto& local : kernel.getLocals()) {
+    if (!m_resMgr->isValidObjId(allObjIds[local.m_assocParamIdx])) {
+      std::printf("PIM-Error: Invalid object id %d\n", allObjIds[local.m_assocParamIdx]);
+      ok = false;
+      break;
+    }
+    PimObjId objId = m_resMgr->pimAllocAssociated(allObjIds[local.m_assocParamIdx], local.m_dataType, local.m_numCustomBits);
+    if (objId == -1) {
+      ok = false;
+      break;
+    }
+    allObjIds.push_back(objId);
+  }
+  if (ok) {
+    std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdMicroKernel>(PimCmdEnum::MICRO_KERNEL, kernel, allObjIds, ofstShift);
+    ok = executeCmd(std::move(cmd));
+  }
+  for (size_t i = objIds.size(); i < allObjIds.size(); ++i) {
+    m_resMgr->pimFree(allObjIds[i]);
+  }
+  return ok;
+}
+
+//! @brief  Delete a micro-kernel
+bool
+pimDevice::pimDeleteMicroKernel(PimMicroKernelId kernelId)
+{
+  if (m_microKernels.erase(kernelId) == 0) {
+    std::printf("PIM-Error: Invalid micro-kernel id %d\n", kernelId);
+    return false;
+  }
+  return true;
+}
+
+//! @brief  Get micro op counts of a micro-kernel, as recorded and after optimization
+bool
+pimDevice::pimGetMicroKernelStats(PimMicroKernelId kernelId, PimMicroKernelStats* stats) const
+{
+  auto it = m_microKernels.find(kernelId);
+  if (it == m_microKernels.end()) {
+    std::printf("PIM-Error: Invalid micro-kernel id %d\n", kernelId);
+    return false;
+  }
+  if (!stats) {
+    std::printf("PIM-Error: Invalid null pointer as micro-kernel stats output\n");
+    return false;
+  }
+  *stats = it->second->getStats();
+  return true;
+}
+
 //! @brief  Execute a PIM command
 bool
 pimDevice::executeCmd(std::unique_ptr<pimCmd> cmd)
 {
   cmd->setDevice(this);
+  double msApiBegin = pimStatsMgr::getThreadMsCurApiRuntime();
+  double msScheduledBegin = pimStatsMgr::getThreadMsScheduled();
   bool ok = cmd->execute();
 
+  if (ok) {
+    // Model perf and energy of the same command on extra simulation targets
+    cmd->getSim()->updateStatsOfExtraTargets(*cmd);
+    // Schedule the command on the modeled timeline, except runtime of nested commands which are scheduled already
+    double msRuntime = (pimStatsMgr::getThreadMsCurApiRuntime() - msApiBegin)
+                       - (pimStatsMgr::getThreadMsScheduled() - msScheduledBegin);
+    cmd->getSim()->getStatsMgr()->scheduleCmd(*cmd, *m_resMgr, msRuntime);
+#ifdef DRAMSIM3_INTEG
+    if (m_dramSim) {
+      m_dramSim->simulate(*cmd, *m_resMgr, msRuntime, cmd->getSim()->getStatsMgr());
+    }
+#endif
+  }
   return ok;
 }
 
@@ -11,13 +11,17 @@
 #include "pimSimConfig.h"
 #include "pimCore.h"
 #include "pimCmd.h"
+#include "pimCmdMicroKernel.h"
 #include "pimPerfEnergyBase.h"
+#include "pimParamsDram.h"
 #ifdef DRAMSIM3_INTEG
-#include "cpu.h"
+#include "pimDramSim.h"
 #endif
 #include <memory>
+#include <unordered_map>
 
 class pimResMgr;
+class pimSim;
 
 
 //! @class  pimDevice
@@ -25,10 +29,11 @@ class pimResMgr;
 class pimDevice
 {
 public:
-  pimDevice(const pimSimConfig& config);
+  pimDevice(pimSim* sim, const pimSimConfig& config, const pimParamsDram& paramsDram);
   ~pimDevice();
 
   const pimSimConfig& getConfig() const { return m_config; }
+  pimSim* getSim() const { return m_sim; }  // the context owning this device
 
   PimDeviceEnum getDeviceType() const { return m_config.getDeviceType(); }
   PimDeviceEnum getSimTarget() const { return m_config.getSimTarget(); }
@@ -52,6 +57,8 @@ public:
   PimObjId pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataType);
   PimObjId pimAllocAssociated(PimObjId assocId, PimDataType dataType);
   PimObjId pimAllocBuffer(uint32_t numElements, PimDataType dataType);
+  PimObjId pimAllocCustomInt(PimAllocEnum allocType, uint64_t numElements, unsigned numBits, bool isSigned);
+  PimObjId pimAllocAssociatedCustomInt(PimObjId assocId, unsigned numBits, bool isSigned);
   bool pimFree(PimObjId obj);
   PimObjId pimCreateRangedRef(PimObjId refId, uint64_t idxBegin, uint64_t idxEnd);
   PimObjId pimCreateDualContactRef(PimObjId refId);
@@ -62,6 +69,14 @@ public:
   bool pimCopyDeviceToMainWithType(PimCopyEnum copyType, PimObjId src, void* dest, uint64_t idxBegin = 0, uint64_t idxEnd = 0);
   bool pimCopyDeviceToDevice(PimObjId src, PimObjId dest, uint64_t idxBegin = 0, uint64_t idxEnd = 0);
 
+  bool pimBeginMicroKernel(const std::vector<PimObjId>& params);
+  PimMicroKernelId pimEndMicroKernel(PimMicroKernelOptEnum opt);
+  bool pimRunMicroKernel(PimMicroKernelId kernelId, const std::vector<PimObjId>& objIds, unsigned ofstShift);
+  bool pimDeleteMicroKernel(PimMicroKernelId kernelId);
+  bool pimGetMicroKernelStats(PimMicroKernelId kernelId, PimMicroKernelStats* stats) const;
+  bool isRecordingMicroKernel() const { return m_recordingMicroKernel != nullptr; }
+  bool recordMicroOp(const PimMicroOp& op) { return m_recordingMicroKernel->addOp(op, m_resMgr.get()); }
+
   pimResMgr* getResMgr() { return m_resMgr.get(); }
   pimPerfEnergyBase* getPerfEnergyModel() { return m_perfEnergyModel.get(); }
   pimCore& getCore(PimCoreId coreId) { return m_cores[coreId]; }
@@ -70,8 +85,11 @@ public:
 private:
   bool init();
   bool adjustConfigForSimTarget(unsigned& numRanks, unsigned& numBankPerRank, unsigned& numSubarrayPerBank, unsigned& numRows, unsigned& numCols);
+  bool isValidCustomInt(unsigned numBits, bool isSigned) const;
 
+  pimSim* m_sim;
   const pimSimConfig& m_config;
+  const pimParamsDram& m_paramsDram;
   unsigned m_numCores = 0;
   unsigned m_numRows = 0;
   unsigned m_numCols = 0;
@@ -81,11 +99,12 @@ private:
   std::unique_ptr<pimResMgr> m_resMgr;
   std::unique_ptr<pimPerfEnergyBase> m_perfEnergyModel;
   std::vector<pimCore> m_cores;
+  std::unique_ptr<pimMicroKernel> m_recordingMicroKernel;
+  std::unordered_map<PimMicroKernelId, std::unique_ptr<pimMicroKernel>> m_microKernels;
+  PimMicroKernelId m_nextMicroKernelId = 0;
 
 #ifdef DRAMSIM3_INTEG
-  dramsim3::PIMCPU* m_hostMemory = nullptr;
-  dramsim3::PIMCPU* m_deviceMemory = nullptr;
-  dramsim3::Config* m_deviceMemoryConfig = nullptr;
+  std::unique_ptr<pimDramSim> m_dramSim;
 #endif
 };
 
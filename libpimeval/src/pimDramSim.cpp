@@ -0,0 +1,167 @@
+// File: pimDramSim.cpp
+// PIMeval Simulator - DRAMsim3 Cycle-Level Timing of PIM Commands
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#ifdef DRAMSIM3_INTEG
+
+#include "pimDramSim.h"
+#include "pimCmd.h"
+#include "pimResMgr.h"
+#include "pimStats.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+
+//! @brief  pimDramSim ctor. DRAMsim3 writes its epoch stats to the temp directory
+pimDramSim::pimDramSim(const std::string& memConfigFile, unsigned numCores, unsigned numRowsPerCore, unsigned numRanks, unsigned sampleInterval)
+  : m_numCoresPerRank(std::max(1u, numCores / std::max(1u, numRanks))),
+    m_sampleInterval(std::max(1u, sampleInterval))
+{
+  std::string outputDir = std::filesystem::temp_directory_path().string();
+  m_dramConfig = std::make_unique<dramsim3::Config>(memConfigFile, outputDir);
+  m_memorySystem = std::make_unique<dramsim3::MemorySystem>(memConfigFile, outputDir,
+      [this](uint64_t) { --m_numPending; }, [this](uint64_t) { --m_numPending; });
+
+  // PIM ranks beyond the channels and ranks of DRAMsim3, and cores of a PIM rank beyond its banks, share DRAM banks
+  const dramsim3::Config& config = *m_dramConfig;
+  unsigned numBanks = static_cast<unsigned>(config.banks);
+  unsigned numDramRanks = static_cast<unsigned>(config.channels * config.ranks);
+  m_numCoresPerBank = (m_numCoresPerRank + numBanks - 1) / numBanks;
+  unsigned numCoresSharingBank = m_numCoresPerBank * ((std::max(1u, numRanks) + numDramRanks - 1) / numDramRanks);
+  unsigned numDramRows = static_cast<unsigned>(config.rows);
+  m_numDramRowsPerCore = std::max(1u, std::min(numRowsPerCore, numDramRows / numCoresSharingBank));
+  if (numCoresSharingBank > numDramRows) {
+    std::printf("PIM-Warning: DRAMsim3 has fewer rows per bank than %u PIM cores sharing a bank\n", numCoresSharingBank);
+  }
+#ifndef DRAMSIM3_WRITE_BUFFER_DRAIN
+  std::printf("PIM-Warning: DRAMsim3 without the write buffer drain patch under third-party/patches times writes when buffered\n");
+#endif
+}
+
+//! @brief  Simulate a sampled PIM command or data copy, and record its simulated runtime with the modeled runtime
+void
+pimDramSim::simulate(const pimCmd& cmd, const pimResMgr& resMgr, double msModeled, pimStatsMgr* statsMgr)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  bool isSampled = (m_numCmdsPerType[cmd.getName()]++ % m_sampleInterval == 0);
+  if (!isSampled) {
+    statsMgr->recordDramSimCmd(cmd.getName(), msModeled, false, 0.0);
+    return;
+  }
+  std::vector<PimObjId> srcObjIds;
+  std::vector<PimObjId> destObjIds;
+  cmd.getObjIds(srcObjIds, destObjIds);
+  m_readAddresses.clear();
+  m_writeAddresses.clear();
+  for (PimObjId objId : srcObjIds) {
+    if (resMgr.isValidObjId(objId)) {
+      addObjTransactions(resMgr.getObjInfo(objId), m_readAddresses);
+    }
+  }
+  for (PimObjId objId : destObjIds) {
+    if (resMgr.isValidObjId(objId)) {
+      addObjTransactions(resMgr.getObjInfo(objId), m_writeAddresses);
+    }
+  }
+  // writing rows which are being read stalls DRAMsim3, so writes wait for all reads
+  uint64_t numCycles = runTransactions(m_readAddresses, false) + runTransactions(m_writeAddresses, true);
+  double msSimulated = numCycles * m_dramConfig->tCK * 1e-6;
+  statsMgr->recordDramSimCmd(cmd.getName(), msModeled, true, msSimulated);
+}
+
+//! @brief  Lower row accesses of a PIM object into DRAMsim3 transactions
+void
+pimDramSim::addObjTransactions(const pimObjInfo& obj, std::vector<uint64_t>& addresses) const
+{
+  unsigned bitsPerBurst = m_dramConfig->request_size_bytes * 8;
+  for (const pimRegion& region : obj.getRegions()) {
+    unsigned numBursts = 1;
+    if (!obj.isVLayout()) {
+      numBursts = (region.getNumAllocCols() + bitsPerBurst - 1) / bitsPerBurst;
+    }
+    for (unsigned row = 0; row < region.getNumAllocRows(); ++row) {
+      for (unsigned burst = 0; burst < numBursts; ++burst) {
+        addresses.push_back(getAddress(region.getCoreId(), region.getRowIdx() + row, region.getColIdx() / bitsPerBurst + burst));
+      }
+    }
+  }
+}
+
+//! @brief  Get DRAMsim3 address of a burst in a row of a PIM core.
+//!         Cores of a rank are spread over its banks, and cores sharing a bank own disjoint ranges of its rows.
+//!         When the range is shorter than rows of a core, rows of the core wrap around within its own range
+uint64_t
+pimDramSim::getAddress(PimCoreId coreId, unsigned rowIdx, unsigned burstIdx) const
+{
+  const dramsim3::Config& config = *m_dramConfig;
+  unsigned numBanks = static_cast<unsigned>(config.banks);
+  unsigned numDramRanks = static_cast<unsigned>(config.channels * config.ranks);
+  unsigned rank = coreId / m_numCoresPerRank;
+  unsigned coreIdxInRank = coreId % m_numCoresPerRank;
+  unsigned bank = 0;
+  unsigned coreIdxInBank = 0;
+  if (m_numCoresPerRank >= numBanks) {
+    bank = coreIdxInRank / m_numCoresPerBank;
+    coreIdxInBank = coreIdxInRank % m_numCoresPerBank;
+  } else {
+    bank = coreIdxInRank * (numBanks / m_numCoresPerRank);
+  }
+  // PIM ranks sharing a DRAMsim3 rank follow the cores of the previous ones in each bank
+  coreIdxInBank += (rank / numDramRanks) * m_numCoresPerBank;
+  uint64_t channel = (rank / config.ranks) % config.channels;
+  uint64_t dramRank = rank % config.ranks;
+  uint64_t bankGroup = bank / config.banks_per_group;
+  uint64_t bankInGroup = bank % config.banks_per_group;
+  uint64_t dramRow = (static_cast<uint64_t>(coreIdxInBank) * m_numDramRowsPerCore + rowIdx % m_numDramRowsPerCore) % config.rows;
+  uint64_t address = ((channel & config.ch_mask) << config.ch_pos)
+                   | ((dramRank & config.ra_mask) << config.ra_pos)
+                   | ((bankGroup & config.bg_mask) << config.bg_pos)
+                   | ((bankInGroup & config.ba_mask) << config.ba_pos)
+                   | ((dramRow & config.ro_mask) << config.ro_pos)
+                   | ((burstIdx & config.co_mask) << config.co_pos);
+  return address << config.shift_bits;
+}
+
+//! @brief  Issue transactions in order as DRAMsim3 accepts them, and return cycles until all of them complete.
+//!         DRAMsim3 acknowledges writes once buffered. With the write buffer drain patch of DRAMsim3, writes
+//!         complete when drained to DRAM. Otherwise they complete when acknowledged, and are drained during later
+//!         commands
+uint64_t
+pimDramSim::runTransactions(const std::vector<uint64_t>& addresses, bool isWrite)
+{
+  uint64_t numCycles = 0;
+  size_t idx = 0;
+  m_numPending = 0;
+  while (idx < addresses.size() || m_numPending > 0 || (isWrite && !isWriteBufferEmpty())) {
+    while (idx < addresses.size() && m_memorySystem->WillAcceptTransaction(addresses[idx], isWrite)) {
+      m_memorySystem->AddTransaction(addresses[idx], isWrite);
+      ++m_numPending;
+      ++idx;
+    }
+#ifdef DRAMSIM3_WRITE_BUFFER_DRAIN
+    if (isWrite) {
+      m_memorySystem->DrainWriteBuffer();
+    }
+#endif
+    m_memorySystem->ClockTick();
+    ++numCycles;
+  }
+  return numCycles;
+}
+
+//! @brief  Check if DRAMsim3 has drained all buffered writes, which is only known with the write buffer drain patch
+bool
+pimDramSim::isWriteBufferEmpty() const
+{
+#ifdef DRAMSIM3_WRITE_BUFFER_DRAIN
+  return m_memorySystem->IsWriteBufferEmpty();
+#else
+  return true;
+#endif
+}
+
+#endif
+
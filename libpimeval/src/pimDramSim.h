@@ -0,0 +1,69 @@
+// File: pimDramSim.h
+// PIMeval Simulator - DRAMsim3 Cycle-Level Timing of PIM Commands
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#ifndef LAVA_PIM_DRAM_SIM_H
+#define LAVA_PIM_DRAM_SIM_H
+
+#ifdef DRAMSIM3_INTEG
+
+#include "libpimeval.h"
+#include "memory_system.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class pimCmd;
+class pimResMgr;
+class pimObjInfo;
+class pimStatsMgr;
+
+
+//! @class  pimDramSim
+//! @brief  Simulate row accesses of PIM commands and data copies with DRAMsim3 as a validation of analytical models
+//! Each row of a PIM object read or written by a command is lowered into DRAMsim3 transactions on the bank of
+//! its core, across the channel, rank, bank group and bank topology of the DRAMsim3 config. DRAMsim3 issues
+//! ACT/PRE for every row, and a row of a horizontal layout object moves through the global data lines in bursts.
+//! A vertical layout row is computed within its subarray with one access. Micro ops repeated on the same rows by
+//! bit-serial programs are not lowered. A command reads all its source rows before writing its destination rows,
+//! and its writes are drained from the DRAMsim3 write buffer to DRAM before it completes. Draining needs DRAMsim3
+//! with third-party/patches/DRAMsim3-write-buffer-drain.patch. With upstream DRAMsim3, which only has the public
+//! MemorySystem API, writes are timed until buffered and drain during later commands. Bursts of all banks
+//! share the channel data bus in DRAMsim3, so the simulated runtime is an upper bound for bank-parallel PIM.
+//! DRAM state, including refresh, carries over across commands. With a sample interval N, only every Nth
+//! command of each command type is simulated
+class pimDramSim
+{
+public:
+  pimDramSim(const std::string& memConfigFile, unsigned numCores, unsigned numRowsPerCore, unsigned numRanks, unsigned sampleInterval);
+  ~pimDramSim() {}
+
+  void simulate(const pimCmd& cmd, const pimResMgr& resMgr, double msModeled, pimStatsMgr* statsMgr);
+
+private:
+  void addObjTransactions(const pimObjInfo& obj, std::vector<uint64_t>& addresses) const;
+  uint64_t getAddress(PimCoreId coreId, unsigned rowIdx, unsigned burstIdx) const;
+  uint64_t runTransactions(const std::vector<uint64_t>& addresses, bool isWrite);
+  bool isWriteBufferEmpty() const;
+
+  std::unique_ptr<dramsim3::Config> m_dramConfig;
+  std::unique_ptr<dramsim3::MemorySystem> m_memorySystem;
+  std::mutex m_mutex;
+  unsigned m_numCoresPerRank = 0;
+  unsigned m_numCoresPerBank = 1;
+  unsigned m_numDramRowsPerCore = 1;
+  unsigned m_sampleInterval = 1;
+  std::unordered_map<std::string, uint64_t> m_numCmdsPerType;
+  uint64_t m_numPending = 0;
+  std::vector<uint64_t> m_readAddresses;
+  std::vector<uint64_t> m_writeAddresses;
+};
+
+#endif
+#endif
+
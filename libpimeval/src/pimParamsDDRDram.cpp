@@ -9,6 +9,7 @@
 #include <sstream>
 #include <string>
 #include <algorithm>
+#include <cstdint>
 #include <cctype>
 #include <locale>
 #include <stdexcept>
@@ -153,3 +154,15 @@ pimParamsDDRDram::pimParamsDDRDram(std::unordered_map<std::string, std::string>
   }
 }
 
+
+//! @brief  Number of ranks sharing the data bus of a channel, derived from channel size in MB and chip density
+int
+pimParamsDDRDram::getNumRanksPerChannel() const
+{
+  uint64_t megabitsPerChip = static_cast<uint64_t>(m_rows) * m_columns * m_deviceWidth * m_bankgroups * m_banksPerGroup / (1024 * 1024);
+  uint64_t megabytesPerRank = megabitsPerChip * getNumChipsPerRank() / 8;
+  if (megabytesPerRank == 0) {
+    return 1;
+  }
+  return std::max(1, static_cast<int>(m_channelSize / megabytesPerRank));
+}
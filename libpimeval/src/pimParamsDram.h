@@ -46,6 +46,13 @@ public:
   virtual double getPjWrite() const = 0;
   virtual double getPjPrecharge() const = 0;
   virtual double getPjActivate() const = 0;
+  virtual double getNsRefreshInterval() const = 0;
+  virtual double getNsRefreshCycle() const = 0;
+  virtual double getPjRefresh() const = 0;
+  virtual int getNumRanksPerChannel() const = 0;
+  virtual double getNsRankToRank() const = 0;
+  virtual double getNsReadToWrite() const = 0;
+  virtual double getNsWriteToRead() const = 0;
   virtual double gettRCD() const = 0;
   virtual double gettRP() const = 0;
   virtual double gettCCD_L() const = 0;
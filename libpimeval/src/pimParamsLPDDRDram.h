@@ -40,6 +40,13 @@ public:
   double getPjWrite() const override { return m_VDD * 0.15 * m_tCK * m_tCCD_L * (m_IDD4W - m_IDD3N); } // write power per chip (data copy)
   double getPjPrecharge() const override { return m_VDD * ((m_IDD0 * m_tRP) - (m_IDD2N * m_tRP)); } // precharge power per chip
   double getPjActivate() const override { return m_VDD * ((m_IDD0 * m_tRP) - (m_IDD3N * m_tRAS)); } // activate power per chip
+  double getNsRefreshInterval() const override { return m_tCK * m_tREFI; }
+  double getNsRefreshCycle() const override { return m_tCK * m_tRFC; }
+  double getPjRefresh() const override { return m_VDD * (m_IDD5AB - m_IDD3N) * m_tRFC; } // all-bank refresh energy per chip
+  int getNumRanksPerChannel() const override; // ranks sharing the data bus of a channel, same as DRAMsim3
+  double getNsRankToRank() const override { return m_tCK * m_tRTRS; }
+  double getNsReadToWrite() const override { return m_tCK * (m_CL + m_BL / 2 + 2 - m_CWL); }
+  double getNsWriteToRead() const override { return m_tCK * (m_CWL + m_BL / 2 + m_tWTR_L); }
   double gettRCD() const override { return m_tRCD; }
   double gettRP() const override { return m_tRP; }
   double gettCCD_L() const override { return m_tCCD_L; }
@@ -29,6 +29,11 @@ public:
   virtual pimeval::perfEnergy getPerfEnergyForRotate(PimCmdEnum cmdType, const pimObjInfo& obj) const override;
   
 protected:
+  virtual pimeval::perfEnergy getPerfEnergyForOpenRowHit(unsigned numCores) const override
+  {
+    return pimeval::perfEnergy(m_tACT + m_tPRE, (m_eACT + m_ePRE) * numCores, m_tACT + m_tPRE, 0.0, 0.0, 0);
+  }
+
   unsigned m_aquaboltFPUBitWidth = 16;
   // TODO: Update for Aquabolt
   double m_aquaboltArithmeticEnergy = 0.0000000004992329586; // mJ
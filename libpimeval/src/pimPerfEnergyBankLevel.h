@@ -28,8 +28,14 @@ public:
   virtual pimeval::perfEnergy getPerfEnergyForBroadcast(PimCmdEnum cmdType, const pimObjInfo& obj) const override;
   virtual pimeval::perfEnergy getPerfEnergyForRotate(PimCmdEnum cmdType, const pimObjInfo& obj) const override;
   virtual pimeval::perfEnergy getPerfEnergyForPrefixSum(PimCmdEnum cmdType, const pimObjInfo& obj) const override;
+  virtual bool isLoadBalanceModeled() const override { return true; }
 
 protected:
+  virtual pimeval::perfEnergy getPerfEnergyForOpenRowHit(unsigned numCores) const override
+  {
+    return pimeval::perfEnergy(m_tACT + m_tPRE, (m_eACT + m_ePRE) * numCores, m_tACT + m_tPRE, 0.0, 0.0, 0);
+  }
+
   double m_blimpLatency = m_tCCD_L * m_tCK;
   unsigned m_blimpCoreBitWidth = m_GDLWidth;
   unsigned m_simdUnitCount = m_blimpCoreBitWidth / 32; // 32-bit SIMD unit
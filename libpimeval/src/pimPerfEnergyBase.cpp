@@ -11,8 +11,10 @@
 #include "pimPerfEnergyBankLevel.h"
 #include "pimPerfEnergyAquabolt.h"
 #include "pimPerfEnergyAim.h"
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <map>
 
 
 //! @brief  A factory function to create perf energy model for sim target
@@ -49,7 +51,8 @@ pimPerfEnergyFactory::createPerfEnergyModel(const pimPerfEnergyModelParams& para
 pimPerfEnergyBase::pimPerfEnergyBase(const pimPerfEnergyModelParams& params)
   : m_simTarget(params.getSimTarget()),
     m_numRanks(params.getNumRanks()),
-    m_paramsDram(params.getParamsDram())
+    m_paramsDram(params.getParamsDram()),
+    m_isOpenPagePolicy(params.isOpenPagePolicy())
 {
   m_tR = m_paramsDram.getNsRowRead() / m_nano_to_milli;
   m_tW = m_paramsDram.getNsRowWrite() / m_nano_to_milli;
@@ -75,6 +78,139 @@ pimPerfEnergyBase::pimPerfEnergyBase(const pimPerfEnergyModelParams& params)
   m_tRP = m_paramsDram.gettRP();
   m_tCAS = m_paramsDram.getNsTCAS() / m_nano_to_milli; // Convert ns to ms
   m_tRAS = m_paramsDram.gettRAS();
+  m_numRanksPerChannel = std::max(1, m_paramsDram.getNumRanksPerChannel());
+  m_numChannels = std::max(1u, (m_numRanks + m_numRanksPerChannel - 1) / m_numRanksPerChannel);
+  m_tRTRS = m_paramsDram.getNsRankToRank() / m_nano_to_milli;
+  m_tRTW = m_paramsDram.getNsReadToWrite() / m_nano_to_milli;
+  m_tWTR = m_paramsDram.getNsWriteToRead() / m_nano_to_milli;
+  m_tREFI = m_paramsDram.getNsRefreshInterval() / m_nano_to_milli;
+  m_tRFC = m_paramsDram.getNsRefreshCycle() / m_nano_to_milli;
+  m_eREF = m_paramsDram.getPjRefresh() / m_pico_to_milli;
+}
+
+//! @brief  Number of all-bank refreshes that stall PIM commands with a total modeled runtime
+//! A refresh is issued every tREFI and blocks all banks for tRFC, so PIM commands progress tREFI - tRFC
+//! between two refreshes. Runtime shorter than that is not stalled
+uint64_t
+pimPerfEnergyBase::getNumRefresh(double msRuntime) const
+{
+  if (msRuntime <= 0.0 || m_tREFI <= m_tRFC) {
+    return 0;
+  }
+  return static_cast<uint64_t>(msRuntime / (m_tREFI - m_tRFC));
+}
+
+//! @brief  Perf energy model of all-bank refreshes of all chips
+pimeval::perfEnergy
+pimPerfEnergyBase::getPerfEnergyForRefresh(uint64_t numRefresh) const
+{
+  double msRuntime = m_tRFC * numRefresh;
+  double mjEnergy = m_eREF * m_numChipsPerRank * m_numRanks * numRefresh;
+  mjEnergy += m_pBChip * m_numChipsPerRank * m_numRanks * msRuntime;
+  return pimeval::perfEnergy(msRuntime, mjEnergy, 0.0, 0.0, 0.0, 0);
+}
+
+//! @brief  Perf energy model of data transfer between CPU memory and a range of elements of a PIM object
+//! Each channel transfers data of the cores in its ranks over its own data bus, and the slowest channel
+//! determines the runtime. Switching between ranks of a channel adds to the runtime of a channel. Bus turnaround
+//! between reads and writes depends on the order of copies, and is modeled on the timeline of the stats manager.
+//! Device-to-device copies do not use channels.
+pimeval::perfEnergy
+pimPerfEnergyBase::getPerfEnergyForObjTransfer(PimCmdEnum cmdType, const pimObjInfo& obj, uint64_t idxBegin, uint64_t idxEnd) const
+{
+  unsigned bitsPerElement = obj.getBitsPerElement(PimBitWidth::ACTUAL);
+  uint64_t numBytes = (idxEnd - idxBegin) * bitsPerElement / 8;
+  pimeval::perfEnergy perfEnergy = getPerfEnergyForBytesTransfer(cmdType, numBytes);
+  if (cmdType != PimCmdEnum::COPY_H2D && cmdType != PimCmdEnum::COPY_D2H) {
+    return perfEnergy;
+  }
+
+  // bits and ranks of each channel
+  std::vector<uint64_t> numBitsPerChannel(m_numChannels, 0);
+  std::vector<std::vector<bool>> isRankUsed(m_numChannels, std::vector<bool>(m_numRanksPerChannel, false));
+  unsigned numCoresPerRank = std::max(1u, obj.getNumCoreAvailable() / m_numRanks);
+  for (const pimRegion& region : obj.getRegions()) {
+    uint64_t elemIdxBegin = std::max(region.getElemIdxBegin(), idxBegin);
+    uint64_t elemIdxEnd = std::min(region.getElemIdxEnd(), idxEnd);
+    if (elemIdxBegin >= elemIdxEnd) {
+      continue;
+    }
+    unsigned rank = std::min(static_cast<unsigned>(region.getCoreId()) / numCoresPerRank, m_numRanks - 1);
+    unsigned channel = rank / m_numRanksPerChannel;
+    numBitsPerChannel[channel] += (elemIdxEnd - elemIdxBegin) * bitsPerElement;
+    isRankUsed[channel][rank % m_numRanksPerChannel] = true;
+  }
+
+  double msRuntime = 0.0;
+  double bytesPerMs = m_typicalRankBW * 1024 * 1024 * 1024 / 1000;
+  for (unsigned channel = 0; channel < m_numChannels; ++channel) {
+    if (numBitsPerChannel[channel] == 0) {
+      continue;
+    }
+    double msChannel = static_cast<double>(numBitsPerChannel[channel] / 8) / bytesPerMs;
+    unsigned numRanksUsed = std::count(isRankUsed[channel].begin(), isRankUsed[channel].end(), true);
+    msChannel += m_tRTRS * (numRanksUsed - 1);
+    msRuntime = std::max(msRuntime, msChannel);
+  }
+  // data transfer energy stays the same, while background energy follows the runtime
+  perfEnergy.m_mjEnergy += m_pBChip * m_numChipsPerRank * m_numRanks * (msRuntime - perfEnergy.m_msRuntime);
+  perfEnergy.m_msRuntime = msRuntime;
+  return perfEnergy;
+}
+
+//! @brief  Model row buffer locality across PIM commands with open-page policy
+//! A command leaves the last row it accessed open in the row buffer of each core. If the first rows read by
+//! the next command are still open on all of its cores, one row activation and precharge is saved. Passing
+//! no object to read or to access last closes all rows, e.g., for data transfer between host and device.
+//! With closed-page policy, every command activates its rows and precharges them afterwards.
+void
+pimPerfEnergyBase::applyRowBufferLocality(pimeval::perfEnergy& perfEnergy, const pimObjInfo* objRead, const pimObjInfo* objLastAccessed) const
+{
+  if (!m_isOpenPagePolicy) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_openRowMutex);
+  if (objRead) {
+    // a command processes the first region of each core in its first pass
+    std::map<PimCoreId, const pimRegion*> firstRegions;
+    for (const pimRegion& region : objRead->getRegions()) {
+      auto it = firstRegions.find(region.getCoreId());
+      if (it == firstRegions.end() || region.getElemIdxBegin() < it->second->getElemIdxBegin()) {
+        firstRegions[region.getCoreId()] = &region;
+      }
+    }
+    unsigned numHits = 0;
+    for (const auto& [coreId, region] : firstRegions) {
+      auto it = m_openRows.find(coreId);
+      if (it != m_openRows.end() && it->second == region->getRowIdx()) {
+        ++numHits;
+      }
+    }
+    // cores work in parallel, so runtime is saved only if all cores hit open rows
+    pimeval::perfEnergy hit = getPerfEnergyForOpenRowHit(numHits);
+    if (numHits > 0 && numHits == firstRegions.size()) {
+      perfEnergy.m_msRuntime -= hit.m_msRuntime;
+      perfEnergy.m_msRead -= hit.m_msRuntime;
+      perfEnergy.m_mjEnergy -= m_pBChip * m_numChipsPerRank * m_numRanks * hit.m_msRuntime;
+    }
+    perfEnergy.m_mjEnergy -= hit.m_mjEnergy;
+  }
+  if (!objRead && !objLastAccessed) {
+    m_openRows.clear();
+  } else if (objLastAccessed) {
+    // the last region of each core stays open after the last pass. Same as the perf energy models,
+    // a region is activated once per pass, so it is identified by its first row
+    std::map<PimCoreId, const pimRegion*> lastRegions;
+    for (const pimRegion& region : objLastAccessed->getRegions()) {
+      auto it = lastRegions.find(region.getCoreId());
+      if (it == lastRegions.end() || region.getElemIdxBegin() > it->second->getElemIdxBegin()) {
+        lastRegions[region.getCoreId()] = &region;
+      }
+    }
+    for (const auto& [coreId, region] : lastRegions) {
+      m_openRows[coreId] = region->getRowIdx();
+    }
+  }
 }
 
 //! @brief  Perf energy model of data transfer between CPU memory and PIM memory
@@ -87,24 +223,29 @@ pimPerfEnergyBase::getPerfEnergyForBytesTransfer(PimCmdEnum cmdType, uint64_t nu
   double msWrite = 0.0;
   double msCompute = 0.0;
   uint64_t mTotalOP = 0;
-  double msRuntime = static_cast<double>(numBytes) / (m_typicalRankBW * m_numRanks * 1024 * 1024 * 1024 / 1000);
+  // data transfer energy of all ranks. Ranks of a channel share its data bus, and data are evenly distributed among channels
+  double msTransfer = static_cast<double>(numBytes) / (m_typicalRankBW * m_numRanks * 1024 * 1024 * 1024 / 1000);
+  double msRuntime = msTransfer;
+  if (cmdType == PimCmdEnum::COPY_H2D || cmdType == PimCmdEnum::COPY_D2H) {
+    msRuntime = static_cast<double>(numBytes) / (m_typicalRankBW * m_numChannels * 1024 * 1024 * 1024 / 1000);
+  }
   switch (cmdType) {
     case PimCmdEnum::COPY_H2D:
     {
-      mjEnergy = m_eW * msRuntime * m_numChipsPerRank * m_numRanks;
+      mjEnergy = m_eW * msTransfer * m_numChipsPerRank * m_numRanks;
       mjEnergy += m_pBChip * m_numChipsPerRank * m_numRanks * msRuntime;
       break;
     }
     case PimCmdEnum::COPY_D2H:
     {
-      mjEnergy = m_eR * msRuntime * m_numChipsPerRank * m_numRanks;
+      mjEnergy = m_eR * msTransfer * m_numChipsPerRank * m_numRanks;
       mjEnergy += m_pBChip * m_numChipsPerRank * m_numRanks * msRuntime;
       break;
     }
     case PimCmdEnum::COPY_D2D:
     {
       // One row read, one row write within a subarray
-      mjEnergy = m_eAP * 2 * msRuntime * m_numChipsPerRank * m_numRanks;
+      mjEnergy = m_eAP * 2 * msTransfer * m_numChipsPerRank * m_numRanks;
       mjEnergy += m_pBChip * m_numChipsPerRank * m_numRanks * msRuntime;
       break;
     }
@@ -13,6 +13,9 @@
 #include "pimResMgr.h"                 // for pimObjInfo
 #include <cstdint>
 #include <memory>                      // for std::unique_ptr
+#include <mutex>                       // for std::mutex
+#include <unordered_map>               // for std::unordered_map
+#include <vector>                      // for std::vector
 
 
 namespace pimeval {
@@ -36,15 +39,17 @@ namespace pimeval {
 class pimPerfEnergyModelParams
 {
 public:
-  pimPerfEnergyModelParams(PimDeviceEnum simTarget, unsigned numRanks, const pimParamsDram& paramsDram)
-    : m_simTarget(simTarget), m_numRanks(numRanks), m_paramsDram(paramsDram) {}
+  pimPerfEnergyModelParams(PimDeviceEnum simTarget, unsigned numRanks, const pimParamsDram& paramsDram, bool isOpenPagePolicy = false)
+    : m_simTarget(simTarget), m_numRanks(numRanks), m_paramsDram(paramsDram), m_isOpenPagePolicy(isOpenPagePolicy) {}
   PimDeviceEnum getSimTarget() const { return m_simTarget; }
   unsigned getNumRanks() const { return m_numRanks; }
   const pimParamsDram& getParamsDram() const { return m_paramsDram; }
+  bool isOpenPagePolicy() const { return m_isOpenPagePolicy; }
 private:
   PimDeviceEnum m_simTarget;
   unsigned m_numRanks;
   const pimParamsDram& m_paramsDram;
+  bool m_isOpenPagePolicy;
 };
 
 //! @class  pimPerfEnergyFactory
@@ -66,6 +71,7 @@ public:
   virtual ~pimPerfEnergyBase() {}
 
   virtual pimeval::perfEnergy getPerfEnergyForBytesTransfer(PimCmdEnum cmdType, uint64_t numBytes) const;
+  pimeval::perfEnergy getPerfEnergyForObjTransfer(PimCmdEnum cmdType, const pimObjInfo& obj, uint64_t idxBegin, uint64_t idxEnd) const;
   virtual pimeval::perfEnergy getPerfEnergyForFunc1(PimCmdEnum cmdType, const pimObjInfo& objSrc, const pimObjInfo& objDest) const;
   virtual pimeval::perfEnergy getPerfEnergyForFunc2(PimCmdEnum cmdType, const pimObjInfo& objSrc1, const pimObjInfo& objSrc2, const pimObjInfo& objDest) const;
   virtual pimeval::perfEnergy getPerfEnergyForReduction(PimCmdEnum cmdType, const pimObjInfo& obj, unsigned numPass) const;
@@ -74,10 +80,27 @@ public:
   virtual pimeval::perfEnergy getPerfEnergyForPrefixSum(PimCmdEnum cmdType, const pimObjInfo& obj) const;
   virtual pimeval::perfEnergy getPerfEnergyForMac(PimCmdEnum cmdType, const pimObjInfo& obj) const;
 
+  uint64_t getNumRefresh(double msRuntime) const;
+  pimeval::perfEnergy getPerfEnergyForRefresh(uint64_t numRefresh) const;
+  void applyRowBufferLocality(pimeval::perfEnergy& perfEnergy, const pimObjInfo* objRead, const pimObjInfo* objLastAccessed) const;
+  bool isOpenPagePolicy() const { return m_isOpenPagePolicy; }
+  unsigned getNumChannels() const { return m_numChannels; }
+  unsigned getNumRanksPerChannel() const { return m_numRanksPerChannel; }
+  double getMsReadToWrite() const { return m_tRTW; }
+  double getMsWriteToRead() const { return m_tWTR; }
+  //! @brief  Whether the model spreads elements of a load-balanced object evenly over all cores
+  virtual bool isLoadBalanceModeled() const { return false; }
+
 protected:
+  // Runtime and energy saved when a command reads rows that are still open on numCores cores
+  virtual pimeval::perfEnergy getPerfEnergyForOpenRowHit(unsigned numCores) const { return pimeval::perfEnergy(); }
+
   PimDeviceEnum m_simTarget;
   unsigned m_numRanks;
   const pimParamsDram& m_paramsDram;
+  bool m_isOpenPagePolicy;
+  mutable std::mutex m_openRowMutex;
+  mutable std::unordered_map<PimCoreId, unsigned> m_openRows; // open row index of each core with open-page policy
 
   const double m_nano_to_milli = 1000000.0;
   const double m_pico_to_milli = 1000000000.0;
@@ -88,9 +111,16 @@ protected:
   double m_tL; // Logic operation for bitserial / tCCD in ms
   double m_tGDL; // Fetch data from local row buffer to global row buffer
   double m_tCAS; // CAS time in ms
+  double m_tREFI; // Refresh interval in ms
+  double m_tRFC; // Refresh cycle time in ms
   int m_GDLWidth; // Number of bits that can be fetched from local to global row buffer.
   int m_numChipsPerRank; // Number of chips per rank
   double m_typicalRankBW; // typical rank data transfer bandwidth in GB/s
+  unsigned m_numRanksPerChannel; // Number of ranks sharing the data bus of a channel
+  unsigned m_numChannels; // Number of channels of all ranks
+  double m_tRTRS; // Rank to rank switching time in ms
+  double m_tRTW; // Read to write bus turnaround time in ms
+  double m_tWTR; // Write to read bus turnaround time in ms
 
   double m_eAP; // Row read(ACT) energy in mJ microjoule
   double m_eL; // Logic energy in mJ microjoule
@@ -98,6 +128,7 @@ protected:
   double m_eW; // global row buffer to local row buffer
   double m_eACT; // Row activate energy in mJ 
   double m_ePRE; // Row precharge energy in mJ
+  double m_eREF; // All-bank refresh energy per chip in mJ
   double m_pBCore; // background power for each core in W
   double m_pBChip; // background power for each core in W
   double m_tCK; // Clock cycle time in ms
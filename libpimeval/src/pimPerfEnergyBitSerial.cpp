@@ -42,20 +42,13 @@ pimPerfEnergyBitSerial::getPerfEnergyBitSerial(PimDeviceEnum deviceType, PimCmdE
       if (deviceType == PIM_DEVICE_BITSIMD_H) {
         deviceType = PIM_DEVICE_BITSIMD_V;
       }
-      // look up perf params from table
+      // look up perf params from table, scaled to bit width for custom bit-width integers
       unsigned numR = 0, numW = 0, numL = 0;
-      auto it1 = pimPerfEnergyTables::bitsimdPerfTable.find(deviceType);
-      if (it1 != pimPerfEnergyTables::bitsimdPerfTable.end()) {
-        auto it2 = it1->second.find(dataType);
-        if (it2 != it1->second.end()) {
-          auto it3 = it2->second.find(cmdType);
-          if (it3 != it2->second.end()) {
-            numR = std::get<0>(it3->second);
-            numW = std::get<1>(it3->second);
-            numL = std::get<2>(it3->second);
-            ok = true;
-          }
-        }
+      bool isCustomInt = (cmdType == PimCmdEnum::ADD ? objDest.isCustomInt() : objSrc1.isCustomInt());
+      if (isCustomInt) {
+        ok = pimPerfEnergyTables::getBitsimdPerfCustomInt(deviceType, dataType, cmdType, bitsPerElement, numR, numW, numL);
+      } else {
+        ok = pimPerfEnergyTables::getBitsimdPerf(deviceType, dataType, cmdType, numR, numW, numL);
       }
       // workaround: adjust for add/sub mixed data type cases
       if (ok) {
@@ -63,8 +56,8 @@ pimPerfEnergyBitSerial::getPerfEnergyBitSerial(PimDeviceEnum deviceType, PimCmdE
         // pimSub: int - bool = int
         if (cmdType == PimCmdEnum::ADD || cmdType == PimCmdEnum::SUB) {
           if (pimUtils::isSigned(dataType) || pimUtils::isUnsigned(dataType)) {
-            unsigned numBitsSrc1 = pimUtils::getNumBitsOfDataType(objSrc1.getDataType(), PimBitWidth::ACTUAL);
-            unsigned numBitsSrc2 = pimUtils::getNumBitsOfDataType(objSrc2.getDataType(), PimBitWidth::ACTUAL);
+            unsigned numBitsSrc1 = objSrc1.getBitsPerElement(PimBitWidth::ACTUAL);
+            unsigned numBitsSrc2 = objSrc2.getBitsPerElement(PimBitWidth::ACTUAL);
             numR = numBitsSrc1 + numBitsSrc2;
           }
         }
@@ -28,8 +28,14 @@ public:
   virtual pimeval::perfEnergy getPerfEnergyForBroadcast(PimCmdEnum cmdType, const pimObjInfo& obj) const override;
   virtual pimeval::perfEnergy getPerfEnergyForRotate(PimCmdEnum cmdType, const pimObjInfo& obj) const override;
   virtual pimeval::perfEnergy getPerfEnergyForPrefixSum(PimCmdEnum cmdType, const pimObjInfo& obj) const override;
+  virtual bool isLoadBalanceModeled() const override { return true; }
 
 protected:
+  virtual pimeval::perfEnergy getPerfEnergyForOpenRowHit(unsigned numCores) const override
+  {
+    return pimeval::perfEnergy(m_tR, m_eAP * numCores, m_tR, 0.0, 0.0, 0);
+  }
+
   double m_fulcrumMulLatency = 0.00000609; // 6.09ns
   double m_fulcrumAddLatency = 0.00000120; // 1.20ns
   unsigned m_fulcrumAluBitWidth = 32;
@@ -6,11 +6,17 @@
 
 #include "pimPerfEnergyTables.h"
 #include "pimCmd.h"
+#include "pimUtils.h"
 #include <unordered_map>
 #include <tuple>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <algorithm>
 
 
 //! @brief  BitSIMD performance table (Tuple: #R, #W, #L)
+//!         Manually maintained. Entries of passed bit-serial micro-programs are overridden by bitsimdPerfTableGenerated
 const std::unordered_map<PimDeviceEnum, std::unordered_map<PimDataType,
     std::unordered_map<PimCmdEnum, std::tuple<unsigned, unsigned, unsigned>>>>
 pimPerfEnergyTables::bitsimdPerfTable = {
@@ -660,4 +666,115 @@ pimPerfEnergyTables::bitsimdPerfTable = {
   }},
 };
 
+//! @brief  Look up #R, #W, #L of a BitSIMD command. Generated table from bit-serial micro-programs
+//!         takes priority over the manually maintained table
+bool
+pimPerfEnergyTables::getBitsimdPerf(PimDeviceEnum deviceType, PimDataType dataType, PimCmdEnum cmdType, unsigned& numR, unsigned& numW, unsigned& numL)
+{
+  for (const auto* table : { &bitsimdPerfTableGenerated, &bitsimdPerfTable }) {
+    auto it1 = table->find(deviceType);
+    if (it1 == table->end()) {
+      continue;
+    }
+    auto it2 = it1->second.find(dataType);
+    if (it2 == it1->second.end()) {
+      continue;
+    }
+    auto it3 = it2->second.find(cmdType);
+    if (it3 == it2->second.end()) {
+      continue;
+    }
+    std::tie(numR, numW, numL) = it3->second;
+    return true;
+  }
+  return false;
+}
 
+//! @brief  Get #R, #W, #L of a BitSIMD command on custom bit-width integers
+//!         Counts of passed bit-serial micro-programs run at numBits are exact. Without such a micro-program,
+//!         e.g., mul and div wider than 32 bits, fit a polynomial of up to degree 2 to the table entries of
+//!         standard integer types with the same signedness, and evaluate it at numBits. Micro-programs scale
+//!         linearly (e.g., add) or quadratically (e.g., mul, div) with the bit width, but the fit is off by a
+//!         few logic ops at small widths where programs have fixed setup ops
+bool
+pimPerfEnergyTables::getBitsimdPerfCustomInt(PimDeviceEnum deviceType, PimDataType dataType, PimCmdEnum cmdType, unsigned numBits, unsigned& numR, unsigned& numW, unsigned& numL)
+{
+  bool isSigned = pimUtils::isSigned(dataType);
+  auto it1 = bitsimdPerfTableCustomIntGenerated.find(deviceType);
+  if (it1 != bitsimdPerfTableCustomIntGenerated.end()) {
+    auto it2 = it1->second.find({ isSigned, numBits });
+    if (it2 != it1->second.end()) {
+      auto it3 = it2->second.find(cmdType);
+      if (it3 != it2->second.end()) {
+        std::tie(numR, numW, numL) = it3->second;
+        return true;
+      }
+    }
+  }
+
+  const std::vector<std::pair<unsigned, PimDataType>> stdTypes = isSigned
+      ? std::vector<std::pair<unsigned, PimDataType>>{ {8, PIM_INT8}, {16, PIM_INT16}, {32, PIM_INT32}, {64, PIM_INT64} }
+      : std::vector<std::pair<unsigned, PimDataType>>{ {8, PIM_UINT8}, {16, PIM_UINT16}, {32, PIM_UINT32}, {64, PIM_UINT64} };
+  std::vector<double> xs;
+  std::vector<std::array<double, 3>> ys;
+  for (const auto& [bits, stdType] : stdTypes) {
+    unsigned r = 0, w = 0, l = 0;
+    if (getBitsimdPerf(deviceType, stdType, cmdType, r, w, l)) {
+      if (bits == numBits) {
+        numR = r;
+        numW = w;
+        numL = l;
+        return true;
+      }
+      xs.push_back(bits);
+      ys.push_back({ static_cast<double>(r), static_cast<double>(w), static_cast<double>(l) });
+    }
+  }
+  if (xs.empty()) {
+    return false;
+  }
+
+  // least squares fit of y = c0 + c1 * x + c2 * x^2, with degree limited by number of samples
+  size_t degree = std::min<size_t>(xs.size() - 1, 2);
+  double counts[3] = { 0.0, 0.0, 0.0 };
+  for (int k = 0; k < 3; ++k) {
+    if (degree == 0) {
+      // single sample: scale proportionally to bit width
+      counts[k] = ys[0][k] * numBits / xs[0];
+      continue;
+    }
+    // normal equations: A^T A c = A^T y, solved with Gaussian elimination
+    size_t n = degree + 1;
+    double m[3][4] = {};
+    for (size_t i = 0; i < xs.size(); ++i) {
+      double pw[3] = { 1.0, xs[i], xs[i] * xs[i] };
+      for (size_t r = 0; r < n; ++r) {
+        for (size_t c = 0; c < n; ++c) {
+          m[r][c] += pw[r] * pw[c];
+        }
+        m[r][n] += pw[r] * ys[i][k];
+      }
+    }
+    for (size_t p = 0; p < n; ++p) {
+      for (size_t r = p + 1; r < n; ++r) {
+        double f = m[r][p] / m[p][p];
+        for (size_t c = p; c <= n; ++c) {
+          m[r][c] -= f * m[p][c];
+        }
+      }
+    }
+    double coef[3] = { 0.0, 0.0, 0.0 };
+    for (int r = static_cast<int>(n) - 1; r >= 0; --r) {
+      double sum = m[r][n];
+      for (size_t c = r + 1; c < n; ++c) {
+        sum -= m[r][c] * coef[c];
+      }
+      coef[r] = sum / m[r][r];
+    }
+    counts[k] = coef[0] + coef[1] * numBits + coef[2] * numBits * numBits;
+  }
+  numR = static_cast<unsigned>(std::max(0.0, std::round(counts[0])));
+  numW = static_cast<unsigned>(std::max(0.0, std::round(counts[1])));
+  numL = static_cast<unsigned>(std::max(0.0, std::round(counts[2])));
+  return true;
+}
@@ -10,14 +10,26 @@
 #include "libpimeval.h"
 #include "pimCmd.h"
 #include <unordered_map>
+#include <map>
 #include <tuple>
+#include <utility>
 
 
 namespace pimPerfEnergyTables
 {
-  // Perf-energy table of BitSIMD-V variants
+  // Perf-energy table of BitSIMD-V variants, manually maintained
   extern const std::unordered_map<PimDeviceEnum, std::unordered_map<PimDataType,
       std::unordered_map<PimCmdEnum, std::tuple<unsigned, unsigned, unsigned>>>> bitsimdPerfTable;
+  // Perf-energy table of BitSIMD-V variants, generated by the bit-serial micro-program framework
+  extern const std::unordered_map<PimDeviceEnum, std::unordered_map<PimDataType,
+      std::unordered_map<PimCmdEnum, std::tuple<unsigned, unsigned, unsigned>>>> bitsimdPerfTableGenerated;
+  // Perf-energy table of BitSIMD-V variants on custom bit-width integers keyed by signedness and bit width,
+  // generated by the bit-serial micro-program framework
+  extern const std::unordered_map<PimDeviceEnum, std::map<std::pair<bool, unsigned>,
+      std::unordered_map<PimCmdEnum, std::tuple<unsigned, unsigned, unsigned>>>> bitsimdPerfTableCustomIntGenerated;
+
+  bool getBitsimdPerf(PimDeviceEnum deviceType, PimDataType dataType, PimCmdEnum cmdType, unsigned& numR, unsigned& numW, unsigned& numL);
+  bool getBitsimdPerfCustomInt(PimDeviceEnum deviceType, PimDataType dataType, PimCmdEnum cmdType, unsigned numBits, unsigned& numR, unsigned& numW, unsigned& numL);
 }
 
 #endif
@@ -0,0 +1,5377 @@
+// File: pimPerfEnergyTablesGenerated.cpp
+// PIMeval Simulator - Performance and Energy Tables
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+//
+// Generated by the bit-serial micro-program framework. Do not edit manually.
+// To regenerate: cd bit-serial && make tables
+
+#include "pimPerfEnergyTables.h"
+#include "pimCmd.h"
+#include <unordered_map>
+#include <map>
+#include <tuple>
+#include <utility>
+
+
+//! @brief  BitSIMD performance table of passed bit-serial micro-programs (Tuple: #R, #W, #L)
+const std::unordered_map<PimDeviceEnum, std::unordered_map<PimDataType,
+    std::unordered_map<PimCmdEnum, std::tuple<unsigned, unsigned, unsigned>>>>
+pimPerfEnergyTables::bitsimdPerfTableGenerated = {
+  { PIM_DEVICE_BITSIMD_V, {
+    { PIM_INT8, {
+      { PimCmdEnum::ABS,          {    8,    8,   32 } },
+      { PimCmdEnum::ADD,          {   16,    8,   24 } },
+      { PimCmdEnum::SUB,          {   16,    8,   24 } },
+      { PimCmdEnum::MUL,          {   72,   36,  128 } },
+      { PimCmdEnum::DIV,          {  172,   90,  279 } },
+      { PimCmdEnum::AND,          {   16,    8,   16 } },
+      { PimCmdEnum::OR,           {   16,    8,   16 } },
+      { PimCmdEnum::XOR,          {   16,    8,   16 } },
+      { PimCmdEnum::XNOR,         {   16,    8,   24 } },
+      { PimCmdEnum::MIN,          {   32,    8,   41 } },
+      { PimCmdEnum::MAX,          {   32,    8,   41 } },
+      { PimCmdEnum::ADD_SCALAR,   {    8,    8,   32 } },
+      { PimCmdEnum::SUB_SCALAR,   {    8,    8,   32 } },
+      { PimCmdEnum::MUL_SCALAR,   {   36,   36,  162 } },
+      { PimCmdEnum::DIV_SCALAR,   {  112,   83,  300 } },
+      { PimCmdEnum::AND_SCALAR,   {    8,    8,   24 } },
+      { PimCmdEnum::OR_SCALAR,    {    8,    8,   24 } },
+      { PimCmdEnum::XOR_SCALAR,   {    8,    8,   24 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    8,    8,   32 } },
+      { PimCmdEnum::MIN_SCALAR,   {   16,    8,   57 } },
+      { PimCmdEnum::MAX_SCALAR,   {   16,    8,   57 } },
+    }},
+    { PIM_INT16, {
+      { PimCmdEnum::ABS,          {   16,   16,   64 } },
+      { PimCmdEnum::ADD,          {   32,   16,   48 } },
+      { PimCmdEnum::SUB,          {   32,   16,   48 } },
+      { PimCmdEnum::MUL,          {  272,  136,  512 } },
+      { PimCmdEnum::DIV,          {  724,  314, 1011 } },
+      { PimCmdEnum::AND,          {   32,   16,   32 } },
+      { PimCmdEnum::OR,           {   32,   16,   32 } },
+      { PimCmdEnum::XOR,          {   32,   16,   32 } },
+      { PimCmdEnum::XNOR,         {   32,   16,   48 } },
+      { PimCmdEnum::MIN,          {   64,   16,   81 } },
+      { PimCmdEnum::MAX,          {   64,   16,   81 } },
+      { PimCmdEnum::ADD_SCALAR,   {   16,   16,   64 } },
+      { PimCmdEnum::SUB_SCALAR,   {   16,   16,   64 } },
+      { PimCmdEnum::MUL_SCALAR,   {  136,  136,  630 } },
+      { PimCmdEnum::DIV_SCALAR,   {  410,  292, 1092 } },
+      { PimCmdEnum::AND_SCALAR,   {   16,   16,   48 } },
+      { PimCmdEnum::OR_SCALAR,    {   16,   16,   48 } },
+      { PimCmdEnum::XOR_SCALAR,   {   16,   16,   48 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   16,   16,   64 } },
+      { PimCmdEnum::MIN_SCALAR,   {   32,   16,  112 } },
+      { PimCmdEnum::MAX_SCALAR,   {   32,   16,  113 } },
+    }},
+    { PIM_INT32, {
+      { PimCmdEnum::ABS,          {   32,   32,  128 } },
+      { PimCmdEnum::POPCOUNT,     {  114,  114,  218 } },
+      { PimCmdEnum::ADD,          {   64,   32,   96 } },
+      { PimCmdEnum::SUB,          {   64,   32,   96 } },
+      { PimCmdEnum::MUL,          { 1056,  528, 2048 } },
+      { PimCmdEnum::DIV,          { 2980, 1146, 3819 } },
+      { PimCmdEnum::AND,          {   64,   32,   64 } },
+      { PimCmdEnum::OR,           {   64,   32,   64 } },
+      { PimCmdEnum::XOR,          {   64,   32,   64 } },
+      { PimCmdEnum::XNOR,         {   64,   32,   96 } },
+      { PimCmdEnum::MIN,          {  128,   32,  161 } },
+      { PimCmdEnum::MAX,          {  128,   32,  161 } },
+      { PimCmdEnum::ADD_SCALAR,   {   32,   32,  128 } },
+      { PimCmdEnum::SUB_SCALAR,   {   32,   32,  128 } },
+      { PimCmdEnum::MUL_SCALAR,   {  528,  528, 2526 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1570, 1092, 4212 } },
+      { PimCmdEnum::AND_SCALAR,   {   32,   32,   96 } },
+      { PimCmdEnum::OR_SCALAR,    {   32,   32,   96 } },
+      { PimCmdEnum::XOR_SCALAR,   {   32,   32,   96 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   32,   32,  128 } },
+      { PimCmdEnum::MIN_SCALAR,   {   64,   32,  224 } },
+      { PimCmdEnum::MAX_SCALAR,   {   64,   32,  225 } },
+    }},
+    { PIM_INT64, {
+      { PimCmdEnum::ABS,          {   64,   64,  256 } },
+      { PimCmdEnum::ADD,          {  128,   64,  192 } },
+      { PimCmdEnum::SUB,          {  128,   64,  192 } },
+      { PimCmdEnum::AND,          {  128,   64,  128 } },
+      { PimCmdEnum::OR,           {  128,   64,  128 } },
+      { PimCmdEnum::XOR,          {  128,   64,  128 } },
+      { PimCmdEnum::XNOR,         {  128,   64,  192 } },
+      { PimCmdEnum::MIN,          {  256,   64,  321 } },
+      { PimCmdEnum::MAX,          {  256,   64,  321 } },
+      { PimCmdEnum::ADD_SCALAR,   {   64,   64,  256 } },
+      { PimCmdEnum::SUB_SCALAR,   {   64,   64,  256 } },
+      { PimCmdEnum::AND_SCALAR,   {   64,   64,  192 } },
+      { PimCmdEnum::OR_SCALAR,    {   64,   64,  192 } },
+      { PimCmdEnum::XOR_SCALAR,   {   64,   64,  192 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   64,   64,  256 } },
+      { PimCmdEnum::MIN_SCALAR,   {  128,   64,  448 } },
+      { PimCmdEnum::MAX_SCALAR,   {  128,   64,  449 } },
+    }},
+    { PIM_UINT8, {
+      { PimCmdEnum::ABS,          {    8,    8,    0 } },
+      { PimCmdEnum::ADD,          {   16,    8,   24 } },
+      { PimCmdEnum::SUB,          {   16,    8,   24 } },
+      { PimCmdEnum::MUL,          {   72,   36,  128 } },
+      { PimCmdEnum::DIV,          {  191,   85,  244 } },
+      { PimCmdEnum::AND,          {   16,    8,   16 } },
+      { PimCmdEnum::OR,           {   16,    8,   16 } },
+      { PimCmdEnum::XOR,          {   16,    8,   16 } },
+      { PimCmdEnum::XNOR,         {   16,    8,   24 } },
+      { PimCmdEnum::MIN,          {   32,    8,   42 } },
+      { PimCmdEnum::MAX,          {   32,    8,   42 } },
+      { PimCmdEnum::ADD_SCALAR,   {    8,    8,   32 } },
+      { PimCmdEnum::SUB_SCALAR,   {    8,    8,   32 } },
+      { PimCmdEnum::MUL_SCALAR,   {   36,   36,  162 } },
+      { PimCmdEnum::DIV_SCALAR,   {  125,   85,  299 } },
+      { PimCmdEnum::AND_SCALAR,   {    8,    8,   24 } },
+      { PimCmdEnum::OR_SCALAR,    {    8,    8,   24 } },
+      { PimCmdEnum::XOR_SCALAR,   {    8,    8,   24 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    8,    8,   32 } },
+      { PimCmdEnum::MIN_SCALAR,   {   16,    8,   58 } },
+      { PimCmdEnum::MAX_SCALAR,   {   16,    8,   58 } },
+    }},
+    { PIM_UINT16, {
+      { PimCmdEnum::ABS,          {   16,   16,    0 } },
+      { PimCmdEnum::ADD,          {   32,   16,   48 } },
+      { PimCmdEnum::SUB,          {   32,   16,   48 } },
+      { PimCmdEnum::MUL,          {  272,  136,  512 } },
+      { PimCmdEnum::DIV,          {  767,  301,  936 } },
+      { PimCmdEnum::AND,          {   32,   16,   32 } },
+      { PimCmdEnum::OR,           {   32,   16,   32 } },
+      { PimCmdEnum::XOR,          {   32,   16,   32 } },
+      { PimCmdEnum::XNOR,         {   32,   16,   48 } },
+      { PimCmdEnum::MIN,          {   64,   16,   82 } },
+      { PimCmdEnum::MAX,          {   64,   16,   82 } },
+      { PimCmdEnum::ADD_SCALAR,   {   16,   16,   64 } },
+      { PimCmdEnum::SUB_SCALAR,   {   16,   16,   64 } },
+      { PimCmdEnum::MUL_SCALAR,   {  136,  136,  630 } },
+      { PimCmdEnum::DIV_SCALAR,   {  425,  293, 1091 } },
+      { PimCmdEnum::AND_SCALAR,   {   16,   16,   48 } },
+      { PimCmdEnum::OR_SCALAR,    {   16,   16,   48 } },
+      { PimCmdEnum::XOR_SCALAR,   {   16,   16,   48 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   16,   16,   64 } },
+      { PimCmdEnum::MIN_SCALAR,   {   32,   16,  114 } },
+      { PimCmdEnum::MAX_SCALAR,   {   32,   16,  114 } },
+    }},
+    { PIM_UINT32, {
+      { PimCmdEnum::ABS,          {   32,   32,    0 } },
+      { PimCmdEnum::POPCOUNT,     {  114,  114,  218 } },
+      { PimCmdEnum::ADD,          {   64,   32,   96 } },
+      { PimCmdEnum::SUB,          {   64,   32,   96 } },
+      { PimCmdEnum::MUL,          { 1056,  528, 2048 } },
+      { PimCmdEnum::DIV,          { 3071, 1117, 3664 } },
+      { PimCmdEnum::AND,          {   64,   32,   64 } },
+      { PimCmdEnum::OR,           {   64,   32,   64 } },
+      { PimCmdEnum::XOR,          {   64,   32,   64 } },
+      { PimCmdEnum::XNOR,         {   64,   32,   96 } },
+      { PimCmdEnum::MIN,          {  128,   32,  162 } },
+      { PimCmdEnum::MAX,          {  128,   32,  162 } },
+      { PimCmdEnum::ADD_SCALAR,   {   32,   32,  128 } },
+      { PimCmdEnum::SUB_SCALAR,   {   32,   32,  128 } },
+      { PimCmdEnum::MUL_SCALAR,   {  528,  528, 2526 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1601, 1093, 4211 } },
+      { PimCmdEnum::AND_SCALAR,   {   32,   32,   96 } },
+      { PimCmdEnum::OR_SCALAR,    {   32,   32,   96 } },
+      { PimCmdEnum::XOR_SCALAR,   {   32,   32,   96 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   32,   32,  128 } },
+      { PimCmdEnum::MIN_SCALAR,   {   64,   32,  226 } },
+      { PimCmdEnum::MAX_SCALAR,   {   64,   32,  226 } },
+    }},
+    { PIM_UINT64, {
+      { PimCmdEnum::ABS,          {   64,   64,    0 } },
+      { PimCmdEnum::ADD,          {  128,   64,  192 } },
+      { PimCmdEnum::SUB,          {  128,   64,  192 } },
+      { PimCmdEnum::AND,          {  128,   64,  128 } },
+      { PimCmdEnum::OR,           {  128,   64,  128 } },
+      { PimCmdEnum::XOR,          {  128,   64,  128 } },
+      { PimCmdEnum::XNOR,         {  128,   64,  192 } },
+      { PimCmdEnum::MIN,          {  256,   64,  322 } },
+      { PimCmdEnum::MAX,          {  256,   64,  322 } },
+      { PimCmdEnum::ADD_SCALAR,   {   64,   64,  256 } },
+      { PimCmdEnum::SUB_SCALAR,   {   64,   64,  256 } },
+      { PimCmdEnum::AND_SCALAR,   {   64,   64,  192 } },
+      { PimCmdEnum::OR_SCALAR,    {   64,   64,  192 } },
+      { PimCmdEnum::XOR_SCALAR,   {   64,   64,  192 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   64,   64,  256 } },
+      { PimCmdEnum::MIN_SCALAR,   {  128,   64,  450 } },
+      { PimCmdEnum::MAX_SCALAR,   {  128,   64,  450 } },
+    }},
+  }},
+  { PIM_DEVICE_BITSIMD_V_AP, {
+    { PIM_INT8, {
+      { PimCmdEnum::ABS,          {    8,    8,   49 } },
+      { PimCmdEnum::ADD,          {   16,    8,   24 } },
+      { PimCmdEnum::SUB,          {   16,    8,   24 } },
+      { PimCmdEnum::MUL,          {   72,   36,  128 } },
+      { PimCmdEnum::DIV,          {  150,   83,  386 } },
+      { PimCmdEnum::AND,          {   16,    8,   16 } },
+      { PimCmdEnum::OR,           {   16,    8,   17 } },
+      { PimCmdEnum::XOR,          {   16,    8,   25 } },
+      { PimCmdEnum::XNOR,         {   16,    8,   16 } },
+      { PimCmdEnum::MIN,          {   32,    8,   48 } },
+      { PimCmdEnum::MAX,          {   32,    8,   48 } },
+      { PimCmdEnum::ADD_SCALAR,   {    8,    8,   32 } },
+      { PimCmdEnum::SUB_SCALAR,   {    8,    8,   32 } },
+      { PimCmdEnum::MUL_SCALAR,   {   36,   36,  162 } },
+      { PimCmdEnum::DIV_SCALAR,   {   91,   75,  372 } },
+      { PimCmdEnum::AND_SCALAR,   {    8,    8,   24 } },
+      { PimCmdEnum::OR_SCALAR,    {    8,    8,   13 } },
+      { PimCmdEnum::XOR_SCALAR,   {    8,    8,   29 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    8,    8,   24 } },
+      { PimCmdEnum::MIN_SCALAR,   {   16,    8,   57 } },
+      { PimCmdEnum::MAX_SCALAR,   {   16,    8,   57 } },
+    }},
+    { PIM_INT16, {
+      { PimCmdEnum::ABS,          {   16,   16,   97 } },
+      { PimCmdEnum::ADD,          {   32,   16,   48 } },
+      { PimCmdEnum::SUB,          {   32,   16,   48 } },
+      { PimCmdEnum::MUL,          {  272,  136,  512 } },
+      { PimCmdEnum::DIV,          {  618,  299, 1418 } },
+      { PimCmdEnum::AND,          {   32,   16,   32 } },
+      { PimCmdEnum::OR,           {   32,   16,   33 } },
+      { PimCmdEnum::XOR,          {   32,   16,   49 } },
+      { PimCmdEnum::XNOR,         {   32,   16,   32 } },
+      { PimCmdEnum::MIN,          {   64,   16,   96 } },
+      { PimCmdEnum::MAX,          {   64,   16,   96 } },
+      { PimCmdEnum::ADD_SCALAR,   {   16,   16,   64 } },
+      { PimCmdEnum::SUB_SCALAR,   {   16,   16,   64 } },
+      { PimCmdEnum::MUL_SCALAR,   {  136,  136,  630 } },
+      { PimCmdEnum::DIV_SCALAR,   {  375,  283, 1404 } },
+      { PimCmdEnum::AND_SCALAR,   {   16,   16,   48 } },
+      { PimCmdEnum::OR_SCALAR,    {   16,   16,   37 } },
+      { PimCmdEnum::XOR_SCALAR,   {   16,   16,   45 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   16,   16,   48 } },
+      { PimCmdEnum::MIN_SCALAR,   {   32,   16,   97 } },
+      { PimCmdEnum::MAX_SCALAR,   {   32,   16,   97 } },
+    }},
+    { PIM_INT32, {
+      { PimCmdEnum::ABS,          {   32,   32,  193 } },
+      { PimCmdEnum::POPCOUNT,     {  114,  114,  302 } },
+      { PimCmdEnum::ADD,          {   64,   32,   96 } },
+      { PimCmdEnum::SUB,          {   64,   32,   96 } },
+      { PimCmdEnum::MUL,          { 1056,  528, 2048 } },
+      { PimCmdEnum::DIV,          { 2514, 1115, 5402 } },
+      { PimCmdEnum::AND,          {   64,   32,   64 } },
+      { PimCmdEnum::OR,           {   64,   32,   65 } },
+      { PimCmdEnum::XOR,          {   64,   32,   97 } },
+      { PimCmdEnum::XNOR,         {   64,   32,   64 } },
+      { PimCmdEnum::MIN,          {  128,   32,  192 } },
+      { PimCmdEnum::MAX,          {  128,   32,  192 } },
+      { PimCmdEnum::ADD_SCALAR,   {   32,   32,  128 } },
+      { PimCmdEnum::SUB_SCALAR,   {   32,   32,  128 } },
+      { PimCmdEnum::MUL_SCALAR,   {  528,  528, 2526 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1519, 1083, 5388 } },
+      { PimCmdEnum::AND_SCALAR,   {   32,   32,   96 } },
+      { PimCmdEnum::OR_SCALAR,    {   32,   32,   85 } },
+      { PimCmdEnum::XOR_SCALAR,   {   32,   32,   77 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   32,   32,   96 } },
+      { PimCmdEnum::MIN_SCALAR,   {   64,   32,  177 } },
+      { PimCmdEnum::MAX_SCALAR,   {   64,   32,  177 } },
+    }},
+    { PIM_INT64, {
+      { PimCmdEnum::ABS,          {   64,   64,  385 } },
+      { PimCmdEnum::ADD,          {  128,   64,  192 } },
+      { PimCmdEnum::SUB,          {  128,   64,  192 } },
+      { PimCmdEnum::AND,          {  128,   64,  128 } },
+      { PimCmdEnum::OR,           {  128,   64,  129 } },
+      { PimCmdEnum::XOR,          {  128,   64,  193 } },
+      { PimCmdEnum::XNOR,         {  128,   64,  128 } },
+      { PimCmdEnum::MIN,          {  256,   64,  384 } },
+      { PimCmdEnum::MAX,          {  256,   64,  384 } },
+      { PimCmdEnum::ADD_SCALAR,   {   64,   64,  256 } },
+      { PimCmdEnum::SUB_SCALAR,   {   64,   64,  256 } },
+      { PimCmdEnum::AND_SCALAR,   {   64,   64,  192 } },
+      { PimCmdEnum::OR_SCALAR,    {   64,   64,  181 } },
+      { PimCmdEnum::XOR_SCALAR,   {   64,   64,  141 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   64,   64,  192 } },
+      { PimCmdEnum::MIN_SCALAR,   {  128,   64,  337 } },
+      { PimCmdEnum::MAX_SCALAR,   {  128,   64,  337 } },
+    }},
+    { PIM_UINT8, {
+      { PimCmdEnum::ABS,          {    8,    8,    0 } },
+      { PimCmdEnum::ADD,          {   16,    8,   24 } },
+      { PimCmdEnum::SUB,          {   16,    8,   24 } },
+      { PimCmdEnum::MUL,          {   72,   36,  128 } },
+      { PimCmdEnum::DIV,          {  163,   78,  329 } },
+      { PimCmdEnum::AND,          {   16,    8,   16 } },
+      { PimCmdEnum::OR,           {   16,    8,   17 } },
+      { PimCmdEnum::XOR,          {   16,    8,   25 } },
+      { PimCmdEnum::XNOR,         {   16,    8,   16 } },
+      { PimCmdEnum::MIN,          {   32,    8,   50 } },
+      { PimCmdEnum::MAX,          {   32,    8,   50 } },
+      { PimCmdEnum::ADD_SCALAR,   {    8,    8,   32 } },
+      { PimCmdEnum::SUB_SCALAR,   {    8,    8,   32 } },
+      { PimCmdEnum::MUL_SCALAR,   {   36,   36,  162 } },
+      { PimCmdEnum::DIV_SCALAR,   {   99,   78,  364 } },
+      { PimCmdEnum::AND_SCALAR,   {    8,    8,   24 } },
+      { PimCmdEnum::OR_SCALAR,    {    8,    8,   13 } },
+      { PimCmdEnum::XOR_SCALAR,   {    8,    8,   29 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    8,    8,   24 } },
+      { PimCmdEnum::MIN_SCALAR,   {   16,    8,   60 } },
+      { PimCmdEnum::MAX_SCALAR,   {   16,    8,   60 } },
+    }},
+    { PIM_UINT16, {
+      { PimCmdEnum::ABS,          {   16,   16,    0 } },
+      { PimCmdEnum::ADD,          {   32,   16,   48 } },
+      { PimCmdEnum::SUB,          {   32,   16,   48 } },
+      { PimCmdEnum::MUL,          {  272,  136,  512 } },
+      { PimCmdEnum::DIV,          {  647,  286, 1297 } },
+      { PimCmdEnum::AND,          {   32,   16,   32 } },
+      { PimCmdEnum::OR,           {   32,   16,   33 } },
+      { PimCmdEnum::XOR,          {   32,   16,   49 } },
+      { PimCmdEnum::XNOR,         {   32,   16,   32 } },
+      { PimCmdEnum::MIN,          {   64,   16,   98 } },
+      { PimCmdEnum::MAX,          {   64,   16,   98 } },
+      { PimCmdEnum::ADD_SCALAR,   {   16,   16,   64 } },
+      { PimCmdEnum::SUB_SCALAR,   {   16,   16,   64 } },
+      { PimCmdEnum::MUL_SCALAR,   {  136,  136,  630 } },
+      { PimCmdEnum::DIV_SCALAR,   {  391,  286, 1380 } },
+      { PimCmdEnum::AND_SCALAR,   {   16,   16,   48 } },
+      { PimCmdEnum::OR_SCALAR,    {   16,   16,   37 } },
+      { PimCmdEnum::XOR_SCALAR,   {   16,   16,   45 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   16,   16,   48 } },
+      { PimCmdEnum::MIN_SCALAR,   {   32,   16,  100 } },
+      { PimCmdEnum::MAX_SCALAR,   {   32,   16,  100 } },
+    }},
+    { PIM_UINT32, {
+      { PimCmdEnum::ABS,          {   32,   32,    0 } },
+      { PimCmdEnum::POPCOUNT,     {  114,  114,  302 } },
+      { PimCmdEnum::ADD,          {   64,   32,   96 } },
+      { PimCmdEnum::SUB,          {   64,   32,   96 } },
+      { PimCmdEnum::MUL,          { 1056,  528, 2048 } },
+      { PimCmdEnum::DIV,          { 2575, 1086, 5153 } },
+      { PimCmdEnum::AND,          {   64,   32,   64 } },
+      { PimCmdEnum::OR,           {   64,   32,   65 } },
+      { PimCmdEnum::XOR,          {   64,   32,   97 } },
+      { PimCmdEnum::XNOR,         {   64,   32,   64 } },
+      { PimCmdEnum::MIN,          {  128,   32,  194 } },
+      { PimCmdEnum::MAX,          {  128,   32,  194 } },
+      { PimCmdEnum::ADD_SCALAR,   {   32,   32,  128 } },
+      { PimCmdEnum::SUB_SCALAR,   {   32,   32,  128 } },
+      { PimCmdEnum::MUL_SCALAR,   {  528,  528, 2526 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1551, 1086, 5332 } },
+      { PimCmdEnum::AND_SCALAR,   {   32,   32,   96 } },
+      { PimCmdEnum::OR_SCALAR,    {   32,   32,   85 } },
+      { PimCmdEnum::XOR_SCALAR,   {   32,   32,   77 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   32,   32,   96 } },
+      { PimCmdEnum::MIN_SCALAR,   {   64,   32,  180 } },
+      { PimCmdEnum::MAX_SCALAR,   {   64,   32,  180 } },
+    }},
+    { PIM_UINT64, {
+      { PimCmdEnum::ABS,          {   64,   64,    0 } },
+      { PimCmdEnum::ADD,          {  128,   64,  192 } },
+      { PimCmdEnum::SUB,          {  128,   64,  192 } },
+      { PimCmdEnum::AND,          {  128,   64,  128 } },
+      { PimCmdEnum::OR,           {  128,   64,  129 } },
+      { PimCmdEnum::XOR,          {  128,   64,  193 } },
+      { PimCmdEnum::XNOR,         {  128,   64,  128 } },
+      { PimCmdEnum::MIN,          {  256,   64,  386 } },
+      { PimCmdEnum::MAX,          {  256,   64,  386 } },
+      { PimCmdEnum::ADD_SCALAR,   {   64,   64,  256 } },
+      { PimCmdEnum::SUB_SCALAR,   {   64,   64,  256 } },
+      { PimCmdEnum::AND_SCALAR,   {   64,   64,  192 } },
+      { PimCmdEnum::OR_SCALAR,    {   64,   64,  181 } },
+      { PimCmdEnum::XOR_SCALAR,   {   64,   64,  141 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   64,   64,  192 } },
+      { PimCmdEnum::MIN_SCALAR,   {  128,   64,  340 } },
+      { PimCmdEnum::MAX_SCALAR,   {  128,   64,  340 } },
+    }},
+  }},
+};
+
+//! @brief  BitSIMD performance table of passed bit-serial micro-programs on custom bit-width integers
+//!         (Key: is signed, number of bits. Tuple: #R, #W, #L)
+const std::unordered_map<PimDeviceEnum, std::map<std::pair<bool, unsigned>,
+    std::unordered_map<PimCmdEnum, std::tuple<unsigned, unsigned, unsigned>>>>
+pimPerfEnergyTables::bitsimdPerfTableCustomIntGenerated = {
+  { PIM_DEVICE_BITSIMD_V, {
+    { { true, 2 }, {
+      { PimCmdEnum::ABS,          {    2,    2,    8 } },
+      { PimCmdEnum::ADD,          {    4,    2,    6 } },
+      { PimCmdEnum::SUB,          {    4,    2,    6 } },
+      { PimCmdEnum::MUL,          {    6,    3,    8 } },
+      { PimCmdEnum::DIV,          {   10,    6,   21 } },
+      { PimCmdEnum::AND,          {    4,    2,    4 } },
+      { PimCmdEnum::OR,           {    4,    2,    4 } },
+      { PimCmdEnum::XOR,          {    4,    2,    4 } },
+      { PimCmdEnum::XNOR,         {    4,    2,    6 } },
+      { PimCmdEnum::MIN,          {    8,    2,   11 } },
+      { PimCmdEnum::MAX,          {    8,    2,   11 } },
+      { PimCmdEnum::ADD_SCALAR,   {    2,    2,    8 } },
+      { PimCmdEnum::SUB_SCALAR,   {    2,    2,    8 } },
+      { PimCmdEnum::MUL_SCALAR,   {    3,    3,   10 } },
+      { PimCmdEnum::DIV_SCALAR,   {    6,    5,   22 } },
+      { PimCmdEnum::AND_SCALAR,   {    2,    2,    6 } },
+      { PimCmdEnum::OR_SCALAR,    {    2,    2,    6 } },
+      { PimCmdEnum::XOR_SCALAR,   {    2,    2,    6 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    2,    2,    8 } },
+      { PimCmdEnum::MIN_SCALAR,   {    4,    2,   15 } },
+      { PimCmdEnum::MAX_SCALAR,   {    4,    2,   15 } },
+    }},
+    { { true, 3 }, {
+      { PimCmdEnum::ABS,          {    3,    3,   12 } },
+      { PimCmdEnum::ADD,          {    6,    3,    9 } },
+      { PimCmdEnum::SUB,          {    6,    3,    9 } },
+      { PimCmdEnum::MUL,          {   12,    6,   18 } },
+      { PimCmdEnum::DIV,          {   22,   15,   49 } },
+      { PimCmdEnum::AND,          {    6,    3,    6 } },
+      { PimCmdEnum::OR,           {    6,    3,    6 } },
+      { PimCmdEnum::XOR,          {    6,    3,    6 } },
+      { PimCmdEnum::XNOR,         {    6,    3,    9 } },
+      { PimCmdEnum::MIN,          {   12,    3,   16 } },
+      { PimCmdEnum::MAX,          {   12,    3,   16 } },
+      { PimCmdEnum::ADD_SCALAR,   {    3,    3,   12 } },
+      { PimCmdEnum::SUB_SCALAR,   {    3,    3,   12 } },
+      { PimCmdEnum::MUL_SCALAR,   {    6,    6,   23 } },
+      { PimCmdEnum::DIV_SCALAR,   {   14,   13,   47 } },
+      { PimCmdEnum::AND_SCALAR,   {    3,    3,    9 } },
+      { PimCmdEnum::OR_SCALAR,    {    3,    3,    9 } },
+      { PimCmdEnum::XOR_SCALAR,   {    3,    3,    9 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    3,    3,   12 } },
+      { PimCmdEnum::MIN_SCALAR,   {    6,    3,   22 } },
+      { PimCmdEnum::MAX_SCALAR,   {    6,    3,   22 } },
+    }},
+    { { true, 4 }, {
+      { PimCmdEnum::ABS,          {    4,    4,   16 } },
+      { PimCmdEnum::ADD,          {    8,    4,   12 } },
+      { PimCmdEnum::SUB,          {    8,    4,   12 } },
+      { PimCmdEnum::MUL,          {   20,   10,   32 } },
+      { PimCmdEnum::DIV,          {   40,   26,   81 } },
+      { PimCmdEnum::AND,          {    8,    4,    8 } },
+      { PimCmdEnum::OR,           {    8,    4,    8 } },
+      { PimCmdEnum::XOR,          {    8,    4,    8 } },
+      { PimCmdEnum::XNOR,         {    8,    4,   12 } },
+      { PimCmdEnum::MIN,          {   16,    4,   21 } },
+      { PimCmdEnum::MAX,          {   16,    4,   21 } },
+      { PimCmdEnum::ADD_SCALAR,   {    4,    4,   16 } },
+      { PimCmdEnum::SUB_SCALAR,   {    4,    4,   16 } },
+      { PimCmdEnum::MUL_SCALAR,   {   10,   10,   41 } },
+      { PimCmdEnum::DIV_SCALAR,   {   26,   23,   80 } },
+      { PimCmdEnum::AND_SCALAR,   {    4,    4,   12 } },
+      { PimCmdEnum::OR_SCALAR,    {    4,    4,   12 } },
+      { PimCmdEnum::XOR_SCALAR,   {    4,    4,   12 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    4,    4,   16 } },
+      { PimCmdEnum::MIN_SCALAR,   {    8,    4,   29 } },
+      { PimCmdEnum::MAX_SCALAR,   {    8,    4,   29 } },
+    }},
+    { { true, 5 }, {
+      { PimCmdEnum::ABS,          {    5,    5,   20 } },
+      { PimCmdEnum::ADD,          {   10,    5,   15 } },
+      { PimCmdEnum::SUB,          {   10,    5,   15 } },
+      { PimCmdEnum::MUL,          {   30,   15,   50 } },
+      { PimCmdEnum::DIV,          {   64,   39,  120 } },
+      { PimCmdEnum::AND,          {   10,    5,   10 } },
+      { PimCmdEnum::OR,           {   10,    5,   10 } },
+      { PimCmdEnum::XOR,          {   10,    5,   10 } },
+      { PimCmdEnum::XNOR,         {   10,    5,   15 } },
+      { PimCmdEnum::MIN,          {   20,    5,   26 } },
+      { PimCmdEnum::MAX,          {   20,    5,   26 } },
+      { PimCmdEnum::ADD_SCALAR,   {    5,    5,   20 } },
+      { PimCmdEnum::SUB_SCALAR,   {    5,    5,   20 } },
+      { PimCmdEnum::MUL_SCALAR,   {   15,   15,   64 } },
+      { PimCmdEnum::DIV_SCALAR,   {   42,   35,  122 } },
+      { PimCmdEnum::AND_SCALAR,   {    5,    5,   15 } },
+      { PimCmdEnum::OR_SCALAR,    {    5,    5,   15 } },
+      { PimCmdEnum::XOR_SCALAR,   {    5,    5,   15 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    5,    5,   20 } },
+      { PimCmdEnum::MIN_SCALAR,   {   10,    5,   36 } },
+      { PimCmdEnum::MAX_SCALAR,   {   10,    5,   36 } },
+    }},
+    { { true, 6 }, {
+      { PimCmdEnum::ABS,          {    6,    6,   24 } },
+      { PimCmdEnum::ADD,          {   12,    6,   18 } },
+      { PimCmdEnum::SUB,          {   12,    6,   18 } },
+      { PimCmdEnum::MUL,          {   42,   21,   72 } },
+      { PimCmdEnum::DIV,          {   94,   54,  166 } },
+      { PimCmdEnum::AND,          {   12,    6,   12 } },
+      { PimCmdEnum::OR,           {   12,    6,   12 } },
+      { PimCmdEnum::XOR,          {   12,    6,   12 } },
+      { PimCmdEnum::XNOR,         {   12,    6,   18 } },
+      { PimCmdEnum::MIN,          {   24,    6,   31 } },
+      { PimCmdEnum::MAX,          {   24,    6,   31 } },
+      { PimCmdEnum::ADD_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::SUB_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::MUL_SCALAR,   {   21,   21,   92 } },
+      { PimCmdEnum::DIV_SCALAR,   {   62,   49,  173 } },
+      { PimCmdEnum::AND_SCALAR,   {    6,    6,   18 } },
+      { PimCmdEnum::OR_SCALAR,    {    6,    6,   18 } },
+      { PimCmdEnum::XOR_SCALAR,   {    6,    6,   18 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    6,    6,   24 } },
+      { PimCmdEnum::MIN_SCALAR,   {   12,    6,   43 } },
+      { PimCmdEnum::MAX_SCALAR,   {   12,    6,   43 } },
+    }},
+    { { true, 7 }, {
+      { PimCmdEnum::ABS,          {    7,    7,   28 } },
+      { PimCmdEnum::ADD,          {   14,    7,   21 } },
+      { PimCmdEnum::SUB,          {   14,    7,   21 } },
+      { PimCmdEnum::MUL,          {   56,   28,   98 } },
+      { PimCmdEnum::DIV,          {  130,   71,  219 } },
+      { PimCmdEnum::AND,          {   14,    7,   14 } },
+      { PimCmdEnum::OR,           {   14,    7,   14 } },
+      { PimCmdEnum::XOR,          {   14,    7,   14 } },
+      { PimCmdEnum::XNOR,         {   14,    7,   21 } },
+      { PimCmdEnum::MIN,          {   28,    7,   36 } },
+      { PimCmdEnum::MAX,          {   28,    7,   36 } },
+      { PimCmdEnum::ADD_SCALAR,   {    7,    7,   28 } },
+      { PimCmdEnum::SUB_SCALAR,   {    7,    7,   28 } },
+      { PimCmdEnum::MUL_SCALAR,   {   28,   28,  125 } },
+      { PimCmdEnum::DIV_SCALAR,   {   86,   65,  233 } },
+      { PimCmdEnum::AND_SCALAR,   {    7,    7,   21 } },
+      { PimCmdEnum::OR_SCALAR,    {    7,    7,   21 } },
+      { PimCmdEnum::XOR_SCALAR,   {    7,    7,   21 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    7,    7,   28 } },
+      { PimCmdEnum::MIN_SCALAR,   {   14,    7,   50 } },
+      { PimCmdEnum::MAX_SCALAR,   {   14,    7,   50 } },
+    }},
+    { { true, 9 }, {
+      { PimCmdEnum::ABS,          {    9,    9,   36 } },
+      { PimCmdEnum::ADD,          {   18,    9,   27 } },
+      { PimCmdEnum::SUB,          {   18,    9,   27 } },
+      { PimCmdEnum::MUL,          {   90,   45,  162 } },
+      { PimCmdEnum::DIV,          {  220,  111,  346 } },
+      { PimCmdEnum::AND,          {   18,    9,   18 } },
+      { PimCmdEnum::OR,           {   18,    9,   18 } },
+      { PimCmdEnum::XOR,          {   18,    9,   18 } },
+      { PimCmdEnum::XNOR,         {   18,    9,   27 } },
+      { PimCmdEnum::MIN,          {   36,    9,   46 } },
+      { PimCmdEnum::MAX,          {   36,    9,   46 } },
+      { PimCmdEnum::ADD_SCALAR,   {    9,    9,   36 } },
+      { PimCmdEnum::SUB_SCALAR,   {    9,    9,   36 } },
+      { PimCmdEnum::MUL_SCALAR,   {   45,   45,  203 } },
+      { PimCmdEnum::DIV_SCALAR,   {  144,  103,  371 } },
+      { PimCmdEnum::AND_SCALAR,   {    9,    9,   27 } },
+      { PimCmdEnum::OR_SCALAR,    {    9,    9,   27 } },
+      { PimCmdEnum::XOR_SCALAR,   {    9,    9,   27 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    9,    9,   36 } },
+      { PimCmdEnum::MIN_SCALAR,   {   18,    9,   63 } },
+      { PimCmdEnum::MAX_SCALAR,   {   18,    9,   64 } },
+    }},
+    { { true, 10 }, {
+      { PimCmdEnum::ABS,          {   10,   10,   40 } },
+      { PimCmdEnum::ADD,          {   20,   10,   30 } },
+      { PimCmdEnum::SUB,          {   20,   10,   30 } },
+      { PimCmdEnum::MUL,          {  110,   55,  200 } },
+      { PimCmdEnum::DIV,          {  274,  134,  420 } },
+      { PimCmdEnum::AND,          {   20,   10,   20 } },
+      { PimCmdEnum::OR,           {   20,   10,   20 } },
+      { PimCmdEnum::XOR,          {   20,   10,   20 } },
+      { PimCmdEnum::XNOR,         {   20,   10,   30 } },
+      { PimCmdEnum::MIN,          {   40,   10,   51 } },
+      { PimCmdEnum::MAX,          {   40,   10,   51 } },
+      { PimCmdEnum::ADD_SCALAR,   {   10,   10,   40 } },
+      { PimCmdEnum::SUB_SCALAR,   {   10,   10,   40 } },
+      { PimCmdEnum::MUL_SCALAR,   {   55,   55,  249 } },
+      { PimCmdEnum::DIV_SCALAR,   {  173,  124,  450 } },
+      { PimCmdEnum::AND_SCALAR,   {   10,   10,   30 } },
+      { PimCmdEnum::OR_SCALAR,    {   10,   10,   30 } },
+      { PimCmdEnum::XOR_SCALAR,   {   10,   10,   30 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   10,   10,   40 } },
+      { PimCmdEnum::MIN_SCALAR,   {   20,   10,   70 } },
+      { PimCmdEnum::MAX_SCALAR,   {   20,   10,   71 } },
+    }},
+    { { true, 11 }, {
+      { PimCmdEnum::ABS,          {   11,   11,   44 } },
+      { PimCmdEnum::ADD,          {   22,   11,   33 } },
+      { PimCmdEnum::SUB,          {   22,   11,   33 } },
+      { PimCmdEnum::MUL,          {  132,   66,  242 } },
+      { PimCmdEnum::DIV,          {  334,  159,  501 } },
+      { PimCmdEnum::AND,          {   22,   11,   22 } },
+      { PimCmdEnum::OR,           {   22,   11,   22 } },
+      { PimCmdEnum::XOR,          {   22,   11,   22 } },
+      { PimCmdEnum::XNOR,         {   22,   11,   33 } },
+      { PimCmdEnum::MIN,          {   44,   11,   56 } },
+      { PimCmdEnum::MAX,          {   44,   11,   56 } },
+      { PimCmdEnum::ADD_SCALAR,   {   11,   11,   44 } },
+      { PimCmdEnum::SUB_SCALAR,   {   11,   11,   44 } },
+      { PimCmdEnum::MUL_SCALAR,   {   66,   66,  300 } },
+      { PimCmdEnum::DIV_SCALAR,   {  205,  147,  537 } },
+      { PimCmdEnum::AND_SCALAR,   {   11,   11,   33 } },
+      { PimCmdEnum::OR_SCALAR,    {   11,   11,   33 } },
+      { PimCmdEnum::XOR_SCALAR,   {   11,   11,   33 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   11,   11,   44 } },
+      { PimCmdEnum::MIN_SCALAR,   {   22,   11,   77 } },
+      { PimCmdEnum::MAX_SCALAR,   {   22,   11,   78 } },
+    }},
+    { { true, 12 }, {
+      { PimCmdEnum::ABS,          {   12,   12,   48 } },
+      { PimCmdEnum::ADD,          {   24,   12,   36 } },
+      { PimCmdEnum::SUB,          {   24,   12,   36 } },
+      { PimCmdEnum::MUL,          {  156,   78,  288 } },
+      { PimCmdEnum::DIV,          {  400,  186,  589 } },
+      { PimCmdEnum::AND,          {   24,   12,   24 } },
+      { PimCmdEnum::OR,           {   24,   12,   24 } },
+      { PimCmdEnum::XOR,          {   24,   12,   24 } },
+      { PimCmdEnum::XNOR,         {   24,   12,   36 } },
+      { PimCmdEnum::MIN,          {   48,   12,   61 } },
+      { PimCmdEnum::MAX,          {   48,   12,   61 } },
+      { PimCmdEnum::ADD_SCALAR,   {   12,   12,   48 } },
+      { PimCmdEnum::SUB_SCALAR,   {   12,   12,   48 } },
+      { PimCmdEnum::MUL_SCALAR,   {   78,   78,  356 } },
+      { PimCmdEnum::DIV_SCALAR,   {  240,  172,  632 } },
+      { PimCmdEnum::AND_SCALAR,   {   12,   12,   36 } },
+      { PimCmdEnum::OR_SCALAR,    {   12,   12,   36 } },
+      { PimCmdEnum::XOR_SCALAR,   {   12,   12,   36 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   12,   12,   48 } },
+      { PimCmdEnum::MIN_SCALAR,   {   24,   12,   84 } },
+      { PimCmdEnum::MAX_SCALAR,   {   24,   12,   85 } },
+    }},
+    { { true, 13 }, {
+      { PimCmdEnum::ABS,          {   13,   13,   52 } },
+      { PimCmdEnum::ADD,          {   26,   13,   39 } },
+      { PimCmdEnum::SUB,          {   26,   13,   39 } },
+      { PimCmdEnum::MUL,          {  182,   91,  338 } },
+      { PimCmdEnum::DIV,          {  472,  215,  684 } },
+      { PimCmdEnum::AND,          {   26,   13,   26 } },
+      { PimCmdEnum::OR,           {   26,   13,   26 } },
+      { PimCmdEnum::XOR,          {   26,   13,   26 } },
+      { PimCmdEnum::XNOR,         {   26,   13,   39 } },
+      { PimCmdEnum::MIN,          {   52,   13,   66 } },
+      { PimCmdEnum::MAX,          {   52,   13,   66 } },
+      { PimCmdEnum::ADD_SCALAR,   {   13,   13,   52 } },
+      { PimCmdEnum::SUB_SCALAR,   {   13,   13,   52 } },
+      { PimCmdEnum::MUL_SCALAR,   {   91,   91,  417 } },
+      { PimCmdEnum::DIV_SCALAR,   {  278,  199,  735 } },
+      { PimCmdEnum::AND_SCALAR,   {   13,   13,   39 } },
+      { PimCmdEnum::OR_SCALAR,    {   13,   13,   39 } },
+      { PimCmdEnum::XOR_SCALAR,   {   13,   13,   39 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   13,   13,   52 } },
+      { PimCmdEnum::MIN_SCALAR,   {   26,   13,   91 } },
+      { PimCmdEnum::MAX_SCALAR,   {   26,   13,   92 } },
+    }},
+    { { true, 14 }, {
+      { PimCmdEnum::ABS,          {   14,   14,   56 } },
+      { PimCmdEnum::ADD,          {   28,   14,   42 } },
+      { PimCmdEnum::SUB,          {   28,   14,   42 } },
+      { PimCmdEnum::MUL,          {  210,  105,  392 } },
+      { PimCmdEnum::DIV,          {  550,  246,  786 } },
+      { PimCmdEnum::AND,          {   28,   14,   28 } },
+      { PimCmdEnum::OR,           {   28,   14,   28 } },
+      { PimCmdEnum::XOR,          {   28,   14,   28 } },
+      { PimCmdEnum::XNOR,         {   28,   14,   42 } },
+      { PimCmdEnum::MIN,          {   56,   14,   71 } },
+      { PimCmdEnum::MAX,          {   56,   14,   71 } },
+      { PimCmdEnum::ADD_SCALAR,   {   14,   14,   56 } },
+      { PimCmdEnum::SUB_SCALAR,   {   14,   14,   56 } },
+      { PimCmdEnum::MUL_SCALAR,   {  105,  105,  483 } },
+      { PimCmdEnum::DIV_SCALAR,   {  319,  228,  846 } },
+      { PimCmdEnum::AND_SCALAR,   {   14,   14,   42 } },
+      { PimCmdEnum::OR_SCALAR,    {   14,   14,   42 } },
+      { PimCmdEnum::XOR_SCALAR,   {   14,   14,   42 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   14,   14,   56 } },
+      { PimCmdEnum::MIN_SCALAR,   {   28,   14,   98 } },
+      { PimCmdEnum::MAX_SCALAR,   {   28,   14,   99 } },
+    }},
+    { { true, 15 }, {
+      { PimCmdEnum::ABS,          {   15,   15,   60 } },
+      { PimCmdEnum::ADD,          {   30,   15,   45 } },
+      { PimCmdEnum::SUB,          {   30,   15,   45 } },
+      { PimCmdEnum::MUL,          {  240,  120,  450 } },
+      { PimCmdEnum::DIV,          {  634,  279,  895 } },
+      { PimCmdEnum::AND,          {   30,   15,   30 } },
+      { PimCmdEnum::OR,           {   30,   15,   30 } },
+      { PimCmdEnum::XOR,          {   30,   15,   30 } },
+      { PimCmdEnum::XNOR,         {   30,   15,   45 } },
+      { PimCmdEnum::MIN,          {   60,   15,   76 } },
+      { PimCmdEnum::MAX,          {   60,   15,   76 } },
+      { PimCmdEnum::ADD_SCALAR,   {   15,   15,   60 } },
+      { PimCmdEnum::SUB_SCALAR,   {   15,   15,   60 } },
+      { PimCmdEnum::MUL_SCALAR,   {  120,  120,  554 } },
+      { PimCmdEnum::DIV_SCALAR,   {  363,  259,  965 } },
+      { PimCmdEnum::AND_SCALAR,   {   15,   15,   45 } },
+      { PimCmdEnum::OR_SCALAR,    {   15,   15,   45 } },
+      { PimCmdEnum::XOR_SCALAR,   {   15,   15,   45 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   15,   15,   60 } },
+      { PimCmdEnum::MIN_SCALAR,   {   30,   15,  105 } },
+      { PimCmdEnum::MAX_SCALAR,   {   30,   15,  106 } },
+    }},
+    { { true, 17 }, {
+      { PimCmdEnum::ABS,          {   17,   17,   68 } },
+      { PimCmdEnum::ADD,          {   34,   17,   51 } },
+      { PimCmdEnum::SUB,          {   34,   17,   51 } },
+      { PimCmdEnum::MUL,          {  306,  153,  578 } },
+      { PimCmdEnum::DIV,          {  820,  351, 1134 } },
+      { PimCmdEnum::AND,          {   34,   17,   34 } },
+      { PimCmdEnum::OR,           {   34,   17,   34 } },
+      { PimCmdEnum::XOR,          {   34,   17,   34 } },
+      { PimCmdEnum::XNOR,         {   34,   17,   51 } },
+      { PimCmdEnum::MIN,          {   68,   17,   86 } },
+      { PimCmdEnum::MAX,          {   68,   17,   86 } },
+      { PimCmdEnum::ADD_SCALAR,   {   17,   17,   68 } },
+      { PimCmdEnum::SUB_SCALAR,   {   17,   17,   68 } },
+      { PimCmdEnum::MUL_SCALAR,   {  153,  153,  711 } },
+      { PimCmdEnum::DIV_SCALAR,   {  460,  327, 1227 } },
+      { PimCmdEnum::AND_SCALAR,   {   17,   17,   51 } },
+      { PimCmdEnum::OR_SCALAR,    {   17,   17,   51 } },
+      { PimCmdEnum::XOR_SCALAR,   {   17,   17,   51 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   17,   17,   68 } },
+      { PimCmdEnum::MIN_SCALAR,   {   34,   17,  119 } },
+      { PimCmdEnum::MAX_SCALAR,   {   34,   17,  120 } },
+    }},
+    { { true, 18 }, {
+      { PimCmdEnum::ABS,          {   18,   18,   72 } },
+      { PimCmdEnum::ADD,          {   36,   18,   54 } },
+      { PimCmdEnum::SUB,          {   36,   18,   54 } },
+      { PimCmdEnum::MUL,          {  342,  171,  648 } },
+      { PimCmdEnum::DIV,          {  922,  390, 1264 } },
+      { PimCmdEnum::AND,          {   36,   18,   36 } },
+      { PimCmdEnum::OR,           {   36,   18,   36 } },
+      { PimCmdEnum::XOR,          {   36,   18,   36 } },
+      { PimCmdEnum::XNOR,         {   36,   18,   54 } },
+      { PimCmdEnum::MIN,          {   72,   18,   91 } },
+      { PimCmdEnum::MAX,          {   72,   18,   91 } },
+      { PimCmdEnum::ADD_SCALAR,   {   18,   18,   72 } },
+      { PimCmdEnum::SUB_SCALAR,   {   18,   18,   72 } },
+      { PimCmdEnum::MUL_SCALAR,   {  171,  171,  797 } },
+      { PimCmdEnum::DIV_SCALAR,   {  513,  364, 1370 } },
+      { PimCmdEnum::AND_SCALAR,   {   18,   18,   54 } },
+      { PimCmdEnum::OR_SCALAR,    {   18,   18,   54 } },
+      { PimCmdEnum::XOR_SCALAR,   {   18,   18,   54 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   18,   18,   72 } },
+      { PimCmdEnum::MIN_SCALAR,   {   36,   18,  126 } },
+      { PimCmdEnum::MAX_SCALAR,   {   36,   18,  127 } },
+    }},
+    { { true, 19 }, {
+      { PimCmdEnum::ABS,          {   19,   19,   76 } },
+      { PimCmdEnum::ADD,          {   38,   19,   57 } },
+      { PimCmdEnum::SUB,          {   38,   19,   57 } },
+      { PimCmdEnum::MUL,          {  380,  190,  722 } },
+      { PimCmdEnum::DIV,          { 1030,  431, 1401 } },
+      { PimCmdEnum::AND,          {   38,   19,   38 } },
+      { PimCmdEnum::OR,           {   38,   19,   38 } },
+      { PimCmdEnum::XOR,          {   38,   19,   38 } },
+      { PimCmdEnum::XNOR,         {   38,   19,   57 } },
+      { PimCmdEnum::MIN,          {   76,   19,   96 } },
+      { PimCmdEnum::MAX,          {   76,   19,   96 } },
+      { PimCmdEnum::ADD_SCALAR,   {   19,   19,   76 } },
+      { PimCmdEnum::SUB_SCALAR,   {   19,   19,   76 } },
+      { PimCmdEnum::MUL_SCALAR,   {  190,  190,  888 } },
+      { PimCmdEnum::DIV_SCALAR,   {  569,  403, 1521 } },
+      { PimCmdEnum::AND_SCALAR,   {   19,   19,   57 } },
+      { PimCmdEnum::OR_SCALAR,    {   19,   19,   57 } },
+      { PimCmdEnum::XOR_SCALAR,   {   19,   19,   57 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   19,   19,   76 } },
+      { PimCmdEnum::MIN_SCALAR,   {   38,   19,  133 } },
+      { PimCmdEnum::MAX_SCALAR,   {   38,   19,  134 } },
+    }},
+    { { true, 20 }, {
+      { PimCmdEnum::ABS,          {   20,   20,   80 } },
+      { PimCmdEnum::ADD,          {   40,   20,   60 } },
+      { PimCmdEnum::SUB,          {   40,   20,   60 } },
+      { PimCmdEnum::MUL,          {  420,  210,  800 } },
+      { PimCmdEnum::DIV,          { 1144,  474, 1545 } },
+      { PimCmdEnum::AND,          {   40,   20,   40 } },
+      { PimCmdEnum::OR,           {   40,   20,   40 } },
+      { PimCmdEnum::XOR,          {   40,   20,   40 } },
+      { PimCmdEnum::XNOR,         {   40,   20,   60 } },
+      { PimCmdEnum::MIN,          {   80,   20,  101 } },
+      { PimCmdEnum::MAX,          {   80,   20,  101 } },
+      { PimCmdEnum::ADD_SCALAR,   {   20,   20,   80 } },
+      { PimCmdEnum::SUB_SCALAR,   {   20,   20,   80 } },
+      { PimCmdEnum::MUL_SCALAR,   {  210,  210,  984 } },
+      { PimCmdEnum::DIV_SCALAR,   {  628,  444, 1680 } },
+      { PimCmdEnum::AND_SCALAR,   {   20,   20,   60 } },
+      { PimCmdEnum::OR_SCALAR,    {   20,   20,   60 } },
+      { PimCmdEnum::XOR_SCALAR,   {   20,   20,   60 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   20,   20,   80 } },
+      { PimCmdEnum::MIN_SCALAR,   {   40,   20,  140 } },
+      { PimCmdEnum::MAX_SCALAR,   {   40,   20,  141 } },
+    }},
+    { { true, 21 }, {
+      { PimCmdEnum::ABS,          {   21,   21,   84 } },
+      { PimCmdEnum::ADD,          {   42,   21,   63 } },
+      { PimCmdEnum::SUB,          {   42,   21,   63 } },
+      { PimCmdEnum::MUL,          {  462,  231,  882 } },
+      { PimCmdEnum::DIV,          { 1264,  519, 1696 } },
+      { PimCmdEnum::AND,          {   42,   21,   42 } },
+      { PimCmdEnum::OR,           {   42,   21,   42 } },
+      { PimCmdEnum::XOR,          {   42,   21,   42 } },
+      { PimCmdEnum::XNOR,         {   42,   21,   63 } },
+      { PimCmdEnum::MIN,          {   84,   21,  106 } },
+      { PimCmdEnum::MAX,          {   84,   21,  106 } },
+      { PimCmdEnum::ADD_SCALAR,   {   21,   21,   84 } },
+      { PimCmdEnum::SUB_SCALAR,   {   21,   21,   84 } },
+      { PimCmdEnum::MUL_SCALAR,   {  231,  231, 1085 } },
+      { PimCmdEnum::DIV_SCALAR,   {  690,  487, 1847 } },
+      { PimCmdEnum::AND_SCALAR,   {   21,   21,   63 } },
+      { PimCmdEnum::OR_SCALAR,    {   21,   21,   63 } },
+      { PimCmdEnum::XOR_SCALAR,   {   21,   21,   63 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   21,   21,   84 } },
+      { PimCmdEnum::MIN_SCALAR,   {   42,   21,  147 } },
+      { PimCmdEnum::MAX_SCALAR,   {   42,   21,  148 } },
+    }},
+    { { true, 22 }, {
+      { PimCmdEnum::ABS,          {   22,   22,   88 } },
+      { PimCmdEnum::ADD,          {   44,   22,   66 } },
+      { PimCmdEnum::SUB,          {   44,   22,   66 } },
+      { PimCmdEnum::MUL,          {  506,  253,  968 } },
+      { PimCmdEnum::DIV,          { 1390,  566, 1854 } },
+      { PimCmdEnum::AND,          {   44,   22,   44 } },
+      { PimCmdEnum::OR,           {   44,   22,   44 } },
+      { PimCmdEnum::XOR,          {   44,   22,   44 } },
+      { PimCmdEnum::XNOR,         {   44,   22,   66 } },
+      { PimCmdEnum::MIN,          {   88,   22,  111 } },
+      { PimCmdEnum::MAX,          {   88,   22,  111 } },
+      { PimCmdEnum::ADD_SCALAR,   {   22,   22,   88 } },
+      { PimCmdEnum::SUB_SCALAR,   {   22,   22,   88 } },
+      { PimCmdEnum::MUL_SCALAR,   {  253,  253, 1191 } },
+      { PimCmdEnum::DIV_SCALAR,   {  755,  532, 2022 } },
+      { PimCmdEnum::AND_SCALAR,   {   22,   22,   66 } },
+      { PimCmdEnum::OR_SCALAR,    {   22,   22,   66 } },
+      { PimCmdEnum::XOR_SCALAR,   {   22,   22,   66 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   22,   22,   88 } },
+      { PimCmdEnum::MIN_SCALAR,   {   44,   22,  154 } },
+      { PimCmdEnum::MAX_SCALAR,   {   44,   22,  155 } },
+    }},
+    { { true, 23 }, {
+      { PimCmdEnum::ABS,          {   23,   23,   92 } },
+      { PimCmdEnum::ADD,          {   46,   23,   69 } },
+      { PimCmdEnum::SUB,          {   46,   23,   69 } },
+      { PimCmdEnum::MUL,          {  552,  276, 1058 } },
+      { PimCmdEnum::DIV,          { 1522,  615, 2019 } },
+      { PimCmdEnum::AND,          {   46,   23,   46 } },
+      { PimCmdEnum::OR,           {   46,   23,   46 } },
+      { PimCmdEnum::XOR,          {   46,   23,   46 } },
+      { PimCmdEnum::XNOR,         {   46,   23,   69 } },
+      { PimCmdEnum::MIN,          {   92,   23,  116 } },
+      { PimCmdEnum::MAX,          {   92,   23,  116 } },
+      { PimCmdEnum::ADD_SCALAR,   {   23,   23,   92 } },
+      { PimCmdEnum::SUB_SCALAR,   {   23,   23,   92 } },
+      { PimCmdEnum::MUL_SCALAR,   {  276,  276, 1302 } },
+      { PimCmdEnum::DIV_SCALAR,   {  823,  579, 2205 } },
+      { PimCmdEnum::AND_SCALAR,   {   23,   23,   69 } },
+      { PimCmdEnum::OR_SCALAR,    {   23,   23,   69 } },
+      { PimCmdEnum::XOR_SCALAR,   {   23,   23,   69 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   23,   23,   92 } },
+      { PimCmdEnum::MIN_SCALAR,   {   46,   23,  161 } },
+      { PimCmdEnum::MAX_SCALAR,   {   46,   23,  162 } },
+    }},
+    { { true, 24 }, {
+      { PimCmdEnum::ABS,          {   24,   24,   96 } },
+      { PimCmdEnum::ADD,          {   48,   24,   72 } },
+      { PimCmdEnum::SUB,          {   48,   24,   72 } },
+      { PimCmdEnum::MUL,          {  600,  300, 1152 } },
+      { PimCmdEnum::DIV,          { 1660,  666, 2191 } },
+      { PimCmdEnum::AND,          {   48,   24,   48 } },
+      { PimCmdEnum::OR,           {   48,   24,   48 } },
+      { PimCmdEnum::XOR,          {   48,   24,   48 } },
+      { PimCmdEnum::XNOR,         {   48,   24,   72 } },
+      { PimCmdEnum::MIN,          {   96,   24,  121 } },
+      { PimCmdEnum::MAX,          {   96,   24,  121 } },
+      { PimCmdEnum::ADD_SCALAR,   {   24,   24,   96 } },
+      { PimCmdEnum::SUB_SCALAR,   {   24,   24,   96 } },
+      { PimCmdEnum::MUL_SCALAR,   {  300,  300, 1418 } },
+      { PimCmdEnum::DIV_SCALAR,   {  894,  628, 2396 } },
+      { PimCmdEnum::AND_SCALAR,   {   24,   24,   72 } },
+      { PimCmdEnum::OR_SCALAR,    {   24,   24,   72 } },
+      { PimCmdEnum::XOR_SCALAR,   {   24,   24,   72 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   24,   24,   96 } },
+      { PimCmdEnum::MIN_SCALAR,   {   48,   24,  168 } },
+      { PimCmdEnum::MAX_SCALAR,   {   48,   24,  169 } },
+    }},
+    { { true, 25 }, {
+      { PimCmdEnum::ABS,          {   25,   25,  100 } },
+      { PimCmdEnum::ADD,          {   50,   25,   75 } },
+      { PimCmdEnum::SUB,          {   50,   25,   75 } },
+      { PimCmdEnum::MUL,          {  650,  325, 1250 } },
+      { PimCmdEnum::DIV,          { 1804,  719, 2370 } },
+      { PimCmdEnum::AND,          {   50,   25,   50 } },
+      { PimCmdEnum::OR,           {   50,   25,   50 } },
+      { PimCmdEnum::XOR,          {   50,   25,   50 } },
+      { PimCmdEnum::XNOR,         {   50,   25,   75 } },
+      { PimCmdEnum::MIN,          {  100,   25,  126 } },
+      { PimCmdEnum::MAX,          {  100,   25,  126 } },
+      { PimCmdEnum::ADD_SCALAR,   {   25,   25,  100 } },
+      { PimCmdEnum::SUB_SCALAR,   {   25,   25,  100 } },
+      { PimCmdEnum::MUL_SCALAR,   {  325,  325, 1539 } },
+      { PimCmdEnum::DIV_SCALAR,   {  968,  679, 2595 } },
+      { PimCmdEnum::AND_SCALAR,   {   25,   25,   75 } },
+      { PimCmdEnum::OR_SCALAR,    {   25,   25,   75 } },
+      { PimCmdEnum::XOR_SCALAR,   {   25,   25,   75 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   25,   25,  100 } },
+      { PimCmdEnum::MIN_SCALAR,   {   50,   25,  175 } },
+      { PimCmdEnum::MAX_SCALAR,   {   50,   25,  176 } },
+    }},
+    { { true, 26 }, {
+      { PimCmdEnum::ABS,          {   26,   26,  104 } },
+      { PimCmdEnum::ADD,          {   52,   26,   78 } },
+      { PimCmdEnum::SUB,          {   52,   26,   78 } },
+      { PimCmdEnum::MUL,          {  702,  351, 1352 } },
+      { PimCmdEnum::DIV,          { 1954,  774, 2556 } },
+      { PimCmdEnum::AND,          {   52,   26,   52 } },
+      { PimCmdEnum::OR,           {   52,   26,   52 } },
+      { PimCmdEnum::XOR,          {   52,   26,   52 } },
+      { PimCmdEnum::XNOR,         {   52,   26,   78 } },
+      { PimCmdEnum::MIN,          {  104,   26,  131 } },
+      { PimCmdEnum::MAX,          {  104,   26,  131 } },
+      { PimCmdEnum::ADD_SCALAR,   {   26,   26,  104 } },
+      { PimCmdEnum::SUB_SCALAR,   {   26,   26,  104 } },
+      { PimCmdEnum::MUL_SCALAR,   {  351,  351, 1665 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1045,  732, 2802 } },
+      { PimCmdEnum::AND_SCALAR,   {   26,   26,   78 } },
+      { PimCmdEnum::OR_SCALAR,    {   26,   26,   78 } },
+      { PimCmdEnum::XOR_SCALAR,   {   26,   26,   78 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   26,   26,  104 } },
+      { PimCmdEnum::MIN_SCALAR,   {   52,   26,  182 } },
+      { PimCmdEnum::MAX_SCALAR,   {   52,   26,  183 } },
+    }},
+    { { true, 27 }, {
+      { PimCmdEnum::ABS,          {   27,   27,  108 } },
+      { PimCmdEnum::ADD,          {   54,   27,   81 } },
+      { PimCmdEnum::SUB,          {   54,   27,   81 } },
+      { PimCmdEnum::MUL,          {  756,  378, 1458 } },
+      { PimCmdEnum::DIV,          { 2110,  831, 2749 } },
+      { PimCmdEnum::AND,          {   54,   27,   54 } },
+      { PimCmdEnum::OR,           {   54,   27,   54 } },
+      { PimCmdEnum::XOR,          {   54,   27,   54 } },
+      { PimCmdEnum::XNOR,         {   54,   27,   81 } },
+      { PimCmdEnum::MIN,          {  108,   27,  136 } },
+      { PimCmdEnum::MAX,          {  108,   27,  136 } },
+      { PimCmdEnum::ADD_SCALAR,   {   27,   27,  108 } },
+      { PimCmdEnum::SUB_SCALAR,   {   27,   27,  108 } },
+      { PimCmdEnum::MUL_SCALAR,   {  378,  378, 1796 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1125,  787, 3017 } },
+      { PimCmdEnum::AND_SCALAR,   {   27,   27,   81 } },
+      { PimCmdEnum::OR_SCALAR,    {   27,   27,   81 } },
+      { PimCmdEnum::XOR_SCALAR,   {   27,   27,   81 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   27,   27,  108 } },
+      { PimCmdEnum::MIN_SCALAR,   {   54,   27,  189 } },
+      { PimCmdEnum::MAX_SCALAR,   {   54,   27,  190 } },
+    }},
+    { { true, 28 }, {
+      { PimCmdEnum::ABS,          {   28,   28,  112 } },
+      { PimCmdEnum::ADD,          {   56,   28,   84 } },
+      { PimCmdEnum::SUB,          {   56,   28,   84 } },
+      { PimCmdEnum::MUL,          {  812,  406, 1568 } },
+      { PimCmdEnum::DIV,          { 2272,  890, 2949 } },
+      { PimCmdEnum::AND,          {   56,   28,   56 } },
+      { PimCmdEnum::OR,           {   56,   28,   56 } },
+      { PimCmdEnum::XOR,          {   56,   28,   56 } },
+      { PimCmdEnum::XNOR,         {   56,   28,   84 } },
+      { PimCmdEnum::MIN,          {  112,   28,  141 } },
+      { PimCmdEnum::MAX,          {  112,   28,  141 } },
+      { PimCmdEnum::ADD_SCALAR,   {   28,   28,  112 } },
+      { PimCmdEnum::SUB_SCALAR,   {   28,   28,  112 } },
+      { PimCmdEnum::MUL_SCALAR,   {  406,  406, 1932 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1208,  844, 3240 } },
+      { PimCmdEnum::AND_SCALAR,   {   28,   28,   84 } },
+      { PimCmdEnum::OR_SCALAR,    {   28,   28,   84 } },
+      { PimCmdEnum::XOR_SCALAR,   {   28,   28,   84 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   28,   28,  112 } },
+      { PimCmdEnum::MIN_SCALAR,   {   56,   28,  196 } },
+      { PimCmdEnum::MAX_SCALAR,   {   56,   28,  197 } },
+    }},
+    { { true, 29 }, {
+      { PimCmdEnum::ABS,          {   29,   29,  116 } },
+      { PimCmdEnum::ADD,          {   58,   29,   87 } },
+      { PimCmdEnum::SUB,          {   58,   29,   87 } },
+      { PimCmdEnum::MUL,          {  870,  435, 1682 } },
+      { PimCmdEnum::DIV,          { 2440,  951, 3156 } },
+      { PimCmdEnum::AND,          {   58,   29,   58 } },
+      { PimCmdEnum::OR,           {   58,   29,   58 } },
+      { PimCmdEnum::XOR,          {   58,   29,   58 } },
+      { PimCmdEnum::XNOR,         {   58,   29,   87 } },
+      { PimCmdEnum::MIN,          {  116,   29,  146 } },
+      { PimCmdEnum::MAX,          {  116,   29,  146 } },
+      { PimCmdEnum::ADD_SCALAR,   {   29,   29,  116 } },
+      { PimCmdEnum::SUB_SCALAR,   {   29,   29,  116 } },
+      { PimCmdEnum::MUL_SCALAR,   {  435,  435, 2073 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1294,  903, 3471 } },
+      { PimCmdEnum::AND_SCALAR,   {   29,   29,   87 } },
+      { PimCmdEnum::OR_SCALAR,    {   29,   29,   87 } },
+      { PimCmdEnum::XOR_SCALAR,   {   29,   29,   87 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   29,   29,  116 } },
+      { PimCmdEnum::MIN_SCALAR,   {   58,   29,  203 } },
+      { PimCmdEnum::MAX_SCALAR,   {   58,   29,  204 } },
+    }},
+    { { true, 30 }, {
+      { PimCmdEnum::ABS,          {   30,   30,  120 } },
+      { PimCmdEnum::ADD,          {   60,   30,   90 } },
+      { PimCmdEnum::SUB,          {   60,   30,   90 } },
+      { PimCmdEnum::MUL,          {  930,  465, 1800 } },
+      { PimCmdEnum::DIV,          { 2614, 1014, 3370 } },
+      { PimCmdEnum::AND,          {   60,   30,   60 } },
+      { PimCmdEnum::OR,           {   60,   30,   60 } },
+      { PimCmdEnum::XOR,          {   60,   30,   60 } },
+      { PimCmdEnum::XNOR,         {   60,   30,   90 } },
+      { PimCmdEnum::MIN,          {  120,   30,  151 } },
+      { PimCmdEnum::MAX,          {  120,   30,  151 } },
+      { PimCmdEnum::ADD_SCALAR,   {   30,   30,  120 } },
+      { PimCmdEnum::SUB_SCALAR,   {   30,   30,  120 } },
+      { PimCmdEnum::MUL_SCALAR,   {  465,  465, 2219 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1383,  964, 3710 } },
+      { PimCmdEnum::AND_SCALAR,   {   30,   30,   90 } },
+      { PimCmdEnum::OR_SCALAR,    {   30,   30,   90 } },
+      { PimCmdEnum::XOR_SCALAR,   {   30,   30,   90 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   30,   30,  120 } },
+      { PimCmdEnum::MIN_SCALAR,   {   60,   30,  210 } },
+      { PimCmdEnum::MAX_SCALAR,   {   60,   30,  211 } },
+    }},
+    { { true, 31 }, {
+      { PimCmdEnum::ABS,          {   31,   31,  124 } },
+      { PimCmdEnum::ADD,          {   62,   31,   93 } },
+      { PimCmdEnum::SUB,          {   62,   31,   93 } },
+      { PimCmdEnum::MUL,          {  992,  496, 1922 } },
+      { PimCmdEnum::DIV,          { 2794, 1079, 3591 } },
+      { PimCmdEnum::AND,          {   62,   31,   62 } },
+      { PimCmdEnum::OR,           {   62,   31,   62 } },
+      { PimCmdEnum::XOR,          {   62,   31,   62 } },
+      { PimCmdEnum::XNOR,         {   62,   31,   93 } },
+      { PimCmdEnum::MIN,          {  124,   31,  156 } },
+      { PimCmdEnum::MAX,          {  124,   31,  156 } },
+      { PimCmdEnum::ADD_SCALAR,   {   31,   31,  124 } },
+      { PimCmdEnum::SUB_SCALAR,   {   31,   31,  124 } },
+      { PimCmdEnum::MUL_SCALAR,   {  496,  496, 2370 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1475, 1027, 3957 } },
+      { PimCmdEnum::AND_SCALAR,   {   31,   31,   93 } },
+      { PimCmdEnum::OR_SCALAR,    {   31,   31,   93 } },
+      { PimCmdEnum::XOR_SCALAR,   {   31,   31,   93 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   31,   31,  124 } },
+      { PimCmdEnum::MIN_SCALAR,   {   62,   31,  217 } },
+      { PimCmdEnum::MAX_SCALAR,   {   62,   31,  218 } },
+    }},
+    { { true, 33 }, {
+      { PimCmdEnum::ABS,          {   33,   33,  132 } },
+      { PimCmdEnum::ADD,          {   66,   33,   99 } },
+      { PimCmdEnum::SUB,          {   66,   33,   99 } },
+      { PimCmdEnum::AND,          {   66,   33,   66 } },
+      { PimCmdEnum::OR,           {   66,   33,   66 } },
+      { PimCmdEnum::XOR,          {   66,   33,   66 } },
+      { PimCmdEnum::XNOR,         {   66,   33,   99 } },
+      { PimCmdEnum::MIN,          {  132,   33,  166 } },
+      { PimCmdEnum::MAX,          {  132,   33,  166 } },
+      { PimCmdEnum::ADD_SCALAR,   {   33,   33,  132 } },
+      { PimCmdEnum::SUB_SCALAR,   {   33,   33,  132 } },
+      { PimCmdEnum::AND_SCALAR,   {   33,   33,   99 } },
+      { PimCmdEnum::OR_SCALAR,    {   33,   33,   99 } },
+      { PimCmdEnum::XOR_SCALAR,   {   33,   33,   99 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   33,   33,  132 } },
+      { PimCmdEnum::MIN_SCALAR,   {   66,   33,  231 } },
+      { PimCmdEnum::MAX_SCALAR,   {   66,   33,  232 } },
+    }},
+    { { true, 34 }, {
+      { PimCmdEnum::ABS,          {   34,   34,  136 } },
+      { PimCmdEnum::ADD,          {   68,   34,  102 } },
+      { PimCmdEnum::SUB,          {   68,   34,  102 } },
+      { PimCmdEnum::AND,          {   68,   34,   68 } },
+      { PimCmdEnum::OR,           {   68,   34,   68 } },
+      { PimCmdEnum::XOR,          {   68,   34,   68 } },
+      { PimCmdEnum::XNOR,         {   68,   34,  102 } },
+      { PimCmdEnum::MIN,          {  136,   34,  171 } },
+      { PimCmdEnum::MAX,          {  136,   34,  171 } },
+      { PimCmdEnum::ADD_SCALAR,   {   34,   34,  136 } },
+      { PimCmdEnum::SUB_SCALAR,   {   34,   34,  136 } },
+      { PimCmdEnum::AND_SCALAR,   {   34,   34,  102 } },
+      { PimCmdEnum::OR_SCALAR,    {   34,   34,  102 } },
+      { PimCmdEnum::XOR_SCALAR,   {   34,   34,  102 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   34,   34,  136 } },
+      { PimCmdEnum::MIN_SCALAR,   {   68,   34,  238 } },
+      { PimCmdEnum::MAX_SCALAR,   {   68,   34,  239 } },
+    }},
+    { { true, 35 }, {
+      { PimCmdEnum::ABS,          {   35,   35,  140 } },
+      { PimCmdEnum::ADD,          {   70,   35,  105 } },
+      { PimCmdEnum::SUB,          {   70,   35,  105 } },
+      { PimCmdEnum::AND,          {   70,   35,   70 } },
+      { PimCmdEnum::OR,           {   70,   35,   70 } },
+      { PimCmdEnum::XOR,          {   70,   35,   70 } },
+      { PimCmdEnum::XNOR,         {   70,   35,  105 } },
+      { PimCmdEnum::MIN,          {  140,   35,  176 } },
+      { PimCmdEnum::MAX,          {  140,   35,  176 } },
+      { PimCmdEnum::ADD_SCALAR,   {   35,   35,  140 } },
+      { PimCmdEnum::SUB_SCALAR,   {   35,   35,  140 } },
+      { PimCmdEnum::AND_SCALAR,   {   35,   35,  105 } },
+      { PimCmdEnum::OR_SCALAR,    {   35,   35,  105 } },
+      { PimCmdEnum::XOR_SCALAR,   {   35,   35,  105 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   35,   35,  140 } },
+      { PimCmdEnum::MIN_SCALAR,   {   70,   35,  245 } },
+      { PimCmdEnum::MAX_SCALAR,   {   70,   35,  246 } },
+    }},
+    { { true, 36 }, {
+      { PimCmdEnum::ABS,          {   36,   36,  144 } },
+      { PimCmdEnum::ADD,          {   72,   36,  108 } },
+      { PimCmdEnum::SUB,          {   72,   36,  108 } },
+      { PimCmdEnum::AND,          {   72,   36,   72 } },
+      { PimCmdEnum::OR,           {   72,   36,   72 } },
+      { PimCmdEnum::XOR,          {   72,   36,   72 } },
+      { PimCmdEnum::XNOR,         {   72,   36,  108 } },
+      { PimCmdEnum::MIN,          {  144,   36,  181 } },
+      { PimCmdEnum::MAX,          {  144,   36,  181 } },
+      { PimCmdEnum::ADD_SCALAR,   {   36,   36,  144 } },
+      { PimCmdEnum::SUB_SCALAR,   {   36,   36,  144 } },
+      { PimCmdEnum::AND_SCALAR,   {   36,   36,  108 } },
+      { PimCmdEnum::OR_SCALAR,    {   36,   36,  108 } },
+      { PimCmdEnum::XOR_SCALAR,   {   36,   36,  108 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   36,   36,  144 } },
+      { PimCmdEnum::MIN_SCALAR,   {   72,   36,  252 } },
+      { PimCmdEnum::MAX_SCALAR,   {   72,   36,  253 } },
+    }},
+    { { true, 37 }, {
+      { PimCmdEnum::ABS,          {   37,   37,  148 } },
+      { PimCmdEnum::ADD,          {   74,   37,  111 } },
+      { PimCmdEnum::SUB,          {   74,   37,  111 } },
+      { PimCmdEnum::AND,          {   74,   37,   74 } },
+      { PimCmdEnum::OR,           {   74,   37,   74 } },
+      { PimCmdEnum::XOR,          {   74,   37,   74 } },
+      { PimCmdEnum::XNOR,         {   74,   37,  111 } },
+      { PimCmdEnum::MIN,          {  148,   37,  186 } },
+      { PimCmdEnum::MAX,          {  148,   37,  186 } },
+      { PimCmdEnum::ADD_SCALAR,   {   37,   37,  148 } },
+      { PimCmdEnum::SUB_SCALAR,   {   37,   37,  148 } },
+      { PimCmdEnum::AND_SCALAR,   {   37,   37,  111 } },
+      { PimCmdEnum::OR_SCALAR,    {   37,   37,  111 } },
+      { PimCmdEnum::XOR_SCALAR,   {   37,   37,  111 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   37,   37,  148 } },
+      { PimCmdEnum::MIN_SCALAR,   {   74,   37,  259 } },
+      { PimCmdEnum::MAX_SCALAR,   {   74,   37,  260 } },
+    }},
+    { { true, 38 }, {
+      { PimCmdEnum::ABS,          {   38,   38,  152 } },
+      { PimCmdEnum::ADD,          {   76,   38,  114 } },
+      { PimCmdEnum::SUB,          {   76,   38,  114 } },
+      { PimCmdEnum::AND,          {   76,   38,   76 } },
+      { PimCmdEnum::OR,           {   76,   38,   76 } },
+      { PimCmdEnum::XOR,          {   76,   38,   76 } },
+      { PimCmdEnum::XNOR,         {   76,   38,  114 } },
+      { PimCmdEnum::MIN,          {  152,   38,  191 } },
+      { PimCmdEnum::MAX,          {  152,   38,  191 } },
+      { PimCmdEnum::ADD_SCALAR,   {   38,   38,  152 } },
+      { PimCmdEnum::SUB_SCALAR,   {   38,   38,  152 } },
+      { PimCmdEnum::AND_SCALAR,   {   38,   38,  114 } },
+      { PimCmdEnum::OR_SCALAR,    {   38,   38,  114 } },
+      { PimCmdEnum::XOR_SCALAR,   {   38,   38,  114 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   38,   38,  152 } },
+      { PimCmdEnum::MIN_SCALAR,   {   76,   38,  266 } },
+      { PimCmdEnum::MAX_SCALAR,   {   76,   38,  267 } },
+    }},
+    { { true, 39 }, {
+      { PimCmdEnum::ABS,          {   39,   39,  156 } },
+      { PimCmdEnum::ADD,          {   78,   39,  117 } },
+      { PimCmdEnum::SUB,          {   78,   39,  117 } },
+      { PimCmdEnum::AND,          {   78,   39,   78 } },
+      { PimCmdEnum::OR,           {   78,   39,   78 } },
+      { PimCmdEnum::XOR,          {   78,   39,   78 } },
+      { PimCmdEnum::XNOR,         {   78,   39,  117 } },
+      { PimCmdEnum::MIN,          {  156,   39,  196 } },
+      { PimCmdEnum::MAX,          {  156,   39,  196 } },
+      { PimCmdEnum::ADD_SCALAR,   {   39,   39,  156 } },
+      { PimCmdEnum::SUB_SCALAR,   {   39,   39,  156 } },
+      { PimCmdEnum::AND_SCALAR,   {   39,   39,  117 } },
+      { PimCmdEnum::OR_SCALAR,    {   39,   39,  117 } },
+      { PimCmdEnum::XOR_SCALAR,   {   39,   39,  117 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   39,   39,  156 } },
+      { PimCmdEnum::MIN_SCALAR,   {   78,   39,  273 } },
+      { PimCmdEnum::MAX_SCALAR,   {   78,   39,  274 } },
+    }},
+    { { true, 40 }, {
+      { PimCmdEnum::ABS,          {   40,   40,  160 } },
+      { PimCmdEnum::ADD,          {   80,   40,  120 } },
+      { PimCmdEnum::SUB,          {   80,   40,  120 } },
+      { PimCmdEnum::AND,          {   80,   40,   80 } },
+      { PimCmdEnum::OR,           {   80,   40,   80 } },
+      { PimCmdEnum::XOR,          {   80,   40,   80 } },
+      { PimCmdEnum::XNOR,         {   80,   40,  120 } },
+      { PimCmdEnum::MIN,          {  160,   40,  201 } },
+      { PimCmdEnum::MAX,          {  160,   40,  201 } },
+      { PimCmdEnum::ADD_SCALAR,   {   40,   40,  160 } },
+      { PimCmdEnum::SUB_SCALAR,   {   40,   40,  160 } },
+      { PimCmdEnum::AND_SCALAR,   {   40,   40,  120 } },
+      { PimCmdEnum::OR_SCALAR,    {   40,   40,  120 } },
+      { PimCmdEnum::XOR_SCALAR,   {   40,   40,  120 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   40,   40,  160 } },
+      { PimCmdEnum::MIN_SCALAR,   {   80,   40,  280 } },
+      { PimCmdEnum::MAX_SCALAR,   {   80,   40,  281 } },
+    }},
+    { { true, 41 }, {
+      { PimCmdEnum::ABS,          {   41,   41,  164 } },
+      { PimCmdEnum::ADD,          {   82,   41,  123 } },
+      { PimCmdEnum::SUB,          {   82,   41,  123 } },
+      { PimCmdEnum::AND,          {   82,   41,   82 } },
+      { PimCmdEnum::OR,           {   82,   41,   82 } },
+      { PimCmdEnum::XOR,          {   82,   41,   82 } },
+      { PimCmdEnum::XNOR,         {   82,   41,  123 } },
+      { PimCmdEnum::MIN,          {  164,   41,  206 } },
+      { PimCmdEnum::MAX,          {  164,   41,  206 } },
+      { PimCmdEnum::ADD_SCALAR,   {   41,   41,  164 } },
+      { PimCmdEnum::SUB_SCALAR,   {   41,   41,  164 } },
+      { PimCmdEnum::AND_SCALAR,   {   41,   41,  123 } },
+      { PimCmdEnum::OR_SCALAR,    {   41,   41,  123 } },
+      { PimCmdEnum::XOR_SCALAR,   {   41,   41,  123 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   41,   41,  164 } },
+      { PimCmdEnum::MIN_SCALAR,   {   82,   41,  287 } },
+      { PimCmdEnum::MAX_SCALAR,   {   82,   41,  288 } },
+    }},
+    { { true, 42 }, {
+      { PimCmdEnum::ABS,          {   42,   42,  168 } },
+      { PimCmdEnum::ADD,          {   84,   42,  126 } },
+      { PimCmdEnum::SUB,          {   84,   42,  126 } },
+      { PimCmdEnum::AND,          {   84,   42,   84 } },
+      { PimCmdEnum::OR,           {   84,   42,   84 } },
+      { PimCmdEnum::XOR,          {   84,   42,   84 } },
+      { PimCmdEnum::XNOR,         {   84,   42,  126 } },
+      { PimCmdEnum::MIN,          {  168,   42,  211 } },
+      { PimCmdEnum::MAX,          {  168,   42,  211 } },
+      { PimCmdEnum::ADD_SCALAR,   {   42,   42,  168 } },
+      { PimCmdEnum::SUB_SCALAR,   {   42,   42,  168 } },
+      { PimCmdEnum::AND_SCALAR,   {   42,   42,  126 } },
+      { PimCmdEnum::OR_SCALAR,    {   42,   42,  126 } },
+      { PimCmdEnum::XOR_SCALAR,   {   42,   42,  126 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   42,   42,  168 } },
+      { PimCmdEnum::MIN_SCALAR,   {   84,   42,  294 } },
+      { PimCmdEnum::MAX_SCALAR,   {   84,   42,  295 } },
+    }},
+    { { true, 43 }, {
+      { PimCmdEnum::ABS,          {   43,   43,  172 } },
+      { PimCmdEnum::ADD,          {   86,   43,  129 } },
+      { PimCmdEnum::SUB,          {   86,   43,  129 } },
+      { PimCmdEnum::AND,          {   86,   43,   86 } },
+      { PimCmdEnum::OR,           {   86,   43,   86 } },
+      { PimCmdEnum::XOR,          {   86,   43,   86 } },
+      { PimCmdEnum::XNOR,         {   86,   43,  129 } },
+      { PimCmdEnum::MIN,          {  172,   43,  216 } },
+      { PimCmdEnum::MAX,          {  172,   43,  216 } },
+      { PimCmdEnum::ADD_SCALAR,   {   43,   43,  172 } },
+      { PimCmdEnum::SUB_SCALAR,   {   43,   43,  172 } },
+      { PimCmdEnum::AND_SCALAR,   {   43,   43,  129 } },
+      { PimCmdEnum::OR_SCALAR,    {   43,   43,  129 } },
+      { PimCmdEnum::XOR_SCALAR,   {   43,   43,  129 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   43,   43,  172 } },
+      { PimCmdEnum::MIN_SCALAR,   {   86,   43,  301 } },
+      { PimCmdEnum::MAX_SCALAR,   {   86,   43,  302 } },
+    }},
+    { { true, 44 }, {
+      { PimCmdEnum::ABS,          {   44,   44,  176 } },
+      { PimCmdEnum::ADD,          {   88,   44,  132 } },
+      { PimCmdEnum::SUB,          {   88,   44,  132 } },
+      { PimCmdEnum::AND,          {   88,   44,   88 } },
+      { PimCmdEnum::OR,           {   88,   44,   88 } },
+      { PimCmdEnum::XOR,          {   88,   44,   88 } },
+      { PimCmdEnum::XNOR,         {   88,   44,  132 } },
+      { PimCmdEnum::MIN,          {  176,   44,  221 } },
+      { PimCmdEnum::MAX,          {  176,   44,  221 } },
+      { PimCmdEnum::ADD_SCALAR,   {   44,   44,  176 } },
+      { PimCmdEnum::SUB_SCALAR,   {   44,   44,  176 } },
+      { PimCmdEnum::AND_SCALAR,   {   44,   44,  132 } },
+      { PimCmdEnum::OR_SCALAR,    {   44,   44,  132 } },
+      { PimCmdEnum::XOR_SCALAR,   {   44,   44,  132 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   44,   44,  176 } },
+      { PimCmdEnum::MIN_SCALAR,   {   88,   44,  308 } },
+      { PimCmdEnum::MAX_SCALAR,   {   88,   44,  309 } },
+    }},
+    { { true, 45 }, {
+      { PimCmdEnum::ABS,          {   45,   45,  180 } },
+      { PimCmdEnum::ADD,          {   90,   45,  135 } },
+      { PimCmdEnum::SUB,          {   90,   45,  135 } },
+      { PimCmdEnum::AND,          {   90,   45,   90 } },
+      { PimCmdEnum::OR,           {   90,   45,   90 } },
+      { PimCmdEnum::XOR,          {   90,   45,   90 } },
+      { PimCmdEnum::XNOR,         {   90,   45,  135 } },
+      { PimCmdEnum::MIN,          {  180,   45,  226 } },
+      { PimCmdEnum::MAX,          {  180,   45,  226 } },
+      { PimCmdEnum::ADD_SCALAR,   {   45,   45,  180 } },
+      { PimCmdEnum::SUB_SCALAR,   {   45,   45,  180 } },
+      { PimCmdEnum::AND_SCALAR,   {   45,   45,  135 } },
+      { PimCmdEnum::OR_SCALAR,    {   45,   45,  135 } },
+      { PimCmdEnum::XOR_SCALAR,   {   45,   45,  135 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   45,   45,  180 } },
+      { PimCmdEnum::MIN_SCALAR,   {   90,   45,  315 } },
+      { PimCmdEnum::MAX_SCALAR,   {   90,   45,  316 } },
+    }},
+    { { true, 46 }, {
+      { PimCmdEnum::ABS,          {   46,   46,  184 } },
+      { PimCmdEnum::ADD,          {   92,   46,  138 } },
+      { PimCmdEnum::SUB,          {   92,   46,  138 } },
+      { PimCmdEnum::AND,          {   92,   46,   92 } },
+      { PimCmdEnum::OR,           {   92,   46,   92 } },
+      { PimCmdEnum::XOR,          {   92,   46,   92 } },
+      { PimCmdEnum::XNOR,         {   92,   46,  138 } },
+      { PimCmdEnum::MIN,          {  184,   46,  231 } },
+      { PimCmdEnum::MAX,          {  184,   46,  231 } },
+      { PimCmdEnum::ADD_SCALAR,   {   46,   46,  184 } },
+      { PimCmdEnum::SUB_SCALAR,   {   46,   46,  184 } },
+      { PimCmdEnum::AND_SCALAR,   {   46,   46,  138 } },
+      { PimCmdEnum::OR_SCALAR,    {   46,   46,  138 } },
+      { PimCmdEnum::XOR_SCALAR,   {   46,   46,  138 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   46,   46,  184 } },
+      { PimCmdEnum::MIN_SCALAR,   {   92,   46,  322 } },
+      { PimCmdEnum::MAX_SCALAR,   {   92,   46,  323 } },
+    }},
+    { { true, 47 }, {
+      { PimCmdEnum::ABS,          {   47,   47,  188 } },
+      { PimCmdEnum::ADD,          {   94,   47,  141 } },
+      { PimCmdEnum::SUB,          {   94,   47,  141 } },
+      { PimCmdEnum::AND,          {   94,   47,   94 } },
+      { PimCmdEnum::OR,           {   94,   47,   94 } },
+      { PimCmdEnum::XOR,          {   94,   47,   94 } },
+      { PimCmdEnum::XNOR,         {   94,   47,  141 } },
+      { PimCmdEnum::MIN,          {  188,   47,  236 } },
+      { PimCmdEnum::MAX,          {  188,   47,  236 } },
+      { PimCmdEnum::ADD_SCALAR,   {   47,   47,  188 } },
+      { PimCmdEnum::SUB_SCALAR,   {   47,   47,  188 } },
+      { PimCmdEnum::AND_SCALAR,   {   47,   47,  141 } },
+      { PimCmdEnum::OR_SCALAR,    {   47,   47,  141 } },
+      { PimCmdEnum::XOR_SCALAR,   {   47,   47,  141 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   47,   47,  188 } },
+      { PimCmdEnum::MIN_SCALAR,   {   94,   47,  329 } },
+      { PimCmdEnum::MAX_SCALAR,   {   94,   47,  330 } },
+    }},
+    { { true, 48 }, {
+      { PimCmdEnum::ABS,          {   48,   48,  192 } },
+      { PimCmdEnum::ADD,          {   96,   48,  144 } },
+      { PimCmdEnum::SUB,          {   96,   48,  144 } },
+      { PimCmdEnum::AND,          {   96,   48,   96 } },
+      { PimCmdEnum::OR,           {   96,   48,   96 } },
+      { PimCmdEnum::XOR,          {   96,   48,   96 } },
+      { PimCmdEnum::XNOR,         {   96,   48,  144 } },
+      { PimCmdEnum::MIN,          {  192,   48,  241 } },
+      { PimCmdEnum::MAX,          {  192,   48,  241 } },
+      { PimCmdEnum::ADD_SCALAR,   {   48,   48,  192 } },
+      { PimCmdEnum::SUB_SCALAR,   {   48,   48,  192 } },
+      { PimCmdEnum::AND_SCALAR,   {   48,   48,  144 } },
+      { PimCmdEnum::OR_SCALAR,    {   48,   48,  144 } },
+      { PimCmdEnum::XOR_SCALAR,   {   48,   48,  144 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   48,   48,  192 } },
+      { PimCmdEnum::MIN_SCALAR,   {   96,   48,  336 } },
+      { PimCmdEnum::MAX_SCALAR,   {   96,   48,  337 } },
+    }},
+    { { true, 49 }, {
+      { PimCmdEnum::ABS,          {   49,   49,  196 } },
+      { PimCmdEnum::ADD,          {   98,   49,  147 } },
+      { PimCmdEnum::SUB,          {   98,   49,  147 } },
+      { PimCmdEnum::AND,          {   98,   49,   98 } },
+      { PimCmdEnum::OR,           {   98,   49,   98 } },
+      { PimCmdEnum::XOR,          {   98,   49,   98 } },
+      { PimCmdEnum::XNOR,         {   98,   49,  147 } },
+      { PimCmdEnum::MIN,          {  196,   49,  246 } },
+      { PimCmdEnum::MAX,          {  196,   49,  246 } },
+      { PimCmdEnum::ADD_SCALAR,   {   49,   49,  196 } },
+      { PimCmdEnum::SUB_SCALAR,   {   49,   49,  196 } },
+      { PimCmdEnum::AND_SCALAR,   {   49,   49,  147 } },
+      { PimCmdEnum::OR_SCALAR,    {   49,   49,  147 } },
+      { PimCmdEnum::XOR_SCALAR,   {   49,   49,  147 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   49,   49,  196 } },
+      { PimCmdEnum::MIN_SCALAR,   {   98,   49,  343 } },
+      { PimCmdEnum::MAX_SCALAR,   {   98,   49,  344 } },
+    }},
+    { { true, 50 }, {
+      { PimCmdEnum::ABS,          {   50,   50,  200 } },
+      { PimCmdEnum::ADD,          {  100,   50,  150 } },
+      { PimCmdEnum::SUB,          {  100,   50,  150 } },
+      { PimCmdEnum::AND,          {  100,   50,  100 } },
+      { PimCmdEnum::OR,           {  100,   50,  100 } },
+      { PimCmdEnum::XOR,          {  100,   50,  100 } },
+      { PimCmdEnum::XNOR,         {  100,   50,  150 } },
+      { PimCmdEnum::MIN,          {  200,   50,  251 } },
+      { PimCmdEnum::MAX,          {  200,   50,  251 } },
+      { PimCmdEnum::ADD_SCALAR,   {   50,   50,  200 } },
+      { PimCmdEnum::SUB_SCALAR,   {   50,   50,  200 } },
+      { PimCmdEnum::AND_SCALAR,   {   50,   50,  150 } },
+      { PimCmdEnum::OR_SCALAR,    {   50,   50,  150 } },
+      { PimCmdEnum::XOR_SCALAR,   {   50,   50,  150 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   50,   50,  200 } },
+      { PimCmdEnum::MIN_SCALAR,   {  100,   50,  350 } },
+      { PimCmdEnum::MAX_SCALAR,   {  100,   50,  351 } },
+    }},
+    { { true, 51 }, {
+      { PimCmdEnum::ABS,          {   51,   51,  204 } },
+      { PimCmdEnum::ADD,          {  102,   51,  153 } },
+      { PimCmdEnum::SUB,          {  102,   51,  153 } },
+      { PimCmdEnum::AND,          {  102,   51,  102 } },
+      { PimCmdEnum::OR,           {  102,   51,  102 } },
+      { PimCmdEnum::XOR,          {  102,   51,  102 } },
+      { PimCmdEnum::XNOR,         {  102,   51,  153 } },
+      { PimCmdEnum::MIN,          {  204,   51,  256 } },
+      { PimCmdEnum::MAX,          {  204,   51,  256 } },
+      { PimCmdEnum::ADD_SCALAR,   {   51,   51,  204 } },
+      { PimCmdEnum::SUB_SCALAR,   {   51,   51,  204 } },
+      { PimCmdEnum::AND_SCALAR,   {   51,   51,  153 } },
+      { PimCmdEnum::OR_SCALAR,    {   51,   51,  153 } },
+      { PimCmdEnum::XOR_SCALAR,   {   51,   51,  153 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   51,   51,  204 } },
+      { PimCmdEnum::MIN_SCALAR,   {  102,   51,  357 } },
+      { PimCmdEnum::MAX_SCALAR,   {  102,   51,  358 } },
+    }},
+    { { true, 52 }, {
+      { PimCmdEnum::ABS,          {   52,   52,  208 } },
+      { PimCmdEnum::ADD,          {  104,   52,  156 } },
+      { PimCmdEnum::SUB,          {  104,   52,  156 } },
+      { PimCmdEnum::AND,          {  104,   52,  104 } },
+      { PimCmdEnum::OR,           {  104,   52,  104 } },
+      { PimCmdEnum::XOR,          {  104,   52,  104 } },
+      { PimCmdEnum::XNOR,         {  104,   52,  156 } },
+      { PimCmdEnum::MIN,          {  208,   52,  261 } },
+      { PimCmdEnum::MAX,          {  208,   52,  261 } },
+      { PimCmdEnum::ADD_SCALAR,   {   52,   52,  208 } },
+      { PimCmdEnum::SUB_SCALAR,   {   52,   52,  208 } },
+      { PimCmdEnum::AND_SCALAR,   {   52,   52,  156 } },
+      { PimCmdEnum::OR_SCALAR,    {   52,   52,  156 } },
+      { PimCmdEnum::XOR_SCALAR,   {   52,   52,  156 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   52,   52,  208 } },
+      { PimCmdEnum::MIN_SCALAR,   {  104,   52,  364 } },
+      { PimCmdEnum::MAX_SCALAR,   {  104,   52,  365 } },
+    }},
+    { { true, 53 }, {
+      { PimCmdEnum::ABS,          {   53,   53,  212 } },
+      { PimCmdEnum::ADD,          {  106,   53,  159 } },
+      { PimCmdEnum::SUB,          {  106,   53,  159 } },
+      { PimCmdEnum::AND,          {  106,   53,  106 } },
+      { PimCmdEnum::OR,           {  106,   53,  106 } },
+      { PimCmdEnum::XOR,          {  106,   53,  106 } },
+      { PimCmdEnum::XNOR,         {  106,   53,  159 } },
+      { PimCmdEnum::MIN,          {  212,   53,  266 } },
+      { PimCmdEnum::MAX,          {  212,   53,  266 } },
+      { PimCmdEnum::ADD_SCALAR,   {   53,   53,  212 } },
+      { PimCmdEnum::SUB_SCALAR,   {   53,   53,  212 } },
+      { PimCmdEnum::AND_SCALAR,   {   53,   53,  159 } },
+      { PimCmdEnum::OR_SCALAR,    {   53,   53,  159 } },
+      { PimCmdEnum::XOR_SCALAR,   {   53,   53,  159 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   53,   53,  212 } },
+      { PimCmdEnum::MIN_SCALAR,   {  106,   53,  371 } },
+      { PimCmdEnum::MAX_SCALAR,   {  106,   53,  372 } },
+    }},
+    { { true, 54 }, {
+      { PimCmdEnum::ABS,          {   54,   54,  216 } },
+      { PimCmdEnum::ADD,          {  108,   54,  162 } },
+      { PimCmdEnum::SUB,          {  108,   54,  162 } },
+      { PimCmdEnum::AND,          {  108,   54,  108 } },
+      { PimCmdEnum::OR,           {  108,   54,  108 } },
+      { PimCmdEnum::XOR,          {  108,   54,  108 } },
+      { PimCmdEnum::XNOR,         {  108,   54,  162 } },
+      { PimCmdEnum::MIN,          {  216,   54,  271 } },
+      { PimCmdEnum::MAX,          {  216,   54,  271 } },
+      { PimCmdEnum::ADD_SCALAR,   {   54,   54,  216 } },
+      { PimCmdEnum::SUB_SCALAR,   {   54,   54,  216 } },
+      { PimCmdEnum::AND_SCALAR,   {   54,   54,  162 } },
+      { PimCmdEnum::OR_SCALAR,    {   54,   54,  162 } },
+      { PimCmdEnum::XOR_SCALAR,   {   54,   54,  162 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   54,   54,  216 } },
+      { PimCmdEnum::MIN_SCALAR,   {  108,   54,  378 } },
+      { PimCmdEnum::MAX_SCALAR,   {  108,   54,  379 } },
+    }},
+    { { true, 55 }, {
+      { PimCmdEnum::ABS,          {   55,   55,  220 } },
+      { PimCmdEnum::ADD,          {  110,   55,  165 } },
+      { PimCmdEnum::SUB,          {  110,   55,  165 } },
+      { PimCmdEnum::AND,          {  110,   55,  110 } },
+      { PimCmdEnum::OR,           {  110,   55,  110 } },
+      { PimCmdEnum::XOR,          {  110,   55,  110 } },
+      { PimCmdEnum::XNOR,         {  110,   55,  165 } },
+      { PimCmdEnum::MIN,          {  220,   55,  276 } },
+      { PimCmdEnum::MAX,          {  220,   55,  276 } },
+      { PimCmdEnum::ADD_SCALAR,   {   55,   55,  220 } },
+      { PimCmdEnum::SUB_SCALAR,   {   55,   55,  220 } },
+      { PimCmdEnum::AND_SCALAR,   {   55,   55,  165 } },
+      { PimCmdEnum::OR_SCALAR,    {   55,   55,  165 } },
+      { PimCmdEnum::XOR_SCALAR,   {   55,   55,  165 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   55,   55,  220 } },
+      { PimCmdEnum::MIN_SCALAR,   {  110,   55,  385 } },
+      { PimCmdEnum::MAX_SCALAR,   {  110,   55,  386 } },
+    }},
+    { { true, 56 }, {
+      { PimCmdEnum::ABS,          {   56,   56,  224 } },
+      { PimCmdEnum::ADD,          {  112,   56,  168 } },
+      { PimCmdEnum::SUB,          {  112,   56,  168 } },
+      { PimCmdEnum::AND,          {  112,   56,  112 } },
+      { PimCmdEnum::OR,           {  112,   56,  112 } },
+      { PimCmdEnum::XOR,          {  112,   56,  112 } },
+      { PimCmdEnum::XNOR,         {  112,   56,  168 } },
+      { PimCmdEnum::MIN,          {  224,   56,  281 } },
+      { PimCmdEnum::MAX,          {  224,   56,  281 } },
+      { PimCmdEnum::ADD_SCALAR,   {   56,   56,  224 } },
+      { PimCmdEnum::SUB_SCALAR,   {   56,   56,  224 } },
+      { PimCmdEnum::AND_SCALAR,   {   56,   56,  168 } },
+      { PimCmdEnum::OR_SCALAR,    {   56,   56,  168 } },
+      { PimCmdEnum::XOR_SCALAR,   {   56,   56,  168 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   56,   56,  224 } },
+      { PimCmdEnum::MIN_SCALAR,   {  112,   56,  392 } },
+      { PimCmdEnum::MAX_SCALAR,   {  112,   56,  393 } },
+    }},
+    { { true, 57 }, {
+      { PimCmdEnum::ABS,          {   57,   57,  228 } },
+      { PimCmdEnum::ADD,          {  114,   57,  171 } },
+      { PimCmdEnum::SUB,          {  114,   57,  171 } },
+      { PimCmdEnum::AND,          {  114,   57,  114 } },
+      { PimCmdEnum::OR,           {  114,   57,  114 } },
+      { PimCmdEnum::XOR,          {  114,   57,  114 } },
+      { PimCmdEnum::XNOR,         {  114,   57,  171 } },
+      { PimCmdEnum::MIN,          {  228,   57,  286 } },
+      { PimCmdEnum::MAX,          {  228,   57,  286 } },
+      { PimCmdEnum::ADD_SCALAR,   {   57,   57,  228 } },
+      { PimCmdEnum::SUB_SCALAR,   {   57,   57,  228 } },
+      { PimCmdEnum::AND_SCALAR,   {   57,   57,  171 } },
+      { PimCmdEnum::OR_SCALAR,    {   57,   57,  171 } },
+      { PimCmdEnum::XOR_SCALAR,   {   57,   57,  171 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   57,   57,  228 } },
+      { PimCmdEnum::MIN_SCALAR,   {  114,   57,  399 } },
+      { PimCmdEnum::MAX_SCALAR,   {  114,   57,  400 } },
+    }},
+    { { true, 58 }, {
+      { PimCmdEnum::ABS,          {   58,   58,  232 } },
+      { PimCmdEnum::ADD,          {  116,   58,  174 } },
+      { PimCmdEnum::SUB,          {  116,   58,  174 } },
+      { PimCmdEnum::AND,          {  116,   58,  116 } },
+      { PimCmdEnum::OR,           {  116,   58,  116 } },
+      { PimCmdEnum::XOR,          {  116,   58,  116 } },
+      { PimCmdEnum::XNOR,         {  116,   58,  174 } },
+      { PimCmdEnum::MIN,          {  232,   58,  291 } },
+      { PimCmdEnum::MAX,          {  232,   58,  291 } },
+      { PimCmdEnum::ADD_SCALAR,   {   58,   58,  232 } },
+      { PimCmdEnum::SUB_SCALAR,   {   58,   58,  232 } },
+      { PimCmdEnum::AND_SCALAR,   {   58,   58,  174 } },
+      { PimCmdEnum::OR_SCALAR,    {   58,   58,  174 } },
+      { PimCmdEnum::XOR_SCALAR,   {   58,   58,  174 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   58,   58,  232 } },
+      { PimCmdEnum::MIN_SCALAR,   {  116,   58,  406 } },
+      { PimCmdEnum::MAX_SCALAR,   {  116,   58,  407 } },
+    }},
+    { { true, 59 }, {
+      { PimCmdEnum::ABS,          {   59,   59,  236 } },
+      { PimCmdEnum::ADD,          {  118,   59,  177 } },
+      { PimCmdEnum::SUB,          {  118,   59,  177 } },
+      { PimCmdEnum::AND,          {  118,   59,  118 } },
+      { PimCmdEnum::OR,           {  118,   59,  118 } },
+      { PimCmdEnum::XOR,          {  118,   59,  118 } },
+      { PimCmdEnum::XNOR,         {  118,   59,  177 } },
+      { PimCmdEnum::MIN,          {  236,   59,  296 } },
+      { PimCmdEnum::MAX,          {  236,   59,  296 } },
+      { PimCmdEnum::ADD_SCALAR,   {   59,   59,  236 } },
+      { PimCmdEnum::SUB_SCALAR,   {   59,   59,  236 } },
+      { PimCmdEnum::AND_SCALAR,   {   59,   59,  177 } },
+      { PimCmdEnum::OR_SCALAR,    {   59,   59,  177 } },
+      { PimCmdEnum::XOR_SCALAR,   {   59,   59,  177 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   59,   59,  236 } },
+      { PimCmdEnum::MIN_SCALAR,   {  118,   59,  413 } },
+      { PimCmdEnum::MAX_SCALAR,   {  118,   59,  414 } },
+    }},
+    { { true, 60 }, {
+      { PimCmdEnum::ABS,          {   60,   60,  240 } },
+      { PimCmdEnum::ADD,          {  120,   60,  180 } },
+      { PimCmdEnum::SUB,          {  120,   60,  180 } },
+      { PimCmdEnum::AND,          {  120,   60,  120 } },
+      { PimCmdEnum::OR,           {  120,   60,  120 } },
+      { PimCmdEnum::XOR,          {  120,   60,  120 } },
+      { PimCmdEnum::XNOR,         {  120,   60,  180 } },
+      { PimCmdEnum::MIN,          {  240,   60,  301 } },
+      { PimCmdEnum::MAX,          {  240,   60,  301 } },
+      { PimCmdEnum::ADD_SCALAR,   {   60,   60,  240 } },
+      { PimCmdEnum::SUB_SCALAR,   {   60,   60,  240 } },
+      { PimCmdEnum::AND_SCALAR,   {   60,   60,  180 } },
+      { PimCmdEnum::OR_SCALAR,    {   60,   60,  180 } },
+      { PimCmdEnum::XOR_SCALAR,   {   60,   60,  180 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   60,   60,  240 } },
+      { PimCmdEnum::MIN_SCALAR,   {  120,   60,  420 } },
+      { PimCmdEnum::MAX_SCALAR,   {  120,   60,  421 } },
+    }},
+    { { true, 61 }, {
+      { PimCmdEnum::ABS,          {   61,   61,  244 } },
+      { PimCmdEnum::ADD,          {  122,   61,  183 } },
+      { PimCmdEnum::SUB,          {  122,   61,  183 } },
+      { PimCmdEnum::AND,          {  122,   61,  122 } },
+      { PimCmdEnum::OR,           {  122,   61,  122 } },
+      { PimCmdEnum::XOR,          {  122,   61,  122 } },
+      { PimCmdEnum::XNOR,         {  122,   61,  183 } },
+      { PimCmdEnum::MIN,          {  244,   61,  306 } },
+      { PimCmdEnum::MAX,          {  244,   61,  306 } },
+      { PimCmdEnum::ADD_SCALAR,   {   61,   61,  244 } },
+      { PimCmdEnum::SUB_SCALAR,   {   61,   61,  244 } },
+      { PimCmdEnum::AND_SCALAR,   {   61,   61,  183 } },
+      { PimCmdEnum::OR_SCALAR,    {   61,   61,  183 } },
+      { PimCmdEnum::XOR_SCALAR,   {   61,   61,  183 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   61,   61,  244 } },
+      { PimCmdEnum::MIN_SCALAR,   {  122,   61,  427 } },
+      { PimCmdEnum::MAX_SCALAR,   {  122,   61,  428 } },
+    }},
+    { { true, 62 }, {
+      { PimCmdEnum::ABS,          {   62,   62,  248 } },
+      { PimCmdEnum::ADD,          {  124,   62,  186 } },
+      { PimCmdEnum::SUB,          {  124,   62,  186 } },
+      { PimCmdEnum::AND,          {  124,   62,  124 } },
+      { PimCmdEnum::OR,           {  124,   62,  124 } },
+      { PimCmdEnum::XOR,          {  124,   62,  124 } },
+      { PimCmdEnum::XNOR,         {  124,   62,  186 } },
+      { PimCmdEnum::MIN,          {  248,   62,  311 } },
+      { PimCmdEnum::MAX,          {  248,   62,  311 } },
+      { PimCmdEnum::ADD_SCALAR,   {   62,   62,  248 } },
+      { PimCmdEnum::SUB_SCALAR,   {   62,   62,  248 } },
+      { PimCmdEnum::AND_SCALAR,   {   62,   62,  186 } },
+      { PimCmdEnum::OR_SCALAR,    {   62,   62,  186 } },
+      { PimCmdEnum::XOR_SCALAR,   {   62,   62,  186 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   62,   62,  248 } },
+      { PimCmdEnum::MIN_SCALAR,   {  124,   62,  434 } },
+      { PimCmdEnum::MAX_SCALAR,   {  124,   62,  435 } },
+    }},
+    { { true, 63 }, {
+      { PimCmdEnum::ABS,          {   63,   63,  252 } },
+      { PimCmdEnum::ADD,          {  126,   63,  189 } },
+      { PimCmdEnum::SUB,          {  126,   63,  189 } },
+      { PimCmdEnum::AND,          {  126,   63,  126 } },
+      { PimCmdEnum::OR,           {  126,   63,  126 } },
+      { PimCmdEnum::XOR,          {  126,   63,  126 } },
+      { PimCmdEnum::XNOR,         {  126,   63,  189 } },
+      { PimCmdEnum::MIN,          {  252,   63,  316 } },
+      { PimCmdEnum::MAX,          {  252,   63,  316 } },
+      { PimCmdEnum::ADD_SCALAR,   {   63,   63,  252 } },
+      { PimCmdEnum::SUB_SCALAR,   {   63,   63,  252 } },
+      { PimCmdEnum::AND_SCALAR,   {   63,   63,  189 } },
+      { PimCmdEnum::OR_SCALAR,    {   63,   63,  189 } },
+      { PimCmdEnum::XOR_SCALAR,   {   63,   63,  189 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   63,   63,  252 } },
+      { PimCmdEnum::MIN_SCALAR,   {  126,   63,  441 } },
+      { PimCmdEnum::MAX_SCALAR,   {  126,   63,  442 } },
+    }},
+    { { false, 1 }, {
+      { PimCmdEnum::ABS,          {    1,    1,    0 } },
+      { PimCmdEnum::POPCOUNT,     {    0,    0,    0 } },
+      { PimCmdEnum::ADD,          {    2,    1,    3 } },
+      { PimCmdEnum::SUB,          {    2,    1,    3 } },
+      { PimCmdEnum::MUL,          {    2,    1,    3 } },
+      { PimCmdEnum::DIV,          {    2,    1,    5 } },
+      { PimCmdEnum::AND,          {    2,    1,    2 } },
+      { PimCmdEnum::OR,           {    2,    1,    2 } },
+      { PimCmdEnum::XOR,          {    2,    1,    2 } },
+      { PimCmdEnum::XNOR,         {    2,    1,    3 } },
+      { PimCmdEnum::EQ,           {    2,    1,    5 } },
+      { PimCmdEnum::MIN,          {    4,    1,    7 } },
+      { PimCmdEnum::MAX,          {    3,    1,    7 } },
+      { PimCmdEnum::ADD_SCALAR,   {    1,    1,    4 } },
+      { PimCmdEnum::SUB_SCALAR,   {    1,    1,    4 } },
+      { PimCmdEnum::MUL_SCALAR,   {    1,    1,    4 } },
+      { PimCmdEnum::DIV_SCALAR,   {    1,    1,    6 } },
+      { PimCmdEnum::AND_SCALAR,   {    1,    1,    3 } },
+      { PimCmdEnum::OR_SCALAR,    {    1,    1,    3 } },
+      { PimCmdEnum::XOR_SCALAR,   {    1,    1,    3 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    1,    1,    4 } },
+      { PimCmdEnum::EQ_SCALAR,    {    1,    1,    6 } },
+      { PimCmdEnum::MIN_SCALAR,   {    2,    1,    9 } },
+      { PimCmdEnum::MAX_SCALAR,   {    1,    1,    9 } },
+    }},
+    { { false, 2 }, {
+      { PimCmdEnum::ABS,          {    2,    2,    0 } },
+      { PimCmdEnum::ADD,          {    4,    2,    6 } },
+      { PimCmdEnum::SUB,          {    4,    2,    6 } },
+      { PimCmdEnum::MUL,          {    6,    3,    8 } },
+      { PimCmdEnum::DIV,          {   11,    7,   19 } },
+      { PimCmdEnum::AND,          {    4,    2,    4 } },
+      { PimCmdEnum::OR,           {    4,    2,    4 } },
+      { PimCmdEnum::XOR,          {    4,    2,    4 } },
+      { PimCmdEnum::XNOR,         {    4,    2,    6 } },
+      { PimCmdEnum::MIN,          {    8,    2,   12 } },
+      { PimCmdEnum::MAX,          {    8,    2,   12 } },
+      { PimCmdEnum::ADD_SCALAR,   {    2,    2,    8 } },
+      { PimCmdEnum::SUB_SCALAR,   {    2,    2,    8 } },
+      { PimCmdEnum::MUL_SCALAR,   {    3,    3,   11 } },
+      { PimCmdEnum::DIV_SCALAR,   {    7,    7,   23 } },
+      { PimCmdEnum::AND_SCALAR,   {    2,    2,    6 } },
+      { PimCmdEnum::OR_SCALAR,    {    2,    2,    6 } },
+      { PimCmdEnum::XOR_SCALAR,   {    2,    2,    6 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    2,    2,    8 } },
+      { PimCmdEnum::MIN_SCALAR,   {    4,    2,   16 } },
+      { PimCmdEnum::MAX_SCALAR,   {    4,    2,   16 } },
+    }},
+    { { false, 3 }, {
+      { PimCmdEnum::ABS,          {    3,    3,    0 } },
+      { PimCmdEnum::ADD,          {    6,    3,    9 } },
+      { PimCmdEnum::SUB,          {    6,    3,    9 } },
+      { PimCmdEnum::MUL,          {   12,    6,   18 } },
+      { PimCmdEnum::DIV,          {   26,   15,   39 } },
+      { PimCmdEnum::AND,          {    6,    3,    6 } },
+      { PimCmdEnum::OR,           {    6,    3,    6 } },
+      { PimCmdEnum::XOR,          {    6,    3,    6 } },
+      { PimCmdEnum::XNOR,         {    6,    3,    9 } },
+      { PimCmdEnum::MIN,          {   12,    3,   17 } },
+      { PimCmdEnum::MAX,          {   12,    3,   17 } },
+      { PimCmdEnum::ADD_SCALAR,   {    3,    3,   12 } },
+      { PimCmdEnum::SUB_SCALAR,   {    3,    3,   12 } },
+      { PimCmdEnum::MUL_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::DIV_SCALAR,   {   17,   15,   48 } },
+      { PimCmdEnum::AND_SCALAR,   {    3,    3,    9 } },
+      { PimCmdEnum::OR_SCALAR,    {    3,    3,    9 } },
+      { PimCmdEnum::XOR_SCALAR,   {    3,    3,    9 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    3,    3,   12 } },
+      { PimCmdEnum::MIN_SCALAR,   {    6,    3,   23 } },
+      { PimCmdEnum::MAX_SCALAR,   {    6,    3,   23 } },
+    }},
+    { { false, 4 }, {
+      { PimCmdEnum::ABS,          {    4,    4,    0 } },
+      { PimCmdEnum::ADD,          {    8,    4,   12 } },
+      { PimCmdEnum::SUB,          {    8,    4,   12 } },
+      { PimCmdEnum::MUL,          {   20,   10,   32 } },
+      { PimCmdEnum::DIV,          {   47,   25,   66 } },
+      { PimCmdEnum::AND,          {    8,    4,    8 } },
+      { PimCmdEnum::OR,           {    8,    4,    8 } },
+      { PimCmdEnum::XOR,          {    8,    4,    8 } },
+      { PimCmdEnum::XNOR,         {    8,    4,   12 } },
+      { PimCmdEnum::MIN,          {   16,    4,   22 } },
+      { PimCmdEnum::MAX,          {   16,    4,   22 } },
+      { PimCmdEnum::ADD_SCALAR,   {    4,    4,   16 } },
+      { PimCmdEnum::SUB_SCALAR,   {    4,    4,   16 } },
+      { PimCmdEnum::MUL_SCALAR,   {   10,   10,   42 } },
+      { PimCmdEnum::DIV_SCALAR,   {   31,   25,   82 } },
+      { PimCmdEnum::AND_SCALAR,   {    4,    4,   12 } },
+      { PimCmdEnum::OR_SCALAR,    {    4,    4,   12 } },
+      { PimCmdEnum::XOR_SCALAR,   {    4,    4,   12 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    4,    4,   16 } },
+      { PimCmdEnum::MIN_SCALAR,   {    8,    4,   30 } },
+      { PimCmdEnum::MAX_SCALAR,   {    8,    4,   30 } },
+    }},
+    { { false, 5 }, {
+      { PimCmdEnum::ABS,          {    5,    5,    0 } },
+      { PimCmdEnum::ADD,          {   10,    5,   15 } },
+      { PimCmdEnum::SUB,          {   10,    5,   15 } },
+      { PimCmdEnum::MUL,          {   30,   15,   50 } },
+      { PimCmdEnum::DIV,          {   74,   37,  100 } },
+      { PimCmdEnum::AND,          {   10,    5,   10 } },
+      { PimCmdEnum::OR,           {   10,    5,   10 } },
+      { PimCmdEnum::XOR,          {   10,    5,   10 } },
+      { PimCmdEnum::XNOR,         {   10,    5,   15 } },
+      { PimCmdEnum::MIN,          {   20,    5,   27 } },
+      { PimCmdEnum::MAX,          {   20,    5,   27 } },
+      { PimCmdEnum::ADD_SCALAR,   {    5,    5,   20 } },
+      { PimCmdEnum::SUB_SCALAR,   {    5,    5,   20 } },
+      { PimCmdEnum::MUL_SCALAR,   {   15,   15,   65 } },
+      { PimCmdEnum::DIV_SCALAR,   {   49,   37,  125 } },
+      { PimCmdEnum::AND_SCALAR,   {    5,    5,   15 } },
+      { PimCmdEnum::OR_SCALAR,    {    5,    5,   15 } },
+      { PimCmdEnum::XOR_SCALAR,   {    5,    5,   15 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    5,    5,   20 } },
+      { PimCmdEnum::MIN_SCALAR,   {   10,    5,   37 } },
+      { PimCmdEnum::MAX_SCALAR,   {   10,    5,   37 } },
+    }},
+    { { false, 6 }, {
+      { PimCmdEnum::ABS,          {    6,    6,    0 } },
+      { PimCmdEnum::ADD,          {   12,    6,   18 } },
+      { PimCmdEnum::SUB,          {   12,    6,   18 } },
+      { PimCmdEnum::MUL,          {   42,   21,   72 } },
+      { PimCmdEnum::DIV,          {  107,   51,  141 } },
+      { PimCmdEnum::AND,          {   12,    6,   12 } },
+      { PimCmdEnum::OR,           {   12,    6,   12 } },
+      { PimCmdEnum::XOR,          {   12,    6,   12 } },
+      { PimCmdEnum::XNOR,         {   12,    6,   18 } },
+      { PimCmdEnum::MIN,          {   24,    6,   32 } },
+      { PimCmdEnum::MAX,          {   24,    6,   32 } },
+      { PimCmdEnum::ADD_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::SUB_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::MUL_SCALAR,   {   21,   21,   93 } },
+      { PimCmdEnum::DIV_SCALAR,   {   71,   51,  177 } },
+      { PimCmdEnum::AND_SCALAR,   {    6,    6,   18 } },
+      { PimCmdEnum::OR_SCALAR,    {    6,    6,   18 } },
+      { PimCmdEnum::XOR_SCALAR,   {    6,    6,   18 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    6,    6,   24 } },
+      { PimCmdEnum::MIN_SCALAR,   {   12,    6,   44 } },
+      { PimCmdEnum::MAX_SCALAR,   {   12,    6,   44 } },
+    }},
+    { { false, 7 }, {
+      { PimCmdEnum::ABS,          {    7,    7,    0 } },
+      { PimCmdEnum::ADD,          {   14,    7,   21 } },
+      { PimCmdEnum::SUB,          {   14,    7,   21 } },
+      { PimCmdEnum::MUL,          {   56,   28,   98 } },
+      { PimCmdEnum::DIV,          {  146,   67,  189 } },
+      { PimCmdEnum::AND,          {   14,    7,   14 } },
+      { PimCmdEnum::OR,           {   14,    7,   14 } },
+      { PimCmdEnum::XOR,          {   14,    7,   14 } },
+      { PimCmdEnum::XNOR,         {   14,    7,   21 } },
+      { PimCmdEnum::MIN,          {   28,    7,   37 } },
+      { PimCmdEnum::MAX,          {   28,    7,   37 } },
+      { PimCmdEnum::ADD_SCALAR,   {    7,    7,   28 } },
+      { PimCmdEnum::SUB_SCALAR,   {    7,    7,   28 } },
+      { PimCmdEnum::MUL_SCALAR,   {   28,   28,  125 } },
+      { PimCmdEnum::DIV_SCALAR,   {   95,   67,  236 } },
+      { PimCmdEnum::AND_SCALAR,   {    7,    7,   21 } },
+      { PimCmdEnum::OR_SCALAR,    {    7,    7,   21 } },
+      { PimCmdEnum::XOR_SCALAR,   {    7,    7,   21 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    7,    7,   28 } },
+      { PimCmdEnum::MIN_SCALAR,   {   14,    7,   51 } },
+      { PimCmdEnum::MAX_SCALAR,   {   14,    7,   51 } },
+    }},
+    { { false, 9 }, {
+      { PimCmdEnum::ABS,          {    9,    9,    0 } },
+      { PimCmdEnum::ADD,          {   18,    9,   27 } },
+      { PimCmdEnum::SUB,          {   18,    9,   27 } },
+      { PimCmdEnum::MUL,          {   90,   45,  162 } },
+      { PimCmdEnum::DIV,          {  242,  105,  306 } },
+      { PimCmdEnum::AND,          {   18,    9,   18 } },
+      { PimCmdEnum::OR,           {   18,    9,   18 } },
+      { PimCmdEnum::XOR,          {   18,    9,   18 } },
+      { PimCmdEnum::XNOR,         {   18,    9,   27 } },
+      { PimCmdEnum::MIN,          {   36,    9,   47 } },
+      { PimCmdEnum::MAX,          {   36,    9,   47 } },
+      { PimCmdEnum::ADD_SCALAR,   {    9,    9,   36 } },
+      { PimCmdEnum::SUB_SCALAR,   {    9,    9,   36 } },
+      { PimCmdEnum::MUL_SCALAR,   {   45,   45,  203 } },
+      { PimCmdEnum::DIV_SCALAR,   {  152,  104,  370 } },
+      { PimCmdEnum::AND_SCALAR,   {    9,    9,   27 } },
+      { PimCmdEnum::OR_SCALAR,    {    9,    9,   27 } },
+      { PimCmdEnum::XOR_SCALAR,   {    9,    9,   27 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    9,    9,   36 } },
+      { PimCmdEnum::MIN_SCALAR,   {   18,    9,   65 } },
+      { PimCmdEnum::MAX_SCALAR,   {   18,    9,   65 } },
+    }},
+    { { false, 10 }, {
+      { PimCmdEnum::ABS,          {   10,   10,    0 } },
+      { PimCmdEnum::ADD,          {   20,   10,   30 } },
+      { PimCmdEnum::SUB,          {   20,   10,   30 } },
+      { PimCmdEnum::MUL,          {  110,   55,  200 } },
+      { PimCmdEnum::DIV,          {  299,  127,  375 } },
+      { PimCmdEnum::AND,          {   20,   10,   20 } },
+      { PimCmdEnum::OR,           {   20,   10,   20 } },
+      { PimCmdEnum::XOR,          {   20,   10,   20 } },
+      { PimCmdEnum::XNOR,         {   20,   10,   30 } },
+      { PimCmdEnum::MIN,          {   40,   10,   52 } },
+      { PimCmdEnum::MAX,          {   40,   10,   52 } },
+      { PimCmdEnum::ADD_SCALAR,   {   10,   10,   40 } },
+      { PimCmdEnum::SUB_SCALAR,   {   10,   10,   40 } },
+      { PimCmdEnum::MUL_SCALAR,   {   55,   55,  249 } },
+      { PimCmdEnum::DIV_SCALAR,   {  182,  125,  449 } },
+      { PimCmdEnum::AND_SCALAR,   {   10,   10,   30 } },
+      { PimCmdEnum::OR_SCALAR,    {   10,   10,   30 } },
+      { PimCmdEnum::XOR_SCALAR,   {   10,   10,   30 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   10,   10,   40 } },
+      { PimCmdEnum::MIN_SCALAR,   {   20,   10,   72 } },
+      { PimCmdEnum::MAX_SCALAR,   {   20,   10,   72 } },
+    }},
+    { { false, 11 }, {
+      { PimCmdEnum::ABS,          {   11,   11,    0 } },
+      { PimCmdEnum::ADD,          {   22,   11,   33 } },
+      { PimCmdEnum::SUB,          {   22,   11,   33 } },
+      { PimCmdEnum::MUL,          {  132,   66,  242 } },
+      { PimCmdEnum::DIV,          {  362,  151,  451 } },
+      { PimCmdEnum::AND,          {   22,   11,   22 } },
+      { PimCmdEnum::OR,           {   22,   11,   22 } },
+      { PimCmdEnum::XOR,          {   22,   11,   22 } },
+      { PimCmdEnum::XNOR,         {   22,   11,   33 } },
+      { PimCmdEnum::MIN,          {   44,   11,   57 } },
+      { PimCmdEnum::MAX,          {   44,   11,   57 } },
+      { PimCmdEnum::ADD_SCALAR,   {   11,   11,   44 } },
+      { PimCmdEnum::SUB_SCALAR,   {   11,   11,   44 } },
+      { PimCmdEnum::MUL_SCALAR,   {   66,   66,  300 } },
+      { PimCmdEnum::DIV_SCALAR,   {  215,  148,  536 } },
+      { PimCmdEnum::AND_SCALAR,   {   11,   11,   33 } },
+      { PimCmdEnum::OR_SCALAR,    {   11,   11,   33 } },
+      { PimCmdEnum::XOR_SCALAR,   {   11,   11,   33 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   11,   11,   44 } },
+      { PimCmdEnum::MIN_SCALAR,   {   22,   11,   79 } },
+      { PimCmdEnum::MAX_SCALAR,   {   22,   11,   79 } },
+    }},
+    { { false, 12 }, {
+      { PimCmdEnum::ABS,          {   12,   12,    0 } },
+      { PimCmdEnum::ADD,          {   24,   12,   36 } },
+      { PimCmdEnum::SUB,          {   24,   12,   36 } },
+      { PimCmdEnum::MUL,          {  156,   78,  288 } },
+      { PimCmdEnum::DIV,          {  431,  177,  534 } },
+      { PimCmdEnum::AND,          {   24,   12,   24 } },
+      { PimCmdEnum::OR,           {   24,   12,   24 } },
+      { PimCmdEnum::XOR,          {   24,   12,   24 } },
+      { PimCmdEnum::XNOR,         {   24,   12,   36 } },
+      { PimCmdEnum::MIN,          {   48,   12,   62 } },
+      { PimCmdEnum::MAX,          {   48,   12,   62 } },
+      { PimCmdEnum::ADD_SCALAR,   {   12,   12,   48 } },
+      { PimCmdEnum::SUB_SCALAR,   {   12,   12,   48 } },
+      { PimCmdEnum::MUL_SCALAR,   {   78,   78,  356 } },
+      { PimCmdEnum::DIV_SCALAR,   {  251,  173,  631 } },
+      { PimCmdEnum::AND_SCALAR,   {   12,   12,   36 } },
+      { PimCmdEnum::OR_SCALAR,    {   12,   12,   36 } },
+      { PimCmdEnum::XOR_SCALAR,   {   12,   12,   36 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   12,   12,   48 } },
+      { PimCmdEnum::MIN_SCALAR,   {   24,   12,   86 } },
+      { PimCmdEnum::MAX_SCALAR,   {   24,   12,   86 } },
+    }},
+    { { false, 13 }, {
+      { PimCmdEnum::ABS,          {   13,   13,    0 } },
+      { PimCmdEnum::ADD,          {   26,   13,   39 } },
+      { PimCmdEnum::SUB,          {   26,   13,   39 } },
+      { PimCmdEnum::MUL,          {  182,   91,  338 } },
+      { PimCmdEnum::DIV,          {  506,  205,  624 } },
+      { PimCmdEnum::AND,          {   26,   13,   26 } },
+      { PimCmdEnum::OR,           {   26,   13,   26 } },
+      { PimCmdEnum::XOR,          {   26,   13,   26 } },
+      { PimCmdEnum::XNOR,         {   26,   13,   39 } },
+      { PimCmdEnum::MIN,          {   52,   13,   67 } },
+      { PimCmdEnum::MAX,          {   52,   13,   67 } },
+      { PimCmdEnum::ADD_SCALAR,   {   13,   13,   52 } },
+      { PimCmdEnum::SUB_SCALAR,   {   13,   13,   52 } },
+      { PimCmdEnum::MUL_SCALAR,   {   91,   91,  417 } },
+      { PimCmdEnum::DIV_SCALAR,   {  290,  200,  734 } },
+      { PimCmdEnum::AND_SCALAR,   {   13,   13,   39 } },
+      { PimCmdEnum::OR_SCALAR,    {   13,   13,   39 } },
+      { PimCmdEnum::XOR_SCALAR,   {   13,   13,   39 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   13,   13,   52 } },
+      { PimCmdEnum::MIN_SCALAR,   {   26,   13,   93 } },
+      { PimCmdEnum::MAX_SCALAR,   {   26,   13,   93 } },
+    }},
+    { { false, 14 }, {
+      { PimCmdEnum::ABS,          {   14,   14,    0 } },
+      { PimCmdEnum::ADD,          {   28,   14,   42 } },
+      { PimCmdEnum::SUB,          {   28,   14,   42 } },
+      { PimCmdEnum::MUL,          {  210,  105,  392 } },
+      { PimCmdEnum::DIV,          {  587,  235,  721 } },
+      { PimCmdEnum::AND,          {   28,   14,   28 } },
+      { PimCmdEnum::OR,           {   28,   14,   28 } },
+      { PimCmdEnum::XOR,          {   28,   14,   28 } },
+      { PimCmdEnum::XNOR,         {   28,   14,   42 } },
+      { PimCmdEnum::MIN,          {   56,   14,   72 } },
+      { PimCmdEnum::MAX,          {   56,   14,   72 } },
+      { PimCmdEnum::ADD_SCALAR,   {   14,   14,   56 } },
+      { PimCmdEnum::SUB_SCALAR,   {   14,   14,   56 } },
+      { PimCmdEnum::MUL_SCALAR,   {  105,  105,  483 } },
+      { PimCmdEnum::DIV_SCALAR,   {  332,  229,  845 } },
+      { PimCmdEnum::AND_SCALAR,   {   14,   14,   42 } },
+      { PimCmdEnum::OR_SCALAR,    {   14,   14,   42 } },
+      { PimCmdEnum::XOR_SCALAR,   {   14,   14,   42 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   14,   14,   56 } },
+      { PimCmdEnum::MIN_SCALAR,   {   28,   14,  100 } },
+      { PimCmdEnum::MAX_SCALAR,   {   28,   14,  100 } },
+    }},
+    { { false, 15 }, {
+      { PimCmdEnum::ABS,          {   15,   15,    0 } },
+      { PimCmdEnum::ADD,          {   30,   15,   45 } },
+      { PimCmdEnum::SUB,          {   30,   15,   45 } },
+      { PimCmdEnum::MUL,          {  240,  120,  450 } },
+      { PimCmdEnum::DIV,          {  674,  267,  825 } },
+      { PimCmdEnum::AND,          {   30,   15,   30 } },
+      { PimCmdEnum::OR,           {   30,   15,   30 } },
+      { PimCmdEnum::XOR,          {   30,   15,   30 } },
+      { PimCmdEnum::XNOR,         {   30,   15,   45 } },
+      { PimCmdEnum::MIN,          {   60,   15,   77 } },
+      { PimCmdEnum::MAX,          {   60,   15,   77 } },
+      { PimCmdEnum::ADD_SCALAR,   {   15,   15,   60 } },
+      { PimCmdEnum::SUB_SCALAR,   {   15,   15,   60 } },
+      { PimCmdEnum::MUL_SCALAR,   {  120,  120,  554 } },
+      { PimCmdEnum::DIV_SCALAR,   {  377,  260,  964 } },
+      { PimCmdEnum::AND_SCALAR,   {   15,   15,   45 } },
+      { PimCmdEnum::OR_SCALAR,    {   15,   15,   45 } },
+      { PimCmdEnum::XOR_SCALAR,   {   15,   15,   45 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   15,   15,   60 } },
+      { PimCmdEnum::MIN_SCALAR,   {   30,   15,  107 } },
+      { PimCmdEnum::MAX_SCALAR,   {   30,   15,  107 } },
+    }},
+    { { false, 17 }, {
+      { PimCmdEnum::ABS,          {   17,   17,    0 } },
+      { PimCmdEnum::ADD,          {   34,   17,   51 } },
+      { PimCmdEnum::SUB,          {   34,   17,   51 } },
+      { PimCmdEnum::MUL,          {  306,  153,  578 } },
+      { PimCmdEnum::DIV,          {  866,  337, 1054 } },
+      { PimCmdEnum::AND,          {   34,   17,   34 } },
+      { PimCmdEnum::OR,           {   34,   17,   34 } },
+      { PimCmdEnum::XOR,          {   34,   17,   34 } },
+      { PimCmdEnum::XNOR,         {   34,   17,   51 } },
+      { PimCmdEnum::MIN,          {   68,   17,   87 } },
+      { PimCmdEnum::MAX,          {   68,   17,   87 } },
+      { PimCmdEnum::ADD_SCALAR,   {   17,   17,   68 } },
+      { PimCmdEnum::SUB_SCALAR,   {   17,   17,   68 } },
+      { PimCmdEnum::MUL_SCALAR,   {  153,  153,  711 } },
+      { PimCmdEnum::DIV_SCALAR,   {  476,  328, 1226 } },
+      { PimCmdEnum::AND_SCALAR,   {   17,   17,   51 } },
+      { PimCmdEnum::OR_SCALAR,    {   17,   17,   51 } },
+      { PimCmdEnum::XOR_SCALAR,   {   17,   17,   51 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   17,   17,   68 } },
+      { PimCmdEnum::MIN_SCALAR,   {   34,   17,  121 } },
+      { PimCmdEnum::MAX_SCALAR,   {   34,   17,  121 } },
+    }},
+    { { false, 18 }, {
+      { PimCmdEnum::ABS,          {   18,   18,    0 } },
+      { PimCmdEnum::ADD,          {   36,   18,   54 } },
+      { PimCmdEnum::SUB,          {   36,   18,   54 } },
+      { PimCmdEnum::MUL,          {  342,  171,  648 } },
+      { PimCmdEnum::DIV,          {  971,  375, 1179 } },
+      { PimCmdEnum::AND,          {   36,   18,   36 } },
+      { PimCmdEnum::OR,           {   36,   18,   36 } },
+      { PimCmdEnum::XOR,          {   36,   18,   36 } },
+      { PimCmdEnum::XNOR,         {   36,   18,   54 } },
+      { PimCmdEnum::MIN,          {   72,   18,   92 } },
+      { PimCmdEnum::MAX,          {   72,   18,   92 } },
+      { PimCmdEnum::ADD_SCALAR,   {   18,   18,   72 } },
+      { PimCmdEnum::SUB_SCALAR,   {   18,   18,   72 } },
+      { PimCmdEnum::MUL_SCALAR,   {  171,  171,  797 } },
+      { PimCmdEnum::DIV_SCALAR,   {  530,  365, 1369 } },
+      { PimCmdEnum::AND_SCALAR,   {   18,   18,   54 } },
+      { PimCmdEnum::OR_SCALAR,    {   18,   18,   54 } },
+      { PimCmdEnum::XOR_SCALAR,   {   18,   18,   54 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   18,   18,   72 } },
+      { PimCmdEnum::MIN_SCALAR,   {   36,   18,  128 } },
+      { PimCmdEnum::MAX_SCALAR,   {   36,   18,  128 } },
+    }},
+    { { false, 19 }, {
+      { PimCmdEnum::ABS,          {   19,   19,    0 } },
+      { PimCmdEnum::ADD,          {   38,   19,   57 } },
+      { PimCmdEnum::SUB,          {   38,   19,   57 } },
+      { PimCmdEnum::MUL,          {  380,  190,  722 } },
+      { PimCmdEnum::DIV,          { 1082,  415, 1311 } },
+      { PimCmdEnum::AND,          {   38,   19,   38 } },
+      { PimCmdEnum::OR,           {   38,   19,   38 } },
+      { PimCmdEnum::XOR,          {   38,   19,   38 } },
+      { PimCmdEnum::XNOR,         {   38,   19,   57 } },
+      { PimCmdEnum::MIN,          {   76,   19,   97 } },
+      { PimCmdEnum::MAX,          {   76,   19,   97 } },
+      { PimCmdEnum::ADD_SCALAR,   {   19,   19,   76 } },
+      { PimCmdEnum::SUB_SCALAR,   {   19,   19,   76 } },
+      { PimCmdEnum::MUL_SCALAR,   {  190,  190,  888 } },
+      { PimCmdEnum::DIV_SCALAR,   {  587,  404, 1520 } },
+      { PimCmdEnum::AND_SCALAR,   {   19,   19,   57 } },
+      { PimCmdEnum::OR_SCALAR,    {   19,   19,   57 } },
+      { PimCmdEnum::XOR_SCALAR,   {   19,   19,   57 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   19,   19,   76 } },
+      { PimCmdEnum::MIN_SCALAR,   {   38,   19,  135 } },
+      { PimCmdEnum::MAX_SCALAR,   {   38,   19,  135 } },
+    }},
+    { { false, 20 }, {
+      { PimCmdEnum::ABS,          {   20,   20,    0 } },
+      { PimCmdEnum::ADD,          {   40,   20,   60 } },
+      { PimCmdEnum::SUB,          {   40,   20,   60 } },
+      { PimCmdEnum::MUL,          {  420,  210,  800 } },
+      { PimCmdEnum::DIV,          { 1199,  457, 1450 } },
+      { PimCmdEnum::AND,          {   40,   20,   40 } },
+      { PimCmdEnum::OR,           {   40,   20,   40 } },
+      { PimCmdEnum::XOR,          {   40,   20,   40 } },
+      { PimCmdEnum::XNOR,         {   40,   20,   60 } },
+      { PimCmdEnum::MIN,          {   80,   20,  102 } },
+      { PimCmdEnum::MAX,          {   80,   20,  102 } },
+      { PimCmdEnum::ADD_SCALAR,   {   20,   20,   80 } },
+      { PimCmdEnum::SUB_SCALAR,   {   20,   20,   80 } },
+      { PimCmdEnum::MUL_SCALAR,   {  210,  210,  984 } },
+      { PimCmdEnum::DIV_SCALAR,   {  647,  445, 1679 } },
+      { PimCmdEnum::AND_SCALAR,   {   20,   20,   60 } },
+      { PimCmdEnum::OR_SCALAR,    {   20,   20,   60 } },
+      { PimCmdEnum::XOR_SCALAR,   {   20,   20,   60 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   20,   20,   80 } },
+      { PimCmdEnum::MIN_SCALAR,   {   40,   20,  142 } },
+      { PimCmdEnum::MAX_SCALAR,   {   40,   20,  142 } },
+    }},
+    { { false, 21 }, {
+      { PimCmdEnum::ABS,          {   21,   21,    0 } },
+      { PimCmdEnum::ADD,          {   42,   21,   63 } },
+      { PimCmdEnum::SUB,          {   42,   21,   63 } },
+      { PimCmdEnum::MUL,          {  462,  231,  882 } },
+      { PimCmdEnum::DIV,          { 1322,  501, 1596 } },
+      { PimCmdEnum::AND,          {   42,   21,   42 } },
+      { PimCmdEnum::OR,           {   42,   21,   42 } },
+      { PimCmdEnum::XOR,          {   42,   21,   42 } },
+      { PimCmdEnum::XNOR,         {   42,   21,   63 } },
+      { PimCmdEnum::MIN,          {   84,   21,  107 } },
+      { PimCmdEnum::MAX,          {   84,   21,  107 } },
+      { PimCmdEnum::ADD_SCALAR,   {   21,   21,   84 } },
+      { PimCmdEnum::SUB_SCALAR,   {   21,   21,   84 } },
+      { PimCmdEnum::MUL_SCALAR,   {  231,  231, 1085 } },
+      { PimCmdEnum::DIV_SCALAR,   {  710,  488, 1846 } },
+      { PimCmdEnum::AND_SCALAR,   {   21,   21,   63 } },
+      { PimCmdEnum::OR_SCALAR,    {   21,   21,   63 } },
+      { PimCmdEnum::XOR_SCALAR,   {   21,   21,   63 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   21,   21,   84 } },
+      { PimCmdEnum::MIN_SCALAR,   {   42,   21,  149 } },
+      { PimCmdEnum::MAX_SCALAR,   {   42,   21,  149 } },
+    }},
+    { { false, 22 }, {
+      { PimCmdEnum::ABS,          {   22,   22,    0 } },
+      { PimCmdEnum::ADD,          {   44,   22,   66 } },
+      { PimCmdEnum::SUB,          {   44,   22,   66 } },
+      { PimCmdEnum::MUL,          {  506,  253,  968 } },
+      { PimCmdEnum::DIV,          { 1451,  547, 1749 } },
+      { PimCmdEnum::AND,          {   44,   22,   44 } },
+      { PimCmdEnum::OR,           {   44,   22,   44 } },
+      { PimCmdEnum::XOR,          {   44,   22,   44 } },
+      { PimCmdEnum::XNOR,         {   44,   22,   66 } },
+      { PimCmdEnum::MIN,          {   88,   22,  112 } },
+      { PimCmdEnum::MAX,          {   88,   22,  112 } },
+      { PimCmdEnum::ADD_SCALAR,   {   22,   22,   88 } },
+      { PimCmdEnum::SUB_SCALAR,   {   22,   22,   88 } },
+      { PimCmdEnum::MUL_SCALAR,   {  253,  253, 1191 } },
+      { PimCmdEnum::DIV_SCALAR,   {  776,  533, 2021 } },
+      { PimCmdEnum::AND_SCALAR,   {   22,   22,   66 } },
+      { PimCmdEnum::OR_SCALAR,    {   22,   22,   66 } },
+      { PimCmdEnum::XOR_SCALAR,   {   22,   22,   66 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   22,   22,   88 } },
+      { PimCmdEnum::MIN_SCALAR,   {   44,   22,  156 } },
+      { PimCmdEnum::MAX_SCALAR,   {   44,   22,  156 } },
+    }},
+    { { false, 23 }, {
+      { PimCmdEnum::ABS,          {   23,   23,    0 } },
+      { PimCmdEnum::ADD,          {   46,   23,   69 } },
+      { PimCmdEnum::SUB,          {   46,   23,   69 } },
+      { PimCmdEnum::MUL,          {  552,  276, 1058 } },
+      { PimCmdEnum::DIV,          { 1586,  595, 1909 } },
+      { PimCmdEnum::AND,          {   46,   23,   46 } },
+      { PimCmdEnum::OR,           {   46,   23,   46 } },
+      { PimCmdEnum::XOR,          {   46,   23,   46 } },
+      { PimCmdEnum::XNOR,         {   46,   23,   69 } },
+      { PimCmdEnum::MIN,          {   92,   23,  117 } },
+      { PimCmdEnum::MAX,          {   92,   23,  117 } },
+      { PimCmdEnum::ADD_SCALAR,   {   23,   23,   92 } },
+      { PimCmdEnum::SUB_SCALAR,   {   23,   23,   92 } },
+      { PimCmdEnum::MUL_SCALAR,   {  276,  276, 1302 } },
+      { PimCmdEnum::DIV_SCALAR,   {  845,  580, 2204 } },
+      { PimCmdEnum::AND_SCALAR,   {   23,   23,   69 } },
+      { PimCmdEnum::OR_SCALAR,    {   23,   23,   69 } },
+      { PimCmdEnum::XOR_SCALAR,   {   23,   23,   69 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   23,   23,   92 } },
+      { PimCmdEnum::MIN_SCALAR,   {   46,   23,  163 } },
+      { PimCmdEnum::MAX_SCALAR,   {   46,   23,  163 } },
+    }},
+    { { false, 24 }, {
+      { PimCmdEnum::ABS,          {   24,   24,    0 } },
+      { PimCmdEnum::ADD,          {   48,   24,   72 } },
+      { PimCmdEnum::SUB,          {   48,   24,   72 } },
+      { PimCmdEnum::MUL,          {  600,  300, 1152 } },
+      { PimCmdEnum::DIV,          { 1727,  645, 2076 } },
+      { PimCmdEnum::AND,          {   48,   24,   48 } },
+      { PimCmdEnum::OR,           {   48,   24,   48 } },
+      { PimCmdEnum::XOR,          {   48,   24,   48 } },
+      { PimCmdEnum::XNOR,         {   48,   24,   72 } },
+      { PimCmdEnum::MIN,          {   96,   24,  122 } },
+      { PimCmdEnum::MAX,          {   96,   24,  122 } },
+      { PimCmdEnum::ADD_SCALAR,   {   24,   24,   96 } },
+      { PimCmdEnum::SUB_SCALAR,   {   24,   24,   96 } },
+      { PimCmdEnum::MUL_SCALAR,   {  300,  300, 1418 } },
+      { PimCmdEnum::DIV_SCALAR,   {  917,  629, 2395 } },
+      { PimCmdEnum::AND_SCALAR,   {   24,   24,   72 } },
+      { PimCmdEnum::OR_SCALAR,    {   24,   24,   72 } },
+      { PimCmdEnum::XOR_SCALAR,   {   24,   24,   72 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   24,   24,   96 } },
+      { PimCmdEnum::MIN_SCALAR,   {   48,   24,  170 } },
+      { PimCmdEnum::MAX_SCALAR,   {   48,   24,  170 } },
+    }},
+    { { false, 25 }, {
+      { PimCmdEnum::ABS,          {   25,   25,    0 } },
+      { PimCmdEnum::ADD,          {   50,   25,   75 } },
+      { PimCmdEnum::SUB,          {   50,   25,   75 } },
+      { PimCmdEnum::MUL,          {  650,  325, 1250 } },
+      { PimCmdEnum::DIV,          { 1874,  697, 2250 } },
+      { PimCmdEnum::AND,          {   50,   25,   50 } },
+      { PimCmdEnum::OR,           {   50,   25,   50 } },
+      { PimCmdEnum::XOR,          {   50,   25,   50 } },
+      { PimCmdEnum::XNOR,         {   50,   25,   75 } },
+      { PimCmdEnum::MIN,          {  100,   25,  127 } },
+      { PimCmdEnum::MAX,          {  100,   25,  127 } },
+      { PimCmdEnum::ADD_SCALAR,   {   25,   25,  100 } },
+      { PimCmdEnum::SUB_SCALAR,   {   25,   25,  100 } },
+      { PimCmdEnum::MUL_SCALAR,   {  325,  325, 1539 } },
+      { PimCmdEnum::DIV_SCALAR,   {  992,  680, 2594 } },
+      { PimCmdEnum::AND_SCALAR,   {   25,   25,   75 } },
+      { PimCmdEnum::OR_SCALAR,    {   25,   25,   75 } },
+      { PimCmdEnum::XOR_SCALAR,   {   25,   25,   75 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   25,   25,  100 } },
+      { PimCmdEnum::MIN_SCALAR,   {   50,   25,  177 } },
+      { PimCmdEnum::MAX_SCALAR,   {   50,   25,  177 } },
+    }},
+    { { false, 26 }, {
+      { PimCmdEnum::ABS,          {   26,   26,    0 } },
+      { PimCmdEnum::ADD,          {   52,   26,   78 } },
+      { PimCmdEnum::SUB,          {   52,   26,   78 } },
+      { PimCmdEnum::MUL,          {  702,  351, 1352 } },
+      { PimCmdEnum::DIV,          { 2027,  751, 2431 } },
+      { PimCmdEnum::AND,          {   52,   26,   52 } },
+      { PimCmdEnum::OR,           {   52,   26,   52 } },
+      { PimCmdEnum::XOR,          {   52,   26,   52 } },
+      { PimCmdEnum::XNOR,         {   52,   26,   78 } },
+      { PimCmdEnum::MIN,          {  104,   26,  132 } },
+      { PimCmdEnum::MAX,          {  104,   26,  132 } },
+      { PimCmdEnum::ADD_SCALAR,   {   26,   26,  104 } },
+      { PimCmdEnum::SUB_SCALAR,   {   26,   26,  104 } },
+      { PimCmdEnum::MUL_SCALAR,   {  351,  351, 1665 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1070,  733, 2801 } },
+      { PimCmdEnum::AND_SCALAR,   {   26,   26,   78 } },
+      { PimCmdEnum::OR_SCALAR,    {   26,   26,   78 } },
+      { PimCmdEnum::XOR_SCALAR,   {   26,   26,   78 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   26,   26,  104 } },
+      { PimCmdEnum::MIN_SCALAR,   {   52,   26,  184 } },
+      { PimCmdEnum::MAX_SCALAR,   {   52,   26,  184 } },
+    }},
+    { { false, 27 }, {
+      { PimCmdEnum::ABS,          {   27,   27,    0 } },
+      { PimCmdEnum::ADD,          {   54,   27,   81 } },
+      { PimCmdEnum::SUB,          {   54,   27,   81 } },
+      { PimCmdEnum::MUL,          {  756,  378, 1458 } },
+      { PimCmdEnum::DIV,          { 2186,  807, 2619 } },
+      { PimCmdEnum::AND,          {   54,   27,   54 } },
+      { PimCmdEnum::OR,           {   54,   27,   54 } },
+      { PimCmdEnum::XOR,          {   54,   27,   54 } },
+      { PimCmdEnum::XNOR,         {   54,   27,   81 } },
+      { PimCmdEnum::MIN,          {  108,   27,  137 } },
+      { PimCmdEnum::MAX,          {  108,   27,  137 } },
+      { PimCmdEnum::ADD_SCALAR,   {   27,   27,  108 } },
+      { PimCmdEnum::SUB_SCALAR,   {   27,   27,  108 } },
+      { PimCmdEnum::MUL_SCALAR,   {  378,  378, 1796 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1151,  788, 3016 } },
+      { PimCmdEnum::AND_SCALAR,   {   27,   27,   81 } },
+      { PimCmdEnum::OR_SCALAR,    {   27,   27,   81 } },
+      { PimCmdEnum::XOR_SCALAR,   {   27,   27,   81 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   27,   27,  108 } },
+      { PimCmdEnum::MIN_SCALAR,   {   54,   27,  191 } },
+      { PimCmdEnum::MAX_SCALAR,   {   54,   27,  191 } },
+    }},
+    { { false, 28 }, {
+      { PimCmdEnum::ABS,          {   28,   28,    0 } },
+      { PimCmdEnum::ADD,          {   56,   28,   84 } },
+      { PimCmdEnum::SUB,          {   56,   28,   84 } },
+      { PimCmdEnum::MUL,          {  812,  406, 1568 } },
+      { PimCmdEnum::DIV,          { 2351,  865, 2814 } },
+      { PimCmdEnum::AND,          {   56,   28,   56 } },
+      { PimCmdEnum::OR,           {   56,   28,   56 } },
+      { PimCmdEnum::XOR,          {   56,   28,   56 } },
+      { PimCmdEnum::XNOR,         {   56,   28,   84 } },
+      { PimCmdEnum::MIN,          {  112,   28,  142 } },
+      { PimCmdEnum::MAX,          {  112,   28,  142 } },
+      { PimCmdEnum::ADD_SCALAR,   {   28,   28,  112 } },
+      { PimCmdEnum::SUB_SCALAR,   {   28,   28,  112 } },
+      { PimCmdEnum::MUL_SCALAR,   {  406,  406, 1932 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1235,  845, 3239 } },
+      { PimCmdEnum::AND_SCALAR,   {   28,   28,   84 } },
+      { PimCmdEnum::OR_SCALAR,    {   28,   28,   84 } },
+      { PimCmdEnum::XOR_SCALAR,   {   28,   28,   84 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   28,   28,  112 } },
+      { PimCmdEnum::MIN_SCALAR,   {   56,   28,  198 } },
+      { PimCmdEnum::MAX_SCALAR,   {   56,   28,  198 } },
+    }},
+    { { false, 29 }, {
+      { PimCmdEnum::ABS,          {   29,   29,    0 } },
+      { PimCmdEnum::ADD,          {   58,   29,   87 } },
+      { PimCmdEnum::SUB,          {   58,   29,   87 } },
+      { PimCmdEnum::MUL,          {  870,  435, 1682 } },
+      { PimCmdEnum::DIV,          { 2522,  925, 3016 } },
+      { PimCmdEnum::AND,          {   58,   29,   58 } },
+      { PimCmdEnum::OR,           {   58,   29,   58 } },
+      { PimCmdEnum::XOR,          {   58,   29,   58 } },
+      { PimCmdEnum::XNOR,         {   58,   29,   87 } },
+      { PimCmdEnum::MIN,          {  116,   29,  147 } },
+      { PimCmdEnum::MAX,          {  116,   29,  147 } },
+      { PimCmdEnum::ADD_SCALAR,   {   29,   29,  116 } },
+      { PimCmdEnum::SUB_SCALAR,   {   29,   29,  116 } },
+      { PimCmdEnum::MUL_SCALAR,   {  435,  435, 2073 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1322,  904, 3470 } },
+      { PimCmdEnum::AND_SCALAR,   {   29,   29,   87 } },
+      { PimCmdEnum::OR_SCALAR,    {   29,   29,   87 } },
+      { PimCmdEnum::XOR_SCALAR,   {   29,   29,   87 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   29,   29,  116 } },
+      { PimCmdEnum::MIN_SCALAR,   {   58,   29,  205 } },
+      { PimCmdEnum::MAX_SCALAR,   {   58,   29,  205 } },
+    }},
+    { { false, 30 }, {
+      { PimCmdEnum::ABS,          {   30,   30,    0 } },
+      { PimCmdEnum::ADD,          {   60,   30,   90 } },
+      { PimCmdEnum::SUB,          {   60,   30,   90 } },
+      { PimCmdEnum::MUL,          {  930,  465, 1800 } },
+      { PimCmdEnum::DIV,          { 2699,  987, 3225 } },
+      { PimCmdEnum::AND,          {   60,   30,   60 } },
+      { PimCmdEnum::OR,           {   60,   30,   60 } },
+      { PimCmdEnum::XOR,          {   60,   30,   60 } },
+      { PimCmdEnum::XNOR,         {   60,   30,   90 } },
+      { PimCmdEnum::MIN,          {  120,   30,  152 } },
+      { PimCmdEnum::MAX,          {  120,   30,  152 } },
+      { PimCmdEnum::ADD_SCALAR,   {   30,   30,  120 } },
+      { PimCmdEnum::SUB_SCALAR,   {   30,   30,  120 } },
+      { PimCmdEnum::MUL_SCALAR,   {  465,  465, 2219 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1412,  965, 3709 } },
+      { PimCmdEnum::AND_SCALAR,   {   30,   30,   90 } },
+      { PimCmdEnum::OR_SCALAR,    {   30,   30,   90 } },
+      { PimCmdEnum::XOR_SCALAR,   {   30,   30,   90 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   30,   30,  120 } },
+      { PimCmdEnum::MIN_SCALAR,   {   60,   30,  212 } },
+      { PimCmdEnum::MAX_SCALAR,   {   60,   30,  212 } },
+    }},
+    { { false, 31 }, {
+      { PimCmdEnum::ABS,          {   31,   31,    0 } },
+      { PimCmdEnum::ADD,          {   62,   31,   93 } },
+      { PimCmdEnum::SUB,          {   62,   31,   93 } },
+      { PimCmdEnum::MUL,          {  992,  496, 1922 } },
+      { PimCmdEnum::DIV,          { 2882, 1051, 3441 } },
+      { PimCmdEnum::AND,          {   62,   31,   62 } },
+      { PimCmdEnum::OR,           {   62,   31,   62 } },
+      { PimCmdEnum::XOR,          {   62,   31,   62 } },
+      { PimCmdEnum::XNOR,         {   62,   31,   93 } },
+      { PimCmdEnum::MIN,          {  124,   31,  157 } },
+      { PimCmdEnum::MAX,          {  124,   31,  157 } },
+      { PimCmdEnum::ADD_SCALAR,   {   31,   31,  124 } },
+      { PimCmdEnum::SUB_SCALAR,   {   31,   31,  124 } },
+      { PimCmdEnum::MUL_SCALAR,   {  496,  496, 2370 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1505, 1028, 3956 } },
+      { PimCmdEnum::AND_SCALAR,   {   31,   31,   93 } },
+      { PimCmdEnum::OR_SCALAR,    {   31,   31,   93 } },
+      { PimCmdEnum::XOR_SCALAR,   {   31,   31,   93 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   31,   31,  124 } },
+      { PimCmdEnum::MIN_SCALAR,   {   62,   31,  219 } },
+      { PimCmdEnum::MAX_SCALAR,   {   62,   31,  219 } },
+    }},
+    { { false, 33 }, {
+      { PimCmdEnum::ABS,          {   33,   33,    0 } },
+      { PimCmdEnum::ADD,          {   66,   33,   99 } },
+      { PimCmdEnum::SUB,          {   66,   33,   99 } },
+      { PimCmdEnum::AND,          {   66,   33,   66 } },
+      { PimCmdEnum::OR,           {   66,   33,   66 } },
+      { PimCmdEnum::XOR,          {   66,   33,   66 } },
+      { PimCmdEnum::XNOR,         {   66,   33,   99 } },
+      { PimCmdEnum::MIN,          {  132,   33,  167 } },
+      { PimCmdEnum::MAX,          {  132,   33,  167 } },
+      { PimCmdEnum::ADD_SCALAR,   {   33,   33,  132 } },
+      { PimCmdEnum::SUB_SCALAR,   {   33,   33,  132 } },
+      { PimCmdEnum::AND_SCALAR,   {   33,   33,   99 } },
+      { PimCmdEnum::OR_SCALAR,    {   33,   33,   99 } },
+      { PimCmdEnum::XOR_SCALAR,   {   33,   33,   99 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   33,   33,  132 } },
+      { PimCmdEnum::MIN_SCALAR,   {   66,   33,  233 } },
+      { PimCmdEnum::MAX_SCALAR,   {   66,   33,  233 } },
+    }},
+    { { false, 34 }, {
+      { PimCmdEnum::ABS,          {   34,   34,    0 } },
+      { PimCmdEnum::ADD,          {   68,   34,  102 } },
+      { PimCmdEnum::SUB,          {   68,   34,  102 } },
+      { PimCmdEnum::AND,          {   68,   34,   68 } },
+      { PimCmdEnum::OR,           {   68,   34,   68 } },
+      { PimCmdEnum::XOR,          {   68,   34,   68 } },
+      { PimCmdEnum::XNOR,         {   68,   34,  102 } },
+      { PimCmdEnum::MIN,          {  136,   34,  172 } },
+      { PimCmdEnum::MAX,          {  136,   34,  172 } },
+      { PimCmdEnum::ADD_SCALAR,   {   34,   34,  136 } },
+      { PimCmdEnum::SUB_SCALAR,   {   34,   34,  136 } },
+      { PimCmdEnum::AND_SCALAR,   {   34,   34,  102 } },
+      { PimCmdEnum::OR_SCALAR,    {   34,   34,  102 } },
+      { PimCmdEnum::XOR_SCALAR,   {   34,   34,  102 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   34,   34,  136 } },
+      { PimCmdEnum::MIN_SCALAR,   {   68,   34,  240 } },
+      { PimCmdEnum::MAX_SCALAR,   {   68,   34,  240 } },
+    }},
+    { { false, 35 }, {
+      { PimCmdEnum::ABS,          {   35,   35,    0 } },
+      { PimCmdEnum::ADD,          {   70,   35,  105 } },
+      { PimCmdEnum::SUB,          {   70,   35,  105 } },
+      { PimCmdEnum::AND,          {   70,   35,   70 } },
+      { PimCmdEnum::OR,           {   70,   35,   70 } },
+      { PimCmdEnum::XOR,          {   70,   35,   70 } },
+      { PimCmdEnum::XNOR,         {   70,   35,  105 } },
+      { PimCmdEnum::MIN,          {  140,   35,  177 } },
+      { PimCmdEnum::MAX,          {  140,   35,  177 } },
+      { PimCmdEnum::ADD_SCALAR,   {   35,   35,  140 } },
+      { PimCmdEnum::SUB_SCALAR,   {   35,   35,  140 } },
+      { PimCmdEnum::AND_SCALAR,   {   35,   35,  105 } },
+      { PimCmdEnum::OR_SCALAR,    {   35,   35,  105 } },
+      { PimCmdEnum::XOR_SCALAR,   {   35,   35,  105 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   35,   35,  140 } },
+      { PimCmdEnum::MIN_SCALAR,   {   70,   35,  247 } },
+      { PimCmdEnum::MAX_SCALAR,   {   70,   35,  247 } },
+    }},
+    { { false, 36 }, {
+      { PimCmdEnum::ABS,          {   36,   36,    0 } },
+      { PimCmdEnum::ADD,          {   72,   36,  108 } },
+      { PimCmdEnum::SUB,          {   72,   36,  108 } },
+      { PimCmdEnum::AND,          {   72,   36,   72 } },
+      { PimCmdEnum::OR,           {   72,   36,   72 } },
+      { PimCmdEnum::XOR,          {   72,   36,   72 } },
+      { PimCmdEnum::XNOR,         {   72,   36,  108 } },
+      { PimCmdEnum::MIN,          {  144,   36,  182 } },
+      { PimCmdEnum::MAX,          {  144,   36,  182 } },
+      { PimCmdEnum::ADD_SCALAR,   {   36,   36,  144 } },
+      { PimCmdEnum::SUB_SCALAR,   {   36,   36,  144 } },
+      { PimCmdEnum::AND_SCALAR,   {   36,   36,  108 } },
+      { PimCmdEnum::OR_SCALAR,    {   36,   36,  108 } },
+      { PimCmdEnum::XOR_SCALAR,   {   36,   36,  108 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   36,   36,  144 } },
+      { PimCmdEnum::MIN_SCALAR,   {   72,   36,  254 } },
+      { PimCmdEnum::MAX_SCALAR,   {   72,   36,  254 } },
+    }},
+    { { false, 37 }, {
+      { PimCmdEnum::ABS,          {   37,   37,    0 } },
+      { PimCmdEnum::ADD,          {   74,   37,  111 } },
+      { PimCmdEnum::SUB,          {   74,   37,  111 } },
+      { PimCmdEnum::AND,          {   74,   37,   74 } },
+      { PimCmdEnum::OR,           {   74,   37,   74 } },
+      { PimCmdEnum::XOR,          {   74,   37,   74 } },
+      { PimCmdEnum::XNOR,         {   74,   37,  111 } },
+      { PimCmdEnum::MIN,          {  148,   37,  187 } },
+      { PimCmdEnum::MAX,          {  148,   37,  187 } },
+      { PimCmdEnum::ADD_SCALAR,   {   37,   37,  148 } },
+      { PimCmdEnum::SUB_SCALAR,   {   37,   37,  148 } },
+      { PimCmdEnum::AND_SCALAR,   {   37,   37,  111 } },
+      { PimCmdEnum::OR_SCALAR,    {   37,   37,  111 } },
+      { PimCmdEnum::XOR_SCALAR,   {   37,   37,  111 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   37,   37,  148 } },
+      { PimCmdEnum::MIN_SCALAR,   {   74,   37,  261 } },
+      { PimCmdEnum::MAX_SCALAR,   {   74,   37,  261 } },
+    }},
+    { { false, 38 }, {
+      { PimCmdEnum::ABS,          {   38,   38,    0 } },
+      { PimCmdEnum::ADD,          {   76,   38,  114 } },
+      { PimCmdEnum::SUB,          {   76,   38,  114 } },
+      { PimCmdEnum::AND,          {   76,   38,   76 } },
+      { PimCmdEnum::OR,           {   76,   38,   76 } },
+      { PimCmdEnum::XOR,          {   76,   38,   76 } },
+      { PimCmdEnum::XNOR,         {   76,   38,  114 } },
+      { PimCmdEnum::MIN,          {  152,   38,  192 } },
+      { PimCmdEnum::MAX,          {  152,   38,  192 } },
+      { PimCmdEnum::ADD_SCALAR,   {   38,   38,  152 } },
+      { PimCmdEnum::SUB_SCALAR,   {   38,   38,  152 } },
+      { PimCmdEnum::AND_SCALAR,   {   38,   38,  114 } },
+      { PimCmdEnum::OR_SCALAR,    {   38,   38,  114 } },
+      { PimCmdEnum::XOR_SCALAR,   {   38,   38,  114 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   38,   38,  152 } },
+      { PimCmdEnum::MIN_SCALAR,   {   76,   38,  268 } },
+      { PimCmdEnum::MAX_SCALAR,   {   76,   38,  268 } },
+    }},
+    { { false, 39 }, {
+      { PimCmdEnum::ABS,          {   39,   39,    0 } },
+      { PimCmdEnum::ADD,          {   78,   39,  117 } },
+      { PimCmdEnum::SUB,          {   78,   39,  117 } },
+      { PimCmdEnum::AND,          {   78,   39,   78 } },
+      { PimCmdEnum::OR,           {   78,   39,   78 } },
+      { PimCmdEnum::XOR,          {   78,   39,   78 } },
+      { PimCmdEnum::XNOR,         {   78,   39,  117 } },
+      { PimCmdEnum::MIN,          {  156,   39,  197 } },
+      { PimCmdEnum::MAX,          {  156,   39,  197 } },
+      { PimCmdEnum::ADD_SCALAR,   {   39,   39,  156 } },
+      { PimCmdEnum::SUB_SCALAR,   {   39,   39,  156 } },
+      { PimCmdEnum::AND_SCALAR,   {   39,   39,  117 } },
+      { PimCmdEnum::OR_SCALAR,    {   39,   39,  117 } },
+      { PimCmdEnum::XOR_SCALAR,   {   39,   39,  117 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   39,   39,  156 } },
+      { PimCmdEnum::MIN_SCALAR,   {   78,   39,  275 } },
+      { PimCmdEnum::MAX_SCALAR,   {   78,   39,  275 } },
+    }},
+    { { false, 40 }, {
+      { PimCmdEnum::ABS,          {   40,   40,    0 } },
+      { PimCmdEnum::ADD,          {   80,   40,  120 } },
+      { PimCmdEnum::SUB,          {   80,   40,  120 } },
+      { PimCmdEnum::AND,          {   80,   40,   80 } },
+      { PimCmdEnum::OR,           {   80,   40,   80 } },
+      { PimCmdEnum::XOR,          {   80,   40,   80 } },
+      { PimCmdEnum::XNOR,         {   80,   40,  120 } },
+      { PimCmdEnum::MIN,          {  160,   40,  202 } },
+      { PimCmdEnum::MAX,          {  160,   40,  202 } },
+      { PimCmdEnum::ADD_SCALAR,   {   40,   40,  160 } },
+      { PimCmdEnum::SUB_SCALAR,   {   40,   40,  160 } },
+      { PimCmdEnum::AND_SCALAR,   {   40,   40,  120 } },
+      { PimCmdEnum::OR_SCALAR,    {   40,   40,  120 } },
+      { PimCmdEnum::XOR_SCALAR,   {   40,   40,  120 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   40,   40,  160 } },
+      { PimCmdEnum::MIN_SCALAR,   {   80,   40,  282 } },
+      { PimCmdEnum::MAX_SCALAR,   {   80,   40,  282 } },
+    }},
+    { { false, 41 }, {
+      { PimCmdEnum::ABS,          {   41,   41,    0 } },
+      { PimCmdEnum::ADD,          {   82,   41,  123 } },
+      { PimCmdEnum::SUB,          {   82,   41,  123 } },
+      { PimCmdEnum::AND,          {   82,   41,   82 } },
+      { PimCmdEnum::OR,           {   82,   41,   82 } },
+      { PimCmdEnum::XOR,          {   82,   41,   82 } },
+      { PimCmdEnum::XNOR,         {   82,   41,  123 } },
+      { PimCmdEnum::MIN,          {  164,   41,  207 } },
+      { PimCmdEnum::MAX,          {  164,   41,  207 } },
+      { PimCmdEnum::ADD_SCALAR,   {   41,   41,  164 } },
+      { PimCmdEnum::SUB_SCALAR,   {   41,   41,  164 } },
+      { PimCmdEnum::AND_SCALAR,   {   41,   41,  123 } },
+      { PimCmdEnum::OR_SCALAR,    {   41,   41,  123 } },
+      { PimCmdEnum::XOR_SCALAR,   {   41,   41,  123 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   41,   41,  164 } },
+      { PimCmdEnum::MIN_SCALAR,   {   82,   41,  289 } },
+      { PimCmdEnum::MAX_SCALAR,   {   82,   41,  289 } },
+    }},
+    { { false, 42 }, {
+      { PimCmdEnum::ABS,          {   42,   42,    0 } },
+      { PimCmdEnum::ADD,          {   84,   42,  126 } },
+      { PimCmdEnum::SUB,          {   84,   42,  126 } },
+      { PimCmdEnum::AND,          {   84,   42,   84 } },
+      { PimCmdEnum::OR,           {   84,   42,   84 } },
+      { PimCmdEnum::XOR,          {   84,   42,   84 } },
+      { PimCmdEnum::XNOR,         {   84,   42,  126 } },
+      { PimCmdEnum::MIN,          {  168,   42,  212 } },
+      { PimCmdEnum::MAX,          {  168,   42,  212 } },
+      { PimCmdEnum::ADD_SCALAR,   {   42,   42,  168 } },
+      { PimCmdEnum::SUB_SCALAR,   {   42,   42,  168 } },
+      { PimCmdEnum::AND_SCALAR,   {   42,   42,  126 } },
+      { PimCmdEnum::OR_SCALAR,    {   42,   42,  126 } },
+      { PimCmdEnum::XOR_SCALAR,   {   42,   42,  126 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   42,   42,  168 } },
+      { PimCmdEnum::MIN_SCALAR,   {   84,   42,  296 } },
+      { PimCmdEnum::MAX_SCALAR,   {   84,   42,  296 } },
+    }},
+    { { false, 43 }, {
+      { PimCmdEnum::ABS,          {   43,   43,    0 } },
+      { PimCmdEnum::ADD,          {   86,   43,  129 } },
+      { PimCmdEnum::SUB,          {   86,   43,  129 } },
+      { PimCmdEnum::AND,          {   86,   43,   86 } },
+      { PimCmdEnum::OR,           {   86,   43,   86 } },
+      { PimCmdEnum::XOR,          {   86,   43,   86 } },
+      { PimCmdEnum::XNOR,         {   86,   43,  129 } },
+      { PimCmdEnum::MIN,          {  172,   43,  217 } },
+      { PimCmdEnum::MAX,          {  172,   43,  217 } },
+      { PimCmdEnum::ADD_SCALAR,   {   43,   43,  172 } },
+      { PimCmdEnum::SUB_SCALAR,   {   43,   43,  172 } },
+      { PimCmdEnum::AND_SCALAR,   {   43,   43,  129 } },
+      { PimCmdEnum::OR_SCALAR,    {   43,   43,  129 } },
+      { PimCmdEnum::XOR_SCALAR,   {   43,   43,  129 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   43,   43,  172 } },
+      { PimCmdEnum::MIN_SCALAR,   {   86,   43,  303 } },
+      { PimCmdEnum::MAX_SCALAR,   {   86,   43,  303 } },
+    }},
+    { { false, 44 }, {
+      { PimCmdEnum::ABS,          {   44,   44,    0 } },
+      { PimCmdEnum::ADD,          {   88,   44,  132 } },
+      { PimCmdEnum::SUB,          {   88,   44,  132 } },
+      { PimCmdEnum::AND,          {   88,   44,   88 } },
+      { PimCmdEnum::OR,           {   88,   44,   88 } },
+      { PimCmdEnum::XOR,          {   88,   44,   88 } },
+      { PimCmdEnum::XNOR,         {   88,   44,  132 } },
+      { PimCmdEnum::MIN,          {  176,   44,  222 } },
+      { PimCmdEnum::MAX,          {  176,   44,  222 } },
+      { PimCmdEnum::ADD_SCALAR,   {   44,   44,  176 } },
+      { PimCmdEnum::SUB_SCALAR,   {   44,   44,  176 } },
+      { PimCmdEnum::AND_SCALAR,   {   44,   44,  132 } },
+      { PimCmdEnum::OR_SCALAR,    {   44,   44,  132 } },
+      { PimCmdEnum::XOR_SCALAR,   {   44,   44,  132 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   44,   44,  176 } },
+      { PimCmdEnum::MIN_SCALAR,   {   88,   44,  310 } },
+      { PimCmdEnum::MAX_SCALAR,   {   88,   44,  310 } },
+    }},
+    { { false, 45 }, {
+      { PimCmdEnum::ABS,          {   45,   45,    0 } },
+      { PimCmdEnum::ADD,          {   90,   45,  135 } },
+      { PimCmdEnum::SUB,          {   90,   45,  135 } },
+      { PimCmdEnum::AND,          {   90,   45,   90 } },
+      { PimCmdEnum::OR,           {   90,   45,   90 } },
+      { PimCmdEnum::XOR,          {   90,   45,   90 } },
+      { PimCmdEnum::XNOR,         {   90,   45,  135 } },
+      { PimCmdEnum::MIN,          {  180,   45,  227 } },
+      { PimCmdEnum::MAX,          {  180,   45,  227 } },
+      { PimCmdEnum::ADD_SCALAR,   {   45,   45,  180 } },
+      { PimCmdEnum::SUB_SCALAR,   {   45,   45,  180 } },
+      { PimCmdEnum::AND_SCALAR,   {   45,   45,  135 } },
+      { PimCmdEnum::OR_SCALAR,    {   45,   45,  135 } },
+      { PimCmdEnum::XOR_SCALAR,   {   45,   45,  135 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   45,   45,  180 } },
+      { PimCmdEnum::MIN_SCALAR,   {   90,   45,  317 } },
+      { PimCmdEnum::MAX_SCALAR,   {   90,   45,  317 } },
+    }},
+    { { false, 46 }, {
+      { PimCmdEnum::ABS,          {   46,   46,    0 } },
+      { PimCmdEnum::ADD,          {   92,   46,  138 } },
+      { PimCmdEnum::SUB,          {   92,   46,  138 } },
+      { PimCmdEnum::AND,          {   92,   46,   92 } },
+      { PimCmdEnum::OR,           {   92,   46,   92 } },
+      { PimCmdEnum::XOR,          {   92,   46,   92 } },
+      { PimCmdEnum::XNOR,         {   92,   46,  138 } },
+      { PimCmdEnum::MIN,          {  184,   46,  232 } },
+      { PimCmdEnum::MAX,          {  184,   46,  232 } },
+      { PimCmdEnum::ADD_SCALAR,   {   46,   46,  184 } },
+      { PimCmdEnum::SUB_SCALAR,   {   46,   46,  184 } },
+      { PimCmdEnum::AND_SCALAR,   {   46,   46,  138 } },
+      { PimCmdEnum::OR_SCALAR,    {   46,   46,  138 } },
+      { PimCmdEnum::XOR_SCALAR,   {   46,   46,  138 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   46,   46,  184 } },
+      { PimCmdEnum::MIN_SCALAR,   {   92,   46,  324 } },
+      { PimCmdEnum::MAX_SCALAR,   {   92,   46,  324 } },
+    }},
+    { { false, 47 }, {
+      { PimCmdEnum::ABS,          {   47,   47,    0 } },
+      { PimCmdEnum::ADD,          {   94,   47,  141 } },
+      { PimCmdEnum::SUB,          {   94,   47,  141 } },
+      { PimCmdEnum::AND,          {   94,   47,   94 } },
+      { PimCmdEnum::OR,           {   94,   47,   94 } },
+      { PimCmdEnum::XOR,          {   94,   47,   94 } },
+      { PimCmdEnum::XNOR,         {   94,   47,  141 } },
+      { PimCmdEnum::MIN,          {  188,   47,  237 } },
+      { PimCmdEnum::MAX,          {  188,   47,  237 } },
+      { PimCmdEnum::ADD_SCALAR,   {   47,   47,  188 } },
+      { PimCmdEnum::SUB_SCALAR,   {   47,   47,  188 } },
+      { PimCmdEnum::AND_SCALAR,   {   47,   47,  141 } },
+      { PimCmdEnum::OR_SCALAR,    {   47,   47,  141 } },
+      { PimCmdEnum::XOR_SCALAR,   {   47,   47,  141 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   47,   47,  188 } },
+      { PimCmdEnum::MIN_SCALAR,   {   94,   47,  331 } },
+      { PimCmdEnum::MAX_SCALAR,   {   94,   47,  331 } },
+    }},
+    { { false, 48 }, {
+      { PimCmdEnum::ABS,          {   48,   48,    0 } },
+      { PimCmdEnum::ADD,          {   96,   48,  144 } },
+      { PimCmdEnum::SUB,          {   96,   48,  144 } },
+      { PimCmdEnum::AND,          {   96,   48,   96 } },
+      { PimCmdEnum::OR,           {   96,   48,   96 } },
+      { PimCmdEnum::XOR,          {   96,   48,   96 } },
+      { PimCmdEnum::XNOR,         {   96,   48,  144 } },
+      { PimCmdEnum::MIN,          {  192,   48,  242 } },
+      { PimCmdEnum::MAX,          {  192,   48,  242 } },
+      { PimCmdEnum::ADD_SCALAR,   {   48,   48,  192 } },
+      { PimCmdEnum::SUB_SCALAR,   {   48,   48,  192 } },
+      { PimCmdEnum::AND_SCALAR,   {   48,   48,  144 } },
+      { PimCmdEnum::OR_SCALAR,    {   48,   48,  144 } },
+      { PimCmdEnum::XOR_SCALAR,   {   48,   48,  144 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   48,   48,  192 } },
+      { PimCmdEnum::MIN_SCALAR,   {   96,   48,  338 } },
+      { PimCmdEnum::MAX_SCALAR,   {   96,   48,  338 } },
+    }},
+    { { false, 49 }, {
+      { PimCmdEnum::ABS,          {   49,   49,    0 } },
+      { PimCmdEnum::ADD,          {   98,   49,  147 } },
+      { PimCmdEnum::SUB,          {   98,   49,  147 } },
+      { PimCmdEnum::AND,          {   98,   49,   98 } },
+      { PimCmdEnum::OR,           {   98,   49,   98 } },
+      { PimCmdEnum::XOR,          {   98,   49,   98 } },
+      { PimCmdEnum::XNOR,         {   98,   49,  147 } },
+      { PimCmdEnum::MIN,          {  196,   49,  247 } },
+      { PimCmdEnum::MAX,          {  196,   49,  247 } },
+      { PimCmdEnum::ADD_SCALAR,   {   49,   49,  196 } },
+      { PimCmdEnum::SUB_SCALAR,   {   49,   49,  196 } },
+      { PimCmdEnum::AND_SCALAR,   {   49,   49,  147 } },
+      { PimCmdEnum::OR_SCALAR,    {   49,   49,  147 } },
+      { PimCmdEnum::XOR_SCALAR,   {   49,   49,  147 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   49,   49,  196 } },
+      { PimCmdEnum::MIN_SCALAR,   {   98,   49,  345 } },
+      { PimCmdEnum::MAX_SCALAR,   {   98,   49,  345 } },
+    }},
+    { { false, 50 }, {
+      { PimCmdEnum::ABS,          {   50,   50,    0 } },
+      { PimCmdEnum::ADD,          {  100,   50,  150 } },
+      { PimCmdEnum::SUB,          {  100,   50,  150 } },
+      { PimCmdEnum::AND,          {  100,   50,  100 } },
+      { PimCmdEnum::OR,           {  100,   50,  100 } },
+      { PimCmdEnum::XOR,          {  100,   50,  100 } },
+      { PimCmdEnum::XNOR,         {  100,   50,  150 } },
+      { PimCmdEnum::MIN,          {  200,   50,  252 } },
+      { PimCmdEnum::MAX,          {  200,   50,  252 } },
+      { PimCmdEnum::ADD_SCALAR,   {   50,   50,  200 } },
+      { PimCmdEnum::SUB_SCALAR,   {   50,   50,  200 } },
+      { PimCmdEnum::AND_SCALAR,   {   50,   50,  150 } },
+      { PimCmdEnum::OR_SCALAR,    {   50,   50,  150 } },
+      { PimCmdEnum::XOR_SCALAR,   {   50,   50,  150 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   50,   50,  200 } },
+      { PimCmdEnum::MIN_SCALAR,   {  100,   50,  352 } },
+      { PimCmdEnum::MAX_SCALAR,   {  100,   50,  352 } },
+    }},
+    { { false, 51 }, {
+      { PimCmdEnum::ABS,          {   51,   51,    0 } },
+      { PimCmdEnum::ADD,          {  102,   51,  153 } },
+      { PimCmdEnum::SUB,          {  102,   51,  153 } },
+      { PimCmdEnum::AND,          {  102,   51,  102 } },
+      { PimCmdEnum::OR,           {  102,   51,  102 } },
+      { PimCmdEnum::XOR,          {  102,   51,  102 } },
+      { PimCmdEnum::XNOR,         {  102,   51,  153 } },
+      { PimCmdEnum::MIN,          {  204,   51,  257 } },
+      { PimCmdEnum::MAX,          {  204,   51,  257 } },
+      { PimCmdEnum::ADD_SCALAR,   {   51,   51,  204 } },
+      { PimCmdEnum::SUB_SCALAR,   {   51,   51,  204 } },
+      { PimCmdEnum::AND_SCALAR,   {   51,   51,  153 } },
+      { PimCmdEnum::OR_SCALAR,    {   51,   51,  153 } },
+      { PimCmdEnum::XOR_SCALAR,   {   51,   51,  153 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   51,   51,  204 } },
+      { PimCmdEnum::MIN_SCALAR,   {  102,   51,  359 } },
+      { PimCmdEnum::MAX_SCALAR,   {  102,   51,  359 } },
+    }},
+    { { false, 52 }, {
+      { PimCmdEnum::ABS,          {   52,   52,    0 } },
+      { PimCmdEnum::ADD,          {  104,   52,  156 } },
+      { PimCmdEnum::SUB,          {  104,   52,  156 } },
+      { PimCmdEnum::AND,          {  104,   52,  104 } },
+      { PimCmdEnum::OR,           {  104,   52,  104 } },
+      { PimCmdEnum::XOR,          {  104,   52,  104 } },
+      { PimCmdEnum::XNOR,         {  104,   52,  156 } },
+      { PimCmdEnum::MIN,          {  208,   52,  262 } },
+      { PimCmdEnum::MAX,          {  208,   52,  262 } },
+      { PimCmdEnum::ADD_SCALAR,   {   52,   52,  208 } },
+      { PimCmdEnum::SUB_SCALAR,   {   52,   52,  208 } },
+      { PimCmdEnum::AND_SCALAR,   {   52,   52,  156 } },
+      { PimCmdEnum::OR_SCALAR,    {   52,   52,  156 } },
+      { PimCmdEnum::XOR_SCALAR,   {   52,   52,  156 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   52,   52,  208 } },
+      { PimCmdEnum::MIN_SCALAR,   {  104,   52,  366 } },
+      { PimCmdEnum::MAX_SCALAR,   {  104,   52,  366 } },
+    }},
+    { { false, 53 }, {
+      { PimCmdEnum::ABS,          {   53,   53,    0 } },
+      { PimCmdEnum::ADD,          {  106,   53,  159 } },
+      { PimCmdEnum::SUB,          {  106,   53,  159 } },
+      { PimCmdEnum::AND,          {  106,   53,  106 } },
+      { PimCmdEnum::OR,           {  106,   53,  106 } },
+      { PimCmdEnum::XOR,          {  106,   53,  106 } },
+      { PimCmdEnum::XNOR,         {  106,   53,  159 } },
+      { PimCmdEnum::MIN,          {  212,   53,  267 } },
+      { PimCmdEnum::MAX,          {  212,   53,  267 } },
+      { PimCmdEnum::ADD_SCALAR,   {   53,   53,  212 } },
+      { PimCmdEnum::SUB_SCALAR,   {   53,   53,  212 } },
+      { PimCmdEnum::AND_SCALAR,   {   53,   53,  159 } },
+      { PimCmdEnum::OR_SCALAR,    {   53,   53,  159 } },
+      { PimCmdEnum::XOR_SCALAR,   {   53,   53,  159 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   53,   53,  212 } },
+      { PimCmdEnum::MIN_SCALAR,   {  106,   53,  373 } },
+      { PimCmdEnum::MAX_SCALAR,   {  106,   53,  373 } },
+    }},
+    { { false, 54 }, {
+      { PimCmdEnum::ABS,          {   54,   54,    0 } },
+      { PimCmdEnum::ADD,          {  108,   54,  162 } },
+      { PimCmdEnum::SUB,          {  108,   54,  162 } },
+      { PimCmdEnum::AND,          {  108,   54,  108 } },
+      { PimCmdEnum::OR,           {  108,   54,  108 } },
+      { PimCmdEnum::XOR,          {  108,   54,  108 } },
+      { PimCmdEnum::XNOR,         {  108,   54,  162 } },
+      { PimCmdEnum::MIN,          {  216,   54,  272 } },
+      { PimCmdEnum::MAX,          {  216,   54,  272 } },
+      { PimCmdEnum::ADD_SCALAR,   {   54,   54,  216 } },
+      { PimCmdEnum::SUB_SCALAR,   {   54,   54,  216 } },
+      { PimCmdEnum::AND_SCALAR,   {   54,   54,  162 } },
+      { PimCmdEnum::OR_SCALAR,    {   54,   54,  162 } },
+      { PimCmdEnum::XOR_SCALAR,   {   54,   54,  162 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   54,   54,  216 } },
+      { PimCmdEnum::MIN_SCALAR,   {  108,   54,  380 } },
+      { PimCmdEnum::MAX_SCALAR,   {  108,   54,  380 } },
+    }},
+    { { false, 55 }, {
+      { PimCmdEnum::ABS,          {   55,   55,    0 } },
+      { PimCmdEnum::ADD,          {  110,   55,  165 } },
+      { PimCmdEnum::SUB,          {  110,   55,  165 } },
+      { PimCmdEnum::AND,          {  110,   55,  110 } },
+      { PimCmdEnum::OR,           {  110,   55,  110 } },
+      { PimCmdEnum::XOR,          {  110,   55,  110 } },
+      { PimCmdEnum::XNOR,         {  110,   55,  165 } },
+      { PimCmdEnum::MIN,          {  220,   55,  277 } },
+      { PimCmdEnum::MAX,          {  220,   55,  277 } },
+      { PimCmdEnum::ADD_SCALAR,   {   55,   55,  220 } },
+      { PimCmdEnum::SUB_SCALAR,   {   55,   55,  220 } },
+      { PimCmdEnum::AND_SCALAR,   {   55,   55,  165 } },
+      { PimCmdEnum::OR_SCALAR,    {   55,   55,  165 } },
+      { PimCmdEnum::XOR_SCALAR,   {   55,   55,  165 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   55,   55,  220 } },
+      { PimCmdEnum::MIN_SCALAR,   {  110,   55,  387 } },
+      { PimCmdEnum::MAX_SCALAR,   {  110,   55,  387 } },
+    }},
+    { { false, 56 }, {
+      { PimCmdEnum::ABS,          {   56,   56,    0 } },
+      { PimCmdEnum::ADD,          {  112,   56,  168 } },
+      { PimCmdEnum::SUB,          {  112,   56,  168 } },
+      { PimCmdEnum::AND,          {  112,   56,  112 } },
+      { PimCmdEnum::OR,           {  112,   56,  112 } },
+      { PimCmdEnum::XOR,          {  112,   56,  112 } },
+      { PimCmdEnum::XNOR,         {  112,   56,  168 } },
+      { PimCmdEnum::MIN,          {  224,   56,  282 } },
+      { PimCmdEnum::MAX,          {  224,   56,  282 } },
+      { PimCmdEnum::ADD_SCALAR,   {   56,   56,  224 } },
+      { PimCmdEnum::SUB_SCALAR,   {   56,   56,  224 } },
+      { PimCmdEnum::AND_SCALAR,   {   56,   56,  168 } },
+      { PimCmdEnum::OR_SCALAR,    {   56,   56,  168 } },
+      { PimCmdEnum::XOR_SCALAR,   {   56,   56,  168 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   56,   56,  224 } },
+      { PimCmdEnum::MIN_SCALAR,   {  112,   56,  394 } },
+      { PimCmdEnum::MAX_SCALAR,   {  112,   56,  394 } },
+    }},
+    { { false, 57 }, {
+      { PimCmdEnum::ABS,          {   57,   57,    0 } },
+      { PimCmdEnum::ADD,          {  114,   57,  171 } },
+      { PimCmdEnum::SUB,          {  114,   57,  171 } },
+      { PimCmdEnum::AND,          {  114,   57,  114 } },
+      { PimCmdEnum::OR,           {  114,   57,  114 } },
+      { PimCmdEnum::XOR,          {  114,   57,  114 } },
+      { PimCmdEnum::XNOR,         {  114,   57,  171 } },
+      { PimCmdEnum::MIN,          {  228,   57,  287 } },
+      { PimCmdEnum::MAX,          {  228,   57,  287 } },
+      { PimCmdEnum::ADD_SCALAR,   {   57,   57,  228 } },
+      { PimCmdEnum::SUB_SCALAR,   {   57,   57,  228 } },
+      { PimCmdEnum::AND_SCALAR,   {   57,   57,  171 } },
+      { PimCmdEnum::OR_SCALAR,    {   57,   57,  171 } },
+      { PimCmdEnum::XOR_SCALAR,   {   57,   57,  171 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   57,   57,  228 } },
+      { PimCmdEnum::MIN_SCALAR,   {  114,   57,  401 } },
+      { PimCmdEnum::MAX_SCALAR,   {  114,   57,  401 } },
+    }},
+    { { false, 58 }, {
+      { PimCmdEnum::ABS,          {   58,   58,    0 } },
+      { PimCmdEnum::ADD,          {  116,   58,  174 } },
+      { PimCmdEnum::SUB,          {  116,   58,  174 } },
+      { PimCmdEnum::AND,          {  116,   58,  116 } },
+      { PimCmdEnum::OR,           {  116,   58,  116 } },
+      { PimCmdEnum::XOR,          {  116,   58,  116 } },
+      { PimCmdEnum::XNOR,         {  116,   58,  174 } },
+      { PimCmdEnum::MIN,          {  232,   58,  292 } },
+      { PimCmdEnum::MAX,          {  232,   58,  292 } },
+      { PimCmdEnum::ADD_SCALAR,   {   58,   58,  232 } },
+      { PimCmdEnum::SUB_SCALAR,   {   58,   58,  232 } },
+      { PimCmdEnum::AND_SCALAR,   {   58,   58,  174 } },
+      { PimCmdEnum::OR_SCALAR,    {   58,   58,  174 } },
+      { PimCmdEnum::XOR_SCALAR,   {   58,   58,  174 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   58,   58,  232 } },
+      { PimCmdEnum::MIN_SCALAR,   {  116,   58,  408 } },
+      { PimCmdEnum::MAX_SCALAR,   {  116,   58,  408 } },
+    }},
+    { { false, 59 }, {
+      { PimCmdEnum::ABS,          {   59,   59,    0 } },
+      { PimCmdEnum::ADD,          {  118,   59,  177 } },
+      { PimCmdEnum::SUB,          {  118,   59,  177 } },
+      { PimCmdEnum::AND,          {  118,   59,  118 } },
+      { PimCmdEnum::OR,           {  118,   59,  118 } },
+      { PimCmdEnum::XOR,          {  118,   59,  118 } },
+      { PimCmdEnum::XNOR,         {  118,   59,  177 } },
+      { PimCmdEnum::MIN,          {  236,   59,  297 } },
+      { PimCmdEnum::MAX,          {  236,   59,  297 } },
+      { PimCmdEnum::ADD_SCALAR,   {   59,   59,  236 } },
+      { PimCmdEnum::SUB_SCALAR,   {   59,   59,  236 } },
+      { PimCmdEnum::AND_SCALAR,   {   59,   59,  177 } },
+      { PimCmdEnum::OR_SCALAR,    {   59,   59,  177 } },
+      { PimCmdEnum::XOR_SCALAR,   {   59,   59,  177 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   59,   59,  236 } },
+      { PimCmdEnum::MIN_SCALAR,   {  118,   59,  415 } },
+      { PimCmdEnum::MAX_SCALAR,   {  118,   59,  415 } },
+    }},
+    { { false, 60 }, {
+      { PimCmdEnum::ABS,          {   60,   60,    0 } },
+      { PimCmdEnum::ADD,          {  120,   60,  180 } },
+      { PimCmdEnum::SUB,          {  120,   60,  180 } },
+      { PimCmdEnum::AND,          {  120,   60,  120 } },
+      { PimCmdEnum::OR,           {  120,   60,  120 } },
+      { PimCmdEnum::XOR,          {  120,   60,  120 } },
+      { PimCmdEnum::XNOR,         {  120,   60,  180 } },
+      { PimCmdEnum::MIN,          {  240,   60,  302 } },
+      { PimCmdEnum::MAX,          {  240,   60,  302 } },
+      { PimCmdEnum::ADD_SCALAR,   {   60,   60,  240 } },
+      { PimCmdEnum::SUB_SCALAR,   {   60,   60,  240 } },
+      { PimCmdEnum::AND_SCALAR,   {   60,   60,  180 } },
+      { PimCmdEnum::OR_SCALAR,    {   60,   60,  180 } },
+      { PimCmdEnum::XOR_SCALAR,   {   60,   60,  180 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   60,   60,  240 } },
+      { PimCmdEnum::MIN_SCALAR,   {  120,   60,  422 } },
+      { PimCmdEnum::MAX_SCALAR,   {  120,   60,  422 } },
+    }},
+    { { false, 61 }, {
+      { PimCmdEnum::ABS,          {   61,   61,    0 } },
+      { PimCmdEnum::ADD,          {  122,   61,  183 } },
+      { PimCmdEnum::SUB,          {  122,   61,  183 } },
+      { PimCmdEnum::AND,          {  122,   61,  122 } },
+      { PimCmdEnum::OR,           {  122,   61,  122 } },
+      { PimCmdEnum::XOR,          {  122,   61,  122 } },
+      { PimCmdEnum::XNOR,         {  122,   61,  183 } },
+      { PimCmdEnum::MIN,          {  244,   61,  307 } },
+      { PimCmdEnum::MAX,          {  244,   61,  307 } },
+      { PimCmdEnum::ADD_SCALAR,   {   61,   61,  244 } },
+      { PimCmdEnum::SUB_SCALAR,   {   61,   61,  244 } },
+      { PimCmdEnum::AND_SCALAR,   {   61,   61,  183 } },
+      { PimCmdEnum::OR_SCALAR,    {   61,   61,  183 } },
+      { PimCmdEnum::XOR_SCALAR,   {   61,   61,  183 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   61,   61,  244 } },
+      { PimCmdEnum::MIN_SCALAR,   {  122,   61,  429 } },
+      { PimCmdEnum::MAX_SCALAR,   {  122,   61,  429 } },
+    }},
+    { { false, 62 }, {
+      { PimCmdEnum::ABS,          {   62,   62,    0 } },
+      { PimCmdEnum::ADD,          {  124,   62,  186 } },
+      { PimCmdEnum::SUB,          {  124,   62,  186 } },
+      { PimCmdEnum::AND,          {  124,   62,  124 } },
+      { PimCmdEnum::OR,           {  124,   62,  124 } },
+      { PimCmdEnum::XOR,          {  124,   62,  124 } },
+      { PimCmdEnum::XNOR,         {  124,   62,  186 } },
+      { PimCmdEnum::MIN,          {  248,   62,  312 } },
+      { PimCmdEnum::MAX,          {  248,   62,  312 } },
+      { PimCmdEnum::ADD_SCALAR,   {   62,   62,  248 } },
+      { PimCmdEnum::SUB_SCALAR,   {   62,   62,  248 } },
+      { PimCmdEnum::AND_SCALAR,   {   62,   62,  186 } },
+      { PimCmdEnum::OR_SCALAR,    {   62,   62,  186 } },
+      { PimCmdEnum::XOR_SCALAR,   {   62,   62,  186 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   62,   62,  248 } },
+      { PimCmdEnum::MIN_SCALAR,   {  124,   62,  436 } },
+      { PimCmdEnum::MAX_SCALAR,   {  124,   62,  436 } },
+    }},
+    { { false, 63 }, {
+      { PimCmdEnum::ABS,          {   63,   63,    0 } },
+      { PimCmdEnum::ADD,          {  126,   63,  189 } },
+      { PimCmdEnum::SUB,          {  126,   63,  189 } },
+      { PimCmdEnum::AND,          {  126,   63,  126 } },
+      { PimCmdEnum::OR,           {  126,   63,  126 } },
+      { PimCmdEnum::XOR,          {  126,   63,  126 } },
+      { PimCmdEnum::XNOR,         {  126,   63,  189 } },
+      { PimCmdEnum::MIN,          {  252,   63,  317 } },
+      { PimCmdEnum::MAX,          {  252,   63,  317 } },
+      { PimCmdEnum::ADD_SCALAR,   {   63,   63,  252 } },
+      { PimCmdEnum::SUB_SCALAR,   {   63,   63,  252 } },
+      { PimCmdEnum::AND_SCALAR,   {   63,   63,  189 } },
+      { PimCmdEnum::OR_SCALAR,    {   63,   63,  189 } },
+      { PimCmdEnum::XOR_SCALAR,   {   63,   63,  189 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   63,   63,  252 } },
+      { PimCmdEnum::MIN_SCALAR,   {  126,   63,  443 } },
+      { PimCmdEnum::MAX_SCALAR,   {  126,   63,  443 } },
+    }},
+  }},
+  { PIM_DEVICE_BITSIMD_V_AP, {
+    { { true, 2 }, {
+      { PimCmdEnum::ABS,          {    2,    2,   13 } },
+      { PimCmdEnum::ADD,          {    4,    2,    6 } },
+      { PimCmdEnum::SUB,          {    4,    2,    6 } },
+      { PimCmdEnum::MUL,          {    6,    3,    8 } },
+      { PimCmdEnum::DIV,          {    9,    5,   30 } },
+      { PimCmdEnum::AND,          {    4,    2,    4 } },
+      { PimCmdEnum::OR,           {    4,    2,    5 } },
+      { PimCmdEnum::XOR,          {    4,    2,    7 } },
+      { PimCmdEnum::XNOR,         {    4,    2,    4 } },
+      { PimCmdEnum::MIN,          {    8,    2,   12 } },
+      { PimCmdEnum::MAX,          {    8,    2,   12 } },
+      { PimCmdEnum::ADD_SCALAR,   {    2,    2,    8 } },
+      { PimCmdEnum::SUB_SCALAR,   {    2,    2,    8 } },
+      { PimCmdEnum::MUL_SCALAR,   {    3,    3,   10 } },
+      { PimCmdEnum::DIV_SCALAR,   {    4,    3,   25 } },
+      { PimCmdEnum::AND_SCALAR,   {    2,    2,    6 } },
+      { PimCmdEnum::OR_SCALAR,    {    2,    2,    5 } },
+      { PimCmdEnum::XOR_SCALAR,   {    2,    2,    7 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    2,    2,    6 } },
+      { PimCmdEnum::MIN_SCALAR,   {    4,    2,   12 } },
+      { PimCmdEnum::MAX_SCALAR,   {    4,    2,   12 } },
+    }},
+    { { true, 3 }, {
+      { PimCmdEnum::ABS,          {    3,    3,   19 } },
+      { PimCmdEnum::ADD,          {    6,    3,    9 } },
+      { PimCmdEnum::SUB,          {    6,    3,    9 } },
+      { PimCmdEnum::MUL,          {   12,    6,   18 } },
+      { PimCmdEnum::DIV,          {   20,   13,   66 } },
+      { PimCmdEnum::AND,          {    6,    3,    6 } },
+      { PimCmdEnum::OR,           {    6,    3,    7 } },
+      { PimCmdEnum::XOR,          {    6,    3,   10 } },
+      { PimCmdEnum::XNOR,         {    6,    3,    6 } },
+      { PimCmdEnum::MIN,          {   12,    3,   18 } },
+      { PimCmdEnum::MAX,          {   12,    3,   18 } },
+      { PimCmdEnum::ADD_SCALAR,   {    3,    3,   12 } },
+      { PimCmdEnum::SUB_SCALAR,   {    3,    3,   12 } },
+      { PimCmdEnum::MUL_SCALAR,   {    6,    6,   23 } },
+      { PimCmdEnum::DIV_SCALAR,   {   11,   10,   57 } },
+      { PimCmdEnum::AND_SCALAR,   {    3,    3,    9 } },
+      { PimCmdEnum::OR_SCALAR,    {    3,    3,    6 } },
+      { PimCmdEnum::XOR_SCALAR,   {    3,    3,   11 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    3,    3,    9 } },
+      { PimCmdEnum::MIN_SCALAR,   {    6,    3,   20 } },
+      { PimCmdEnum::MAX_SCALAR,   {    6,    3,   20 } },
+    }},
+    { { true, 4 }, {
+      { PimCmdEnum::ABS,          {    4,    4,   25 } },
+      { PimCmdEnum::ADD,          {    8,    4,   12 } },
+      { PimCmdEnum::SUB,          {    8,    4,   12 } },
+      { PimCmdEnum::MUL,          {   20,   10,   32 } },
+      { PimCmdEnum::DIV,          {   36,   23,  110 } },
+      { PimCmdEnum::AND,          {    8,    4,    8 } },
+      { PimCmdEnum::OR,           {    8,    4,    9 } },
+      { PimCmdEnum::XOR,          {    8,    4,   13 } },
+      { PimCmdEnum::XNOR,         {    8,    4,    8 } },
+      { PimCmdEnum::MIN,          {   16,    4,   24 } },
+      { PimCmdEnum::MAX,          {   16,    4,   24 } },
+      { PimCmdEnum::ADD_SCALAR,   {    4,    4,   16 } },
+      { PimCmdEnum::SUB_SCALAR,   {    4,    4,   16 } },
+      { PimCmdEnum::MUL_SCALAR,   {   10,   10,   41 } },
+      { PimCmdEnum::DIV_SCALAR,   {   21,   19,   99 } },
+      { PimCmdEnum::AND_SCALAR,   {    4,    4,   12 } },
+      { PimCmdEnum::OR_SCALAR,    {    4,    4,    7 } },
+      { PimCmdEnum::XOR_SCALAR,   {    4,    4,   15 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    4,    4,   12 } },
+      { PimCmdEnum::MIN_SCALAR,   {    8,    4,   28 } },
+      { PimCmdEnum::MAX_SCALAR,   {    8,    4,   28 } },
+    }},
+    { { true, 5 }, {
+      { PimCmdEnum::ABS,          {    5,    5,   31 } },
+      { PimCmdEnum::ADD,          {   10,    5,   15 } },
+      { PimCmdEnum::SUB,          {   10,    5,   15 } },
+      { PimCmdEnum::MUL,          {   30,   15,   50 } },
+      { PimCmdEnum::DIV,          {   57,   35,  164 } },
+      { PimCmdEnum::AND,          {   10,    5,   10 } },
+      { PimCmdEnum::OR,           {   10,    5,   11 } },
+      { PimCmdEnum::XOR,          {   10,    5,   16 } },
+      { PimCmdEnum::XNOR,         {   10,    5,   10 } },
+      { PimCmdEnum::MIN,          {   20,    5,   30 } },
+      { PimCmdEnum::MAX,          {   20,    5,   30 } },
+      { PimCmdEnum::ADD_SCALAR,   {    5,    5,   20 } },
+      { PimCmdEnum::SUB_SCALAR,   {    5,    5,   20 } },
+      { PimCmdEnum::MUL_SCALAR,   {   15,   15,   64 } },
+      { PimCmdEnum::DIV_SCALAR,   {   34,   30,  152 } },
+      { PimCmdEnum::AND_SCALAR,   {    5,    5,   15 } },
+      { PimCmdEnum::OR_SCALAR,    {    5,    5,    8 } },
+      { PimCmdEnum::XOR_SCALAR,   {    5,    5,   19 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    5,    5,   15 } },
+      { PimCmdEnum::MIN_SCALAR,   {   10,    5,   36 } },
+      { PimCmdEnum::MAX_SCALAR,   {   10,    5,   36 } },
+    }},
+    { { true, 6 }, {
+      { PimCmdEnum::ABS,          {    6,    6,   37 } },
+      { PimCmdEnum::ADD,          {   12,    6,   18 } },
+      { PimCmdEnum::SUB,          {   12,    6,   18 } },
+      { PimCmdEnum::MUL,          {   42,   21,   72 } },
+      { PimCmdEnum::DIV,          {   83,   49,  228 } },
+      { PimCmdEnum::AND,          {   12,    6,   12 } },
+      { PimCmdEnum::OR,           {   12,    6,   13 } },
+      { PimCmdEnum::XOR,          {   12,    6,   19 } },
+      { PimCmdEnum::XNOR,         {   12,    6,   12 } },
+      { PimCmdEnum::MIN,          {   24,    6,   36 } },
+      { PimCmdEnum::MAX,          {   24,    6,   36 } },
+      { PimCmdEnum::ADD_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::SUB_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::MUL_SCALAR,   {   21,   21,   92 } },
+      { PimCmdEnum::DIV_SCALAR,   {   50,   43,  216 } },
+      { PimCmdEnum::AND_SCALAR,   {    6,    6,   18 } },
+      { PimCmdEnum::OR_SCALAR,    {    6,    6,    9 } },
+      { PimCmdEnum::XOR_SCALAR,   {    6,    6,   23 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    6,    6,   18 } },
+      { PimCmdEnum::MIN_SCALAR,   {   12,    6,   44 } },
+      { PimCmdEnum::MAX_SCALAR,   {   12,    6,   44 } },
+    }},
+    { { true, 7 }, {
+      { PimCmdEnum::ABS,          {    7,    7,   43 } },
+      { PimCmdEnum::ADD,          {   14,    7,   21 } },
+      { PimCmdEnum::SUB,          {   14,    7,   21 } },
+      { PimCmdEnum::MUL,          {   56,   28,   98 } },
+      { PimCmdEnum::DIV,          {  114,   65,  302 } },
+      { PimCmdEnum::AND,          {   14,    7,   14 } },
+      { PimCmdEnum::OR,           {   14,    7,   15 } },
+      { PimCmdEnum::XOR,          {   14,    7,   22 } },
+      { PimCmdEnum::XNOR,         {   14,    7,   14 } },
+      { PimCmdEnum::MIN,          {   28,    7,   42 } },
+      { PimCmdEnum::MAX,          {   28,    7,   42 } },
+      { PimCmdEnum::ADD_SCALAR,   {    7,    7,   28 } },
+      { PimCmdEnum::SUB_SCALAR,   {    7,    7,   28 } },
+      { PimCmdEnum::MUL_SCALAR,   {   28,   28,  125 } },
+      { PimCmdEnum::DIV_SCALAR,   {   69,   58,  291 } },
+      { PimCmdEnum::AND_SCALAR,   {    7,    7,   21 } },
+      { PimCmdEnum::OR_SCALAR,    {    7,    7,   10 } },
+      { PimCmdEnum::XOR_SCALAR,   {    7,    7,   27 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    7,    7,   21 } },
+      { PimCmdEnum::MIN_SCALAR,   {   14,    7,   52 } },
+      { PimCmdEnum::MAX_SCALAR,   {   14,    7,   52 } },
+    }},
+    { { true, 9 }, {
+      { PimCmdEnum::ABS,          {    9,    9,   55 } },
+      { PimCmdEnum::ADD,          {   18,    9,   27 } },
+      { PimCmdEnum::SUB,          {   18,    9,   27 } },
+      { PimCmdEnum::MUL,          {   90,   45,  162 } },
+      { PimCmdEnum::DIV,          {  191,  103,  480 } },
+      { PimCmdEnum::AND,          {   18,    9,   18 } },
+      { PimCmdEnum::OR,           {   18,    9,   19 } },
+      { PimCmdEnum::XOR,          {   18,    9,   28 } },
+      { PimCmdEnum::XNOR,         {   18,    9,   18 } },
+      { PimCmdEnum::MIN,          {   36,    9,   54 } },
+      { PimCmdEnum::MAX,          {   36,    9,   54 } },
+      { PimCmdEnum::ADD_SCALAR,   {    9,    9,   36 } },
+      { PimCmdEnum::SUB_SCALAR,   {    9,    9,   36 } },
+      { PimCmdEnum::MUL_SCALAR,   {   45,   45,  203 } },
+      { PimCmdEnum::DIV_SCALAR,   {  116,   94,  466 } },
+      { PimCmdEnum::AND_SCALAR,   {    9,    9,   27 } },
+      { PimCmdEnum::OR_SCALAR,    {    9,    9,   16 } },
+      { PimCmdEnum::XOR_SCALAR,   {    9,    9,   31 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    9,    9,   27 } },
+      { PimCmdEnum::MIN_SCALAR,   {   18,    9,   62 } },
+      { PimCmdEnum::MAX_SCALAR,   {   18,    9,   62 } },
+    }},
+    { { true, 10 }, {
+      { PimCmdEnum::ABS,          {   10,   10,   61 } },
+      { PimCmdEnum::ADD,          {   20,   10,   30 } },
+      { PimCmdEnum::SUB,          {   20,   10,   30 } },
+      { PimCmdEnum::MUL,          {  110,   55,  200 } },
+      { PimCmdEnum::DIV,          {  237,  125,  584 } },
+      { PimCmdEnum::AND,          {   20,   10,   20 } },
+      { PimCmdEnum::OR,           {   20,   10,   21 } },
+      { PimCmdEnum::XOR,          {   20,   10,   31 } },
+      { PimCmdEnum::XNOR,         {   20,   10,   20 } },
+      { PimCmdEnum::MIN,          {   40,   10,   60 } },
+      { PimCmdEnum::MAX,          {   40,   10,   60 } },
+      { PimCmdEnum::ADD_SCALAR,   {   10,   10,   40 } },
+      { PimCmdEnum::SUB_SCALAR,   {   10,   10,   40 } },
+      { PimCmdEnum::MUL_SCALAR,   {   55,   55,  249 } },
+      { PimCmdEnum::DIV_SCALAR,   {  144,  115,  570 } },
+      { PimCmdEnum::AND_SCALAR,   {   10,   10,   30 } },
+      { PimCmdEnum::OR_SCALAR,    {   10,   10,   19 } },
+      { PimCmdEnum::XOR_SCALAR,   {   10,   10,   33 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   10,   10,   30 } },
+      { PimCmdEnum::MIN_SCALAR,   {   20,   10,   67 } },
+      { PimCmdEnum::MAX_SCALAR,   {   20,   10,   67 } },
+    }},
+    { { true, 11 }, {
+      { PimCmdEnum::ABS,          {   11,   11,   67 } },
+      { PimCmdEnum::ADD,          {   22,   11,   33 } },
+      { PimCmdEnum::SUB,          {   22,   11,   33 } },
+      { PimCmdEnum::MUL,          {  132,   66,  242 } },
+      { PimCmdEnum::DIV,          {  288,  149,  698 } },
+      { PimCmdEnum::AND,          {   22,   11,   22 } },
+      { PimCmdEnum::OR,           {   22,   11,   23 } },
+      { PimCmdEnum::XOR,          {   22,   11,   34 } },
+      { PimCmdEnum::XNOR,         {   22,   11,   22 } },
+      { PimCmdEnum::MIN,          {   44,   11,   66 } },
+      { PimCmdEnum::MAX,          {   44,   11,   66 } },
+      { PimCmdEnum::ADD_SCALAR,   {   11,   11,   44 } },
+      { PimCmdEnum::SUB_SCALAR,   {   11,   11,   44 } },
+      { PimCmdEnum::MUL_SCALAR,   {   66,   66,  300 } },
+      { PimCmdEnum::DIV_SCALAR,   {  175,  138,  684 } },
+      { PimCmdEnum::AND_SCALAR,   {   11,   11,   33 } },
+      { PimCmdEnum::OR_SCALAR,    {   11,   11,   22 } },
+      { PimCmdEnum::XOR_SCALAR,   {   11,   11,   35 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   11,   11,   33 } },
+      { PimCmdEnum::MIN_SCALAR,   {   22,   11,   72 } },
+      { PimCmdEnum::MAX_SCALAR,   {   22,   11,   72 } },
+    }},
+    { { true, 12 }, {
+      { PimCmdEnum::ABS,          {   12,   12,   73 } },
+      { PimCmdEnum::ADD,          {   24,   12,   36 } },
+      { PimCmdEnum::SUB,          {   24,   12,   36 } },
+      { PimCmdEnum::MUL,          {  156,   78,  288 } },
+      { PimCmdEnum::DIV,          {  344,  175,  822 } },
+      { PimCmdEnum::AND,          {   24,   12,   24 } },
+      { PimCmdEnum::OR,           {   24,   12,   25 } },
+      { PimCmdEnum::XOR,          {   24,   12,   37 } },
+      { PimCmdEnum::XNOR,         {   24,   12,   24 } },
+      { PimCmdEnum::MIN,          {   48,   12,   72 } },
+      { PimCmdEnum::MAX,          {   48,   12,   72 } },
+      { PimCmdEnum::ADD_SCALAR,   {   12,   12,   48 } },
+      { PimCmdEnum::SUB_SCALAR,   {   12,   12,   48 } },
+      { PimCmdEnum::MUL_SCALAR,   {   78,   78,  356 } },
+      { PimCmdEnum::DIV_SCALAR,   {  209,  163,  808 } },
+      { PimCmdEnum::AND_SCALAR,   {   12,   12,   36 } },
+      { PimCmdEnum::OR_SCALAR,    {   12,   12,   25 } },
+      { PimCmdEnum::XOR_SCALAR,   {   12,   12,   37 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   12,   12,   36 } },
+      { PimCmdEnum::MIN_SCALAR,   {   24,   12,   77 } },
+      { PimCmdEnum::MAX_SCALAR,   {   24,   12,   77 } },
+    }},
+    { { true, 13 }, {
+      { PimCmdEnum::ABS,          {   13,   13,   79 } },
+      { PimCmdEnum::ADD,          {   26,   13,   39 } },
+      { PimCmdEnum::SUB,          {   26,   13,   39 } },
+      { PimCmdEnum::MUL,          {  182,   91,  338 } },
+      { PimCmdEnum::DIV,          {  405,  203,  956 } },
+      { PimCmdEnum::AND,          {   26,   13,   26 } },
+      { PimCmdEnum::OR,           {   26,   13,   27 } },
+      { PimCmdEnum::XOR,          {   26,   13,   40 } },
+      { PimCmdEnum::XNOR,         {   26,   13,   26 } },
+      { PimCmdEnum::MIN,          {   52,   13,   78 } },
+      { PimCmdEnum::MAX,          {   52,   13,   78 } },
+      { PimCmdEnum::ADD_SCALAR,   {   13,   13,   52 } },
+      { PimCmdEnum::SUB_SCALAR,   {   13,   13,   52 } },
+      { PimCmdEnum::MUL_SCALAR,   {   91,   91,  417 } },
+      { PimCmdEnum::DIV_SCALAR,   {  246,  190,  942 } },
+      { PimCmdEnum::AND_SCALAR,   {   13,   13,   39 } },
+      { PimCmdEnum::OR_SCALAR,    {   13,   13,   28 } },
+      { PimCmdEnum::XOR_SCALAR,   {   13,   13,   39 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   13,   13,   39 } },
+      { PimCmdEnum::MIN_SCALAR,   {   26,   13,   82 } },
+      { PimCmdEnum::MAX_SCALAR,   {   26,   13,   82 } },
+    }},
+    { { true, 14 }, {
+      { PimCmdEnum::ABS,          {   14,   14,   85 } },
+      { PimCmdEnum::ADD,          {   28,   14,   42 } },
+      { PimCmdEnum::SUB,          {   28,   14,   42 } },
+      { PimCmdEnum::MUL,          {  210,  105,  392 } },
+      { PimCmdEnum::DIV,          {  471,  233, 1100 } },
+      { PimCmdEnum::AND,          {   28,   14,   28 } },
+      { PimCmdEnum::OR,           {   28,   14,   29 } },
+      { PimCmdEnum::XOR,          {   28,   14,   43 } },
+      { PimCmdEnum::XNOR,         {   28,   14,   28 } },
+      { PimCmdEnum::MIN,          {   56,   14,   84 } },
+      { PimCmdEnum::MAX,          {   56,   14,   84 } },
+      { PimCmdEnum::ADD_SCALAR,   {   14,   14,   56 } },
+      { PimCmdEnum::SUB_SCALAR,   {   14,   14,   56 } },
+      { PimCmdEnum::MUL_SCALAR,   {  105,  105,  483 } },
+      { PimCmdEnum::DIV_SCALAR,   {  286,  219, 1086 } },
+      { PimCmdEnum::AND_SCALAR,   {   14,   14,   42 } },
+      { PimCmdEnum::OR_SCALAR,    {   14,   14,   31 } },
+      { PimCmdEnum::XOR_SCALAR,   {   14,   14,   41 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   14,   14,   42 } },
+      { PimCmdEnum::MIN_SCALAR,   {   28,   14,   87 } },
+      { PimCmdEnum::MAX_SCALAR,   {   28,   14,   87 } },
+    }},
+    { { true, 15 }, {
+      { PimCmdEnum::ABS,          {   15,   15,   91 } },
+      { PimCmdEnum::ADD,          {   30,   15,   45 } },
+      { PimCmdEnum::SUB,          {   30,   15,   45 } },
+      { PimCmdEnum::MUL,          {  240,  120,  450 } },
+      { PimCmdEnum::DIV,          {  542,  265, 1254 } },
+      { PimCmdEnum::AND,          {   30,   15,   30 } },
+      { PimCmdEnum::OR,           {   30,   15,   31 } },
+      { PimCmdEnum::XOR,          {   30,   15,   46 } },
+      { PimCmdEnum::XNOR,         {   30,   15,   30 } },
+      { PimCmdEnum::MIN,          {   60,   15,   90 } },
+      { PimCmdEnum::MAX,          {   60,   15,   90 } },
+      { PimCmdEnum::ADD_SCALAR,   {   15,   15,   60 } },
+      { PimCmdEnum::SUB_SCALAR,   {   15,   15,   60 } },
+      { PimCmdEnum::MUL_SCALAR,   {  120,  120,  554 } },
+      { PimCmdEnum::DIV_SCALAR,   {  329,  250, 1240 } },
+      { PimCmdEnum::AND_SCALAR,   {   15,   15,   45 } },
+      { PimCmdEnum::OR_SCALAR,    {   15,   15,   34 } },
+      { PimCmdEnum::XOR_SCALAR,   {   15,   15,   43 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   15,   15,   45 } },
+      { PimCmdEnum::MIN_SCALAR,   {   30,   15,   92 } },
+      { PimCmdEnum::MAX_SCALAR,   {   30,   15,   92 } },
+    }},
+    { { true, 17 }, {
+      { PimCmdEnum::ABS,          {   17,   17,  103 } },
+      { PimCmdEnum::ADD,          {   34,   17,   51 } },
+      { PimCmdEnum::SUB,          {   34,   17,   51 } },
+      { PimCmdEnum::MUL,          {  306,  153,  578 } },
+      { PimCmdEnum::DIV,          {  699,  335, 1592 } },
+      { PimCmdEnum::AND,          {   34,   17,   34 } },
+      { PimCmdEnum::OR,           {   34,   17,   35 } },
+      { PimCmdEnum::XOR,          {   34,   17,   52 } },
+      { PimCmdEnum::XNOR,         {   34,   17,   34 } },
+      { PimCmdEnum::MIN,          {   68,   17,  102 } },
+      { PimCmdEnum::MAX,          {   68,   17,  102 } },
+      { PimCmdEnum::ADD_SCALAR,   {   17,   17,   68 } },
+      { PimCmdEnum::SUB_SCALAR,   {   17,   17,   68 } },
+      { PimCmdEnum::MUL_SCALAR,   {  153,  153,  711 } },
+      { PimCmdEnum::DIV_SCALAR,   {  424,  318, 1578 } },
+      { PimCmdEnum::AND_SCALAR,   {   17,   17,   51 } },
+      { PimCmdEnum::OR_SCALAR,    {   17,   17,   40 } },
+      { PimCmdEnum::XOR_SCALAR,   {   17,   17,   47 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   17,   17,   51 } },
+      { PimCmdEnum::MIN_SCALAR,   {   34,   17,  102 } },
+      { PimCmdEnum::MAX_SCALAR,   {   34,   17,  102 } },
+    }},
+    { { true, 18 }, {
+      { PimCmdEnum::ABS,          {   18,   18,  109 } },
+      { PimCmdEnum::ADD,          {   36,   18,   54 } },
+      { PimCmdEnum::SUB,          {   36,   18,   54 } },
+      { PimCmdEnum::MUL,          {  342,  171,  648 } },
+      { PimCmdEnum::DIV,          {  785,  373, 1776 } },
+      { PimCmdEnum::AND,          {   36,   18,   36 } },
+      { PimCmdEnum::OR,           {   36,   18,   37 } },
+      { PimCmdEnum::XOR,          {   36,   18,   55 } },
+      { PimCmdEnum::XNOR,         {   36,   18,   36 } },
+      { PimCmdEnum::MIN,          {   72,   18,  108 } },
+      { PimCmdEnum::MAX,          {   72,   18,  108 } },
+      { PimCmdEnum::ADD_SCALAR,   {   18,   18,   72 } },
+      { PimCmdEnum::SUB_SCALAR,   {   18,   18,   72 } },
+      { PimCmdEnum::MUL_SCALAR,   {  171,  171,  797 } },
+      { PimCmdEnum::DIV_SCALAR,   {  476,  355, 1762 } },
+      { PimCmdEnum::AND_SCALAR,   {   18,   18,   54 } },
+      { PimCmdEnum::OR_SCALAR,    {   18,   18,   43 } },
+      { PimCmdEnum::XOR_SCALAR,   {   18,   18,   49 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   18,   18,   54 } },
+      { PimCmdEnum::MIN_SCALAR,   {   36,   18,  107 } },
+      { PimCmdEnum::MAX_SCALAR,   {   36,   18,  107 } },
+    }},
+    { { true, 19 }, {
+      { PimCmdEnum::ABS,          {   19,   19,  115 } },
+      { PimCmdEnum::ADD,          {   38,   19,   57 } },
+      { PimCmdEnum::SUB,          {   38,   19,   57 } },
+      { PimCmdEnum::MUL,          {  380,  190,  722 } },
+      { PimCmdEnum::DIV,          {  876,  413, 1970 } },
+      { PimCmdEnum::AND,          {   38,   19,   38 } },
+      { PimCmdEnum::OR,           {   38,   19,   39 } },
+      { PimCmdEnum::XOR,          {   38,   19,   58 } },
+      { PimCmdEnum::XNOR,         {   38,   19,   38 } },
+      { PimCmdEnum::MIN,          {   76,   19,  114 } },
+      { PimCmdEnum::MAX,          {   76,   19,  114 } },
+      { PimCmdEnum::ADD_SCALAR,   {   19,   19,   76 } },
+      { PimCmdEnum::SUB_SCALAR,   {   19,   19,   76 } },
+      { PimCmdEnum::MUL_SCALAR,   {  190,  190,  888 } },
+      { PimCmdEnum::DIV_SCALAR,   {  531,  394, 1956 } },
+      { PimCmdEnum::AND_SCALAR,   {   19,   19,   57 } },
+      { PimCmdEnum::OR_SCALAR,    {   19,   19,   46 } },
+      { PimCmdEnum::XOR_SCALAR,   {   19,   19,   51 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   19,   19,   57 } },
+      { PimCmdEnum::MIN_SCALAR,   {   38,   19,  112 } },
+      { PimCmdEnum::MAX_SCALAR,   {   38,   19,  112 } },
+    }},
+    { { true, 20 }, {
+      { PimCmdEnum::ABS,          {   20,   20,  121 } },
+      { PimCmdEnum::ADD,          {   40,   20,   60 } },
+      { PimCmdEnum::SUB,          {   40,   20,   60 } },
+      { PimCmdEnum::MUL,          {  420,  210,  800 } },
+      { PimCmdEnum::DIV,          {  972,  455, 2174 } },
+      { PimCmdEnum::AND,          {   40,   20,   40 } },
+      { PimCmdEnum::OR,           {   40,   20,   41 } },
+      { PimCmdEnum::XOR,          {   40,   20,   61 } },
+      { PimCmdEnum::XNOR,         {   40,   20,   40 } },
+      { PimCmdEnum::MIN,          {   80,   20,  120 } },
+      { PimCmdEnum::MAX,          {   80,   20,  120 } },
+      { PimCmdEnum::ADD_SCALAR,   {   20,   20,   80 } },
+      { PimCmdEnum::SUB_SCALAR,   {   20,   20,   80 } },
+      { PimCmdEnum::MUL_SCALAR,   {  210,  210,  984 } },
+      { PimCmdEnum::DIV_SCALAR,   {  589,  435, 2160 } },
+      { PimCmdEnum::AND_SCALAR,   {   20,   20,   60 } },
+      { PimCmdEnum::OR_SCALAR,    {   20,   20,   49 } },
+      { PimCmdEnum::XOR_SCALAR,   {   20,   20,   53 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   20,   20,   60 } },
+      { PimCmdEnum::MIN_SCALAR,   {   40,   20,  117 } },
+      { PimCmdEnum::MAX_SCALAR,   {   40,   20,  117 } },
+    }},
+    { { true, 21 }, {
+      { PimCmdEnum::ABS,          {   21,   21,  127 } },
+      { PimCmdEnum::ADD,          {   42,   21,   63 } },
+      { PimCmdEnum::SUB,          {   42,   21,   63 } },
+      { PimCmdEnum::MUL,          {  462,  231,  882 } },
+      { PimCmdEnum::DIV,          { 1073,  499, 2388 } },
+      { PimCmdEnum::AND,          {   42,   21,   42 } },
+      { PimCmdEnum::OR,           {   42,   21,   43 } },
+      { PimCmdEnum::XOR,          {   42,   21,   64 } },
+      { PimCmdEnum::XNOR,         {   42,   21,   42 } },
+      { PimCmdEnum::MIN,          {   84,   21,  126 } },
+      { PimCmdEnum::MAX,          {   84,   21,  126 } },
+      { PimCmdEnum::ADD_SCALAR,   {   21,   21,   84 } },
+      { PimCmdEnum::SUB_SCALAR,   {   21,   21,   84 } },
+      { PimCmdEnum::MUL_SCALAR,   {  231,  231, 1085 } },
+      { PimCmdEnum::DIV_SCALAR,   {  650,  478, 2374 } },
+      { PimCmdEnum::AND_SCALAR,   {   21,   21,   63 } },
+      { PimCmdEnum::OR_SCALAR,    {   21,   21,   52 } },
+      { PimCmdEnum::XOR_SCALAR,   {   21,   21,   55 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   21,   21,   63 } },
+      { PimCmdEnum::MIN_SCALAR,   {   42,   21,  122 } },
+      { PimCmdEnum::MAX_SCALAR,   {   42,   21,  122 } },
+    }},
+    { { true, 22 }, {
+      { PimCmdEnum::ABS,          {   22,   22,  133 } },
+      { PimCmdEnum::ADD,          {   44,   22,   66 } },
+      { PimCmdEnum::SUB,          {   44,   22,   66 } },
+      { PimCmdEnum::MUL,          {  506,  253,  968 } },
+      { PimCmdEnum::DIV,          { 1179,  545, 2612 } },
+      { PimCmdEnum::AND,          {   44,   22,   44 } },
+      { PimCmdEnum::OR,           {   44,   22,   45 } },
+      { PimCmdEnum::XOR,          {   44,   22,   67 } },
+      { PimCmdEnum::XNOR,         {   44,   22,   44 } },
+      { PimCmdEnum::MIN,          {   88,   22,  132 } },
+      { PimCmdEnum::MAX,          {   88,   22,  132 } },
+      { PimCmdEnum::ADD_SCALAR,   {   22,   22,   88 } },
+      { PimCmdEnum::SUB_SCALAR,   {   22,   22,   88 } },
+      { PimCmdEnum::MUL_SCALAR,   {  253,  253, 1191 } },
+      { PimCmdEnum::DIV_SCALAR,   {  714,  523, 2598 } },
+      { PimCmdEnum::AND_SCALAR,   {   22,   22,   66 } },
+      { PimCmdEnum::OR_SCALAR,    {   22,   22,   55 } },
+      { PimCmdEnum::XOR_SCALAR,   {   22,   22,   57 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   22,   22,   66 } },
+      { PimCmdEnum::MIN_SCALAR,   {   44,   22,  127 } },
+      { PimCmdEnum::MAX_SCALAR,   {   44,   22,  127 } },
+    }},
+    { { true, 23 }, {
+      { PimCmdEnum::ABS,          {   23,   23,  139 } },
+      { PimCmdEnum::ADD,          {   46,   23,   69 } },
+      { PimCmdEnum::SUB,          {   46,   23,   69 } },
+      { PimCmdEnum::MUL,          {  552,  276, 1058 } },
+      { PimCmdEnum::DIV,          { 1290,  593, 2846 } },
+      { PimCmdEnum::AND,          {   46,   23,   46 } },
+      { PimCmdEnum::OR,           {   46,   23,   47 } },
+      { PimCmdEnum::XOR,          {   46,   23,   70 } },
+      { PimCmdEnum::XNOR,         {   46,   23,   46 } },
+      { PimCmdEnum::MIN,          {   92,   23,  138 } },
+      { PimCmdEnum::MAX,          {   92,   23,  138 } },
+      { PimCmdEnum::ADD_SCALAR,   {   23,   23,   92 } },
+      { PimCmdEnum::SUB_SCALAR,   {   23,   23,   92 } },
+      { PimCmdEnum::MUL_SCALAR,   {  276,  276, 1302 } },
+      { PimCmdEnum::DIV_SCALAR,   {  781,  570, 2832 } },
+      { PimCmdEnum::AND_SCALAR,   {   23,   23,   69 } },
+      { PimCmdEnum::OR_SCALAR,    {   23,   23,   58 } },
+      { PimCmdEnum::XOR_SCALAR,   {   23,   23,   59 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   23,   23,   69 } },
+      { PimCmdEnum::MIN_SCALAR,   {   46,   23,  132 } },
+      { PimCmdEnum::MAX_SCALAR,   {   46,   23,  132 } },
+    }},
+    { { true, 24 }, {
+      { PimCmdEnum::ABS,          {   24,   24,  145 } },
+      { PimCmdEnum::ADD,          {   48,   24,   72 } },
+      { PimCmdEnum::SUB,          {   48,   24,   72 } },
+      { PimCmdEnum::MUL,          {  600,  300, 1152 } },
+      { PimCmdEnum::DIV,          { 1406,  643, 3090 } },
+      { PimCmdEnum::AND,          {   48,   24,   48 } },
+      { PimCmdEnum::OR,           {   48,   24,   49 } },
+      { PimCmdEnum::XOR,          {   48,   24,   73 } },
+      { PimCmdEnum::XNOR,         {   48,   24,   48 } },
+      { PimCmdEnum::MIN,          {   96,   24,  144 } },
+      { PimCmdEnum::MAX,          {   96,   24,  144 } },
+      { PimCmdEnum::ADD_SCALAR,   {   24,   24,   96 } },
+      { PimCmdEnum::SUB_SCALAR,   {   24,   24,   96 } },
+      { PimCmdEnum::MUL_SCALAR,   {  300,  300, 1418 } },
+      { PimCmdEnum::DIV_SCALAR,   {  851,  619, 3076 } },
+      { PimCmdEnum::AND_SCALAR,   {   24,   24,   72 } },
+      { PimCmdEnum::OR_SCALAR,    {   24,   24,   61 } },
+      { PimCmdEnum::XOR_SCALAR,   {   24,   24,   61 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   24,   24,   72 } },
+      { PimCmdEnum::MIN_SCALAR,   {   48,   24,  137 } },
+      { PimCmdEnum::MAX_SCALAR,   {   48,   24,  137 } },
+    }},
+    { { true, 25 }, {
+      { PimCmdEnum::ABS,          {   25,   25,  151 } },
+      { PimCmdEnum::ADD,          {   50,   25,   75 } },
+      { PimCmdEnum::SUB,          {   50,   25,   75 } },
+      { PimCmdEnum::MUL,          {  650,  325, 1250 } },
+      { PimCmdEnum::DIV,          { 1527,  695, 3344 } },
+      { PimCmdEnum::AND,          {   50,   25,   50 } },
+      { PimCmdEnum::OR,           {   50,   25,   51 } },
+      { PimCmdEnum::XOR,          {   50,   25,   76 } },
+      { PimCmdEnum::XNOR,         {   50,   25,   50 } },
+      { PimCmdEnum::MIN,          {  100,   25,  150 } },
+      { PimCmdEnum::MAX,          {  100,   25,  150 } },
+      { PimCmdEnum::ADD_SCALAR,   {   25,   25,  100 } },
+      { PimCmdEnum::SUB_SCALAR,   {   25,   25,  100 } },
+      { PimCmdEnum::MUL_SCALAR,   {  325,  325, 1539 } },
+      { PimCmdEnum::DIV_SCALAR,   {  924,  670, 3330 } },
+      { PimCmdEnum::AND_SCALAR,   {   25,   25,   75 } },
+      { PimCmdEnum::OR_SCALAR,    {   25,   25,   64 } },
+      { PimCmdEnum::XOR_SCALAR,   {   25,   25,   63 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   25,   25,   75 } },
+      { PimCmdEnum::MIN_SCALAR,   {   50,   25,  142 } },
+      { PimCmdEnum::MAX_SCALAR,   {   50,   25,  142 } },
+    }},
+    { { true, 26 }, {
+      { PimCmdEnum::ABS,          {   26,   26,  157 } },
+      { PimCmdEnum::ADD,          {   52,   26,   78 } },
+      { PimCmdEnum::SUB,          {   52,   26,   78 } },
+      { PimCmdEnum::MUL,          {  702,  351, 1352 } },
+      { PimCmdEnum::DIV,          { 1653,  749, 3608 } },
+      { PimCmdEnum::AND,          {   52,   26,   52 } },
+      { PimCmdEnum::OR,           {   52,   26,   53 } },
+      { PimCmdEnum::XOR,          {   52,   26,   79 } },
+      { PimCmdEnum::XNOR,         {   52,   26,   52 } },
+      { PimCmdEnum::MIN,          {  104,   26,  156 } },
+      { PimCmdEnum::MAX,          {  104,   26,  156 } },
+      { PimCmdEnum::ADD_SCALAR,   {   26,   26,  104 } },
+      { PimCmdEnum::SUB_SCALAR,   {   26,   26,  104 } },
+      { PimCmdEnum::MUL_SCALAR,   {  351,  351, 1665 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1000,  723, 3594 } },
+      { PimCmdEnum::AND_SCALAR,   {   26,   26,   78 } },
+      { PimCmdEnum::OR_SCALAR,    {   26,   26,   67 } },
+      { PimCmdEnum::XOR_SCALAR,   {   26,   26,   65 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   26,   26,   78 } },
+      { PimCmdEnum::MIN_SCALAR,   {   52,   26,  147 } },
+      { PimCmdEnum::MAX_SCALAR,   {   52,   26,  147 } },
+    }},
+    { { true, 27 }, {
+      { PimCmdEnum::ABS,          {   27,   27,  163 } },
+      { PimCmdEnum::ADD,          {   54,   27,   81 } },
+      { PimCmdEnum::SUB,          {   54,   27,   81 } },
+      { PimCmdEnum::MUL,          {  756,  378, 1458 } },
+      { PimCmdEnum::DIV,          { 1784,  805, 3882 } },
+      { PimCmdEnum::AND,          {   54,   27,   54 } },
+      { PimCmdEnum::OR,           {   54,   27,   55 } },
+      { PimCmdEnum::XOR,          {   54,   27,   82 } },
+      { PimCmdEnum::XNOR,         {   54,   27,   54 } },
+      { PimCmdEnum::MIN,          {  108,   27,  162 } },
+      { PimCmdEnum::MAX,          {  108,   27,  162 } },
+      { PimCmdEnum::ADD_SCALAR,   {   27,   27,  108 } },
+      { PimCmdEnum::SUB_SCALAR,   {   27,   27,  108 } },
+      { PimCmdEnum::MUL_SCALAR,   {  378,  378, 1796 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1079,  778, 3868 } },
+      { PimCmdEnum::AND_SCALAR,   {   27,   27,   81 } },
+      { PimCmdEnum::OR_SCALAR,    {   27,   27,   70 } },
+      { PimCmdEnum::XOR_SCALAR,   {   27,   27,   67 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   27,   27,   81 } },
+      { PimCmdEnum::MIN_SCALAR,   {   54,   27,  152 } },
+      { PimCmdEnum::MAX_SCALAR,   {   54,   27,  152 } },
+    }},
+    { { true, 28 }, {
+      { PimCmdEnum::ABS,          {   28,   28,  169 } },
+      { PimCmdEnum::ADD,          {   56,   28,   84 } },
+      { PimCmdEnum::SUB,          {   56,   28,   84 } },
+      { PimCmdEnum::MUL,          {  812,  406, 1568 } },
+      { PimCmdEnum::DIV,          { 1920,  863, 4166 } },
+      { PimCmdEnum::AND,          {   56,   28,   56 } },
+      { PimCmdEnum::OR,           {   56,   28,   57 } },
+      { PimCmdEnum::XOR,          {   56,   28,   85 } },
+      { PimCmdEnum::XNOR,         {   56,   28,   56 } },
+      { PimCmdEnum::MIN,          {  112,   28,  168 } },
+      { PimCmdEnum::MAX,          {  112,   28,  168 } },
+      { PimCmdEnum::ADD_SCALAR,   {   28,   28,  112 } },
+      { PimCmdEnum::SUB_SCALAR,   {   28,   28,  112 } },
+      { PimCmdEnum::MUL_SCALAR,   {  406,  406, 1932 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1161,  835, 4152 } },
+      { PimCmdEnum::AND_SCALAR,   {   28,   28,   84 } },
+      { PimCmdEnum::OR_SCALAR,    {   28,   28,   73 } },
+      { PimCmdEnum::XOR_SCALAR,   {   28,   28,   69 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   28,   28,   84 } },
+      { PimCmdEnum::MIN_SCALAR,   {   56,   28,  157 } },
+      { PimCmdEnum::MAX_SCALAR,   {   56,   28,  157 } },
+    }},
+    { { true, 29 }, {
+      { PimCmdEnum::ABS,          {   29,   29,  175 } },
+      { PimCmdEnum::ADD,          {   58,   29,   87 } },
+      { PimCmdEnum::SUB,          {   58,   29,   87 } },
+      { PimCmdEnum::MUL,          {  870,  435, 1682 } },
+      { PimCmdEnum::DIV,          { 2061,  923, 4460 } },
+      { PimCmdEnum::AND,          {   58,   29,   58 } },
+      { PimCmdEnum::OR,           {   58,   29,   59 } },
+      { PimCmdEnum::XOR,          {   58,   29,   88 } },
+      { PimCmdEnum::XNOR,         {   58,   29,   58 } },
+      { PimCmdEnum::MIN,          {  116,   29,  174 } },
+      { PimCmdEnum::MAX,          {  116,   29,  174 } },
+      { PimCmdEnum::ADD_SCALAR,   {   29,   29,  116 } },
+      { PimCmdEnum::SUB_SCALAR,   {   29,   29,  116 } },
+      { PimCmdEnum::MUL_SCALAR,   {  435,  435, 2073 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1246,  894, 4446 } },
+      { PimCmdEnum::AND_SCALAR,   {   29,   29,   87 } },
+      { PimCmdEnum::OR_SCALAR,    {   29,   29,   76 } },
+      { PimCmdEnum::XOR_SCALAR,   {   29,   29,   71 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   29,   29,   87 } },
+      { PimCmdEnum::MIN_SCALAR,   {   58,   29,  162 } },
+      { PimCmdEnum::MAX_SCALAR,   {   58,   29,  162 } },
+    }},
+    { { true, 30 }, {
+      { PimCmdEnum::ABS,          {   30,   30,  181 } },
+      { PimCmdEnum::ADD,          {   60,   30,   90 } },
+      { PimCmdEnum::SUB,          {   60,   30,   90 } },
+      { PimCmdEnum::MUL,          {  930,  465, 1800 } },
+      { PimCmdEnum::DIV,          { 2207,  985, 4764 } },
+      { PimCmdEnum::AND,          {   60,   30,   60 } },
+      { PimCmdEnum::OR,           {   60,   30,   61 } },
+      { PimCmdEnum::XOR,          {   60,   30,   91 } },
+      { PimCmdEnum::XNOR,         {   60,   30,   60 } },
+      { PimCmdEnum::MIN,          {  120,   30,  180 } },
+      { PimCmdEnum::MAX,          {  120,   30,  180 } },
+      { PimCmdEnum::ADD_SCALAR,   {   30,   30,  120 } },
+      { PimCmdEnum::SUB_SCALAR,   {   30,   30,  120 } },
+      { PimCmdEnum::MUL_SCALAR,   {  465,  465, 2219 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1334,  955, 4750 } },
+      { PimCmdEnum::AND_SCALAR,   {   30,   30,   90 } },
+      { PimCmdEnum::OR_SCALAR,    {   30,   30,   79 } },
+      { PimCmdEnum::XOR_SCALAR,   {   30,   30,   73 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   30,   30,   90 } },
+      { PimCmdEnum::MIN_SCALAR,   {   60,   30,  167 } },
+      { PimCmdEnum::MAX_SCALAR,   {   60,   30,  167 } },
+    }},
+    { { true, 31 }, {
+      { PimCmdEnum::ABS,          {   31,   31,  187 } },
+      { PimCmdEnum::ADD,          {   62,   31,   93 } },
+      { PimCmdEnum::SUB,          {   62,   31,   93 } },
+      { PimCmdEnum::MUL,          {  992,  496, 1922 } },
+      { PimCmdEnum::DIV,          { 2358, 1049, 5078 } },
+      { PimCmdEnum::AND,          {   62,   31,   62 } },
+      { PimCmdEnum::OR,           {   62,   31,   63 } },
+      { PimCmdEnum::XOR,          {   62,   31,   94 } },
+      { PimCmdEnum::XNOR,         {   62,   31,   62 } },
+      { PimCmdEnum::MIN,          {  124,   31,  186 } },
+      { PimCmdEnum::MAX,          {  124,   31,  186 } },
+      { PimCmdEnum::ADD_SCALAR,   {   31,   31,  124 } },
+      { PimCmdEnum::SUB_SCALAR,   {   31,   31,  124 } },
+      { PimCmdEnum::MUL_SCALAR,   {  496,  496, 2370 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1425, 1018, 5064 } },
+      { PimCmdEnum::AND_SCALAR,   {   31,   31,   93 } },
+      { PimCmdEnum::OR_SCALAR,    {   31,   31,   82 } },
+      { PimCmdEnum::XOR_SCALAR,   {   31,   31,   75 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   31,   31,   93 } },
+      { PimCmdEnum::MIN_SCALAR,   {   62,   31,  172 } },
+      { PimCmdEnum::MAX_SCALAR,   {   62,   31,  172 } },
+    }},
+    { { true, 33 }, {
+      { PimCmdEnum::ABS,          {   33,   33,  199 } },
+      { PimCmdEnum::ADD,          {   66,   33,   99 } },
+      { PimCmdEnum::SUB,          {   66,   33,   99 } },
+      { PimCmdEnum::AND,          {   66,   33,   66 } },
+      { PimCmdEnum::OR,           {   66,   33,   67 } },
+      { PimCmdEnum::XOR,          {   66,   33,  100 } },
+      { PimCmdEnum::XNOR,         {   66,   33,   66 } },
+      { PimCmdEnum::MIN,          {  132,   33,  198 } },
+      { PimCmdEnum::MAX,          {  132,   33,  198 } },
+      { PimCmdEnum::ADD_SCALAR,   {   33,   33,  132 } },
+      { PimCmdEnum::SUB_SCALAR,   {   33,   33,  132 } },
+      { PimCmdEnum::AND_SCALAR,   {   33,   33,   99 } },
+      { PimCmdEnum::OR_SCALAR,    {   33,   33,   88 } },
+      { PimCmdEnum::XOR_SCALAR,   {   33,   33,   79 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   33,   33,   99 } },
+      { PimCmdEnum::MIN_SCALAR,   {   66,   33,  182 } },
+      { PimCmdEnum::MAX_SCALAR,   {   66,   33,  182 } },
+    }},
+    { { true, 34 }, {
+      { PimCmdEnum::ABS,          {   34,   34,  205 } },
+      { PimCmdEnum::ADD,          {   68,   34,  102 } },
+      { PimCmdEnum::SUB,          {   68,   34,  102 } },
+      { PimCmdEnum::AND,          {   68,   34,   68 } },
+      { PimCmdEnum::OR,           {   68,   34,   69 } },
+      { PimCmdEnum::XOR,          {   68,   34,  103 } },
+      { PimCmdEnum::XNOR,         {   68,   34,   68 } },
+      { PimCmdEnum::MIN,          {  136,   34,  204 } },
+      { PimCmdEnum::MAX,          {  136,   34,  204 } },
+      { PimCmdEnum::ADD_SCALAR,   {   34,   34,  136 } },
+      { PimCmdEnum::SUB_SCALAR,   {   34,   34,  136 } },
+      { PimCmdEnum::AND_SCALAR,   {   34,   34,  102 } },
+      { PimCmdEnum::OR_SCALAR,    {   34,   34,   91 } },
+      { PimCmdEnum::XOR_SCALAR,   {   34,   34,   81 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   34,   34,  102 } },
+      { PimCmdEnum::MIN_SCALAR,   {   68,   34,  187 } },
+      { PimCmdEnum::MAX_SCALAR,   {   68,   34,  187 } },
+    }},
+    { { true, 35 }, {
+      { PimCmdEnum::ABS,          {   35,   35,  211 } },
+      { PimCmdEnum::ADD,          {   70,   35,  105 } },
+      { PimCmdEnum::SUB,          {   70,   35,  105 } },
+      { PimCmdEnum::AND,          {   70,   35,   70 } },
+      { PimCmdEnum::OR,           {   70,   35,   71 } },
+      { PimCmdEnum::XOR,          {   70,   35,  106 } },
+      { PimCmdEnum::XNOR,         {   70,   35,   70 } },
+      { PimCmdEnum::MIN,          {  140,   35,  210 } },
+      { PimCmdEnum::MAX,          {  140,   35,  210 } },
+      { PimCmdEnum::ADD_SCALAR,   {   35,   35,  140 } },
+      { PimCmdEnum::SUB_SCALAR,   {   35,   35,  140 } },
+      { PimCmdEnum::AND_SCALAR,   {   35,   35,  105 } },
+      { PimCmdEnum::OR_SCALAR,    {   35,   35,   94 } },
+      { PimCmdEnum::XOR_SCALAR,   {   35,   35,   83 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   35,   35,  105 } },
+      { PimCmdEnum::MIN_SCALAR,   {   70,   35,  192 } },
+      { PimCmdEnum::MAX_SCALAR,   {   70,   35,  192 } },
+    }},
+    { { true, 36 }, {
+      { PimCmdEnum::ABS,          {   36,   36,  217 } },
+      { PimCmdEnum::ADD,          {   72,   36,  108 } },
+      { PimCmdEnum::SUB,          {   72,   36,  108 } },
+      { PimCmdEnum::AND,          {   72,   36,   72 } },
+      { PimCmdEnum::OR,           {   72,   36,   73 } },
+      { PimCmdEnum::XOR,          {   72,   36,  109 } },
+      { PimCmdEnum::XNOR,         {   72,   36,   72 } },
+      { PimCmdEnum::MIN,          {  144,   36,  216 } },
+      { PimCmdEnum::MAX,          {  144,   36,  216 } },
+      { PimCmdEnum::ADD_SCALAR,   {   36,   36,  144 } },
+      { PimCmdEnum::SUB_SCALAR,   {   36,   36,  144 } },
+      { PimCmdEnum::AND_SCALAR,   {   36,   36,  108 } },
+      { PimCmdEnum::OR_SCALAR,    {   36,   36,   97 } },
+      { PimCmdEnum::XOR_SCALAR,   {   36,   36,   85 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   36,   36,  108 } },
+      { PimCmdEnum::MIN_SCALAR,   {   72,   36,  197 } },
+      { PimCmdEnum::MAX_SCALAR,   {   72,   36,  197 } },
+    }},
+    { { true, 37 }, {
+      { PimCmdEnum::ABS,          {   37,   37,  223 } },
+      { PimCmdEnum::ADD,          {   74,   37,  111 } },
+      { PimCmdEnum::SUB,          {   74,   37,  111 } },
+      { PimCmdEnum::AND,          {   74,   37,   74 } },
+      { PimCmdEnum::OR,           {   74,   37,   75 } },
+      { PimCmdEnum::XOR,          {   74,   37,  112 } },
+      { PimCmdEnum::XNOR,         {   74,   37,   74 } },
+      { PimCmdEnum::MIN,          {  148,   37,  222 } },
+      { PimCmdEnum::MAX,          {  148,   37,  222 } },
+      { PimCmdEnum::ADD_SCALAR,   {   37,   37,  148 } },
+      { PimCmdEnum::SUB_SCALAR,   {   37,   37,  148 } },
+      { PimCmdEnum::AND_SCALAR,   {   37,   37,  111 } },
+      { PimCmdEnum::OR_SCALAR,    {   37,   37,  100 } },
+      { PimCmdEnum::XOR_SCALAR,   {   37,   37,   87 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   37,   37,  111 } },
+      { PimCmdEnum::MIN_SCALAR,   {   74,   37,  202 } },
+      { PimCmdEnum::MAX_SCALAR,   {   74,   37,  202 } },
+    }},
+    { { true, 38 }, {
+      { PimCmdEnum::ABS,          {   38,   38,  229 } },
+      { PimCmdEnum::ADD,          {   76,   38,  114 } },
+      { PimCmdEnum::SUB,          {   76,   38,  114 } },
+      { PimCmdEnum::AND,          {   76,   38,   76 } },
+      { PimCmdEnum::OR,           {   76,   38,   77 } },
+      { PimCmdEnum::XOR,          {   76,   38,  115 } },
+      { PimCmdEnum::XNOR,         {   76,   38,   76 } },
+      { PimCmdEnum::MIN,          {  152,   38,  228 } },
+      { PimCmdEnum::MAX,          {  152,   38,  228 } },
+      { PimCmdEnum::ADD_SCALAR,   {   38,   38,  152 } },
+      { PimCmdEnum::SUB_SCALAR,   {   38,   38,  152 } },
+      { PimCmdEnum::AND_SCALAR,   {   38,   38,  114 } },
+      { PimCmdEnum::OR_SCALAR,    {   38,   38,  103 } },
+      { PimCmdEnum::XOR_SCALAR,   {   38,   38,   89 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   38,   38,  114 } },
+      { PimCmdEnum::MIN_SCALAR,   {   76,   38,  207 } },
+      { PimCmdEnum::MAX_SCALAR,   {   76,   38,  207 } },
+    }},
+    { { true, 39 }, {
+      { PimCmdEnum::ABS,          {   39,   39,  235 } },
+      { PimCmdEnum::ADD,          {   78,   39,  117 } },
+      { PimCmdEnum::SUB,          {   78,   39,  117 } },
+      { PimCmdEnum::AND,          {   78,   39,   78 } },
+      { PimCmdEnum::OR,           {   78,   39,   79 } },
+      { PimCmdEnum::XOR,          {   78,   39,  118 } },
+      { PimCmdEnum::XNOR,         {   78,   39,   78 } },
+      { PimCmdEnum::MIN,          {  156,   39,  234 } },
+      { PimCmdEnum::MAX,          {  156,   39,  234 } },
+      { PimCmdEnum::ADD_SCALAR,   {   39,   39,  156 } },
+      { PimCmdEnum::SUB_SCALAR,   {   39,   39,  156 } },
+      { PimCmdEnum::AND_SCALAR,   {   39,   39,  117 } },
+      { PimCmdEnum::OR_SCALAR,    {   39,   39,  106 } },
+      { PimCmdEnum::XOR_SCALAR,   {   39,   39,   91 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   39,   39,  117 } },
+      { PimCmdEnum::MIN_SCALAR,   {   78,   39,  212 } },
+      { PimCmdEnum::MAX_SCALAR,   {   78,   39,  212 } },
+    }},
+    { { true, 40 }, {
+      { PimCmdEnum::ABS,          {   40,   40,  241 } },
+      { PimCmdEnum::ADD,          {   80,   40,  120 } },
+      { PimCmdEnum::SUB,          {   80,   40,  120 } },
+      { PimCmdEnum::AND,          {   80,   40,   80 } },
+      { PimCmdEnum::OR,           {   80,   40,   81 } },
+      { PimCmdEnum::XOR,          {   80,   40,  121 } },
+      { PimCmdEnum::XNOR,         {   80,   40,   80 } },
+      { PimCmdEnum::MIN,          {  160,   40,  240 } },
+      { PimCmdEnum::MAX,          {  160,   40,  240 } },
+      { PimCmdEnum::ADD_SCALAR,   {   40,   40,  160 } },
+      { PimCmdEnum::SUB_SCALAR,   {   40,   40,  160 } },
+      { PimCmdEnum::AND_SCALAR,   {   40,   40,  120 } },
+      { PimCmdEnum::OR_SCALAR,    {   40,   40,  109 } },
+      { PimCmdEnum::XOR_SCALAR,   {   40,   40,   93 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   40,   40,  120 } },
+      { PimCmdEnum::MIN_SCALAR,   {   80,   40,  217 } },
+      { PimCmdEnum::MAX_SCALAR,   {   80,   40,  217 } },
+    }},
+    { { true, 41 }, {
+      { PimCmdEnum::ABS,          {   41,   41,  247 } },
+      { PimCmdEnum::ADD,          {   82,   41,  123 } },
+      { PimCmdEnum::SUB,          {   82,   41,  123 } },
+      { PimCmdEnum::AND,          {   82,   41,   82 } },
+      { PimCmdEnum::OR,           {   82,   41,   83 } },
+      { PimCmdEnum::XOR,          {   82,   41,  124 } },
+      { PimCmdEnum::XNOR,         {   82,   41,   82 } },
+      { PimCmdEnum::MIN,          {  164,   41,  246 } },
+      { PimCmdEnum::MAX,          {  164,   41,  246 } },
+      { PimCmdEnum::ADD_SCALAR,   {   41,   41,  164 } },
+      { PimCmdEnum::SUB_SCALAR,   {   41,   41,  164 } },
+      { PimCmdEnum::AND_SCALAR,   {   41,   41,  123 } },
+      { PimCmdEnum::OR_SCALAR,    {   41,   41,  112 } },
+      { PimCmdEnum::XOR_SCALAR,   {   41,   41,   95 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   41,   41,  123 } },
+      { PimCmdEnum::MIN_SCALAR,   {   82,   41,  222 } },
+      { PimCmdEnum::MAX_SCALAR,   {   82,   41,  222 } },
+    }},
+    { { true, 42 }, {
+      { PimCmdEnum::ABS,          {   42,   42,  253 } },
+      { PimCmdEnum::ADD,          {   84,   42,  126 } },
+      { PimCmdEnum::SUB,          {   84,   42,  126 } },
+      { PimCmdEnum::AND,          {   84,   42,   84 } },
+      { PimCmdEnum::OR,           {   84,   42,   85 } },
+      { PimCmdEnum::XOR,          {   84,   42,  127 } },
+      { PimCmdEnum::XNOR,         {   84,   42,   84 } },
+      { PimCmdEnum::MIN,          {  168,   42,  252 } },
+      { PimCmdEnum::MAX,          {  168,   42,  252 } },
+      { PimCmdEnum::ADD_SCALAR,   {   42,   42,  168 } },
+      { PimCmdEnum::SUB_SCALAR,   {   42,   42,  168 } },
+      { PimCmdEnum::AND_SCALAR,   {   42,   42,  126 } },
+      { PimCmdEnum::OR_SCALAR,    {   42,   42,  115 } },
+      { PimCmdEnum::XOR_SCALAR,   {   42,   42,   97 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   42,   42,  126 } },
+      { PimCmdEnum::MIN_SCALAR,   {   84,   42,  227 } },
+      { PimCmdEnum::MAX_SCALAR,   {   84,   42,  227 } },
+    }},
+    { { true, 43 }, {
+      { PimCmdEnum::ABS,          {   43,   43,  259 } },
+      { PimCmdEnum::ADD,          {   86,   43,  129 } },
+      { PimCmdEnum::SUB,          {   86,   43,  129 } },
+      { PimCmdEnum::AND,          {   86,   43,   86 } },
+      { PimCmdEnum::OR,           {   86,   43,   87 } },
+      { PimCmdEnum::XOR,          {   86,   43,  130 } },
+      { PimCmdEnum::XNOR,         {   86,   43,   86 } },
+      { PimCmdEnum::MIN,          {  172,   43,  258 } },
+      { PimCmdEnum::MAX,          {  172,   43,  258 } },
+      { PimCmdEnum::ADD_SCALAR,   {   43,   43,  172 } },
+      { PimCmdEnum::SUB_SCALAR,   {   43,   43,  172 } },
+      { PimCmdEnum::AND_SCALAR,   {   43,   43,  129 } },
+      { PimCmdEnum::OR_SCALAR,    {   43,   43,  118 } },
+      { PimCmdEnum::XOR_SCALAR,   {   43,   43,   99 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   43,   43,  129 } },
+      { PimCmdEnum::MIN_SCALAR,   {   86,   43,  232 } },
+      { PimCmdEnum::MAX_SCALAR,   {   86,   43,  232 } },
+    }},
+    { { true, 44 }, {
+      { PimCmdEnum::ABS,          {   44,   44,  265 } },
+      { PimCmdEnum::ADD,          {   88,   44,  132 } },
+      { PimCmdEnum::SUB,          {   88,   44,  132 } },
+      { PimCmdEnum::AND,          {   88,   44,   88 } },
+      { PimCmdEnum::OR,           {   88,   44,   89 } },
+      { PimCmdEnum::XOR,          {   88,   44,  133 } },
+      { PimCmdEnum::XNOR,         {   88,   44,   88 } },
+      { PimCmdEnum::MIN,          {  176,   44,  264 } },
+      { PimCmdEnum::MAX,          {  176,   44,  264 } },
+      { PimCmdEnum::ADD_SCALAR,   {   44,   44,  176 } },
+      { PimCmdEnum::SUB_SCALAR,   {   44,   44,  176 } },
+      { PimCmdEnum::AND_SCALAR,   {   44,   44,  132 } },
+      { PimCmdEnum::OR_SCALAR,    {   44,   44,  121 } },
+      { PimCmdEnum::XOR_SCALAR,   {   44,   44,  101 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   44,   44,  132 } },
+      { PimCmdEnum::MIN_SCALAR,   {   88,   44,  237 } },
+      { PimCmdEnum::MAX_SCALAR,   {   88,   44,  237 } },
+    }},
+    { { true, 45 }, {
+      { PimCmdEnum::ABS,          {   45,   45,  271 } },
+      { PimCmdEnum::ADD,          {   90,   45,  135 } },
+      { PimCmdEnum::SUB,          {   90,   45,  135 } },
+      { PimCmdEnum::AND,          {   90,   45,   90 } },
+      { PimCmdEnum::OR,           {   90,   45,   91 } },
+      { PimCmdEnum::XOR,          {   90,   45,  136 } },
+      { PimCmdEnum::XNOR,         {   90,   45,   90 } },
+      { PimCmdEnum::MIN,          {  180,   45,  270 } },
+      { PimCmdEnum::MAX,          {  180,   45,  270 } },
+      { PimCmdEnum::ADD_SCALAR,   {   45,   45,  180 } },
+      { PimCmdEnum::SUB_SCALAR,   {   45,   45,  180 } },
+      { PimCmdEnum::AND_SCALAR,   {   45,   45,  135 } },
+      { PimCmdEnum::OR_SCALAR,    {   45,   45,  124 } },
+      { PimCmdEnum::XOR_SCALAR,   {   45,   45,  103 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   45,   45,  135 } },
+      { PimCmdEnum::MIN_SCALAR,   {   90,   45,  242 } },
+      { PimCmdEnum::MAX_SCALAR,   {   90,   45,  242 } },
+    }},
+    { { true, 46 }, {
+      { PimCmdEnum::ABS,          {   46,   46,  277 } },
+      { PimCmdEnum::ADD,          {   92,   46,  138 } },
+      { PimCmdEnum::SUB,          {   92,   46,  138 } },
+      { PimCmdEnum::AND,          {   92,   46,   92 } },
+      { PimCmdEnum::OR,           {   92,   46,   93 } },
+      { PimCmdEnum::XOR,          {   92,   46,  139 } },
+      { PimCmdEnum::XNOR,         {   92,   46,   92 } },
+      { PimCmdEnum::MIN,          {  184,   46,  276 } },
+      { PimCmdEnum::MAX,          {  184,   46,  276 } },
+      { PimCmdEnum::ADD_SCALAR,   {   46,   46,  184 } },
+      { PimCmdEnum::SUB_SCALAR,   {   46,   46,  184 } },
+      { PimCmdEnum::AND_SCALAR,   {   46,   46,  138 } },
+      { PimCmdEnum::OR_SCALAR,    {   46,   46,  127 } },
+      { PimCmdEnum::XOR_SCALAR,   {   46,   46,  105 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   46,   46,  138 } },
+      { PimCmdEnum::MIN_SCALAR,   {   92,   46,  247 } },
+      { PimCmdEnum::MAX_SCALAR,   {   92,   46,  247 } },
+    }},
+    { { true, 47 }, {
+      { PimCmdEnum::ABS,          {   47,   47,  283 } },
+      { PimCmdEnum::ADD,          {   94,   47,  141 } },
+      { PimCmdEnum::SUB,          {   94,   47,  141 } },
+      { PimCmdEnum::AND,          {   94,   47,   94 } },
+      { PimCmdEnum::OR,           {   94,   47,   95 } },
+      { PimCmdEnum::XOR,          {   94,   47,  142 } },
+      { PimCmdEnum::XNOR,         {   94,   47,   94 } },
+      { PimCmdEnum::MIN,          {  188,   47,  282 } },
+      { PimCmdEnum::MAX,          {  188,   47,  282 } },
+      { PimCmdEnum::ADD_SCALAR,   {   47,   47,  188 } },
+      { PimCmdEnum::SUB_SCALAR,   {   47,   47,  188 } },
+      { PimCmdEnum::AND_SCALAR,   {   47,   47,  141 } },
+      { PimCmdEnum::OR_SCALAR,    {   47,   47,  130 } },
+      { PimCmdEnum::XOR_SCALAR,   {   47,   47,  107 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   47,   47,  141 } },
+      { PimCmdEnum::MIN_SCALAR,   {   94,   47,  252 } },
+      { PimCmdEnum::MAX_SCALAR,   {   94,   47,  252 } },
+    }},
+    { { true, 48 }, {
+      { PimCmdEnum::ABS,          {   48,   48,  289 } },
+      { PimCmdEnum::ADD,          {   96,   48,  144 } },
+      { PimCmdEnum::SUB,          {   96,   48,  144 } },
+      { PimCmdEnum::AND,          {   96,   48,   96 } },
+      { PimCmdEnum::OR,           {   96,   48,   97 } },
+      { PimCmdEnum::XOR,          {   96,   48,  145 } },
+      { PimCmdEnum::XNOR,         {   96,   48,   96 } },
+      { PimCmdEnum::MIN,          {  192,   48,  288 } },
+      { PimCmdEnum::MAX,          {  192,   48,  288 } },
+      { PimCmdEnum::ADD_SCALAR,   {   48,   48,  192 } },
+      { PimCmdEnum::SUB_SCALAR,   {   48,   48,  192 } },
+      { PimCmdEnum::AND_SCALAR,   {   48,   48,  144 } },
+      { PimCmdEnum::OR_SCALAR,    {   48,   48,  133 } },
+      { PimCmdEnum::XOR_SCALAR,   {   48,   48,  109 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   48,   48,  144 } },
+      { PimCmdEnum::MIN_SCALAR,   {   96,   48,  257 } },
+      { PimCmdEnum::MAX_SCALAR,   {   96,   48,  257 } },
+    }},
+    { { true, 49 }, {
+      { PimCmdEnum::ABS,          {   49,   49,  295 } },
+      { PimCmdEnum::ADD,          {   98,   49,  147 } },
+      { PimCmdEnum::SUB,          {   98,   49,  147 } },
+      { PimCmdEnum::AND,          {   98,   49,   98 } },
+      { PimCmdEnum::OR,           {   98,   49,   99 } },
+      { PimCmdEnum::XOR,          {   98,   49,  148 } },
+      { PimCmdEnum::XNOR,         {   98,   49,   98 } },
+      { PimCmdEnum::MIN,          {  196,   49,  294 } },
+      { PimCmdEnum::MAX,          {  196,   49,  294 } },
+      { PimCmdEnum::ADD_SCALAR,   {   49,   49,  196 } },
+      { PimCmdEnum::SUB_SCALAR,   {   49,   49,  196 } },
+      { PimCmdEnum::AND_SCALAR,   {   49,   49,  147 } },
+      { PimCmdEnum::OR_SCALAR,    {   49,   49,  136 } },
+      { PimCmdEnum::XOR_SCALAR,   {   49,   49,  111 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   49,   49,  147 } },
+      { PimCmdEnum::MIN_SCALAR,   {   98,   49,  262 } },
+      { PimCmdEnum::MAX_SCALAR,   {   98,   49,  262 } },
+    }},
+    { { true, 50 }, {
+      { PimCmdEnum::ABS,          {   50,   50,  301 } },
+      { PimCmdEnum::ADD,          {  100,   50,  150 } },
+      { PimCmdEnum::SUB,          {  100,   50,  150 } },
+      { PimCmdEnum::AND,          {  100,   50,  100 } },
+      { PimCmdEnum::OR,           {  100,   50,  101 } },
+      { PimCmdEnum::XOR,          {  100,   50,  151 } },
+      { PimCmdEnum::XNOR,         {  100,   50,  100 } },
+      { PimCmdEnum::MIN,          {  200,   50,  300 } },
+      { PimCmdEnum::MAX,          {  200,   50,  300 } },
+      { PimCmdEnum::ADD_SCALAR,   {   50,   50,  200 } },
+      { PimCmdEnum::SUB_SCALAR,   {   50,   50,  200 } },
+      { PimCmdEnum::AND_SCALAR,   {   50,   50,  150 } },
+      { PimCmdEnum::OR_SCALAR,    {   50,   50,  139 } },
+      { PimCmdEnum::XOR_SCALAR,   {   50,   50,  113 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   50,   50,  150 } },
+      { PimCmdEnum::MIN_SCALAR,   {  100,   50,  267 } },
+      { PimCmdEnum::MAX_SCALAR,   {  100,   50,  267 } },
+    }},
+    { { true, 51 }, {
+      { PimCmdEnum::ABS,          {   51,   51,  307 } },
+      { PimCmdEnum::ADD,          {  102,   51,  153 } },
+      { PimCmdEnum::SUB,          {  102,   51,  153 } },
+      { PimCmdEnum::AND,          {  102,   51,  102 } },
+      { PimCmdEnum::OR,           {  102,   51,  103 } },
+      { PimCmdEnum::XOR,          {  102,   51,  154 } },
+      { PimCmdEnum::XNOR,         {  102,   51,  102 } },
+      { PimCmdEnum::MIN,          {  204,   51,  306 } },
+      { PimCmdEnum::MAX,          {  204,   51,  306 } },
+      { PimCmdEnum::ADD_SCALAR,   {   51,   51,  204 } },
+      { PimCmdEnum::SUB_SCALAR,   {   51,   51,  204 } },
+      { PimCmdEnum::AND_SCALAR,   {   51,   51,  153 } },
+      { PimCmdEnum::OR_SCALAR,    {   51,   51,  142 } },
+      { PimCmdEnum::XOR_SCALAR,   {   51,   51,  115 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   51,   51,  153 } },
+      { PimCmdEnum::MIN_SCALAR,   {  102,   51,  272 } },
+      { PimCmdEnum::MAX_SCALAR,   {  102,   51,  272 } },
+    }},
+    { { true, 52 }, {
+      { PimCmdEnum::ABS,          {   52,   52,  313 } },
+      { PimCmdEnum::ADD,          {  104,   52,  156 } },
+      { PimCmdEnum::SUB,          {  104,   52,  156 } },
+      { PimCmdEnum::AND,          {  104,   52,  104 } },
+      { PimCmdEnum::OR,           {  104,   52,  105 } },
+      { PimCmdEnum::XOR,          {  104,   52,  157 } },
+      { PimCmdEnum::XNOR,         {  104,   52,  104 } },
+      { PimCmdEnum::MIN,          {  208,   52,  312 } },
+      { PimCmdEnum::MAX,          {  208,   52,  312 } },
+      { PimCmdEnum::ADD_SCALAR,   {   52,   52,  208 } },
+      { PimCmdEnum::SUB_SCALAR,   {   52,   52,  208 } },
+      { PimCmdEnum::AND_SCALAR,   {   52,   52,  156 } },
+      { PimCmdEnum::OR_SCALAR,    {   52,   52,  145 } },
+      { PimCmdEnum::XOR_SCALAR,   {   52,   52,  117 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   52,   52,  156 } },
+      { PimCmdEnum::MIN_SCALAR,   {  104,   52,  277 } },
+      { PimCmdEnum::MAX_SCALAR,   {  104,   52,  277 } },
+    }},
+    { { true, 53 }, {
+      { PimCmdEnum::ABS,          {   53,   53,  319 } },
+      { PimCmdEnum::ADD,          {  106,   53,  159 } },
+      { PimCmdEnum::SUB,          {  106,   53,  159 } },
+      { PimCmdEnum::AND,          {  106,   53,  106 } },
+      { PimCmdEnum::OR,           {  106,   53,  107 } },
+      { PimCmdEnum::XOR,          {  106,   53,  160 } },
+      { PimCmdEnum::XNOR,         {  106,   53,  106 } },
+      { PimCmdEnum::MIN,          {  212,   53,  318 } },
+      { PimCmdEnum::MAX,          {  212,   53,  318 } },
+      { PimCmdEnum::ADD_SCALAR,   {   53,   53,  212 } },
+      { PimCmdEnum::SUB_SCALAR,   {   53,   53,  212 } },
+      { PimCmdEnum::AND_SCALAR,   {   53,   53,  159 } },
+      { PimCmdEnum::OR_SCALAR,    {   53,   53,  148 } },
+      { PimCmdEnum::XOR_SCALAR,   {   53,   53,  119 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   53,   53,  159 } },
+      { PimCmdEnum::MIN_SCALAR,   {  106,   53,  282 } },
+      { PimCmdEnum::MAX_SCALAR,   {  106,   53,  282 } },
+    }},
+    { { true, 54 }, {
+      { PimCmdEnum::ABS,          {   54,   54,  325 } },
+      { PimCmdEnum::ADD,          {  108,   54,  162 } },
+      { PimCmdEnum::SUB,          {  108,   54,  162 } },
+      { PimCmdEnum::AND,          {  108,   54,  108 } },
+      { PimCmdEnum::OR,           {  108,   54,  109 } },
+      { PimCmdEnum::XOR,          {  108,   54,  163 } },
+      { PimCmdEnum::XNOR,         {  108,   54,  108 } },
+      { PimCmdEnum::MIN,          {  216,   54,  324 } },
+      { PimCmdEnum::MAX,          {  216,   54,  324 } },
+      { PimCmdEnum::ADD_SCALAR,   {   54,   54,  216 } },
+      { PimCmdEnum::SUB_SCALAR,   {   54,   54,  216 } },
+      { PimCmdEnum::AND_SCALAR,   {   54,   54,  162 } },
+      { PimCmdEnum::OR_SCALAR,    {   54,   54,  151 } },
+      { PimCmdEnum::XOR_SCALAR,   {   54,   54,  121 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   54,   54,  162 } },
+      { PimCmdEnum::MIN_SCALAR,   {  108,   54,  287 } },
+      { PimCmdEnum::MAX_SCALAR,   {  108,   54,  287 } },
+    }},
+    { { true, 55 }, {
+      { PimCmdEnum::ABS,          {   55,   55,  331 } },
+      { PimCmdEnum::ADD,          {  110,   55,  165 } },
+      { PimCmdEnum::SUB,          {  110,   55,  165 } },
+      { PimCmdEnum::AND,          {  110,   55,  110 } },
+      { PimCmdEnum::OR,           {  110,   55,  111 } },
+      { PimCmdEnum::XOR,          {  110,   55,  166 } },
+      { PimCmdEnum::XNOR,         {  110,   55,  110 } },
+      { PimCmdEnum::MIN,          {  220,   55,  330 } },
+      { PimCmdEnum::MAX,          {  220,   55,  330 } },
+      { PimCmdEnum::ADD_SCALAR,   {   55,   55,  220 } },
+      { PimCmdEnum::SUB_SCALAR,   {   55,   55,  220 } },
+      { PimCmdEnum::AND_SCALAR,   {   55,   55,  165 } },
+      { PimCmdEnum::OR_SCALAR,    {   55,   55,  154 } },
+      { PimCmdEnum::XOR_SCALAR,   {   55,   55,  123 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   55,   55,  165 } },
+      { PimCmdEnum::MIN_SCALAR,   {  110,   55,  292 } },
+      { PimCmdEnum::MAX_SCALAR,   {  110,   55,  292 } },
+    }},
+    { { true, 56 }, {
+      { PimCmdEnum::ABS,          {   56,   56,  337 } },
+      { PimCmdEnum::ADD,          {  112,   56,  168 } },
+      { PimCmdEnum::SUB,          {  112,   56,  168 } },
+      { PimCmdEnum::AND,          {  112,   56,  112 } },
+      { PimCmdEnum::OR,           {  112,   56,  113 } },
+      { PimCmdEnum::XOR,          {  112,   56,  169 } },
+      { PimCmdEnum::XNOR,         {  112,   56,  112 } },
+      { PimCmdEnum::MIN,          {  224,   56,  336 } },
+      { PimCmdEnum::MAX,          {  224,   56,  336 } },
+      { PimCmdEnum::ADD_SCALAR,   {   56,   56,  224 } },
+      { PimCmdEnum::SUB_SCALAR,   {   56,   56,  224 } },
+      { PimCmdEnum::AND_SCALAR,   {   56,   56,  168 } },
+      { PimCmdEnum::OR_SCALAR,    {   56,   56,  157 } },
+      { PimCmdEnum::XOR_SCALAR,   {   56,   56,  125 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   56,   56,  168 } },
+      { PimCmdEnum::MIN_SCALAR,   {  112,   56,  297 } },
+      { PimCmdEnum::MAX_SCALAR,   {  112,   56,  297 } },
+    }},
+    { { true, 57 }, {
+      { PimCmdEnum::ABS,          {   57,   57,  343 } },
+      { PimCmdEnum::ADD,          {  114,   57,  171 } },
+      { PimCmdEnum::SUB,          {  114,   57,  171 } },
+      { PimCmdEnum::AND,          {  114,   57,  114 } },
+      { PimCmdEnum::OR,           {  114,   57,  115 } },
+      { PimCmdEnum::XOR,          {  114,   57,  172 } },
+      { PimCmdEnum::XNOR,         {  114,   57,  114 } },
+      { PimCmdEnum::MIN,          {  228,   57,  342 } },
+      { PimCmdEnum::MAX,          {  228,   57,  342 } },
+      { PimCmdEnum::ADD_SCALAR,   {   57,   57,  228 } },
+      { PimCmdEnum::SUB_SCALAR,   {   57,   57,  228 } },
+      { PimCmdEnum::AND_SCALAR,   {   57,   57,  171 } },
+      { PimCmdEnum::OR_SCALAR,    {   57,   57,  160 } },
+      { PimCmdEnum::XOR_SCALAR,   {   57,   57,  127 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   57,   57,  171 } },
+      { PimCmdEnum::MIN_SCALAR,   {  114,   57,  302 } },
+      { PimCmdEnum::MAX_SCALAR,   {  114,   57,  302 } },
+    }},
+    { { true, 58 }, {
+      { PimCmdEnum::ABS,          {   58,   58,  349 } },
+      { PimCmdEnum::ADD,          {  116,   58,  174 } },
+      { PimCmdEnum::SUB,          {  116,   58,  174 } },
+      { PimCmdEnum::AND,          {  116,   58,  116 } },
+      { PimCmdEnum::OR,           {  116,   58,  117 } },
+      { PimCmdEnum::XOR,          {  116,   58,  175 } },
+      { PimCmdEnum::XNOR,         {  116,   58,  116 } },
+      { PimCmdEnum::MIN,          {  232,   58,  348 } },
+      { PimCmdEnum::MAX,          {  232,   58,  348 } },
+      { PimCmdEnum::ADD_SCALAR,   {   58,   58,  232 } },
+      { PimCmdEnum::SUB_SCALAR,   {   58,   58,  232 } },
+      { PimCmdEnum::AND_SCALAR,   {   58,   58,  174 } },
+      { PimCmdEnum::OR_SCALAR,    {   58,   58,  163 } },
+      { PimCmdEnum::XOR_SCALAR,   {   58,   58,  129 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   58,   58,  174 } },
+      { PimCmdEnum::MIN_SCALAR,   {  116,   58,  307 } },
+      { PimCmdEnum::MAX_SCALAR,   {  116,   58,  307 } },
+    }},
+    { { true, 59 }, {
+      { PimCmdEnum::ABS,          {   59,   59,  355 } },
+      { PimCmdEnum::ADD,          {  118,   59,  177 } },
+      { PimCmdEnum::SUB,          {  118,   59,  177 } },
+      { PimCmdEnum::AND,          {  118,   59,  118 } },
+      { PimCmdEnum::OR,           {  118,   59,  119 } },
+      { PimCmdEnum::XOR,          {  118,   59,  178 } },
+      { PimCmdEnum::XNOR,         {  118,   59,  118 } },
+      { PimCmdEnum::MIN,          {  236,   59,  354 } },
+      { PimCmdEnum::MAX,          {  236,   59,  354 } },
+      { PimCmdEnum::ADD_SCALAR,   {   59,   59,  236 } },
+      { PimCmdEnum::SUB_SCALAR,   {   59,   59,  236 } },
+      { PimCmdEnum::AND_SCALAR,   {   59,   59,  177 } },
+      { PimCmdEnum::OR_SCALAR,    {   59,   59,  166 } },
+      { PimCmdEnum::XOR_SCALAR,   {   59,   59,  131 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   59,   59,  177 } },
+      { PimCmdEnum::MIN_SCALAR,   {  118,   59,  312 } },
+      { PimCmdEnum::MAX_SCALAR,   {  118,   59,  312 } },
+    }},
+    { { true, 60 }, {
+      { PimCmdEnum::ABS,          {   60,   60,  361 } },
+      { PimCmdEnum::ADD,          {  120,   60,  180 } },
+      { PimCmdEnum::SUB,          {  120,   60,  180 } },
+      { PimCmdEnum::AND,          {  120,   60,  120 } },
+      { PimCmdEnum::OR,           {  120,   60,  121 } },
+      { PimCmdEnum::XOR,          {  120,   60,  181 } },
+      { PimCmdEnum::XNOR,         {  120,   60,  120 } },
+      { PimCmdEnum::MIN,          {  240,   60,  360 } },
+      { PimCmdEnum::MAX,          {  240,   60,  360 } },
+      { PimCmdEnum::ADD_SCALAR,   {   60,   60,  240 } },
+      { PimCmdEnum::SUB_SCALAR,   {   60,   60,  240 } },
+      { PimCmdEnum::AND_SCALAR,   {   60,   60,  180 } },
+      { PimCmdEnum::OR_SCALAR,    {   60,   60,  169 } },
+      { PimCmdEnum::XOR_SCALAR,   {   60,   60,  133 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   60,   60,  180 } },
+      { PimCmdEnum::MIN_SCALAR,   {  120,   60,  317 } },
+      { PimCmdEnum::MAX_SCALAR,   {  120,   60,  317 } },
+    }},
+    { { true, 61 }, {
+      { PimCmdEnum::ABS,          {   61,   61,  367 } },
+      { PimCmdEnum::ADD,          {  122,   61,  183 } },
+      { PimCmdEnum::SUB,          {  122,   61,  183 } },
+      { PimCmdEnum::AND,          {  122,   61,  122 } },
+      { PimCmdEnum::OR,           {  122,   61,  123 } },
+      { PimCmdEnum::XOR,          {  122,   61,  184 } },
+      { PimCmdEnum::XNOR,         {  122,   61,  122 } },
+      { PimCmdEnum::MIN,          {  244,   61,  366 } },
+      { PimCmdEnum::MAX,          {  244,   61,  366 } },
+      { PimCmdEnum::ADD_SCALAR,   {   61,   61,  244 } },
+      { PimCmdEnum::SUB_SCALAR,   {   61,   61,  244 } },
+      { PimCmdEnum::AND_SCALAR,   {   61,   61,  183 } },
+      { PimCmdEnum::OR_SCALAR,    {   61,   61,  172 } },
+      { PimCmdEnum::XOR_SCALAR,   {   61,   61,  135 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   61,   61,  183 } },
+      { PimCmdEnum::MIN_SCALAR,   {  122,   61,  322 } },
+      { PimCmdEnum::MAX_SCALAR,   {  122,   61,  322 } },
+    }},
+    { { true, 62 }, {
+      { PimCmdEnum::ABS,          {   62,   62,  373 } },
+      { PimCmdEnum::ADD,          {  124,   62,  186 } },
+      { PimCmdEnum::SUB,          {  124,   62,  186 } },
+      { PimCmdEnum::AND,          {  124,   62,  124 } },
+      { PimCmdEnum::OR,           {  124,   62,  125 } },
+      { PimCmdEnum::XOR,          {  124,   62,  187 } },
+      { PimCmdEnum::XNOR,         {  124,   62,  124 } },
+      { PimCmdEnum::MIN,          {  248,   62,  372 } },
+      { PimCmdEnum::MAX,          {  248,   62,  372 } },
+      { PimCmdEnum::ADD_SCALAR,   {   62,   62,  248 } },
+      { PimCmdEnum::SUB_SCALAR,   {   62,   62,  248 } },
+      { PimCmdEnum::AND_SCALAR,   {   62,   62,  186 } },
+      { PimCmdEnum::OR_SCALAR,    {   62,   62,  175 } },
+      { PimCmdEnum::XOR_SCALAR,   {   62,   62,  137 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   62,   62,  186 } },
+      { PimCmdEnum::MIN_SCALAR,   {  124,   62,  327 } },
+      { PimCmdEnum::MAX_SCALAR,   {  124,   62,  327 } },
+    }},
+    { { true, 63 }, {
+      { PimCmdEnum::ABS,          {   63,   63,  379 } },
+      { PimCmdEnum::ADD,          {  126,   63,  189 } },
+      { PimCmdEnum::SUB,          {  126,   63,  189 } },
+      { PimCmdEnum::AND,          {  126,   63,  126 } },
+      { PimCmdEnum::OR,           {  126,   63,  127 } },
+      { PimCmdEnum::XOR,          {  126,   63,  190 } },
+      { PimCmdEnum::XNOR,         {  126,   63,  126 } },
+      { PimCmdEnum::MIN,          {  252,   63,  378 } },
+      { PimCmdEnum::MAX,          {  252,   63,  378 } },
+      { PimCmdEnum::ADD_SCALAR,   {   63,   63,  252 } },
+      { PimCmdEnum::SUB_SCALAR,   {   63,   63,  252 } },
+      { PimCmdEnum::AND_SCALAR,   {   63,   63,  189 } },
+      { PimCmdEnum::OR_SCALAR,    {   63,   63,  178 } },
+      { PimCmdEnum::XOR_SCALAR,   {   63,   63,  139 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   63,   63,  189 } },
+      { PimCmdEnum::MIN_SCALAR,   {  126,   63,  332 } },
+      { PimCmdEnum::MAX_SCALAR,   {  126,   63,  332 } },
+    }},
+    { { false, 1 }, {
+      { PimCmdEnum::ABS,          {    1,    1,    0 } },
+      { PimCmdEnum::POPCOUNT,     {    0,    0,    0 } },
+      { PimCmdEnum::ADD,          {    2,    1,    3 } },
+      { PimCmdEnum::SUB,          {    2,    1,    3 } },
+      { PimCmdEnum::MUL,          {    2,    1,    3 } },
+      { PimCmdEnum::DIV,          {    2,    1,    7 } },
+      { PimCmdEnum::AND,          {    2,    1,    2 } },
+      { PimCmdEnum::OR,           {    2,    1,    3 } },
+      { PimCmdEnum::XOR,          {    2,    1,    4 } },
+      { PimCmdEnum::XNOR,         {    2,    1,    2 } },
+      { PimCmdEnum::EQ,           {    2,    1,    5 } },
+      { PimCmdEnum::MIN,          {    4,    1,    8 } },
+      { PimCmdEnum::MAX,          {    3,    1,    8 } },
+      { PimCmdEnum::ADD_SCALAR,   {    1,    1,    4 } },
+      { PimCmdEnum::SUB_SCALAR,   {    1,    1,    4 } },
+      { PimCmdEnum::MUL_SCALAR,   {    1,    1,    4 } },
+      { PimCmdEnum::DIV_SCALAR,   {    1,    1,    8 } },
+      { PimCmdEnum::AND_SCALAR,   {    1,    1,    3 } },
+      { PimCmdEnum::OR_SCALAR,    {    1,    1,    2 } },
+      { PimCmdEnum::XOR_SCALAR,   {    1,    1,    5 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    1,    1,    3 } },
+      { PimCmdEnum::EQ_SCALAR,    {    1,    1,    4 } },
+      { PimCmdEnum::MIN_SCALAR,   {    2,    1,   10 } },
+      { PimCmdEnum::MAX_SCALAR,   {    1,    1,   10 } },
+    }},
+    { { false, 2 }, {
+      { PimCmdEnum::ABS,          {    2,    2,    0 } },
+      { PimCmdEnum::ADD,          {    4,    2,    6 } },
+      { PimCmdEnum::SUB,          {    4,    2,    6 } },
+      { PimCmdEnum::MUL,          {    6,    3,    8 } },
+      { PimCmdEnum::DIV,          {   10,    6,   23 } },
+      { PimCmdEnum::AND,          {    4,    2,    4 } },
+      { PimCmdEnum::OR,           {    4,    2,    5 } },
+      { PimCmdEnum::XOR,          {    4,    2,    7 } },
+      { PimCmdEnum::XNOR,         {    4,    2,    4 } },
+      { PimCmdEnum::MIN,          {    8,    2,   14 } },
+      { PimCmdEnum::MAX,          {    8,    2,   14 } },
+      { PimCmdEnum::ADD_SCALAR,   {    2,    2,    8 } },
+      { PimCmdEnum::SUB_SCALAR,   {    2,    2,    8 } },
+      { PimCmdEnum::MUL_SCALAR,   {    3,    3,   11 } },
+      { PimCmdEnum::DIV_SCALAR,   {    6,    6,   27 } },
+      { PimCmdEnum::AND_SCALAR,   {    2,    2,    6 } },
+      { PimCmdEnum::OR_SCALAR,    {    2,    2,    3 } },
+      { PimCmdEnum::XOR_SCALAR,   {    2,    2,    9 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    2,    2,    6 } },
+      { PimCmdEnum::MIN_SCALAR,   {    4,    2,   18 } },
+      { PimCmdEnum::MAX_SCALAR,   {    4,    2,   18 } },
+    }},
+    { { false, 3 }, {
+      { PimCmdEnum::ABS,          {    3,    3,    0 } },
+      { PimCmdEnum::ADD,          {    6,    3,    9 } },
+      { PimCmdEnum::SUB,          {    6,    3,    9 } },
+      { PimCmdEnum::MUL,          {   12,    6,   18 } },
+      { PimCmdEnum::DIV,          {   23,   13,   49 } },
+      { PimCmdEnum::AND,          {    6,    3,    6 } },
+      { PimCmdEnum::OR,           {    6,    3,    7 } },
+      { PimCmdEnum::XOR,          {    6,    3,   10 } },
+      { PimCmdEnum::XNOR,         {    6,    3,    6 } },
+      { PimCmdEnum::MIN,          {   12,    3,   20 } },
+      { PimCmdEnum::MAX,          {   12,    3,   20 } },
+      { PimCmdEnum::ADD_SCALAR,   {    3,    3,   12 } },
+      { PimCmdEnum::SUB_SCALAR,   {    3,    3,   12 } },
+      { PimCmdEnum::MUL_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::DIV_SCALAR,   {   14,   13,   57 } },
+      { PimCmdEnum::AND_SCALAR,   {    3,    3,    9 } },
+      { PimCmdEnum::OR_SCALAR,    {    3,    3,    4 } },
+      { PimCmdEnum::XOR_SCALAR,   {    3,    3,   13 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    3,    3,    9 } },
+      { PimCmdEnum::MIN_SCALAR,   {    6,    3,   26 } },
+      { PimCmdEnum::MAX_SCALAR,   {    6,    3,   26 } },
+    }},
+    { { false, 4 }, {
+      { PimCmdEnum::ABS,          {    4,    4,    0 } },
+      { PimCmdEnum::ADD,          {    8,    4,   12 } },
+      { PimCmdEnum::SUB,          {    8,    4,   12 } },
+      { PimCmdEnum::MUL,          {   20,   10,   32 } },
+      { PimCmdEnum::DIV,          {   41,   22,   85 } },
+      { PimCmdEnum::AND,          {    8,    4,    8 } },
+      { PimCmdEnum::OR,           {    8,    4,    9 } },
+      { PimCmdEnum::XOR,          {    8,    4,   13 } },
+      { PimCmdEnum::XNOR,         {    8,    4,    8 } },
+      { PimCmdEnum::MIN,          {   16,    4,   26 } },
+      { PimCmdEnum::MAX,          {   16,    4,   26 } },
+      { PimCmdEnum::ADD_SCALAR,   {    4,    4,   16 } },
+      { PimCmdEnum::SUB_SCALAR,   {    4,    4,   16 } },
+      { PimCmdEnum::MUL_SCALAR,   {   10,   10,   42 } },
+      { PimCmdEnum::DIV_SCALAR,   {   25,   22,   98 } },
+      { PimCmdEnum::AND_SCALAR,   {    4,    4,   12 } },
+      { PimCmdEnum::OR_SCALAR,    {    4,    4,    5 } },
+      { PimCmdEnum::XOR_SCALAR,   {    4,    4,   17 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    4,    4,   12 } },
+      { PimCmdEnum::MIN_SCALAR,   {    8,    4,   34 } },
+      { PimCmdEnum::MAX_SCALAR,   {    8,    4,   34 } },
+    }},
+    { { false, 5 }, {
+      { PimCmdEnum::ABS,          {    5,    5,    0 } },
+      { PimCmdEnum::ADD,          {   10,    5,   15 } },
+      { PimCmdEnum::SUB,          {   10,    5,   15 } },
+      { PimCmdEnum::MUL,          {   30,   15,   50 } },
+      { PimCmdEnum::DIV,          {   64,   33,  131 } },
+      { PimCmdEnum::AND,          {   10,    5,   10 } },
+      { PimCmdEnum::OR,           {   10,    5,   11 } },
+      { PimCmdEnum::XOR,          {   10,    5,   16 } },
+      { PimCmdEnum::XNOR,         {   10,    5,   10 } },
+      { PimCmdEnum::MIN,          {   20,    5,   32 } },
+      { PimCmdEnum::MAX,          {   20,    5,   32 } },
+      { PimCmdEnum::ADD_SCALAR,   {    5,    5,   20 } },
+      { PimCmdEnum::SUB_SCALAR,   {    5,    5,   20 } },
+      { PimCmdEnum::MUL_SCALAR,   {   15,   15,   65 } },
+      { PimCmdEnum::DIV_SCALAR,   {   39,   33,  150 } },
+      { PimCmdEnum::AND_SCALAR,   {    5,    5,   15 } },
+      { PimCmdEnum::OR_SCALAR,    {    5,    5,    6 } },
+      { PimCmdEnum::XOR_SCALAR,   {    5,    5,   21 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    5,    5,   15 } },
+      { PimCmdEnum::MIN_SCALAR,   {   10,    5,   42 } },
+      { PimCmdEnum::MAX_SCALAR,   {   10,    5,   42 } },
+    }},
+    { { false, 6 }, {
+      { PimCmdEnum::ABS,          {    6,    6,    0 } },
+      { PimCmdEnum::ADD,          {   12,    6,   18 } },
+      { PimCmdEnum::SUB,          {   12,    6,   18 } },
+      { PimCmdEnum::MUL,          {   42,   21,   72 } },
+      { PimCmdEnum::DIV,          {   92,   46,  187 } },
+      { PimCmdEnum::AND,          {   12,    6,   12 } },
+      { PimCmdEnum::OR,           {   12,    6,   13 } },
+      { PimCmdEnum::XOR,          {   12,    6,   19 } },
+      { PimCmdEnum::XNOR,         {   12,    6,   12 } },
+      { PimCmdEnum::MIN,          {   24,    6,   38 } },
+      { PimCmdEnum::MAX,          {   24,    6,   38 } },
+      { PimCmdEnum::ADD_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::SUB_SCALAR,   {    6,    6,   24 } },
+      { PimCmdEnum::MUL_SCALAR,   {   21,   21,   93 } },
+      { PimCmdEnum::DIV_SCALAR,   {   56,   46,  213 } },
+      { PimCmdEnum::AND_SCALAR,   {    6,    6,   18 } },
+      { PimCmdEnum::OR_SCALAR,    {    6,    6,    7 } },
+      { PimCmdEnum::XOR_SCALAR,   {    6,    6,   25 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    6,    6,   18 } },
+      { PimCmdEnum::MIN_SCALAR,   {   12,    6,   50 } },
+      { PimCmdEnum::MAX_SCALAR,   {   12,    6,   50 } },
+    }},
+    { { false, 7 }, {
+      { PimCmdEnum::ABS,          {    7,    7,    0 } },
+      { PimCmdEnum::ADD,          {   14,    7,   21 } },
+      { PimCmdEnum::SUB,          {   14,    7,   21 } },
+      { PimCmdEnum::MUL,          {   56,   28,   98 } },
+      { PimCmdEnum::DIV,          {  125,   61,  253 } },
+      { PimCmdEnum::AND,          {   14,    7,   14 } },
+      { PimCmdEnum::OR,           {   14,    7,   15 } },
+      { PimCmdEnum::XOR,          {   14,    7,   22 } },
+      { PimCmdEnum::XNOR,         {   14,    7,   14 } },
+      { PimCmdEnum::MIN,          {   28,    7,   44 } },
+      { PimCmdEnum::MAX,          {   28,    7,   44 } },
+      { PimCmdEnum::ADD_SCALAR,   {    7,    7,   28 } },
+      { PimCmdEnum::SUB_SCALAR,   {    7,    7,   28 } },
+      { PimCmdEnum::MUL_SCALAR,   {   28,   28,  125 } },
+      { PimCmdEnum::DIV_SCALAR,   {   76,   61,  282 } },
+      { PimCmdEnum::AND_SCALAR,   {    7,    7,   21 } },
+      { PimCmdEnum::OR_SCALAR,    {    7,    7,   10 } },
+      { PimCmdEnum::XOR_SCALAR,   {    7,    7,   27 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    7,    7,   21 } },
+      { PimCmdEnum::MIN_SCALAR,   {   14,    7,   55 } },
+      { PimCmdEnum::MAX_SCALAR,   {   14,    7,   55 } },
+    }},
+    { { false, 9 }, {
+      { PimCmdEnum::ABS,          {    9,    9,    0 } },
+      { PimCmdEnum::ADD,          {   18,    9,   27 } },
+      { PimCmdEnum::SUB,          {   18,    9,   27 } },
+      { PimCmdEnum::MUL,          {   90,   45,  162 } },
+      { PimCmdEnum::DIV,          {  206,   97,  415 } },
+      { PimCmdEnum::AND,          {   18,    9,   18 } },
+      { PimCmdEnum::OR,           {   18,    9,   19 } },
+      { PimCmdEnum::XOR,          {   18,    9,   28 } },
+      { PimCmdEnum::XNOR,         {   18,    9,   18 } },
+      { PimCmdEnum::MIN,          {   36,    9,   56 } },
+      { PimCmdEnum::MAX,          {   36,    9,   56 } },
+      { PimCmdEnum::ADD_SCALAR,   {    9,    9,   36 } },
+      { PimCmdEnum::SUB_SCALAR,   {    9,    9,   36 } },
+      { PimCmdEnum::MUL_SCALAR,   {   45,   45,  203 } },
+      { PimCmdEnum::DIV_SCALAR,   {  125,   97,  456 } },
+      { PimCmdEnum::AND_SCALAR,   {    9,    9,   27 } },
+      { PimCmdEnum::OR_SCALAR,    {    9,    9,   16 } },
+      { PimCmdEnum::XOR_SCALAR,   {    9,    9,   31 } },
+      { PimCmdEnum::XNOR_SCALAR,  {    9,    9,   27 } },
+      { PimCmdEnum::MIN_SCALAR,   {   18,    9,   65 } },
+      { PimCmdEnum::MAX_SCALAR,   {   18,    9,   65 } },
+    }},
+    { { false, 10 }, {
+      { PimCmdEnum::ABS,          {   10,   10,    0 } },
+      { PimCmdEnum::ADD,          {   20,   10,   30 } },
+      { PimCmdEnum::SUB,          {   20,   10,   30 } },
+      { PimCmdEnum::MUL,          {  110,   55,  200 } },
+      { PimCmdEnum::DIV,          {  254,  118,  511 } },
+      { PimCmdEnum::AND,          {   20,   10,   20 } },
+      { PimCmdEnum::OR,           {   20,   10,   21 } },
+      { PimCmdEnum::XOR,          {   20,   10,   31 } },
+      { PimCmdEnum::XNOR,         {   20,   10,   20 } },
+      { PimCmdEnum::MIN,          {   40,   10,   62 } },
+      { PimCmdEnum::MAX,          {   40,   10,   62 } },
+      { PimCmdEnum::ADD_SCALAR,   {   10,   10,   40 } },
+      { PimCmdEnum::SUB_SCALAR,   {   10,   10,   40 } },
+      { PimCmdEnum::MUL_SCALAR,   {   55,   55,  249 } },
+      { PimCmdEnum::DIV_SCALAR,   {  154,  118,  558 } },
+      { PimCmdEnum::AND_SCALAR,   {   10,   10,   30 } },
+      { PimCmdEnum::OR_SCALAR,    {   10,   10,   19 } },
+      { PimCmdEnum::XOR_SCALAR,   {   10,   10,   33 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   10,   10,   30 } },
+      { PimCmdEnum::MIN_SCALAR,   {   20,   10,   70 } },
+      { PimCmdEnum::MAX_SCALAR,   {   20,   10,   70 } },
+    }},
+    { { false, 11 }, {
+      { PimCmdEnum::ABS,          {   11,   11,    0 } },
+      { PimCmdEnum::ADD,          {   22,   11,   33 } },
+      { PimCmdEnum::SUB,          {   22,   11,   33 } },
+      { PimCmdEnum::MUL,          {  132,   66,  242 } },
+      { PimCmdEnum::DIV,          {  307,  141,  617 } },
+      { PimCmdEnum::AND,          {   22,   11,   22 } },
+      { PimCmdEnum::OR,           {   22,   11,   23 } },
+      { PimCmdEnum::XOR,          {   22,   11,   34 } },
+      { PimCmdEnum::XNOR,         {   22,   11,   22 } },
+      { PimCmdEnum::MIN,          {   44,   11,   68 } },
+      { PimCmdEnum::MAX,          {   44,   11,   68 } },
+      { PimCmdEnum::ADD_SCALAR,   {   11,   11,   44 } },
+      { PimCmdEnum::SUB_SCALAR,   {   11,   11,   44 } },
+      { PimCmdEnum::MUL_SCALAR,   {   66,   66,  300 } },
+      { PimCmdEnum::DIV_SCALAR,   {  186,  141,  670 } },
+      { PimCmdEnum::AND_SCALAR,   {   11,   11,   33 } },
+      { PimCmdEnum::OR_SCALAR,    {   11,   11,   22 } },
+      { PimCmdEnum::XOR_SCALAR,   {   11,   11,   35 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   11,   11,   33 } },
+      { PimCmdEnum::MIN_SCALAR,   {   22,   11,   75 } },
+      { PimCmdEnum::MAX_SCALAR,   {   22,   11,   75 } },
+    }},
+    { { false, 12 }, {
+      { PimCmdEnum::ABS,          {   12,   12,    0 } },
+      { PimCmdEnum::ADD,          {   24,   12,   36 } },
+      { PimCmdEnum::SUB,          {   24,   12,   36 } },
+      { PimCmdEnum::MUL,          {  156,   78,  288 } },
+      { PimCmdEnum::DIV,          {  365,  166,  733 } },
+      { PimCmdEnum::AND,          {   24,   12,   24 } },
+      { PimCmdEnum::OR,           {   24,   12,   25 } },
+      { PimCmdEnum::XOR,          {   24,   12,   37 } },
+      { PimCmdEnum::XNOR,         {   24,   12,   24 } },
+      { PimCmdEnum::MIN,          {   48,   12,   74 } },
+      { PimCmdEnum::MAX,          {   48,   12,   74 } },
+      { PimCmdEnum::ADD_SCALAR,   {   12,   12,   48 } },
+      { PimCmdEnum::SUB_SCALAR,   {   12,   12,   48 } },
+      { PimCmdEnum::MUL_SCALAR,   {   78,   78,  356 } },
+      { PimCmdEnum::DIV_SCALAR,   {  221,  166,  792 } },
+      { PimCmdEnum::AND_SCALAR,   {   12,   12,   36 } },
+      { PimCmdEnum::OR_SCALAR,    {   12,   12,   25 } },
+      { PimCmdEnum::XOR_SCALAR,   {   12,   12,   37 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   12,   12,   36 } },
+      { PimCmdEnum::MIN_SCALAR,   {   24,   12,   80 } },
+      { PimCmdEnum::MAX_SCALAR,   {   24,   12,   80 } },
+    }},
+    { { false, 13 }, {
+      { PimCmdEnum::ABS,          {   13,   13,    0 } },
+      { PimCmdEnum::ADD,          {   26,   13,   39 } },
+      { PimCmdEnum::SUB,          {   26,   13,   39 } },
+      { PimCmdEnum::MUL,          {  182,   91,  338 } },
+      { PimCmdEnum::DIV,          {  428,  193,  859 } },
+      { PimCmdEnum::AND,          {   26,   13,   26 } },
+      { PimCmdEnum::OR,           {   26,   13,   27 } },
+      { PimCmdEnum::XOR,          {   26,   13,   40 } },
+      { PimCmdEnum::XNOR,         {   26,   13,   26 } },
+      { PimCmdEnum::MIN,          {   52,   13,   80 } },
+      { PimCmdEnum::MAX,          {   52,   13,   80 } },
+      { PimCmdEnum::ADD_SCALAR,   {   13,   13,   52 } },
+      { PimCmdEnum::SUB_SCALAR,   {   13,   13,   52 } },
+      { PimCmdEnum::MUL_SCALAR,   {   91,   91,  417 } },
+      { PimCmdEnum::DIV_SCALAR,   {  259,  193,  924 } },
+      { PimCmdEnum::AND_SCALAR,   {   13,   13,   39 } },
+      { PimCmdEnum::OR_SCALAR,    {   13,   13,   28 } },
+      { PimCmdEnum::XOR_SCALAR,   {   13,   13,   39 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   13,   13,   39 } },
+      { PimCmdEnum::MIN_SCALAR,   {   26,   13,   85 } },
+      { PimCmdEnum::MAX_SCALAR,   {   26,   13,   85 } },
+    }},
+    { { false, 14 }, {
+      { PimCmdEnum::ABS,          {   14,   14,    0 } },
+      { PimCmdEnum::ADD,          {   28,   14,   42 } },
+      { PimCmdEnum::SUB,          {   28,   14,   42 } },
+      { PimCmdEnum::MUL,          {  210,  105,  392 } },
+      { PimCmdEnum::DIV,          {  496,  222,  995 } },
+      { PimCmdEnum::AND,          {   28,   14,   28 } },
+      { PimCmdEnum::OR,           {   28,   14,   29 } },
+      { PimCmdEnum::XOR,          {   28,   14,   43 } },
+      { PimCmdEnum::XNOR,         {   28,   14,   28 } },
+      { PimCmdEnum::MIN,          {   56,   14,   86 } },
+      { PimCmdEnum::MAX,          {   56,   14,   86 } },
+      { PimCmdEnum::ADD_SCALAR,   {   14,   14,   56 } },
+      { PimCmdEnum::SUB_SCALAR,   {   14,   14,   56 } },
+      { PimCmdEnum::MUL_SCALAR,   {  105,  105,  483 } },
+      { PimCmdEnum::DIV_SCALAR,   {  300,  222, 1066 } },
+      { PimCmdEnum::AND_SCALAR,   {   14,   14,   42 } },
+      { PimCmdEnum::OR_SCALAR,    {   14,   14,   31 } },
+      { PimCmdEnum::XOR_SCALAR,   {   14,   14,   41 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   14,   14,   42 } },
+      { PimCmdEnum::MIN_SCALAR,   {   28,   14,   90 } },
+      { PimCmdEnum::MAX_SCALAR,   {   28,   14,   90 } },
+    }},
+    { { false, 15 }, {
+      { PimCmdEnum::ABS,          {   15,   15,    0 } },
+      { PimCmdEnum::ADD,          {   30,   15,   45 } },
+      { PimCmdEnum::SUB,          {   30,   15,   45 } },
+      { PimCmdEnum::MUL,          {  240,  120,  450 } },
+      { PimCmdEnum::DIV,          {  569,  253, 1141 } },
+      { PimCmdEnum::AND,          {   30,   15,   30 } },
+      { PimCmdEnum::OR,           {   30,   15,   31 } },
+      { PimCmdEnum::XOR,          {   30,   15,   46 } },
+      { PimCmdEnum::XNOR,         {   30,   15,   30 } },
+      { PimCmdEnum::MIN,          {   60,   15,   92 } },
+      { PimCmdEnum::MAX,          {   60,   15,   92 } },
+      { PimCmdEnum::ADD_SCALAR,   {   15,   15,   60 } },
+      { PimCmdEnum::SUB_SCALAR,   {   15,   15,   60 } },
+      { PimCmdEnum::MUL_SCALAR,   {  120,  120,  554 } },
+      { PimCmdEnum::DIV_SCALAR,   {  344,  253, 1218 } },
+      { PimCmdEnum::AND_SCALAR,   {   15,   15,   45 } },
+      { PimCmdEnum::OR_SCALAR,    {   15,   15,   34 } },
+      { PimCmdEnum::XOR_SCALAR,   {   15,   15,   43 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   15,   15,   45 } },
+      { PimCmdEnum::MIN_SCALAR,   {   30,   15,   95 } },
+      { PimCmdEnum::MAX_SCALAR,   {   30,   15,   95 } },
+    }},
+    { { false, 17 }, {
+      { PimCmdEnum::ABS,          {   17,   17,    0 } },
+      { PimCmdEnum::ADD,          {   34,   17,   51 } },
+      { PimCmdEnum::SUB,          {   34,   17,   51 } },
+      { PimCmdEnum::MUL,          {  306,  153,  578 } },
+      { PimCmdEnum::DIV,          {  730,  321, 1463 } },
+      { PimCmdEnum::AND,          {   34,   17,   34 } },
+      { PimCmdEnum::OR,           {   34,   17,   35 } },
+      { PimCmdEnum::XOR,          {   34,   17,   52 } },
+      { PimCmdEnum::XNOR,         {   34,   17,   34 } },
+      { PimCmdEnum::MIN,          {   68,   17,  104 } },
+      { PimCmdEnum::MAX,          {   68,   17,  104 } },
+      { PimCmdEnum::ADD_SCALAR,   {   17,   17,   68 } },
+      { PimCmdEnum::SUB_SCALAR,   {   17,   17,   68 } },
+      { PimCmdEnum::MUL_SCALAR,   {  153,  153,  711 } },
+      { PimCmdEnum::DIV_SCALAR,   {  441,  321, 1552 } },
+      { PimCmdEnum::AND_SCALAR,   {   17,   17,   51 } },
+      { PimCmdEnum::OR_SCALAR,    {   17,   17,   40 } },
+      { PimCmdEnum::XOR_SCALAR,   {   17,   17,   47 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   17,   17,   51 } },
+      { PimCmdEnum::MIN_SCALAR,   {   34,   17,  105 } },
+      { PimCmdEnum::MAX_SCALAR,   {   34,   17,  105 } },
+    }},
+    { { false, 18 }, {
+      { PimCmdEnum::ABS,          {   18,   18,    0 } },
+      { PimCmdEnum::ADD,          {   36,   18,   54 } },
+      { PimCmdEnum::SUB,          {   36,   18,   54 } },
+      { PimCmdEnum::MUL,          {  342,  171,  648 } },
+      { PimCmdEnum::DIV,          {  818,  358, 1639 } },
+      { PimCmdEnum::AND,          {   36,   18,   36 } },
+      { PimCmdEnum::OR,           {   36,   18,   37 } },
+      { PimCmdEnum::XOR,          {   36,   18,   55 } },
+      { PimCmdEnum::XNOR,         {   36,   18,   36 } },
+      { PimCmdEnum::MIN,          {   72,   18,  110 } },
+      { PimCmdEnum::MAX,          {   72,   18,  110 } },
+      { PimCmdEnum::ADD_SCALAR,   {   18,   18,   72 } },
+      { PimCmdEnum::SUB_SCALAR,   {   18,   18,   72 } },
+      { PimCmdEnum::MUL_SCALAR,   {  171,  171,  797 } },
+      { PimCmdEnum::DIV_SCALAR,   {  494,  358, 1734 } },
+      { PimCmdEnum::AND_SCALAR,   {   18,   18,   54 } },
+      { PimCmdEnum::OR_SCALAR,    {   18,   18,   43 } },
+      { PimCmdEnum::XOR_SCALAR,   {   18,   18,   49 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   18,   18,   54 } },
+      { PimCmdEnum::MIN_SCALAR,   {   36,   18,  110 } },
+      { PimCmdEnum::MAX_SCALAR,   {   36,   18,  110 } },
+    }},
+    { { false, 19 }, {
+      { PimCmdEnum::ABS,          {   19,   19,    0 } },
+      { PimCmdEnum::ADD,          {   38,   19,   57 } },
+      { PimCmdEnum::SUB,          {   38,   19,   57 } },
+      { PimCmdEnum::MUL,          {  380,  190,  722 } },
+      { PimCmdEnum::DIV,          {  911,  397, 1825 } },
+      { PimCmdEnum::AND,          {   38,   19,   38 } },
+      { PimCmdEnum::OR,           {   38,   19,   39 } },
+      { PimCmdEnum::XOR,          {   38,   19,   58 } },
+      { PimCmdEnum::XNOR,         {   38,   19,   38 } },
+      { PimCmdEnum::MIN,          {   76,   19,  116 } },
+      { PimCmdEnum::MAX,          {   76,   19,  116 } },
+      { PimCmdEnum::ADD_SCALAR,   {   19,   19,   76 } },
+      { PimCmdEnum::SUB_SCALAR,   {   19,   19,   76 } },
+      { PimCmdEnum::MUL_SCALAR,   {  190,  190,  888 } },
+      { PimCmdEnum::DIV_SCALAR,   {  550,  397, 1926 } },
+      { PimCmdEnum::AND_SCALAR,   {   19,   19,   57 } },
+      { PimCmdEnum::OR_SCALAR,    {   19,   19,   46 } },
+      { PimCmdEnum::XOR_SCALAR,   {   19,   19,   51 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   19,   19,   57 } },
+      { PimCmdEnum::MIN_SCALAR,   {   38,   19,  115 } },
+      { PimCmdEnum::MAX_SCALAR,   {   38,   19,  115 } },
+    }},
+    { { false, 20 }, {
+      { PimCmdEnum::ABS,          {   20,   20,    0 } },
+      { PimCmdEnum::ADD,          {   40,   20,   60 } },
+      { PimCmdEnum::SUB,          {   40,   20,   60 } },
+      { PimCmdEnum::MUL,          {  420,  210,  800 } },
+      { PimCmdEnum::DIV,          { 1009,  438, 2021 } },
+      { PimCmdEnum::AND,          {   40,   20,   40 } },
+      { PimCmdEnum::OR,           {   40,   20,   41 } },
+      { PimCmdEnum::XOR,          {   40,   20,   61 } },
+      { PimCmdEnum::XNOR,         {   40,   20,   40 } },
+      { PimCmdEnum::MIN,          {   80,   20,  122 } },
+      { PimCmdEnum::MAX,          {   80,   20,  122 } },
+      { PimCmdEnum::ADD_SCALAR,   {   20,   20,   80 } },
+      { PimCmdEnum::SUB_SCALAR,   {   20,   20,   80 } },
+      { PimCmdEnum::MUL_SCALAR,   {  210,  210,  984 } },
+      { PimCmdEnum::DIV_SCALAR,   {  609,  438, 2128 } },
+      { PimCmdEnum::AND_SCALAR,   {   20,   20,   60 } },
+      { PimCmdEnum::OR_SCALAR,    {   20,   20,   49 } },
+      { PimCmdEnum::XOR_SCALAR,   {   20,   20,   53 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   20,   20,   60 } },
+      { PimCmdEnum::MIN_SCALAR,   {   40,   20,  120 } },
+      { PimCmdEnum::MAX_SCALAR,   {   40,   20,  120 } },
+    }},
+    { { false, 21 }, {
+      { PimCmdEnum::ABS,          {   21,   21,    0 } },
+      { PimCmdEnum::ADD,          {   42,   21,   63 } },
+      { PimCmdEnum::SUB,          {   42,   21,   63 } },
+      { PimCmdEnum::MUL,          {  462,  231,  882 } },
+      { PimCmdEnum::DIV,          { 1112,  481, 2227 } },
+      { PimCmdEnum::AND,          {   42,   21,   42 } },
+      { PimCmdEnum::OR,           {   42,   21,   43 } },
+      { PimCmdEnum::XOR,          {   42,   21,   64 } },
+      { PimCmdEnum::XNOR,         {   42,   21,   42 } },
+      { PimCmdEnum::MIN,          {   84,   21,  128 } },
+      { PimCmdEnum::MAX,          {   84,   21,  128 } },
+      { PimCmdEnum::ADD_SCALAR,   {   21,   21,   84 } },
+      { PimCmdEnum::SUB_SCALAR,   {   21,   21,   84 } },
+      { PimCmdEnum::MUL_SCALAR,   {  231,  231, 1085 } },
+      { PimCmdEnum::DIV_SCALAR,   {  671,  481, 2340 } },
+      { PimCmdEnum::AND_SCALAR,   {   21,   21,   63 } },
+      { PimCmdEnum::OR_SCALAR,    {   21,   21,   52 } },
+      { PimCmdEnum::XOR_SCALAR,   {   21,   21,   55 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   21,   21,   63 } },
+      { PimCmdEnum::MIN_SCALAR,   {   42,   21,  125 } },
+      { PimCmdEnum::MAX_SCALAR,   {   42,   21,  125 } },
+    }},
+    { { false, 22 }, {
+      { PimCmdEnum::ABS,          {   22,   22,    0 } },
+      { PimCmdEnum::ADD,          {   44,   22,   66 } },
+      { PimCmdEnum::SUB,          {   44,   22,   66 } },
+      { PimCmdEnum::MUL,          {  506,  253,  968 } },
+      { PimCmdEnum::DIV,          { 1220,  526, 2443 } },
+      { PimCmdEnum::AND,          {   44,   22,   44 } },
+      { PimCmdEnum::OR,           {   44,   22,   45 } },
+      { PimCmdEnum::XOR,          {   44,   22,   67 } },
+      { PimCmdEnum::XNOR,         {   44,   22,   44 } },
+      { PimCmdEnum::MIN,          {   88,   22,  134 } },
+      { PimCmdEnum::MAX,          {   88,   22,  134 } },
+      { PimCmdEnum::ADD_SCALAR,   {   22,   22,   88 } },
+      { PimCmdEnum::SUB_SCALAR,   {   22,   22,   88 } },
+      { PimCmdEnum::MUL_SCALAR,   {  253,  253, 1191 } },
+      { PimCmdEnum::DIV_SCALAR,   {  736,  526, 2562 } },
+      { PimCmdEnum::AND_SCALAR,   {   22,   22,   66 } },
+      { PimCmdEnum::OR_SCALAR,    {   22,   22,   55 } },
+      { PimCmdEnum::XOR_SCALAR,   {   22,   22,   57 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   22,   22,   66 } },
+      { PimCmdEnum::MIN_SCALAR,   {   44,   22,  130 } },
+      { PimCmdEnum::MAX_SCALAR,   {   44,   22,  130 } },
+    }},
+    { { false, 23 }, {
+      { PimCmdEnum::ABS,          {   23,   23,    0 } },
+      { PimCmdEnum::ADD,          {   46,   23,   69 } },
+      { PimCmdEnum::SUB,          {   46,   23,   69 } },
+      { PimCmdEnum::MUL,          {  552,  276, 1058 } },
+      { PimCmdEnum::DIV,          { 1333,  573, 2669 } },
+      { PimCmdEnum::AND,          {   46,   23,   46 } },
+      { PimCmdEnum::OR,           {   46,   23,   47 } },
+      { PimCmdEnum::XOR,          {   46,   23,   70 } },
+      { PimCmdEnum::XNOR,         {   46,   23,   46 } },
+      { PimCmdEnum::MIN,          {   92,   23,  140 } },
+      { PimCmdEnum::MAX,          {   92,   23,  140 } },
+      { PimCmdEnum::ADD_SCALAR,   {   23,   23,   92 } },
+      { PimCmdEnum::SUB_SCALAR,   {   23,   23,   92 } },
+      { PimCmdEnum::MUL_SCALAR,   {  276,  276, 1302 } },
+      { PimCmdEnum::DIV_SCALAR,   {  804,  573, 2794 } },
+      { PimCmdEnum::AND_SCALAR,   {   23,   23,   69 } },
+      { PimCmdEnum::OR_SCALAR,    {   23,   23,   58 } },
+      { PimCmdEnum::XOR_SCALAR,   {   23,   23,   59 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   23,   23,   69 } },
+      { PimCmdEnum::MIN_SCALAR,   {   46,   23,  135 } },
+      { PimCmdEnum::MAX_SCALAR,   {   46,   23,  135 } },
+    }},
+    { { false, 24 }, {
+      { PimCmdEnum::ABS,          {   24,   24,    0 } },
+      { PimCmdEnum::ADD,          {   48,   24,   72 } },
+      { PimCmdEnum::SUB,          {   48,   24,   72 } },
+      { PimCmdEnum::MUL,          {  600,  300, 1152 } },
+      { PimCmdEnum::DIV,          { 1451,  622, 2905 } },
+      { PimCmdEnum::AND,          {   48,   24,   48 } },
+      { PimCmdEnum::OR,           {   48,   24,   49 } },
+      { PimCmdEnum::XOR,          {   48,   24,   73 } },
+      { PimCmdEnum::XNOR,         {   48,   24,   48 } },
+      { PimCmdEnum::MIN,          {   96,   24,  146 } },
+      { PimCmdEnum::MAX,          {   96,   24,  146 } },
+      { PimCmdEnum::ADD_SCALAR,   {   24,   24,   96 } },
+      { PimCmdEnum::SUB_SCALAR,   {   24,   24,   96 } },
+      { PimCmdEnum::MUL_SCALAR,   {  300,  300, 1418 } },
+      { PimCmdEnum::DIV_SCALAR,   {  875,  622, 3036 } },
+      { PimCmdEnum::AND_SCALAR,   {   24,   24,   72 } },
+      { PimCmdEnum::OR_SCALAR,    {   24,   24,   61 } },
+      { PimCmdEnum::XOR_SCALAR,   {   24,   24,   61 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   24,   24,   72 } },
+      { PimCmdEnum::MIN_SCALAR,   {   48,   24,  140 } },
+      { PimCmdEnum::MAX_SCALAR,   {   48,   24,  140 } },
+    }},
+    { { false, 25 }, {
+      { PimCmdEnum::ABS,          {   25,   25,    0 } },
+      { PimCmdEnum::ADD,          {   50,   25,   75 } },
+      { PimCmdEnum::SUB,          {   50,   25,   75 } },
+      { PimCmdEnum::MUL,          {  650,  325, 1250 } },
+      { PimCmdEnum::DIV,          { 1574,  673, 3151 } },
+      { PimCmdEnum::AND,          {   50,   25,   50 } },
+      { PimCmdEnum::OR,           {   50,   25,   51 } },
+      { PimCmdEnum::XOR,          {   50,   25,   76 } },
+      { PimCmdEnum::XNOR,         {   50,   25,   50 } },
+      { PimCmdEnum::MIN,          {  100,   25,  152 } },
+      { PimCmdEnum::MAX,          {  100,   25,  152 } },
+      { PimCmdEnum::ADD_SCALAR,   {   25,   25,  100 } },
+      { PimCmdEnum::SUB_SCALAR,   {   25,   25,  100 } },
+      { PimCmdEnum::MUL_SCALAR,   {  325,  325, 1539 } },
+      { PimCmdEnum::DIV_SCALAR,   {  949,  673, 3288 } },
+      { PimCmdEnum::AND_SCALAR,   {   25,   25,   75 } },
+      { PimCmdEnum::OR_SCALAR,    {   25,   25,   64 } },
+      { PimCmdEnum::XOR_SCALAR,   {   25,   25,   63 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   25,   25,   75 } },
+      { PimCmdEnum::MIN_SCALAR,   {   50,   25,  145 } },
+      { PimCmdEnum::MAX_SCALAR,   {   50,   25,  145 } },
+    }},
+    { { false, 26 }, {
+      { PimCmdEnum::ABS,          {   26,   26,    0 } },
+      { PimCmdEnum::ADD,          {   52,   26,   78 } },
+      { PimCmdEnum::SUB,          {   52,   26,   78 } },
+      { PimCmdEnum::MUL,          {  702,  351, 1352 } },
+      { PimCmdEnum::DIV,          { 1702,  726, 3407 } },
+      { PimCmdEnum::AND,          {   52,   26,   52 } },
+      { PimCmdEnum::OR,           {   52,   26,   53 } },
+      { PimCmdEnum::XOR,          {   52,   26,   79 } },
+      { PimCmdEnum::XNOR,         {   52,   26,   52 } },
+      { PimCmdEnum::MIN,          {  104,   26,  158 } },
+      { PimCmdEnum::MAX,          {  104,   26,  158 } },
+      { PimCmdEnum::ADD_SCALAR,   {   26,   26,  104 } },
+      { PimCmdEnum::SUB_SCALAR,   {   26,   26,  104 } },
+      { PimCmdEnum::MUL_SCALAR,   {  351,  351, 1665 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1026,  726, 3550 } },
+      { PimCmdEnum::AND_SCALAR,   {   26,   26,   78 } },
+      { PimCmdEnum::OR_SCALAR,    {   26,   26,   67 } },
+      { PimCmdEnum::XOR_SCALAR,   {   26,   26,   65 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   26,   26,   78 } },
+      { PimCmdEnum::MIN_SCALAR,   {   52,   26,  150 } },
+      { PimCmdEnum::MAX_SCALAR,   {   52,   26,  150 } },
+    }},
+    { { false, 27 }, {
+      { PimCmdEnum::ABS,          {   27,   27,    0 } },
+      { PimCmdEnum::ADD,          {   54,   27,   81 } },
+      { PimCmdEnum::SUB,          {   54,   27,   81 } },
+      { PimCmdEnum::MUL,          {  756,  378, 1458 } },
+      { PimCmdEnum::DIV,          { 1835,  781, 3673 } },
+      { PimCmdEnum::AND,          {   54,   27,   54 } },
+      { PimCmdEnum::OR,           {   54,   27,   55 } },
+      { PimCmdEnum::XOR,          {   54,   27,   82 } },
+      { PimCmdEnum::XNOR,         {   54,   27,   54 } },
+      { PimCmdEnum::MIN,          {  108,   27,  164 } },
+      { PimCmdEnum::MAX,          {  108,   27,  164 } },
+      { PimCmdEnum::ADD_SCALAR,   {   27,   27,  108 } },
+      { PimCmdEnum::SUB_SCALAR,   {   27,   27,  108 } },
+      { PimCmdEnum::MUL_SCALAR,   {  378,  378, 1796 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1106,  781, 3822 } },
+      { PimCmdEnum::AND_SCALAR,   {   27,   27,   81 } },
+      { PimCmdEnum::OR_SCALAR,    {   27,   27,   70 } },
+      { PimCmdEnum::XOR_SCALAR,   {   27,   27,   67 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   27,   27,   81 } },
+      { PimCmdEnum::MIN_SCALAR,   {   54,   27,  155 } },
+      { PimCmdEnum::MAX_SCALAR,   {   54,   27,  155 } },
+    }},
+    { { false, 28 }, {
+      { PimCmdEnum::ABS,          {   28,   28,    0 } },
+      { PimCmdEnum::ADD,          {   56,   28,   84 } },
+      { PimCmdEnum::SUB,          {   56,   28,   84 } },
+      { PimCmdEnum::MUL,          {  812,  406, 1568 } },
+      { PimCmdEnum::DIV,          { 1973,  838, 3949 } },
+      { PimCmdEnum::AND,          {   56,   28,   56 } },
+      { PimCmdEnum::OR,           {   56,   28,   57 } },
+      { PimCmdEnum::XOR,          {   56,   28,   85 } },
+      { PimCmdEnum::XNOR,         {   56,   28,   56 } },
+      { PimCmdEnum::MIN,          {  112,   28,  170 } },
+      { PimCmdEnum::MAX,          {  112,   28,  170 } },
+      { PimCmdEnum::ADD_SCALAR,   {   28,   28,  112 } },
+      { PimCmdEnum::SUB_SCALAR,   {   28,   28,  112 } },
+      { PimCmdEnum::MUL_SCALAR,   {  406,  406, 1932 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1189,  838, 4104 } },
+      { PimCmdEnum::AND_SCALAR,   {   28,   28,   84 } },
+      { PimCmdEnum::OR_SCALAR,    {   28,   28,   73 } },
+      { PimCmdEnum::XOR_SCALAR,   {   28,   28,   69 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   28,   28,   84 } },
+      { PimCmdEnum::MIN_SCALAR,   {   56,   28,  160 } },
+      { PimCmdEnum::MAX_SCALAR,   {   56,   28,  160 } },
+    }},
+    { { false, 29 }, {
+      { PimCmdEnum::ABS,          {   29,   29,    0 } },
+      { PimCmdEnum::ADD,          {   58,   29,   87 } },
+      { PimCmdEnum::SUB,          {   58,   29,   87 } },
+      { PimCmdEnum::MUL,          {  870,  435, 1682 } },
+      { PimCmdEnum::DIV,          { 2116,  897, 4235 } },
+      { PimCmdEnum::AND,          {   58,   29,   58 } },
+      { PimCmdEnum::OR,           {   58,   29,   59 } },
+      { PimCmdEnum::XOR,          {   58,   29,   88 } },
+      { PimCmdEnum::XNOR,         {   58,   29,   58 } },
+      { PimCmdEnum::MIN,          {  116,   29,  176 } },
+      { PimCmdEnum::MAX,          {  116,   29,  176 } },
+      { PimCmdEnum::ADD_SCALAR,   {   29,   29,  116 } },
+      { PimCmdEnum::SUB_SCALAR,   {   29,   29,  116 } },
+      { PimCmdEnum::MUL_SCALAR,   {  435,  435, 2073 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1275,  897, 4396 } },
+      { PimCmdEnum::AND_SCALAR,   {   29,   29,   87 } },
+      { PimCmdEnum::OR_SCALAR,    {   29,   29,   76 } },
+      { PimCmdEnum::XOR_SCALAR,   {   29,   29,   71 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   29,   29,   87 } },
+      { PimCmdEnum::MIN_SCALAR,   {   58,   29,  165 } },
+      { PimCmdEnum::MAX_SCALAR,   {   58,   29,  165 } },
+    }},
+    { { false, 30 }, {
+      { PimCmdEnum::ABS,          {   30,   30,    0 } },
+      { PimCmdEnum::ADD,          {   60,   30,   90 } },
+      { PimCmdEnum::SUB,          {   60,   30,   90 } },
+      { PimCmdEnum::MUL,          {  930,  465, 1800 } },
+      { PimCmdEnum::DIV,          { 2264,  958, 4531 } },
+      { PimCmdEnum::AND,          {   60,   30,   60 } },
+      { PimCmdEnum::OR,           {   60,   30,   61 } },
+      { PimCmdEnum::XOR,          {   60,   30,   91 } },
+      { PimCmdEnum::XNOR,         {   60,   30,   60 } },
+      { PimCmdEnum::MIN,          {  120,   30,  182 } },
+      { PimCmdEnum::MAX,          {  120,   30,  182 } },
+      { PimCmdEnum::ADD_SCALAR,   {   30,   30,  120 } },
+      { PimCmdEnum::SUB_SCALAR,   {   30,   30,  120 } },
+      { PimCmdEnum::MUL_SCALAR,   {  465,  465, 2219 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1364,  958, 4698 } },
+      { PimCmdEnum::AND_SCALAR,   {   30,   30,   90 } },
+      { PimCmdEnum::OR_SCALAR,    {   30,   30,   79 } },
+      { PimCmdEnum::XOR_SCALAR,   {   30,   30,   73 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   30,   30,   90 } },
+      { PimCmdEnum::MIN_SCALAR,   {   60,   30,  170 } },
+      { PimCmdEnum::MAX_SCALAR,   {   60,   30,  170 } },
+    }},
+    { { false, 31 }, {
+      { PimCmdEnum::ABS,          {   31,   31,    0 } },
+      { PimCmdEnum::ADD,          {   62,   31,   93 } },
+      { PimCmdEnum::SUB,          {   62,   31,   93 } },
+      { PimCmdEnum::MUL,          {  992,  496, 1922 } },
+      { PimCmdEnum::DIV,          { 2417, 1021, 4837 } },
+      { PimCmdEnum::AND,          {   62,   31,   62 } },
+      { PimCmdEnum::OR,           {   62,   31,   63 } },
+      { PimCmdEnum::XOR,          {   62,   31,   94 } },
+      { PimCmdEnum::XNOR,         {   62,   31,   62 } },
+      { PimCmdEnum::MIN,          {  124,   31,  188 } },
+      { PimCmdEnum::MAX,          {  124,   31,  188 } },
+      { PimCmdEnum::ADD_SCALAR,   {   31,   31,  124 } },
+      { PimCmdEnum::SUB_SCALAR,   {   31,   31,  124 } },
+      { PimCmdEnum::MUL_SCALAR,   {  496,  496, 2370 } },
+      { PimCmdEnum::DIV_SCALAR,   { 1456, 1021, 5010 } },
+      { PimCmdEnum::AND_SCALAR,   {   31,   31,   93 } },
+      { PimCmdEnum::OR_SCALAR,    {   31,   31,   82 } },
+      { PimCmdEnum::XOR_SCALAR,   {   31,   31,   75 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   31,   31,   93 } },
+      { PimCmdEnum::MIN_SCALAR,   {   62,   31,  175 } },
+      { PimCmdEnum::MAX_SCALAR,   {   62,   31,  175 } },
+    }},
+    { { false, 33 }, {
+      { PimCmdEnum::ABS,          {   33,   33,    0 } },
+      { PimCmdEnum::ADD,          {   66,   33,   99 } },
+      { PimCmdEnum::SUB,          {   66,   33,   99 } },
+      { PimCmdEnum::AND,          {   66,   33,   66 } },
+      { PimCmdEnum::OR,           {   66,   33,   67 } },
+      { PimCmdEnum::XOR,          {   66,   33,  100 } },
+      { PimCmdEnum::XNOR,         {   66,   33,   66 } },
+      { PimCmdEnum::MIN,          {  132,   33,  200 } },
+      { PimCmdEnum::MAX,          {  132,   33,  200 } },
+      { PimCmdEnum::ADD_SCALAR,   {   33,   33,  132 } },
+      { PimCmdEnum::SUB_SCALAR,   {   33,   33,  132 } },
+      { PimCmdEnum::AND_SCALAR,   {   33,   33,   99 } },
+      { PimCmdEnum::OR_SCALAR,    {   33,   33,   88 } },
+      { PimCmdEnum::XOR_SCALAR,   {   33,   33,   79 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   33,   33,   99 } },
+      { PimCmdEnum::MIN_SCALAR,   {   66,   33,  185 } },
+      { PimCmdEnum::MAX_SCALAR,   {   66,   33,  185 } },
+    }},
+    { { false, 34 }, {
+      { PimCmdEnum::ABS,          {   34,   34,    0 } },
+      { PimCmdEnum::ADD,          {   68,   34,  102 } },
+      { PimCmdEnum::SUB,          {   68,   34,  102 } },
+      { PimCmdEnum::AND,          {   68,   34,   68 } },
+      { PimCmdEnum::OR,           {   68,   34,   69 } },
+      { PimCmdEnum::XOR,          {   68,   34,  103 } },
+      { PimCmdEnum::XNOR,         {   68,   34,   68 } },
+      { PimCmdEnum::MIN,          {  136,   34,  206 } },
+      { PimCmdEnum::MAX,          {  136,   34,  206 } },
+      { PimCmdEnum::ADD_SCALAR,   {   34,   34,  136 } },
+      { PimCmdEnum::SUB_SCALAR,   {   34,   34,  136 } },
+      { PimCmdEnum::AND_SCALAR,   {   34,   34,  102 } },
+      { PimCmdEnum::OR_SCALAR,    {   34,   34,   91 } },
+      { PimCmdEnum::XOR_SCALAR,   {   34,   34,   81 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   34,   34,  102 } },
+      { PimCmdEnum::MIN_SCALAR,   {   68,   34,  190 } },
+      { PimCmdEnum::MAX_SCALAR,   {   68,   34,  190 } },
+    }},
+    { { false, 35 }, {
+      { PimCmdEnum::ABS,          {   35,   35,    0 } },
+      { PimCmdEnum::ADD,          {   70,   35,  105 } },
+      { PimCmdEnum::SUB,          {   70,   35,  105 } },
+      { PimCmdEnum::AND,          {   70,   35,   70 } },
+      { PimCmdEnum::OR,           {   70,   35,   71 } },
+      { PimCmdEnum::XOR,          {   70,   35,  106 } },
+      { PimCmdEnum::XNOR,         {   70,   35,   70 } },
+      { PimCmdEnum::MIN,          {  140,   35,  212 } },
+      { PimCmdEnum::MAX,          {  140,   35,  212 } },
+      { PimCmdEnum::ADD_SCALAR,   {   35,   35,  140 } },
+      { PimCmdEnum::SUB_SCALAR,   {   35,   35,  140 } },
+      { PimCmdEnum::AND_SCALAR,   {   35,   35,  105 } },
+      { PimCmdEnum::OR_SCALAR,    {   35,   35,   94 } },
+      { PimCmdEnum::XOR_SCALAR,   {   35,   35,   83 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   35,   35,  105 } },
+      { PimCmdEnum::MIN_SCALAR,   {   70,   35,  195 } },
+      { PimCmdEnum::MAX_SCALAR,   {   70,   35,  195 } },
+    }},
+    { { false, 36 }, {
+      { PimCmdEnum::ABS,          {   36,   36,    0 } },
+      { PimCmdEnum::ADD,          {   72,   36,  108 } },
+      { PimCmdEnum::SUB,          {   72,   36,  108 } },
+      { PimCmdEnum::AND,          {   72,   36,   72 } },
+      { PimCmdEnum::OR,           {   72,   36,   73 } },
+      { PimCmdEnum::XOR,          {   72,   36,  109 } },
+      { PimCmdEnum::XNOR,         {   72,   36,   72 } },
+      { PimCmdEnum::MIN,          {  144,   36,  218 } },
+      { PimCmdEnum::MAX,          {  144,   36,  218 } },
+      { PimCmdEnum::ADD_SCALAR,   {   36,   36,  144 } },
+      { PimCmdEnum::SUB_SCALAR,   {   36,   36,  144 } },
+      { PimCmdEnum::AND_SCALAR,   {   36,   36,  108 } },
+      { PimCmdEnum::OR_SCALAR,    {   36,   36,   97 } },
+      { PimCmdEnum::XOR_SCALAR,   {   36,   36,   85 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   36,   36,  108 } },
+      { PimCmdEnum::MIN_SCALAR,   {   72,   36,  200 } },
+      { PimCmdEnum::MAX_SCALAR,   {   72,   36,  200 } },
+    }},
+    { { false, 37 }, {
+      { PimCmdEnum::ABS,          {   37,   37,    0 } },
+      { PimCmdEnum::ADD,          {   74,   37,  111 } },
+      { PimCmdEnum::SUB,          {   74,   37,  111 } },
+      { PimCmdEnum::AND,          {   74,   37,   74 } },
+      { PimCmdEnum::OR,           {   74,   37,   75 } },
+      { PimCmdEnum::XOR,          {   74,   37,  112 } },
+      { PimCmdEnum::XNOR,         {   74,   37,   74 } },
+      { PimCmdEnum::MIN,          {  148,   37,  224 } },
+      { PimCmdEnum::MAX,          {  148,   37,  224 } },
+      { PimCmdEnum::ADD_SCALAR,   {   37,   37,  148 } },
+      { PimCmdEnum::SUB_SCALAR,   {   37,   37,  148 } },
+      { PimCmdEnum::AND_SCALAR,   {   37,   37,  111 } },
+      { PimCmdEnum::OR_SCALAR,    {   37,   37,  100 } },
+      { PimCmdEnum::XOR_SCALAR,   {   37,   37,   87 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   37,   37,  111 } },
+      { PimCmdEnum::MIN_SCALAR,   {   74,   37,  205 } },
+      { PimCmdEnum::MAX_SCALAR,   {   74,   37,  205 } },
+    }},
+    { { false, 38 }, {
+      { PimCmdEnum::ABS,          {   38,   38,    0 } },
+      { PimCmdEnum::ADD,          {   76,   38,  114 } },
+      { PimCmdEnum::SUB,          {   76,   38,  114 } },
+      { PimCmdEnum::AND,          {   76,   38,   76 } },
+      { PimCmdEnum::OR,           {   76,   38,   77 } },
+      { PimCmdEnum::XOR,          {   76,   38,  115 } },
+      { PimCmdEnum::XNOR,         {   76,   38,   76 } },
+      { PimCmdEnum::MIN,          {  152,   38,  230 } },
+      { PimCmdEnum::MAX,          {  152,   38,  230 } },
+      { PimCmdEnum::ADD_SCALAR,   {   38,   38,  152 } },
+      { PimCmdEnum::SUB_SCALAR,   {   38,   38,  152 } },
+      { PimCmdEnum::AND_SCALAR,   {   38,   38,  114 } },
+      { PimCmdEnum::OR_SCALAR,    {   38,   38,  103 } },
+      { PimCmdEnum::XOR_SCALAR,   {   38,   38,   89 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   38,   38,  114 } },
+      { PimCmdEnum::MIN_SCALAR,   {   76,   38,  210 } },
+      { PimCmdEnum::MAX_SCALAR,   {   76,   38,  210 } },
+    }},
+    { { false, 39 }, {
+      { PimCmdEnum::ABS,          {   39,   39,    0 } },
+      { PimCmdEnum::ADD,          {   78,   39,  117 } },
+      { PimCmdEnum::SUB,          {   78,   39,  117 } },
+      { PimCmdEnum::AND,          {   78,   39,   78 } },
+      { PimCmdEnum::OR,           {   78,   39,   79 } },
+      { PimCmdEnum::XOR,          {   78,   39,  118 } },
+      { PimCmdEnum::XNOR,         {   78,   39,   78 } },
+      { PimCmdEnum::MIN,          {  156,   39,  236 } },
+      { PimCmdEnum::MAX,          {  156,   39,  236 } },
+      { PimCmdEnum::ADD_SCALAR,   {   39,   39,  156 } },
+      { PimCmdEnum::SUB_SCALAR,   {   39,   39,  156 } },
+      { PimCmdEnum::AND_SCALAR,   {   39,   39,  117 } },
+      { PimCmdEnum::OR_SCALAR,    {   39,   39,  106 } },
+      { PimCmdEnum::XOR_SCALAR,   {   39,   39,   91 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   39,   39,  117 } },
+      { PimCmdEnum::MIN_SCALAR,   {   78,   39,  215 } },
+      { PimCmdEnum::MAX_SCALAR,   {   78,   39,  215 } },
+    }},
+    { { false, 40 }, {
+      { PimCmdEnum::ABS,          {   40,   40,    0 } },
+      { PimCmdEnum::ADD,          {   80,   40,  120 } },
+      { PimCmdEnum::SUB,          {   80,   40,  120 } },
+      { PimCmdEnum::AND,          {   80,   40,   80 } },
+      { PimCmdEnum::OR,           {   80,   40,   81 } },
+      { PimCmdEnum::XOR,          {   80,   40,  121 } },
+      { PimCmdEnum::XNOR,         {   80,   40,   80 } },
+      { PimCmdEnum::MIN,          {  160,   40,  242 } },
+      { PimCmdEnum::MAX,          {  160,   40,  242 } },
+      { PimCmdEnum::ADD_SCALAR,   {   40,   40,  160 } },
+      { PimCmdEnum::SUB_SCALAR,   {   40,   40,  160 } },
+      { PimCmdEnum::AND_SCALAR,   {   40,   40,  120 } },
+      { PimCmdEnum::OR_SCALAR,    {   40,   40,  109 } },
+      { PimCmdEnum::XOR_SCALAR,   {   40,   40,   93 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   40,   40,  120 } },
+      { PimCmdEnum::MIN_SCALAR,   {   80,   40,  220 } },
+      { PimCmdEnum::MAX_SCALAR,   {   80,   40,  220 } },
+    }},
+    { { false, 41 }, {
+      { PimCmdEnum::ABS,          {   41,   41,    0 } },
+      { PimCmdEnum::ADD,          {   82,   41,  123 } },
+      { PimCmdEnum::SUB,          {   82,   41,  123 } },
+      { PimCmdEnum::AND,          {   82,   41,   82 } },
+      { PimCmdEnum::OR,           {   82,   41,   83 } },
+      { PimCmdEnum::XOR,          {   82,   41,  124 } },
+      { PimCmdEnum::XNOR,         {   82,   41,   82 } },
+      { PimCmdEnum::MIN,          {  164,   41,  248 } },
+      { PimCmdEnum::MAX,          {  164,   41,  248 } },
+      { PimCmdEnum::ADD_SCALAR,   {   41,   41,  164 } },
+      { PimCmdEnum::SUB_SCALAR,   {   41,   41,  164 } },
+      { PimCmdEnum::AND_SCALAR,   {   41,   41,  123 } },
+      { PimCmdEnum::OR_SCALAR,    {   41,   41,  112 } },
+      { PimCmdEnum::XOR_SCALAR,   {   41,   41,   95 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   41,   41,  123 } },
+      { PimCmdEnum::MIN_SCALAR,   {   82,   41,  225 } },
+      { PimCmdEnum::MAX_SCALAR,   {   82,   41,  225 } },
+    }},
+    { { false, 42 }, {
+      { PimCmdEnum::ABS,          {   42,   42,    0 } },
+      { PimCmdEnum::ADD,          {   84,   42,  126 } },
+      { PimCmdEnum::SUB,          {   84,   42,  126 } },
+      { PimCmdEnum::AND,          {   84,   42,   84 } },
+      { PimCmdEnum::OR,           {   84,   42,   85 } },
+      { PimCmdEnum::XOR,          {   84,   42,  127 } },
+      { PimCmdEnum::XNOR,         {   84,   42,   84 } },
+      { PimCmdEnum::MIN,          {  168,   42,  254 } },
+      { PimCmdEnum::MAX,          {  168,   42,  254 } },
+      { PimCmdEnum::ADD_SCALAR,   {   42,   42,  168 } },
+      { PimCmdEnum::SUB_SCALAR,   {   42,   42,  168 } },
+      { PimCmdEnum::AND_SCALAR,   {   42,   42,  126 } },
+      { PimCmdEnum::OR_SCALAR,    {   42,   42,  115 } },
+      { PimCmdEnum::XOR_SCALAR,   {   42,   42,   97 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   42,   42,  126 } },
+      { PimCmdEnum::MIN_SCALAR,   {   84,   42,  230 } },
+      { PimCmdEnum::MAX_SCALAR,   {   84,   42,  230 } },
+    }},
+    { { false, 43 }, {
+      { PimCmdEnum::ABS,          {   43,   43,    0 } },
+      { PimCmdEnum::ADD,          {   86,   43,  129 } },
+      { PimCmdEnum::SUB,          {   86,   43,  129 } },
+      { PimCmdEnum::AND,          {   86,   43,   86 } },
+      { PimCmdEnum::OR,           {   86,   43,   87 } },
+      { PimCmdEnum::XOR,          {   86,   43,  130 } },
+      { PimCmdEnum::XNOR,         {   86,   43,   86 } },
+      { PimCmdEnum::MIN,          {  172,   43,  260 } },
+      { PimCmdEnum::MAX,          {  172,   43,  260 } },
+      { PimCmdEnum::ADD_SCALAR,   {   43,   43,  172 } },
+      { PimCmdEnum::SUB_SCALAR,   {   43,   43,  172 } },
+      { PimCmdEnum::AND_SCALAR,   {   43,   43,  129 } },
+      { PimCmdEnum::OR_SCALAR,    {   43,   43,  118 } },
+      { PimCmdEnum::XOR_SCALAR,   {   43,   43,   99 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   43,   43,  129 } },
+      { PimCmdEnum::MIN_SCALAR,   {   86,   43,  235 } },
+      { PimCmdEnum::MAX_SCALAR,   {   86,   43,  235 } },
+    }},
+    { { false, 44 }, {
+      { PimCmdEnum::ABS,          {   44,   44,    0 } },
+      { PimCmdEnum::ADD,          {   88,   44,  132 } },
+      { PimCmdEnum::SUB,          {   88,   44,  132 } },
+      { PimCmdEnum::AND,          {   88,   44,   88 } },
+      { PimCmdEnum::OR,           {   88,   44,   89 } },
+      { PimCmdEnum::XOR,          {   88,   44,  133 } },
+      { PimCmdEnum::XNOR,         {   88,   44,   88 } },
+      { PimCmdEnum::MIN,          {  176,   44,  266 } },
+      { PimCmdEnum::MAX,          {  176,   44,  266 } },
+      { PimCmdEnum::ADD_SCALAR,   {   44,   44,  176 } },
+      { PimCmdEnum::SUB_SCALAR,   {   44,   44,  176 } },
+      { PimCmdEnum::AND_SCALAR,   {   44,   44,  132 } },
+      { PimCmdEnum::OR_SCALAR,    {   44,   44,  121 } },
+      { PimCmdEnum::XOR_SCALAR,   {   44,   44,  101 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   44,   44,  132 } },
+      { PimCmdEnum::MIN_SCALAR,   {   88,   44,  240 } },
+      { PimCmdEnum::MAX_SCALAR,   {   88,   44,  240 } },
+    }},
+    { { false, 45 }, {
+      { PimCmdEnum::ABS,          {   45,   45,    0 } },
+      { PimCmdEnum::ADD,          {   90,   45,  135 } },
+      { PimCmdEnum::SUB,          {   90,   45,  135 } },
+      { PimCmdEnum::AND,          {   90,   45,   90 } },
+      { PimCmdEnum::OR,           {   90,   45,   91 } },
+      { PimCmdEnum::XOR,          {   90,   45,  136 } },
+      { PimCmdEnum::XNOR,         {   90,   45,   90 } },
+      { PimCmdEnum::MIN,          {  180,   45,  272 } },
+      { PimCmdEnum::MAX,          {  180,   45,  272 } },
+      { PimCmdEnum::ADD_SCALAR,   {   45,   45,  180 } },
+      { PimCmdEnum::SUB_SCALAR,   {   45,   45,  180 } },
+      { PimCmdEnum::AND_SCALAR,   {   45,   45,  135 } },
+      { PimCmdEnum::OR_SCALAR,    {   45,   45,  124 } },
+      { PimCmdEnum::XOR_SCALAR,   {   45,   45,  103 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   45,   45,  135 } },
+      { PimCmdEnum::MIN_SCALAR,   {   90,   45,  245 } },
+      { PimCmdEnum::MAX_SCALAR,   {   90,   45,  245 } },
+    }},
+    { { false, 46 }, {
+      { PimCmdEnum::ABS,          {   46,   46,    0 } },
+      { PimCmdEnum::ADD,          {   92,   46,  138 } },
+      { PimCmdEnum::SUB,          {   92,   46,  138 } },
+      { PimCmdEnum::AND,          {   92,   46,   92 } },
+      { PimCmdEnum::OR,           {   92,   46,   93 } },
+      { PimCmdEnum::XOR,          {   92,   46,  139 } },
+      { PimCmdEnum::XNOR,         {   92,   46,   92 } },
+      { PimCmdEnum::MIN,          {  184,   46,  278 } },
+      { PimCmdEnum::MAX,          {  184,   46,  278 } },
+      { PimCmdEnum::ADD_SCALAR,   {   46,   46,  184 } },
+      { PimCmdEnum::SUB_SCALAR,   {   46,   46,  184 } },
+      { PimCmdEnum::AND_SCALAR,   {   46,   46,  138 } },
+      { PimCmdEnum::OR_SCALAR,    {   46,   46,  127 } },
+      { PimCmdEnum::XOR_SCALAR,   {   46,   46,  105 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   46,   46,  138 } },
+      { PimCmdEnum::MIN_SCALAR,   {   92,   46,  250 } },
+      { PimCmdEnum::MAX_SCALAR,   {   92,   46,  250 } },
+    }},
+    { { false, 47 }, {
+      { PimCmdEnum::ABS,          {   47,   47,    0 } },
+      { PimCmdEnum::ADD,          {   94,   47,  141 } },
+      { PimCmdEnum::SUB,          {   94,   47,  141 } },
+      { PimCmdEnum::AND,          {   94,   47,   94 } },
+      { PimCmdEnum::OR,           {   94,   47,   95 } },
+      { PimCmdEnum::XOR,          {   94,   47,  142 } },
+      { PimCmdEnum::XNOR,         {   94,   47,   94 } },
+      { PimCmdEnum::MIN,          {  188,   47,  284 } },
+      { PimCmdEnum::MAX,          {  188,   47,  284 } },
+      { PimCmdEnum::ADD_SCALAR,   {   47,   47,  188 } },
+      { PimCmdEnum::SUB_SCALAR,   {   47,   47,  188 } },
+      { PimCmdEnum::AND_SCALAR,   {   47,   47,  141 } },
+      { PimCmdEnum::OR_SCALAR,    {   47,   47,  130 } },
+      { PimCmdEnum::XOR_SCALAR,   {   47,   47,  107 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   47,   47,  141 } },
+      { PimCmdEnum::MIN_SCALAR,   {   94,   47,  255 } },
+      { PimCmdEnum::MAX_SCALAR,   {   94,   47,  255 } },
+    }},
+    { { false, 48 }, {
+      { PimCmdEnum::ABS,          {   48,   48,    0 } },
+      { PimCmdEnum::ADD,          {   96,   48,  144 } },
+      { PimCmdEnum::SUB,          {   96,   48,  144 } },
+      { PimCmdEnum::AND,          {   96,   48,   96 } },
+      { PimCmdEnum::OR,           {   96,   48,   97 } },
+      { PimCmdEnum::XOR,          {   96,   48,  145 } },
+      { PimCmdEnum::XNOR,         {   96,   48,   96 } },
+      { PimCmdEnum::MIN,          {  192,   48,  290 } },
+      { PimCmdEnum::MAX,          {  192,   48,  290 } },
+      { PimCmdEnum::ADD_SCALAR,   {   48,   48,  192 } },
+      { PimCmdEnum::SUB_SCALAR,   {   48,   48,  192 } },
+      { PimCmdEnum::AND_SCALAR,   {   48,   48,  144 } },
+      { PimCmdEnum::OR_SCALAR,    {   48,   48,  133 } },
+      { PimCmdEnum::XOR_SCALAR,   {   48,   48,  109 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   48,   48,  144 } },
+      { PimCmdEnum::MIN_SCALAR,   {   96,   48,  260 } },
+      { PimCmdEnum::MAX_SCALAR,   {   96,   48,  260 } },
+    }},
+    { { false, 49 }, {
+      { PimCmdEnum::ABS,          {   49,   49,    0 } },
+      { PimCmdEnum::ADD,          {   98,   49,  147 } },
+      { PimCmdEnum::SUB,          {   98,   49,  147 } },
+      { PimCmdEnum::AND,          {   98,   49,   98 } },
+      { PimCmdEnum::OR,           {   98,   49,   99 } },
+      { PimCmdEnum::XOR,          {   98,   49,  148 } },
+      { PimCmdEnum::XNOR,         {   98,   49,   98 } },
+      { PimCmdEnum::MIN,          {  196,   49,  296 } },
+      { PimCmdEnum::MAX,          {  196,   49,  296 } },
+      { PimCmdEnum::ADD_SCALAR,   {   49,   49,  196 } },
+      { PimCmdEnum::SUB_SCALAR,   {   49,   49,  196 } },
+      { PimCmdEnum::AND_SCALAR,   {   49,   49,  147 } },
+      { PimCmdEnum::OR_SCALAR,    {   49,   49,  136 } },
+      { PimCmdEnum::XOR_SCALAR,   {   49,   49,  111 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   49,   49,  147 } },
+      { PimCmdEnum::MIN_SCALAR,   {   98,   49,  265 } },
+      { PimCmdEnum::MAX_SCALAR,   {   98,   49,  265 } },
+    }},
+    { { false, 50 }, {
+      { PimCmdEnum::ABS,          {   50,   50,    0 } },
+      { PimCmdEnum::ADD,          {  100,   50,  150 } },
+      { PimCmdEnum::SUB,          {  100,   50,  150 } },
+      { PimCmdEnum::AND,          {  100,   50,  100 } },
+      { PimCmdEnum::OR,           {  100,   50,  101 } },
+      { PimCmdEnum::XOR,          {  100,   50,  151 } },
+      { PimCmdEnum::XNOR,         {  100,   50,  100 } },
+      { PimCmdEnum::MIN,          {  200,   50,  302 } },
+      { PimCmdEnum::MAX,          {  200,   50,  302 } },
+      { PimCmdEnum::ADD_SCALAR,   {   50,   50,  200 } },
+      { PimCmdEnum::SUB_SCALAR,   {   50,   50,  200 } },
+      { PimCmdEnum::AND_SCALAR,   {   50,   50,  150 } },
+      { PimCmdEnum::OR_SCALAR,    {   50,   50,  139 } },
+      { PimCmdEnum::XOR_SCALAR,   {   50,   50,  113 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   50,   50,  150 } },
+      { PimCmdEnum::MIN_SCALAR,   {  100,   50,  270 } },
+      { PimCmdEnum::MAX_SCALAR,   {  100,   50,  270 } },
+    }},
+    { { false, 51 }, {
+      { PimCmdEnum::ABS,          {   51,   51,    0 } },
+      { PimCmdEnum::ADD,          {  102,   51,  153 } },
+      { PimCmdEnum::SUB,          {  102,   51,  153 } },
+      { PimCmdEnum::AND,          {  102,   51,  102 } },
+      { PimCmdEnum::OR,           {  102,   51,  103 } },
+      { PimCmdEnum::XOR,          {  102,   51,  154 } },
+      { PimCmdEnum::XNOR,         {  102,   51,  102 } },
+      { PimCmdEnum::MIN,          {  204,   51,  308 } },
+      { PimCmdEnum::MAX,          {  204,   51,  308 } },
+      { PimCmdEnum::ADD_SCALAR,   {   51,   51,  204 } },
+      { PimCmdEnum::SUB_SCALAR,   {   51,   51,  204 } },
+      { PimCmdEnum::AND_SCALAR,   {   51,   51,  153 } },
+      { PimCmdEnum::OR_SCALAR,    {   51,   51,  142 } },
+      { PimCmdEnum::XOR_SCALAR,   {   51,   51,  115 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   51,   51,  153 } },
+      { PimCmdEnum::MIN_SCALAR,   {  102,   51,  275 } },
+      { PimCmdEnum::MAX_SCALAR,   {  102,   51,  275 } },
+    }},
+    { { false, 52 }, {
+      { PimCmdEnum::ABS,          {   52,   52,    0 } },
+      { PimCmdEnum::ADD,          {  104,   52,  156 } },
+      { PimCmdEnum::SUB,          {  104,   52,  156 } },
+      { PimCmdEnum::AND,          {  104,   52,  104 } },
+      { PimCmdEnum::OR,           {  104,   52,  105 } },
+      { PimCmdEnum::XOR,          {  104,   52,  157 } },
+      { PimCmdEnum::XNOR,         {  104,   52,  104 } },
+      { PimCmdEnum::MIN,          {  208,   52,  314 } },
+      { PimCmdEnum::MAX,          {  208,   52,  314 } },
+      { PimCmdEnum::ADD_SCALAR,   {   52,   52,  208 } },
+      { PimCmdEnum::SUB_SCALAR,   {   52,   52,  208 } },
+      { PimCmdEnum::AND_SCALAR,   {   52,   52,  156 } },
+      { PimCmdEnum::OR_SCALAR,    {   52,   52,  145 } },
+      { PimCmdEnum::XOR_SCALAR,   {   52,   52,  117 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   52,   52,  156 } },
+      { PimCmdEnum::MIN_SCALAR,   {  104,   52,  280 } },
+      { PimCmdEnum::MAX_SCALAR,   {  104,   52,  280 } },
+    }},
+    { { false, 53 }, {
+      { PimCmdEnum::ABS,          {   53,   53,    0 } },
+      { PimCmdEnum::ADD,          {  106,   53,  159 } },
+      { PimCmdEnum::SUB,          {  106,   53,  159 } },
+      { PimCmdEnum::AND,          {  106,   53,  106 } },
+      { PimCmdEnum::OR,           {  106,   53,  107 } },
+      { PimCmdEnum::XOR,          {  106,   53,  160 } },
+      { PimCmdEnum::XNOR,         {  106,   53,  106 } },
+      { PimCmdEnum::MIN,          {  212,   53,  320 } },
+      { PimCmdEnum::MAX,          {  212,   53,  320 } },
+      { PimCmdEnum::ADD_SCALAR,   {   53,   53,  212 } },
+      { PimCmdEnum::SUB_SCALAR,   {   53,   53,  212 } },
+      { PimCmdEnum::AND_SCALAR,   {   53,   53,  159 } },
+      { PimCmdEnum::OR_SCALAR,    {   53,   53,  148 } },
+      { PimCmdEnum::XOR_SCALAR,   {   53,   53,  119 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   53,   53,  159 } },
+      { PimCmdEnum::MIN_SCALAR,   {  106,   53,  285 } },
+      { PimCmdEnum::MAX_SCALAR,   {  106,   53,  285 } },
+    }},
+    { { false, 54 }, {
+      { PimCmdEnum::ABS,          {   54,   54,    0 } },
+      { PimCmdEnum::ADD,          {  108,   54,  162 } },
+      { PimCmdEnum::SUB,          {  108,   54,  162 } },
+      { PimCmdEnum::AND,          {  108,   54,  108 } },
+      { PimCmdEnum::OR,           {  108,   54,  109 } },
+      { PimCmdEnum::XOR,          {  108,   54,  163 } },
+      { PimCmdEnum::XNOR,         {  108,   54,  108 } },
+      { PimCmdEnum::MIN,          {  216,   54,  326 } },
+      { PimCmdEnum::MAX,          {  216,   54,  326 } },
+      { PimCmdEnum::ADD_SCALAR,   {   54,   54,  216 } },
+      { PimCmdEnum::SUB_SCALAR,   {   54,   54,  216 } },
+      { PimCmdEnum::AND_SCALAR,   {   54,   54,  162 } },
+      { PimCmdEnum::OR_SCALAR,    {   54,   54,  151 } },
+      { PimCmdEnum::XOR_SCALAR,   {   54,   54,  121 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   54,   54,  162 } },
+      { PimCmdEnum::MIN_SCALAR,   {  108,   54,  290 } },
+      { PimCmdEnum::MAX_SCALAR,   {  108,   54,  290 } },
+    }},
+    { { false, 55 }, {
+      { PimCmdEnum::ABS,          {   55,   55,    0 } },
+      { PimCmdEnum::ADD,          {  110,   55,  165 } },
+      { PimCmdEnum::SUB,          {  110,   55,  165 } },
+      { PimCmdEnum::AND,          {  110,   55,  110 } },
+      { PimCmdEnum::OR,           {  110,   55,  111 } },
+      { PimCmdEnum::XOR,          {  110,   55,  166 } },
+      { PimCmdEnum::XNOR,         {  110,   55,  110 } },
+      { PimCmdEnum::MIN,          {  220,   55,  332 } },
+      { PimCmdEnum::MAX,          {  220,   55,  332 } },
+      { PimCmdEnum::ADD_SCALAR,   {   55,   55,  220 } },
+      { PimCmdEnum::SUB_SCALAR,   {   55,   55,  220 } },
+      { PimCmdEnum::AND_SCALAR,   {   55,   55,  165 } },
+      { PimCmdEnum::OR_SCALAR,    {   55,   55,  154 } },
+      { PimCmdEnum::XOR_SCALAR,   {   55,   55,  123 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   55,   55,  165 } },
+      { PimCmdEnum::MIN_SCALAR,   {  110,   55,  295 } },
+      { PimCmdEnum::MAX_SCALAR,   {  110,   55,  295 } },
+    }},
+    { { false, 56 }, {
+      { PimCmdEnum::ABS,          {   56,   56,    0 } },
+      { PimCmdEnum::ADD,          {  112,   56,  168 } },
+      { PimCmdEnum::SUB,          {  112,   56,  168 } },
+      { PimCmdEnum::AND,          {  112,   56,  112 } },
+      { PimCmdEnum::OR,           {  112,   56,  113 } },
+      { PimCmdEnum::XOR,          {  112,   56,  169 } },
+      { PimCmdEnum::XNOR,         {  112,   56,  112 } },
+      { PimCmdEnum::MIN,          {  224,   56,  338 } },
+      { PimCmdEnum::MAX,          {  224,   56,  338 } },
+      { PimCmdEnum::ADD_SCALAR,   {   56,   56,  224 } },
+      { PimCmdEnum::SUB_SCALAR,   {   56,   56,  224 } },
+      { PimCmdEnum::AND_SCALAR,   {   56,   56,  168 } },
+      { PimCmdEnum::OR_SCALAR,    {   56,   56,  157 } },
+      { PimCmdEnum::XOR_SCALAR,   {   56,   56,  125 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   56,   56,  168 } },
+      { PimCmdEnum::MIN_SCALAR,   {  112,   56,  300 } },
+      { PimCmdEnum::MAX_SCALAR,   {  112,   56,  300 } },
+    }},
+    { { false, 57 }, {
+      { PimCmdEnum::ABS,          {   57,   57,    0 } },
+      { PimCmdEnum::ADD,          {  114,   57,  171 } },
+      { PimCmdEnum::SUB,          {  114,   57,  171 } },
+      { PimCmdEnum::AND,          {  114,   57,  114 } },
+      { PimCmdEnum::OR,           {  114,   57,  115 } },
+      { PimCmdEnum::XOR,          {  114,   57,  172 } },
+      { PimCmdEnum::XNOR,         {  114,   57,  114 } },
+      { PimCmdEnum::MIN,          {  228,   57,  344 } },
+      { PimCmdEnum::MAX,          {  228,   57,  344 } },
+      { PimCmdEnum::ADD_SCALAR,   {   57,   57,  228 } },
+      { PimCmdEnum::SUB_SCALAR,   {   57,   57,  228 } },
+      { PimCmdEnum::AND_SCALAR,   {   57,   57,  171 } },
+      { PimCmdEnum::OR_SCALAR,    {   57,   57,  160 } },
+      { PimCmdEnum::XOR_SCALAR,   {   57,   57,  127 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   57,   57,  171 } },
+      { PimCmdEnum::MIN_SCALAR,   {  114,   57,  305 } },
+      { PimCmdEnum::MAX_SCALAR,   {  114,   57,  305 } },
+    }},
+    { { false, 58 }, {
+      { PimCmdEnum::ABS,          {   58,   58,    0 } },
+      { PimCmdEnum::ADD,          {  116,   58,  174 } },
+      { PimCmdEnum::SUB,          {  116,   58,  174 } },
+      { PimCmdEnum::AND,          {  116,   58,  116 } },
+      { PimCmdEnum::OR,           {  116,   58,  117 } },
+      { PimCmdEnum::XOR,          {  116,   58,  175 } },
+      { PimCmdEnum::XNOR,         {  116,   58,  116 } },
+      { PimCmdEnum::MIN,          {  232,   58,  350 } },
+      { PimCmdEnum::MAX,          {  232,   58,  350 } },
+      { PimCmdEnum::ADD_SCALAR,   {   58,   58,  232 } },
+      { PimCmdEnum::SUB_SCALAR,   {   58,   58,  232 } },
+      { PimCmdEnum::AND_SCALAR,   {   58,   58,  174 } },
+      { PimCmdEnum::OR_SCALAR,    {   58,   58,  163 } },
+      { PimCmdEnum::XOR_SCALAR,   {   58,   58,  129 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   58,   58,  174 } },
+      { PimCmdEnum::MIN_SCALAR,   {  116,   58,  310 } },
+      { PimCmdEnum::MAX_SCALAR,   {  116,   58,  310 } },
+    }},
+    { { false, 59 }, {
+      { PimCmdEnum::ABS,          {   59,   59,    0 } },
+      { PimCmdEnum::ADD,          {  118,   59,  177 } },
+      { PimCmdEnum::SUB,          {  118,   59,  177 } },
+      { PimCmdEnum::AND,          {  118,   59,  118 } },
+      { PimCmdEnum::OR,           {  118,   59,  119 } },
+      { PimCmdEnum::XOR,          {  118,   59,  178 } },
+      { PimCmdEnum::XNOR,         {  118,   59,  118 } },
+      { PimCmdEnum::MIN,          {  236,   59,  356 } },
+      { PimCmdEnum::MAX,          {  236,   59,  356 } },
+      { PimCmdEnum::ADD_SCALAR,   {   59,   59,  236 } },
+      { PimCmdEnum::SUB_SCALAR,   {   59,   59,  236 } },
+      { PimCmdEnum::AND_SCALAR,   {   59,   59,  177 } },
+      { PimCmdEnum::OR_SCALAR,    {   59,   59,  166 } },
+      { PimCmdEnum::XOR_SCALAR,   {   59,   59,  131 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   59,   59,  177 } },
+      { PimCmdEnum::MIN_SCALAR,   {  118,   59,  315 } },
+      { PimCmdEnum::MAX_SCALAR,   {  118,   59,  315 } },
+    }},
+    { { false, 60 }, {
+      { PimCmdEnum::ABS,          {   60,   60,    0 } },
+      { PimCmdEnum::ADD,          {  120,   60,  180 } },
+      { PimCmdEnum::SUB,          {  120,   60,  180 } },
+      { PimCmdEnum::AND,          {  120,   60,  120 } },
+      { PimCmdEnum::OR,           {  120,   60,  121 } },
+      { PimCmdEnum::XOR,          {  120,   60,  181 } },
+      { PimCmdEnum::XNOR,         {  120,   60,  120 } },
+      { PimCmdEnum::MIN,          {  240,   60,  362 } },
+      { PimCmdEnum::MAX,          {  240,   60,  362 } },
+      { PimCmdEnum::ADD_SCALAR,   {   60,   60,  240 } },
+      { PimCmdEnum::SUB_SCALAR,   {   60,   60,  240 } },
+      { PimCmdEnum::AND_SCALAR,   {   60,   60,  180 } },
+      { PimCmdEnum::OR_SCALAR,    {   60,   60,  169 } },
+      { PimCmdEnum::XOR_SCALAR,   {   60,   60,  133 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   60,   60,  180 } },
+      { PimCmdEnum::MIN_SCALAR,   {  120,   60,  320 } },
+      { PimCmdEnum::MAX_SCALAR,   {  120,   60,  320 } },
+    }},
+    { { false, 61 }, {
+      { PimCmdEnum::ABS,          {   61,   61,    0 } },
+      { PimCmdEnum::ADD,          {  122,   61,  183 } },
+      { PimCmdEnum::SUB,          {  122,   61,  183 } },
+      { PimCmdEnum::AND,          {  122,   61,  122 } },
+      { PimCmdEnum::OR,           {  122,   61,  123 } },
+      { PimCmdEnum::XOR,          {  122,   61,  184 } },
+      { PimCmdEnum::XNOR,         {  122,   61,  122 } },
+      { PimCmdEnum::MIN,          {  244,   61,  368 } },
+      { PimCmdEnum::MAX,          {  244,   61,  368 } },
+      { PimCmdEnum::ADD_SCALAR,   {   61,   61,  244 } },
+      { PimCmdEnum::SUB_SCALAR,   {   61,   61,  244 } },
+      { PimCmdEnum::AND_SCALAR,   {   61,   61,  183 } },
+      { PimCmdEnum::OR_SCALAR,    {   61,   61,  172 } },
+      { PimCmdEnum::XOR_SCALAR,   {   61,   61,  135 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   61,   61,  183 } },
+      { PimCmdEnum::MIN_SCALAR,   {  122,   61,  325 } },
+      { PimCmdEnum::MAX_SCALAR,   {  122,   61,  325 } },
+    }},
+    { { false, 62 }, {
+      { PimCmdEnum::ABS,          {   62,   62,    0 } },
+      { PimCmdEnum::ADD,          {  124,   62,  186 } },
+      { PimCmdEnum::SUB,          {  124,   62,  186 } },
+      { PimCmdEnum::AND,          {  124,   62,  124 } },
+      { PimCmdEnum::OR,           {  124,   62,  125 } },
+      { PimCmdEnum::XOR,          {  124,   62,  187 } },
+      { PimCmdEnum::XNOR,         {  124,   62,  124 } },
+      { PimCmdEnum::MIN,          {  248,   62,  374 } },
+      { PimCmdEnum::MAX,          {  248,   62,  374 } },
+      { PimCmdEnum::ADD_SCALAR,   {   62,   62,  248 } },
+      { PimCmdEnum::SUB_SCALAR,   {   62,   62,  248 } },
+      { PimCmdEnum::AND_SCALAR,   {   62,   62,  186 } },
+      { PimCmdEnum::OR_SCALAR,    {   62,   62,  175 } },
+      { PimCmdEnum::XOR_SCALAR,   {   62,   62,  137 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   62,   62,  186 } },
+      { PimCmdEnum::MIN_SCALAR,   {  124,   62,  330 } },
+      { PimCmdEnum::MAX_SCALAR,   {  124,   62,  330 } },
+    }},
+    { { false, 63 }, {
+      { PimCmdEnum::ABS,          {   63,   63,    0 } },
+      { PimCmdEnum::ADD,          {  126,   63,  189 } },
+      { PimCmdEnum::SUB,          {  126,   63,  189 } },
+      { PimCmdEnum::AND,          {  126,   63,  126 } },
+      { PimCmdEnum::OR,           {  126,   63,  127 } },
+      { PimCmdEnum::XOR,          {  126,   63,  190 } },
+      { PimCmdEnum::XNOR,         {  126,   63,  126 } },
+      { PimCmdEnum::MIN,          {  252,   63,  380 } },
+      { PimCmdEnum::MAX,          {  252,   63,  380 } },
+      { PimCmdEnum::ADD_SCALAR,   {   63,   63,  252 } },
+      { PimCmdEnum::SUB_SCALAR,   {   63,   63,  252 } },
+      { PimCmdEnum::AND_SCALAR,   {   63,   63,  189 } },
+      { PimCmdEnum::OR_SCALAR,    {   63,   63,  178 } },
+      { PimCmdEnum::XOR_SCALAR,   {   63,   63,  139 } },
+      { PimCmdEnum::XNOR_SCALAR,  {   63,   63,  189 } },
+      { PimCmdEnum::MIN_SCALAR,   {  126,   63,  335 } },
+      { PimCmdEnum::MAX_SCALAR,   {  126,   63,  335 } },
+    }},
+  }},
+};
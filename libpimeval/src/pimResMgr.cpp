@@ -6,6 +6,7 @@
 
 #include "pimResMgr.h"       // for pimResMgr
 #include "pimDevice.h"       // for pimDevice
+#include "pimSim.h"          // for pimSim
 #include <cstdio>            // for printf
 #include <algorithm>         // for sort, prev
 #include <stdexcept>         // for throw, invalid_argument
@@ -49,6 +50,10 @@ pimObjInfo::finalize()
     }
   }
   m_numCoresUsed = coreIdCnt.size();
+  m_regionsPerCoreHist.clear();
+  for (const auto& [coreId, numRegions] : coreIdCnt) {
+    m_regionsPerCoreHist[numRegions]++;
+  }
   m_numCoreAvailable = m_device->getNumCores();
   m_isLoadBalanced = m_device->getConfig().isLoadBalanced();
 
@@ -64,6 +69,10 @@ pimObjInfo::getBitsPerElement(PimBitWidth bitWidthType) const
   switch (bitWidthType) {
     case PimBitWidth::ACTUAL:
     case PimBitWidth::SIM:
+      if (m_numCustomBits > 0) {
+        return m_numCustomBits;
+      }
+      return pimUtils::getNumBitsOfDataType(m_dataType, bitWidthType);
     case PimBitWidth::HOST:
       return pimUtils::getNumBitsOfDataType(m_dataType, bitWidthType);
     case PimBitWidth::PADDED:
@@ -190,52 +199,164 @@ pimObjInfo::getElementBits(uint64_t index) const
   return bits;
 }
 
-//! @brief  Sync PIM object data from simulated memory
+//! @brief  Group region indices by PIM core. Regions on the same core may share packed memory words
+std::vector<std::vector<size_t>>
+pimObjInfo::getRegionIdxsPerCore() const
+{
+  std::vector<std::vector<size_t>> regionIdxsPerCore;
+  std::unordered_map<PimCoreId, size_t> coreIdToGroup;
+  for (size_t i = 0; i < m_regions.size(); ++i) {
+    PimCoreId coreId = m_regions[i].getCoreId();
+    auto it = coreIdToGroup.find(coreId);
+    if (it == coreIdToGroup.end()) {
+      it = coreIdToGroup.emplace(coreId, regionIdxsPerCore.size()).first;
+      regionIdxsPerCore.emplace_back();
+    }
+    regionIdxsPerCore[it->second].push_back(i);
+  }
+  return regionIdxsPerCore;
+}
+
+//! @brief  Sync PIM object data from simulated memory for a list of regions
 void
-pimObjInfo::syncFromSimulatedMem()
+pimObjInfo::syncRegionsFromSimulatedMem(const std::vector<size_t>& regionIdxs)
 {
   pimObjInfo &obj = (m_refObjId != -1 ? m_device->getResMgr()->getObjInfo(m_refObjId) : *this);
   unsigned numBits = getBitsPerElement(PimBitWidth::SIM);
-  for (size_t i = 0; i < m_regions.size(); ++i) {
-    pimRegion& region = m_regions[i];
+  uint64_t vals[64];
+  for (size_t i : regionIdxs) {
+    const pimRegion& region = m_regions[i];
     PimCoreId coreId = region.getCoreId();
     pimCore& core = m_device->getCore(coreId);
     uint64_t elemIdxBegin = region.getElemIdxBegin();
     uint64_t numElemInRegion = region.getNumElemInRegion();
-    for (uint64_t j = 0; j < numElemInRegion; ++j) {
-      auto [rowLoc, colLoc] = region.locateIthElemInRegion(j);
-      uint64_t bits = isVLayout() ? core.getBitsV(rowLoc, colLoc, numBits)
-                                  : core.getBitsH(rowLoc, colLoc, numBits);
-      obj.m_data.setElementBits(elemIdxBegin + j, bits);
+    if (isVLayout()) {
+      // process 64 elements at a time with bit-matrix transposition
+      for (uint64_t j = 0; j < numElemInRegion; j += 64) {
+        unsigned numElems = static_cast<unsigned>(std::min<uint64_t>(64, numElemInRegion - j));
+        auto [rowLoc, colLoc] = region.locateIthElemInRegion(j);
+        core.getBitsVBlock(rowLoc, colLoc, numBits, numElems, vals);
+        for (unsigned k = 0; k < numElems; ++k) {
+          obj.m_data.setElementBits(elemIdxBegin + j + k, vals[k]);
+        }
+      }
+    } else {
+      for (uint64_t j = 0; j < numElemInRegion; ++j) {
+        auto [rowLoc, colLoc] = region.locateIthElemInRegion(j);
+        uint64_t bits = core.getBitsH(rowLoc, colLoc, numBits);
+        obj.m_data.setElementBits(elemIdxBegin + j, bits);
+      }
     }
   }
 }
 
-//! @brief  Sync PIM object data to simulated memory
+//! @brief  Sync PIM object data to simulated memory for a list of regions
 void
-pimObjInfo::syncToSimulatedMem() const
+pimObjInfo::syncRegionsToSimulatedMem(const std::vector<size_t>& regionIdxs) const
 {
   const pimObjInfo &obj = (m_refObjId != -1 ? m_device->getResMgr()->getObjInfo(m_refObjId) : *this);
   unsigned numBits = getBitsPerElement(PimBitWidth::SIM);
-  for (size_t i = 0; i < m_regions.size(); ++i) {
+  uint64_t vals[64];
+  for (size_t i : regionIdxs) {
     const pimRegion& region = m_regions[i];
     PimCoreId coreId = region.getCoreId();
     pimCore& core = m_device->getCore(coreId);
     uint64_t elemIdxBegin = region.getElemIdxBegin();
     uint64_t numElemInRegion = region.getNumElemInRegion();
-    for (uint64_t j = 0; j < numElemInRegion; ++j) {
-      uint64_t bits = 0;
-      obj.m_data.getElementBits(elemIdxBegin + j, bits);
-      auto [rowLoc, colLoc] = region.locateIthElemInRegion(j);
-      if (isVLayout()) {
-        core.setBitsV(rowLoc, colLoc, bits, numBits);
-      } else {
+    if (isVLayout()) {
+      // process 64 elements at a time with bit-matrix transposition
+      for (uint64_t j = 0; j < numElemInRegion; j += 64) {
+        unsigned numElems = static_cast<unsigned>(std::min<uint64_t>(64, numElemInRegion - j));
+        for (unsigned k = 0; k < numElems; ++k) {
+          obj.m_data.getElementBits(elemIdxBegin + j + k, vals[k]);
+        }
+        auto [rowLoc, colLoc] = region.locateIthElemInRegion(j);
+        core.setBitsVBlock(rowLoc, colLoc, numBits, numElems, vals);
+      }
+    } else {
+      for (uint64_t j = 0; j < numElemInRegion; ++j) {
+        uint64_t bits = 0;
+        obj.m_data.getElementBits(elemIdxBegin + j, bits);
+        auto [rowLoc, colLoc] = region.locateIthElemInRegion(j);
         core.setBitsH(rowLoc, colLoc, bits, numBits);
       }
     }
   }
 }
 
+//! @brief  Sync PIM object data from simulated memory if data holder is stale
+void
+pimObjInfo::syncFromSimulatedMem()
+{
+  const pimObjInfo &obj = (m_refObjId != -1 ? m_device->getResMgr()->getObjInfo(m_refObjId) : *this);
+  if (!obj.m_isDataHolderStale) {
+    return;
+  }
+  std::vector<std::vector<size_t>> regionIdxsPerCore = getRegionIdxsPerCore();
+  // use thread pool of the context owning this object, which may not be the current context of the calling thread
+  pimSim* sim = m_device->getSim();
+  if (sim->getNumThreads() > 1 && regionIdxsPerCore.size() > 1) { // MT
+    std::vector<pimUtils::threadWorker*> workers;
+    for (const auto& regionIdxs : regionIdxsPerCore) {
+      workers.push_back(new syncWorker(this, regionIdxs, false));
+    }
+    sim->getThreadPool()->doWork(workers);
+    for (auto worker : workers) {
+      delete worker;
+    }
+  } else { // single thread
+    for (const auto& regionIdxs : regionIdxsPerCore) {
+      syncRegionsFromSimulatedMem(regionIdxs);
+    }
+  }
+  obj.m_isDataHolderStale = false;
+}
+
+//! @brief  Sync PIM object data to simulated memory if simulated memory is stale
+void
+pimObjInfo::syncToSimulatedMem() const
+{
+  const pimObjInfo &obj = (m_refObjId != -1 ? m_device->getResMgr()->getObjInfo(m_refObjId) : *this);
+  if (!obj.m_isSimulatedMemStale) {
+    return;
+  }
+  std::vector<std::vector<size_t>> regionIdxsPerCore = getRegionIdxsPerCore();
+  pimSim* sim = m_device->getSim();
+  if (sim->getNumThreads() > 1 && regionIdxsPerCore.size() > 1) { // MT
+    std::vector<pimUtils::threadWorker*> workers;
+    for (const auto& regionIdxs : regionIdxsPerCore) {
+      workers.push_back(new syncWorker(this, regionIdxs, true));
+    }
+    sim->getThreadPool()->doWork(workers);
+    for (auto worker : workers) {
+      delete worker;
+    }
+  } else { // single thread
+    for (const auto& regionIdxs : regionIdxsPerCore) {
+      syncRegionsToSimulatedMem(regionIdxs);
+    }
+  }
+  obj.m_isSimulatedMemStale = false;
+}
+
+//! @brief  Mark data holder as modified, i.e., simulated memory becomes stale
+void
+pimObjInfo::markDataHolderModified() const
+{
+  const pimObjInfo &obj = (m_refObjId != -1 ? m_device->getResMgr()->getObjInfo(m_refObjId) : *this);
+  obj.m_isDataHolderStale = false;
+  obj.m_isSimulatedMemStale = true;
+}
+
+//! @brief  Mark simulated memory as modified, i.e., data holder becomes stale
+void
+pimObjInfo::markSimulatedMemModified() const
+{
+  const pimObjInfo &obj = (m_refObjId != -1 ? m_device->getResMgr()->getObjInfo(m_refObjId) : *this);
+  obj.m_isSimulatedMemStale = false;
+  obj.m_isDataHolderStale = true;
+}
+
 
 //! @brief  pimResMgr ctor
 pimResMgr::pimResMgr(pimDevice* device)
@@ -258,8 +379,9 @@ pimResMgr::~pimResMgr()
 //! @brief  Allocate a new PIM object
 //!         For V layout, dataType determines the number of rows per region
 //!         For H layout, dataType determines the number of bits per element
+//!         A non-zero numCustomBits overrides the number of bits per element of an integer dataType
 PimObjId
-pimResMgr::pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataType)
+pimResMgr::pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataType, unsigned numCustomBits)
 {
   if (m_debugAlloc) {
     printf("PIM-Debug: pimAlloc: Request: %s %lu elements of type %s\n",
@@ -273,9 +395,14 @@ pimResMgr::pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType da
   }
 
   unsigned bitsPerElement = pimUtils::getNumBitsOfDataType(dataType, PimBitWidth::SIM);
+  // custom bit-width integers take numCustomBits rows in V layout, and are padded to host type in H layout
+  if (numCustomBits > 0 && (allocType == PIM_ALLOC_V || allocType == PIM_ALLOC_V1)) {
+    bitsPerElement = numCustomBits;
+  }
 
   std::vector<PimCoreId> sortedCoreId = getCoreIdsSortedByLeastUsage();
   pimObjInfo newObj(m_availObjId, dataType, allocType, numElements, bitsPerElement, m_device);
+  newObj.setNumCustomBits(numCustomBits);
   m_availObjId++;
 
   unsigned numCores = m_device->getNumCores();
@@ -372,7 +499,7 @@ pimResMgr::pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType da
     objId = newObj.getObjId();
     newObj.finalize();
     // update new object to resource mgr
-    m_objMap.insert(std::make_pair(newObj.getObjId(), newObj));
+    m_objTable.insert(newObj);
   }
 
   if (m_debugAlloc) {
@@ -462,7 +589,7 @@ pimResMgr::pimAllocBuffer(uint32_t numElements, PimDataType dataType)
     objId = newObj.getObjId();
     newObj.finalize();
     // update new object to resource mgr
-    m_objMap.insert(std::make_pair(newObj.getObjId(), newObj));
+    m_objTable.insert(newObj);
   }
 
   if (m_debugAlloc) {
@@ -481,7 +608,7 @@ pimResMgr::pimAllocBuffer(uint32_t numElements, PimDataType dataType)
 //!         For V layout, no specific requirement on data type
 //!         For H layout, data type of the new object must be equal to or narrower than the associated object
 PimObjId
-pimResMgr::pimAllocAssociated(PimObjId assocId, PimDataType dataType)
+pimResMgr::pimAllocAssociated(PimObjId assocId, PimDataType dataType, unsigned numCustomBits)
 {
   if (m_debugAlloc) {
     printf("PIM-Debug: pimAllocAssociated: Request: Data type %s associated with PIM object ID %d\n",
@@ -489,13 +616,13 @@ pimResMgr::pimAllocAssociated(PimObjId assocId, PimDataType dataType)
   }
 
   // check if assoc obj is valid
-  if (m_objMap.find(assocId) == m_objMap.end()) {
+  if (!isValidObjId(assocId)) {
     printf("PIM-Error: pimAllocAssociated: Invalid associated PIM object ID %d\n", assocId);
     return -1;
   }
 
   // associated object must not be a buffer
-  const pimObjInfo& assocObj = m_objMap.at(assocId);
+  const pimObjInfo& assocObj = getObjInfo(assocId);
   if (assocObj.isBuffer()) {
     printf("PIM-Error: pimAllocAssociated: Associated PIM object ID %d is a buffer, which is not allowed.\n", assocId);
     return -1;
@@ -508,6 +635,10 @@ pimResMgr::pimAllocAssociated(PimObjId assocId, PimDataType dataType)
   PimAllocEnum allocType = assocObj.getAllocType();
   uint64_t numElements = assocObj.getNumElements();
   unsigned bitsPerElement = pimUtils::getNumBitsOfDataType(dataType, PimBitWidth::SIM);
+  // custom bit-width integers take numCustomBits rows in V layout, and are padded to host type in H layout
+  if (numCustomBits > 0 && (allocType == PIM_ALLOC_V || allocType == PIM_ALLOC_V1)) {
+    bitsPerElement = numCustomBits;
+  }
   unsigned bitsPerElementAssoc = assocObj.getBitsPerElement(PimBitWidth::PADDED);
   if (allocType == PIM_ALLOC_V || allocType == PIM_ALLOC_V1) {
     if (m_debugAlloc) {
@@ -540,6 +671,7 @@ pimResMgr::pimAllocAssociated(PimObjId assocId, PimDataType dataType)
 
   // allocate associated regions
   pimObjInfo newObj(m_availObjId, dataType, allocType, numElements, bitsPerElement, m_device);
+  newObj.setNumCustomBits(numCustomBits);
   m_availObjId++;
 
   unsigned numCols = m_device->getNumCols();
@@ -650,7 +782,7 @@ pimResMgr::pimAllocAssociated(PimObjId assocId, PimDataType dataType)
     newObj.finalize();
     newObj.setAssocObjId(assocObj.getAssocObjId());
     // update new object to resource mgr
-    m_objMap.insert(std::make_pair(newObj.getObjId(), newObj));
+    m_objTable.insert(newObj);
   }
 
   if (m_debugAlloc) {
@@ -668,25 +800,31 @@ pimResMgr::pimAllocAssociated(PimObjId assocId, PimDataType dataType)
 bool
 pimResMgr::pimFree(PimObjId objId)
 {
-  if (m_objMap.find(objId) == m_objMap.end()) {
+  if (!isValidObjId(objId)) {
     printf("PIM-Error: pimFree: Invalid PIM object ID %d\n", objId);
     return false;
   }
   unsigned numCores = m_device->getNumCores();
-  const pimObjInfo& obj = m_objMap.at(objId);
+  const pimObjInfo& obj = getObjInfo(objId);
 
   if (!obj.isDualContactRef()) {
+    bool hasSimulatedMem = (m_device->getDeviceType() != PIM_FUNCTIONAL);
     for (unsigned i = 0; i < numCores; ++i) {
       m_coreUsage.at(i)->deleteObj(objId);
+      // release simulated memory of a core once it has no live allocation
+      if (hasSimulatedMem && m_coreUsage.at(i)->isEmpty()) {
+        m_device->getCore(i).releaseMemory();
+      }
     }
   }
-  m_objMap.erase(objId);
+  m_objTable.erase(objId);
 
   // free all reference as well
   if (m_refMap.find(objId) != m_refMap.end()) {
     for (auto refId : m_refMap.at(objId)) {
-      m_objMap.erase(refId);
+      m_objTable.erase(refId);
     }
+    m_refMap.erase(objId);
   }
 
   if (m_debugAlloc) {
@@ -708,12 +846,12 @@ PimObjId
 pimResMgr::pimCreateDualContactRef(PimObjId refId)
 {
   // check if ref obj is valid
-  if (m_objMap.find(refId) == m_objMap.end()) {
+  if (!isValidObjId(refId)) {
     std::printf("PIM-Error: Invalid ref object ID %d for PIM dual contact ref\n", refId);
     return -1;
   }
 
-  const pimObjInfo& refObj = m_objMap.at(refId);
+  const pimObjInfo& refObj = getObjInfo(refId);
   if (refObj.isDualContactRef()) {
     std::printf("PIM-Error: Cannot create dual contact ref of dual contact ref %d\n", refId);
     return -1;
@@ -728,11 +866,76 @@ pimResMgr::pimCreateDualContactRef(PimObjId refId)
   newObj.setRefObjId(refObj.getObjId());
   m_refMap[refObj.getObjId()].insert(objId);
   newObj.setIsDualContactRef(true);
-  m_objMap.insert(std::make_pair(newObj.getObjId(), newObj));
+  m_objTable.insert(newObj);
 
   return objId;
 }
 
+//! @brief  objTable ctor
+pimResMgr::objTable::objTable()
+  : m_segments(std::make_unique<std::atomic<segment*>[]>(s_maxNumSegments))
+{
+  for (unsigned i = 0; i < s_maxNumSegments; ++i) {
+    m_segments[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+//! @brief  objTable dtor
+pimResMgr::objTable::~objTable()
+{
+  for (unsigned i = 0; i < s_maxNumSegments; ++i) {
+    segment* seg = m_segments[i].load(std::memory_order_relaxed);
+    if (!seg) {
+      continue;
+    }
+    for (unsigned j = 0; j < s_segmentSize; ++j) {
+      delete seg->m_objs[j].load(std::memory_order_relaxed);
+    }
+    delete seg;
+  }
+}
+
+//! @brief  Find a PIM object by ID. Return nullptr if not found
+pimObjInfo*
+pimResMgr::objTable::find(PimObjId objId) const
+{
+  if (objId < 0 || static_cast<uint64_t>(objId) >= static_cast<uint64_t>(s_maxNumSegments) * s_segmentSize) {
+    return nullptr;
+  }
+  segment* seg = m_segments[objId >> s_segmentBits].load(std::memory_order_acquire);
+  return seg ? seg->m_objs[objId & (s_segmentSize - 1)].load(std::memory_order_acquire) : nullptr;
+}
+
+//! @brief  Insert a copy of a new PIM object
+void
+pimResMgr::objTable::insert(const pimObjInfo& obj)
+{
+  PimObjId objId = obj.getObjId();
+  assert(objId >= 0 && static_cast<uint64_t>(objId) < static_cast<uint64_t>(s_maxNumSegments) * s_segmentSize);
+  std::atomic<segment*>& segPtr = m_segments[objId >> s_segmentBits];
+  segment* seg = segPtr.load(std::memory_order_acquire);
+  if (!seg) {
+    seg = new segment();
+    for (unsigned j = 0; j < s_segmentSize; ++j) {
+      seg->m_objs[j].store(nullptr, std::memory_order_relaxed);
+    }
+    segPtr.store(seg, std::memory_order_release);
+  }
+  pimObjInfo* oldObj = seg->m_objs[objId & (s_segmentSize - 1)].exchange(new pimObjInfo(obj), std::memory_order_acq_rel);
+  delete oldObj;
+}
+
+//! @brief  Erase a PIM object by ID
+void
+pimResMgr::objTable::erase(PimObjId objId)
+{
+  if (!find(objId)) {
+    return;
+  }
+  segment* seg = m_segments[objId >> s_segmentBits].load(std::memory_order_acquire);
+  delete seg->m_objs[objId & (s_segmentSize - 1)].exchange(nullptr, std::memory_order_acq_rel);
+}
+
 //! @brief  Alloc resource on a specific core. Perform row allocation for now.
 pimRegion
 pimResMgr::findAvailRegionOnCore(PimCoreId coreId, unsigned numAllocRows, unsigned numAllocCols) const
@@ -793,6 +996,7 @@ pimResMgr::coreUsage::findAvailRange(unsigned numRowsToAlloc)
 void
 pimResMgr::coreUsage::addRange(std::pair<unsigned, unsigned> range, PimObjId objId)
 {
+  m_totRowsInUse += range.second;
   // aggregate with the prev range
   if (!m_rangesInUse.empty()) {
     auto it = std::prev(m_rangesInUse.end());
@@ -815,6 +1019,7 @@ pimResMgr::coreUsage::deleteObj(PimObjId objId)
 {
   for (auto it = m_rangesInUse.begin(); it != m_rangesInUse.end();) {
     if (it->second == objId) {
+      m_totRowsInUse -= it->first.second;
       it = m_rangesInUse.erase(it);
     } else {
       ++it;
@@ -835,7 +1040,9 @@ pimResMgr::coreUsage::newAllocEnd(bool success)
 {
   if (!success) {
     for (const auto &range : m_newAlloc) {
-      m_rangesInUse.erase(range);
+      if (m_rangesInUse.erase(range) > 0) {
+        m_totRowsInUse -= range.second;
+      }
     }
   }
   m_newAlloc.clear();
@@ -864,3 +1071,16 @@ pimResMgr::isHybridLayoutObj(PimObjId objId) const
   return false;
 }
 
+//! @brief  Get host memory allocated by data holders of all PIM objects
+uint64_t
+pimResMgr::getNumHostDataBytes() const
+{
+  uint64_t numBytes = 0;
+  for (PimObjId objId = 0; objId < m_availObjId; ++objId) {
+    const pimObjInfo* obj = m_objTable.find(objId);
+    if (obj) {
+      numBytes += obj->getNumHostDataBytes();
+    }
+  }
+  return numBytes;
+}
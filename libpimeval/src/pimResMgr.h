@@ -15,6 +15,7 @@
 #include <map>               // for map
 #include <string>            // for string
 #include <memory>            // for unique_ptr
+#include <atomic>            // for atomic
 #include <cassert>           // for assert
 
 class pimDevice;
@@ -77,6 +78,8 @@ private:
 //! @class  pimDataHolder
 //! @brief  A container holding raw data vector of a PIM object as a byte array
 //! Assumption: Caller gurantees correct range and indices
+//! The byte array is allocated on first write, so that objects never written, e.g. objects of extra simulation
+//! targets which only model perf and energy, hold no host memory. Untouched data reads as zeros
 class pimDataHolder
 {
 public:
@@ -88,22 +91,45 @@ public:
     // Note: Each data element is stored as m_bytesPerElement bytes in this data holder.
     // This aligns with the number of bytes per element in the host void* ptr for memcpy.
     m_bytesPerElement = (numBitsOfDataType + 7) / 8;  // round up, e.g. 1 byte per bool
-    m_data.resize(m_numElements * m_bytesPerElement);
+    // Element bits are truncated to simulated bit width, e.g. 1 bit per bool
+    unsigned numBitsSim = pimUtils::getNumBitsOfDataType(m_dataType, PimBitWidth::SIM);
+    m_bitsMaskSim = (numBitsSim >= 64 ? ~0ULL : ((1ULL << numBitsSim) - 1));
   }
   ~pimDataHolder() {}
 
+  // use a custom bit width for integer elements. Values wrap at numBits bits
+  void setNumCustomBits(unsigned numBits) {
+    if (numBits > 0) {
+      m_numCustomBits = numBits;
+      m_bitsMaskSim = (numBits >= 64 ? ~0ULL : ((1ULL << numBits) - 1));
+    }
+  }
+
   // return the number of bytes within a given range
   uint64_t getNumBytes(uint64_t idxBegin, uint64_t idxEnd) const {
     uint64_t numElements = (idxEnd == 0 ? m_numElements : idxEnd - idxBegin);
     return numElements * m_bytesPerElement;
   }
 
+  // return the number of bytes of host memory allocated by this holder
+  uint64_t getNumAllocatedBytes() const { return m_data.size(); }
+
   // copy data of range [idxBegin, idxEnd) from host ptr into holder
   // use full range if idxEnd is default 0
   bool copyFromHost(void* src, uint64_t idxBegin = 0, uint64_t idxEnd = 0) {
     uint64_t byteIndex = idxBegin * m_bytesPerElement;
     uint64_t numBytes = getNumBytes(idxBegin, idxEnd);
+    allocateMemoryOnWrite();
     std::memcpy(m_data.data() + byteIndex, src, numBytes);
+    // wrap host values of custom bit-width integers
+    if (m_numCustomBits > 0) {
+      uint64_t idxLast = (idxEnd == 0 ? m_numElements : idxEnd);
+      for (uint64_t i = idxBegin; i < idxLast; ++i) {
+        uint64_t bits = 0;
+        getElementBits(i, bits);
+        setElementBits(i, bits);
+      }
+    }
     return true;
   }
 
@@ -112,6 +138,10 @@ public:
   bool copyToHost(void* dest, uint64_t idxBegin = 0, uint64_t idxEnd = 0) const {
     uint64_t byteIndex = idxBegin * m_bytesPerElement;
     uint64_t numBytes = getNumBytes(idxBegin, idxEnd);
+    if (m_data.empty()) {
+      std::memset(dest, 0, numBytes);
+      return true;
+    }
     std::memcpy(dest, m_data.data() + byteIndex, numBytes);
     return true;
   }
@@ -121,13 +151,27 @@ public:
   bool copyToObj(pimDataHolder& dest, uint64_t idxBegin = 0, uint64_t idxEnd = 0) const {
     uint64_t byteIndex = idxBegin * m_bytesPerElement;
     uint64_t numBytes = getNumBytes(idxBegin, idxEnd);
+    if (m_data.empty()) {
+      if (!dest.m_data.empty()) {
+        std::memset(dest.m_data.data() + byteIndex, 0, numBytes);
+      }
+      return true;
+    }
+    dest.allocateMemoryOnWrite();
     std::memcpy(dest.m_data.data() + byteIndex, m_data.data() + byteIndex, numBytes);
     return true;
   }
 
   // set an element at index from bit representation
   bool setElementBits(uint64_t index, uint64_t bits) {
+    if (m_numCustomBits > 0) {
+      // keep custom bit-width integers sign-extended in host format
+      bits = pimUtils::wrapBits(bits, m_numCustomBits, pimUtils::isSigned(m_dataType));
+    } else {
+      bits &= m_bitsMaskSim;
+    }
     uint64_t byteIndex = index * m_bytesPerElement;
+    allocateMemoryOnWrite();
     std::memcpy(m_data.data() + byteIndex, &bits, m_bytesPerElement);
     return true;
   }
@@ -135,6 +179,9 @@ public:
   // get bit representation of an element at index
   bool getElementBits(uint64_t index, uint64_t &bits) const {
     bits = 0;
+    if (m_data.empty()) {
+      return true;
+    }
     uint64_t byteIndex = index * m_bytesPerElement;
     std::memcpy(&bits, m_data.data() + byteIndex, m_bytesPerElement);
     bits = pimUtils::signExt(bits, m_dataType);
@@ -153,10 +200,19 @@ public:
   }
 
 private:
-  std::vector<uint8_t> m_data;
+  // allocate zero-initialized byte array before the first write
+  void allocateMemoryOnWrite() {
+    if (m_data.empty()) {
+      m_data.resize(m_numElements * m_bytesPerElement);
+    }
+  }
+
+  std::vector<uint8_t> m_data;  // empty if untouched
   PimDataType m_dataType;
   uint64_t m_numElements;
   unsigned m_bytesPerElement;
+  uint64_t m_bitsMaskSim;
+  unsigned m_numCustomBits = 0;
 };
 
 //! @class  pimObjInfo
@@ -196,6 +252,7 @@ public:
   void setRefObjId(PimObjId refObjId) { m_refObjId = refObjId; }
   void setIsDualContactRef(bool val) { m_isDualContactRef = val; }
   void setNumColsPerElem(unsigned val) { m_numColsPerElem = val; }
+  void setNumCustomBits(unsigned val) { m_numCustomBits = val; m_data.setNumCustomBits(val); }
   void finalize();
 
   PimObjId getObjId() const { return m_objId; }
@@ -212,11 +269,15 @@ public:
   bool isHLayout() const { return m_allocType == PIM_ALLOC_H || m_allocType == PIM_ALLOC_H1; }
   bool isLoadBalanced() const { return m_isLoadBalanced; }
   bool isBuffer() const { return m_isBuffer; }
+  bool isCustomInt() const { return m_numCustomBits > 0; }
+  unsigned getNumCustomBits() const { return m_numCustomBits; }
+  uint64_t getNumHostDataBytes() const { return m_data.getNumAllocatedBytes(); }
 
   const std::vector<pimRegion>& getRegions() const { return m_regions; }
   std::vector<pimRegion> getRegionsOfCore(PimCoreId coreId) const;
   unsigned getMaxNumRegionsPerCore() const { return m_maxNumRegionsPerCore; }
   unsigned getNumCoresUsed() const { return m_numCoresUsed; }
+  const std::map<unsigned, unsigned>& getRegionsPerCoreHist() const { return m_regionsPerCoreHist; }
   unsigned getNumCoreAvailable() const { return m_numCoreAvailable; }
   unsigned getMaxElementsPerRegion() const { return m_maxElementsPerRegion; }
   unsigned getNumColsPerElem() const { return m_numColsPerElem; }
@@ -248,7 +309,44 @@ public:
   void syncFromSimulatedMem();
   void syncToSimulatedMem() const;
 
+  // Note: Below two functions track which side is modified since the last sync, so that
+  // syncFromSimulatedMem and syncToSimulatedMem can skip work when the other side is up to date.
+  // - Call markDataHolderModified after a functional command updates the data holder.
+  //   If only part of the data holder is updated, sync from simulated memory first.
+  // - Call markSimulatedMemModified after a micro-op writes rows of this object.
+  //   Sync to simulated memory first so that other rows are up to date.
+  // For reference PIM objects, the state is tracked on the ref-to object.
+  void markDataHolderModified() const;
+  void markSimulatedMemModified() const;
+
+  // Group region indices by PIM core, for processing regions of different cores in parallel
+  std::vector<std::vector<size_t>> getRegionIdxsPerCore() const;
+
 private:
+  void syncRegionsFromSimulatedMem(const std::vector<size_t>& regionIdxs);
+  void syncRegionsToSimulatedMem(const std::vector<size_t>& regionIdxs) const;
+
+  //! @class  pimObjInfo::syncWorker
+  //! @brief  Thread worker to sync all regions of a PIM object on one PIM core
+  class syncWorker : public pimUtils::threadWorker {
+  public:
+    syncWorker(const pimObjInfo* obj, const std::vector<size_t>& regionIdxs, bool isToSimulatedMem)
+      : m_obj(obj), m_regionIdxs(regionIdxs), m_isToSimulatedMem(isToSimulatedMem) {}
+    virtual ~syncWorker() {}
+    virtual void execute() {
+      if (m_isToSimulatedMem) {
+        m_obj->syncRegionsToSimulatedMem(m_regionIdxs);
+      } else {
+        // syncing from simulated memory updates the data holder of this object
+        const_cast<pimObjInfo*>(m_obj)->syncRegionsFromSimulatedMem(m_regionIdxs);
+      }
+    }
+  private:
+    const pimObjInfo* m_obj = nullptr;
+    const std::vector<size_t>& m_regionIdxs;
+    bool m_isToSimulatedMem = false;
+  };
+
   PimObjId m_objId = -1;
   PimObjId m_assocObjId = -1;
   PimObjId m_refObjId = -1;
@@ -257,16 +355,21 @@ private:
   pimDataHolder m_data;
   uint64_t m_numElements = 0;
   unsigned m_bitsPerElementPadded = 0;
+  unsigned m_numCustomBits = 0;  // bit width of custom bit-width integers, 0 for standard data types
   unsigned m_numCoreAvailable = 0;
   std::vector<pimRegion> m_regions;  // a list of core ID and regions
   unsigned m_maxNumRegionsPerCore = 0;
   unsigned m_numCoresUsed = 0;
+  std::map<unsigned, unsigned> m_regionsPerCoreHist;  // number of regions per used core to number of cores
   unsigned m_maxElementsPerRegion = 0;
   unsigned m_numColsPerElem = 0; // number of cols per element
   bool m_isDualContactRef = false;
   pimDevice* m_device = nullptr; // for accessing simulated memory
   bool m_isLoadBalanced = true;
   bool m_isBuffer = false; // true if this is a global buffer
+  // Coherence between data holder and simulated memory. Simulated memory is the initial source of truth.
+  mutable bool m_isDataHolderStale = true;
+  mutable bool m_isSimulatedMemStale = false;
 };
 
 
@@ -278,20 +381,22 @@ public:
   pimResMgr(pimDevice* device);
   ~pimResMgr();
 
-  PimObjId pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataType);
-  PimObjId pimAllocAssociated(PimObjId assocId, PimDataType dataType);
+  PimObjId pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataType, unsigned numCustomBits = 0);
+  PimObjId pimAllocAssociated(PimObjId assocId, PimDataType dataType, unsigned numCustomBits = 0);
   PimObjId pimAllocBuffer(uint32_t numElements, PimDataType dataType);
   bool pimFree(PimObjId objId);
   PimObjId pimCreateRangedRef(PimObjId refId, uint64_t idxBegin, uint64_t idxEnd);
   PimObjId pimCreateDualContactRef(PimObjId refId);
 
-  bool isValidObjId(PimObjId objId) const { return m_objMap.find(objId) != m_objMap.end(); }
-  const pimObjInfo& getObjInfo(PimObjId objId) const { assert(objId != -1); return m_objMap.at(objId); }
-  pimObjInfo& getObjInfo(PimObjId objId) { assert(objId != -1); return m_objMap.at(objId); }
+  bool isValidObjId(PimObjId objId) const { return m_objTable.find(objId) != nullptr; }
+  void setNextObjId(PimObjId objId) { m_availObjId = objId; }  // keep object IDs in sync across devices
+  const pimObjInfo& getObjInfo(PimObjId objId) const { pimObjInfo* obj = m_objTable.find(objId); assert(obj); return *obj; }
+  pimObjInfo& getObjInfo(PimObjId objId) { pimObjInfo* obj = m_objTable.find(objId); assert(obj); return *obj; }
 
   bool isVLayoutObj(PimObjId objId) const;
   bool isHLayoutObj(PimObjId objId) const;
   bool isHybridLayoutObj(PimObjId objId) const;
+  uint64_t getNumHostDataBytes() const;
 
 private:
   pimRegion findAvailRegionOnCore(PimCoreId coreId, unsigned numAllocRows, unsigned numAllocCols) const;
@@ -305,6 +410,7 @@ private:
     ~coreUsage() {}
     unsigned getNumRowsPerCore() const { return m_numRowsPerCore; }
     unsigned getTotRowsInUse() const { return m_totRowsInUse; }
+    bool isEmpty() const { return m_rangesInUse.empty(); }
     unsigned findAvailRange(unsigned numRowsToAlloc);
     void addRange(std::pair<unsigned, unsigned> range, PimObjId objId);
     void deleteObj(PimObjId objId);
@@ -317,9 +423,30 @@ private:
     std::set<std::pair<unsigned, unsigned>> m_newAlloc;
   };
 
+  //! @class  objTable
+  //! @brief  Concurrent table of PIM objects indexed by object ID
+  //! Object IDs are assigned incrementally, so objects are stored in fixed-size segments which never move.
+  //! Lookups are lock-free. Inserts and erases are serialized by the caller, i.e., PIM object allocation
+  class objTable {
+  public:
+    objTable();
+    ~objTable();
+    pimObjInfo* find(PimObjId objId) const;
+    void insert(const pimObjInfo& obj);
+    void erase(PimObjId objId);
+  private:
+    static constexpr unsigned s_segmentBits = 12;
+    static constexpr unsigned s_segmentSize = 1u << s_segmentBits;
+    static constexpr unsigned s_maxNumSegments = 1u << 16;
+    struct segment {
+      std::atomic<pimObjInfo*> m_objs[s_segmentSize];
+    };
+    std::unique_ptr<std::atomic<segment*>[]> m_segments;
+  };
+
   pimDevice* m_device;
   PimObjId m_availObjId;
-  std::unordered_map<PimObjId, pimObjInfo> m_objMap;
+  objTable m_objTable;
   std::unordered_map<PimCoreId, std::unique_ptr<pimResMgr::coreUsage>> m_coreUsage;
   std::unordered_map<PimObjId, std::set<PimObjId>> m_refMap;
   bool m_debugAlloc = 0;
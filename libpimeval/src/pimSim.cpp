@@ -5,37 +5,101 @@
 // See the LICENSE file in the root of this repository for more details.
 
 #include "pimSim.h"
+#include "pimChromeTrace.h"
 #include "pimCmd.h"
 #include "pimCmdFuse.h"
 #include "pimParamsDram.h"
 #include "pimStats.h"
+#include "pimTrace.h"
 #include "pimUtils.h"
 #include <cstdio>
 #include <memory>
 #include <algorithm>
 #include <string>
+#include <filesystem>
 
-// The pimSim singleton
-pimSim* pimSim::s_instance = nullptr;
+// The default PIM context, and contexts created by pimCreateContext
+std::atomic<pimSim*> pimSim::s_instance = nullptr;
+std::mutex pimSim::s_mutex;
+std::unordered_set<pimSim*> pimSim::s_contexts;
+thread_local pimSim* pimSim::s_current = nullptr;
 
-//! @brief  Get or create the pimSim singleton
+//! @brief  Get the current PIM context of the calling thread
 pimSim*
 pimSim::get()
 {
-  if (!s_instance) {
-    s_instance = new pimSim();
+  return s_current ? s_current : getDefault();
+}
+
+//! @brief  Get or create the default PIM context
+pimSim*
+pimSim::getDefault()
+{
+  pimSim* instance = s_instance.load(std::memory_order_acquire);
+  if (!instance) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    instance = s_instance.load(std::memory_order_relaxed);
+    if (!instance) {
+      instance = new pimSim();
+      s_instance.store(instance, std::memory_order_release);
+    }
   }
-  return s_instance;
+  return instance;
 }
 
-//! @brief  Destroy the pimSim singleton
+//! @brief  Destroy the default PIM context
 void
 pimSim::destroy()
 {
-  if (s_instance) {
-    delete s_instance;
-    s_instance = nullptr;
+  std::lock_guard<std::mutex> lock(s_mutex);
+  pimSim* instance = s_instance.exchange(nullptr);
+  if (s_current == instance) {
+    s_current = nullptr;
+  }
+  delete instance;
+}
+
+//! @brief  Create a new PIM context which is independent of all other contexts
+pimSim*
+pimSim::createContext()
+{
+  pimSim* context = new pimSim();
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_contexts.insert(context);
+  return context;
+}
+
+//! @brief  Delete a PIM context created by createContext. The calling thread falls back to the default context
+bool
+pimSim::deleteContext(pimSim* context)
+{
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_contexts.erase(context) == 0) {
+      std::printf("PIM-Error: Invalid PIM context to delete\n");
+      return false;
+    }
+  }
+  if (s_current == context) {
+    s_current = nullptr;
+  }
+  delete context;
+  return true;
+}
+
+//! @brief  Set the current PIM context of the calling thread. Use nullptr for the default context
+bool
+pimSim::setCurrentContext(pimSim* context)
+{
+  if (context && context != s_instance.load()) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_contexts.find(context) == s_contexts.end()) {
+      std::printf("PIM-Error: Invalid PIM context\n");
+      return false;
+    }
   }
+  s_current = context;
+  return true;
 }
 
 //! @brief  pimSim ctor
@@ -47,12 +111,22 @@ pimSim::pimSim()
 pimSim::~pimSim()
 {
   uninit();
+  if (pimTraceWriter::getContext() == this) {
+    pimTraceWriter::close();
+  }
+  if (pimChromeTrace::getContext() == this) {
+    pimChromeTrace::close();
+  }
 }
 
 //! @brief  Uninitialize pimSim member classes
 void
 pimSim::uninit()
 {
+  // finish pending async API calls before deleting the device
+  m_streamMgr.reset();
+  m_extraTargets.clear();
+  m_hasSkippedMicroOps = false;
   m_device.reset();
   m_threadPool.reset();
   m_statsMgr.reset();
@@ -98,7 +172,7 @@ pimSim::createDeviceCommon()
   }
 
   // Create PIM device
-  m_device = std::make_unique<pimDevice>(m_config);
+  m_device = std::make_unique<pimDevice>(this, m_config, *m_paramsDram);
 
   if (!m_device->isValid()) {
     uninit();
@@ -108,18 +182,140 @@ pimSim::createDeviceCommon()
 
   // Create stats mgr
   m_statsMgr = std::make_unique<pimStatsMgr>();
+  if (const pimPerfEnergyBase* perfEnergyModel = m_device->getPerfEnergyModel()) {
+    m_statsMgr->setBusTurnaround(perfEnergyModel->getMsReadToWrite(), perfEnergyModel->getMsWriteToRead());
+  }
 
   // Create thread pool
   if (getNumThreads() > 1) {
     m_threadPool = std::make_unique<pimUtils::threadPool>(getNumThreads());
   }
+
+  createExtraTargets();
+
+  // Create stream mgr for async API calls
+  m_streamMgr = std::make_unique<pimStreamMgr>(this);
+
+  // Record PIM API trace if requested
+  if (!m_config.getTraceOutFile().empty()) {
+    pimTraceWriter::open(m_config.getTraceOutFile(), m_config.isTracePayloadOn(), this);
+  }
+
+  // Record Chrome trace if requested
+  if (!m_config.getChromeTraceFile().empty() && pimChromeTrace::open(m_config.getChromeTraceFile(), this)) {
+    unsigned numRanks = std::max(1u, m_device->getNumRanks());
+    pimChromeTrace::beginDevice(pimUtils::pimDeviceEnumToStr(m_device->getSimTarget()), numRanks, m_device->getNumCores() / numRanks);
+  }
   return true;
 }
 
+//! @brief  Create extra simulation targets. Each of them is a functional device with its own
+//!         data layout, region placement, perf energy model and stats. An extra target that
+//!         cannot be created is skipped with a warning
+void
+pimSim::createExtraTargets()
+{
+  for (size_t i = 0; i < m_config.getNumExtraSimTargets(); ++i) {
+    extraTarget target;
+    target.m_config = std::make_unique<pimSimConfig>(m_config.getExtraSimTargetConfig(i));
+    if (!target.m_config->getMemConfigFile().empty()) {
+      target.m_paramsDram = pimParamsDram::createFromConfig(target.m_config->getMemConfigFile());
+    } else {
+      target.m_paramsDram = pimParamsDram::create(target.m_config->getMemoryProtocol());
+    }
+    std::string targetName = pimUtils::pimDeviceEnumToStr(target.m_config->getSimTarget());
+    std::printf("PIM-Info: Creating extra simulation target %s\n", targetName.c_str());
+    target.m_device = std::make_unique<pimDevice>(this, *target.m_config, *target.m_paramsDram);
+    if (!target.m_device->isValid()) {
+      std::printf("PIM-Warning: Failed to create extra simulation target %s. Skipped.\n", targetName.c_str());
+      continue;
+    }
+    target.m_statsMgr = std::make_unique<pimStatsMgr>();
+    if (const pimPerfEnergyBase* perfEnergyModel = target.m_device->getPerfEnergyModel()) {
+      target.m_statsMgr->setBusTurnaround(perfEnergyModel->getMsReadToWrite(), perfEnergyModel->getMsWriteToRead());
+    }
+    target.m_isValid = true;
+    m_extraTargets.push_back(std::move(target));
+  }
+}
+
+//! @brief  Allocate the same PIM object on all extra simulation targets with the same object ID
+void
+pimSim::syncAllocToExtraTargets(PimObjId objId, const std::function<PimObjId(pimDevice*)>& alloc)
+{
+  if (objId == -1) {
+    return;
+  }
+  for (auto& target : m_extraTargets) {
+    if (!target.m_isValid) {
+      continue;
+    }
+    target.m_device->getResMgr()->setNextObjId(objId);
+    if (alloc(target.m_device.get()) != objId) {
+      std::printf("PIM-Warning: Failed to allocate PIM object %d on extra simulation target %s. Disabled this target.\n",
+                  objId, pimUtils::pimDeviceEnumToStr(target.m_config->getSimTarget()).c_str());
+      target.m_isValid = false;
+    }
+  }
+}
+
+//! @brief  Model perf and energy of an executed command on all extra simulation targets
+void
+pimSim::updateStatsOfExtraTargets(pimCmd& cmd)
+{
+  if (m_extraTargets.empty()) {
+    return;
+  }
+  // micro ops are specific to the bit-serial architecture of the primary device
+  if (cmd.isMicroOp()) {
+    if (!m_hasSkippedMicroOps.exchange(true)) {
+      std::printf("PIM-Warning: Micro ops are not modeled on extra simulation targets\n");
+    }
+    return;
+  }
+  for (auto& target : m_extraTargets) {
+    if (target.m_isValid) {
+      cmd.updateStatsOnDevice(target.m_device.get(), target.m_statsMgr.get());
+    }
+  }
+}
+
+//! @brief  Get names and stats of the primary device and all extra simulation targets, or none without extra targets.
+//!         Stats of a disabled target are null
+std::vector<pimStatsTarget>
+pimSim::getStatsTargets() const
+{
+  std::vector<pimStatsTarget> targets;
+  if (m_extraTargets.empty()) {
+    return targets;
+  }
+  targets.push_back({ pimUtils::pimDeviceEnumToStr(getSimTarget()), m_statsMgr.get(), m_device->getResMgr()->getNumHostDataBytes() });
+  for (const auto& target : m_extraTargets) {
+    std::string targetName = pimUtils::pimDeviceEnumToStr(target.m_config->getSimTarget());
+    if (!target.m_config->getMemConfigFile().empty() && target.m_config->getMemConfigFile() != m_config.getMemConfigFile()) {
+      targetName += ":" + std::filesystem::path(target.m_config->getMemConfigFile()).filename().string();
+    }
+    if (target.m_isValid) {
+      targets.push_back({ targetName, target.m_statsMgr.get(), target.m_device->getResMgr()->getNumHostDataBytes() });
+    } else {
+      targets.push_back({ targetName, nullptr, 0 });
+    }
+  }
+  return targets;
+}
+
 //! @brief  Delete PIM device
 bool
 pimSim::deleteDevice()
 {
+  const std::string& statsOutFile = m_config.getStatsOutFile();
+  if (!statsOutFile.empty() && isValidDevice(false)) {
+    bool isCsv = std::filesystem::path(statsOutFile).extension() == ".csv";
+    m_statsMgr->exportStats(statsOutFile, isCsv ? PIM_STATS_CSV : PIM_STATS_JSON, getStatsTargets());
+  }
+  if (pimChromeTrace::getContext() == this) {
+    pimChromeTrace::flush();
+  }
   uninit();
   return true;
 }
@@ -155,6 +351,16 @@ pimSim::isValidDevice(bool showMsg) const
   return isValid;
 }
 
+//! @brief  Get the stream mgr of current device
+pimStreamMgr*
+pimSim::getStreamMgr() const
+{
+  if (!isValidDevice()) {
+    return nullptr;
+  }
+  return m_streamMgr.get();
+}
+
 //! @brief  Get number of PIM cores
 unsigned
 pimSim::getNumCores() const
@@ -185,7 +391,20 @@ pimSim::getNumCols() const
   return 0;
 }
 
-//! @brief  Get number of columns per PIM core
+//! @brief  Get number of host bytes of a PIM object within range [idxBegin, idxEnd). Use full range if idxEnd is 0
+uint64_t
+pimSim::getNumHostBytes(PimObjId objId, uint64_t idxBegin, uint64_t idxEnd) const
+{
+  if (!m_device || !m_device->isValid() || !m_device->getResMgr()->isValidObjId(objId)) {
+    return 0;
+  }
+  const pimObjInfo& obj = m_device->getResMgr()->getObjInfo(objId);
+  uint64_t numElements = (idxEnd == 0 ? obj.getNumElements() : idxEnd - idxBegin);
+  unsigned bytesPerElement = (pimUtils::getNumBitsOfDataType(obj.getDataType(), PimBitWidth::HOST) + 7) / 8;
+  return numElements * bytesPerElement;
+}
+
+//! @brief  Get the perf energy model of current device
 pimPerfEnergyBase*
 pimSim::getPerfEnergyModel()
 {
@@ -195,11 +414,18 @@ pimSim::getPerfEnergyModel()
   return nullptr;
 }
 
+//! @brief  Get the stats manager of current device
+pimStatsMgr*
+pimSim::getStatsMgr()
+{
+  return m_statsMgr.get();
+}
+
 //! @brief  Start timer for a PIM kernel to measure CPU runtime and DRAM refresh
 void
-pimSim::startKernelTimer() const
+pimSim::startKernelTimer(const std::string& tag) const
 {
-  m_statsMgr->startKernelTimer();
+  m_statsMgr->startKernelTimer(tag);
 }
 
 //! @brief  End timer for a PIM kernel to measure CPU runtime and DRAM refresh
@@ -214,6 +440,10 @@ void
 pimSim::showStats() const
 {
   m_statsMgr->showStats();
+  m_streamMgr->showStats();
+  if (!m_extraTargets.empty()) {
+    pimStatsMgr::showMultiTargetStats(getStatsTargets());
+  }
 }
 
 //! @brief  Reset PIM command stats
@@ -221,6 +451,48 @@ void
 pimSim::resetStats() const
 {
   m_statsMgr->resetStats();
+  m_streamMgr->resetStats();
+  for (const auto& target : m_extraTargets) {
+    target.m_statsMgr->resetStats();
+  }
+}
+
+//! @brief  Get number of row read, row write and logic micro ops since last stats reset
+bool
+pimSim::getMicroOpStats(unsigned* numR, unsigned* numW, unsigned* numL) const
+{
+  if (!isValidDevice()) { return false; }
+  if (!numR || !numW || !numL) {
+    std::printf("PIM-Error: Invalid null pointer as micro op stats output\n");
+    return false;
+  }
+  m_statsMgr->getMicroOpStats(*numR, *numW, *numL);
+  return true;
+}
+
+//! @brief  Get summary of estimated runtime and energy since last stats reset
+bool
+pimSim::getStatsSummary(PimStatsSummary* summary) const
+{
+  if (!isValidDevice()) { return false; }
+  if (!summary) {
+    std::printf("PIM-Error: Invalid null pointer as stats summary output\n");
+    return false;
+  }
+  m_statsMgr->getStatsSummary(*summary);
+  return true;
+}
+
+//! @brief  Export stats since last stats reset to a file
+bool
+pimSim::exportStats(const char* filePath, PimStatsFormatEnum format) const
+{
+  if (!isValidDevice()) { return false; }
+  if (!filePath) {
+    std::printf("PIM-Error: Invalid null pointer as stats file path\n");
+    return false;
+  }
+  return m_statsMgr->exportStats(filePath, format, getStatsTargets());
 }
 
 //! @brief  Allocate a PIM object
@@ -229,7 +501,10 @@ pimSim::pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataT
 {
   pimPerfMon perfMon("pimAlloc");
   if (!isValidDevice()) { return -1; }
-  return m_device->pimAlloc(allocType, numElements, dataType);
+  std::lock_guard<std::mutex> lock(m_allocMutex);
+  PimObjId objId = m_device->pimAlloc(allocType, numElements, dataType);
+  syncAllocToExtraTargets(objId, [&](pimDevice* device) { return device->pimAlloc(allocType, numElements, dataType); });
+  return objId;
 }
 
 //! @brief  Allocate a PIM object that is associated with an existing ojbect
@@ -238,7 +513,10 @@ pimSim::pimAllocAssociated(PimObjId assocId, PimDataType dataType)
 {
   pimPerfMon perfMon("pimAllocAssociated");
   if (!isValidDevice()) { return -1; }
-  return m_device->pimAllocAssociated(assocId, dataType);
+  std::lock_guard<std::mutex> lock(m_allocMutex);
+  PimObjId objId = m_device->pimAllocAssociated(assocId, dataType);
+  syncAllocToExtraTargets(objId, [&](pimDevice* device) { return device->pimAllocAssociated(assocId, dataType); });
+  return objId;
 }
 
 PimObjId
@@ -246,7 +524,34 @@ pimSim::pimAllocBuffer(uint32_t numElements, PimDataType dataType)
 {
   pimPerfMon perfMon("pimAllocBuffer");
   if (!isValidDevice()) { return -1; }
-  return m_device->pimAllocBuffer(numElements, dataType);
+  std::lock_guard<std::mutex> lock(m_allocMutex);
+  PimObjId objId = m_device->pimAllocBuffer(numElements, dataType);
+  syncAllocToExtraTargets(objId, [&](pimDevice* device) { return device->pimAllocBuffer(numElements, dataType); });
+  return objId;
+}
+
+//! @brief  Allocate a PIM object of custom bit-width integers
+PimObjId
+pimSim::pimAllocCustomInt(PimAllocEnum allocType, uint64_t numElements, unsigned numBits, bool isSigned)
+{
+  pimPerfMon perfMon("pimAllocCustomInt");
+  if (!isValidDevice()) { return -1; }
+  std::lock_guard<std::mutex> lock(m_allocMutex);
+  PimObjId objId = m_device->pimAllocCustomInt(allocType, numElements, numBits, isSigned);
+  syncAllocToExtraTargets(objId, [&](pimDevice* device) { return device->pimAllocCustomInt(allocType, numElements, numBits, isSigned); });
+  return objId;
+}
+
+//! @brief  Allocate a PIM object of custom bit-width integers associated with an existing object
+PimObjId
+pimSim::pimAllocAssociatedCustomInt(PimObjId assocId, unsigned numBits, bool isSigned)
+{
+  pimPerfMon perfMon("pimAllocAssociatedCustomInt");
+  if (!isValidDevice()) { return -1; }
+  std::lock_guard<std::mutex> lock(m_allocMutex);
+  PimObjId objId = m_device->pimAllocAssociatedCustomInt(assocId, numBits, isSigned);
+  syncAllocToExtraTargets(objId, [&](pimDevice* device) { return device->pimAllocAssociatedCustomInt(assocId, numBits, isSigned); });
+  return objId;
 }
 
 // @brief  Free a PIM object
@@ -255,6 +560,12 @@ pimSim::pimFree(PimObjId obj)
 {
   pimPerfMon perfMon("pimFree");
   if (!isValidDevice()) { return false; }
+  std::lock_guard<std::mutex> lock(m_allocMutex);
+  for (auto& target : m_extraTargets) {
+    if (target.m_isValid && target.m_device->getResMgr()->isValidObjId(obj)) {
+      target.m_device->pimFree(obj);
+    }
+  }
   return m_device->pimFree(obj);
 }
 
@@ -264,7 +575,10 @@ pimSim::pimCreateRangedRef(PimObjId refId, uint64_t idxBegin, uint64_t idxEnd)
 {
   pimPerfMon perfMon("pimCreateRangedRef");
   if (!isValidDevice()) { return -1; }
-  return m_device->pimCreateRangedRef(refId, idxBegin, idxEnd);
+  std::lock_guard<std::mutex> lock(m_allocMutex);
+  PimObjId objId = m_device->pimCreateRangedRef(refId, idxBegin, idxEnd);
+  syncAllocToExtraTargets(objId, [&](pimDevice* device) { return device->pimCreateRangedRef(refId, idxBegin, idxEnd); });
+  return objId;
 }
 
 //! @brief  Create an obj referencing to negation of an existing obj based on dual-contact memory cells
@@ -273,7 +587,10 @@ pimSim::pimCreateDualContactRef(PimObjId refId)
 {
   pimPerfMon perfMon("pimCreateDualContactRef");
   if (!isValidDevice()) { return -1; }
-  return m_device->pimCreateDualContactRef(refId);
+  std::lock_guard<std::mutex> lock(m_allocMutex);
+  PimObjId objId = m_device->pimCreateDualContactRef(refId);
+  syncAllocToExtraTargets(objId, [&](pimDevice* device) { return device->pimCreateDualContactRef(refId); });
+  return objId;
 }
 
 // @brief  Copy data from main memory to PIM device within a range
@@ -973,6 +1290,7 @@ pimSim::pimOpReadRowToSa(PimObjId objId, unsigned ofst)
 {
   pimPerfMon perfMon("pimOpReadRowToSa");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_READ_ROW_TO_SA, objId, ofst}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdReadRowToSa>(PimCmdEnum::ROW_R, objId, ofst);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -982,6 +1300,7 @@ pimSim::pimOpWriteSaToRow(PimObjId objId, unsigned ofst)
 {
   pimPerfMon perfMon("pimOpWriteSaToRow");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_WRITE_SA_TO_ROW, objId, ofst}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdWriteSaToRow>(PimCmdEnum::ROW_W, objId, ofst);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -990,7 +1309,15 @@ bool
 pimSim::pimOpTRA(PimObjId src1, unsigned ofst1, PimObjId src2, unsigned ofst2, PimObjId src3, unsigned ofst3)
 {
   pimPerfMon perfMon("pimOpTRA");
-  return false;
+  if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) {
+    std::printf("PIM-Error: pimOpTRA is not supported in micro-kernel recording\n");
+    return false;
+  }
+  // triple row activation is an AP on three rows
+  std::vector<std::pair<PimObjId, unsigned>> srcRows = { {src1, ofst1}, {src2, ofst2}, {src3, ofst3} };
+  std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdAnalogAAP>(PimCmdEnum::ROW_AP, srcRows);
+  return m_device->executeCmd(std::move(cmd));
 }
 
 bool
@@ -998,6 +1325,7 @@ pimSim::pimOpMove(PimObjId objId, PimRowReg src, PimRowReg dest)
 {
   pimPerfMon perfMon("pimOpMove");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_MOV, objId, 0, dest, src}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_MOV, objId, dest, src);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1007,6 +1335,7 @@ pimSim::pimOpSet(PimObjId objId, PimRowReg dest, bool val)
 {
   pimPerfMon perfMon("pimOpSet");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_SET, objId, 0, dest, PIM_RREG_NONE, PIM_RREG_NONE, PIM_RREG_NONE, val}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_SET, objId, dest, val);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1016,6 +1345,7 @@ pimSim::pimOpNot(PimObjId objId, PimRowReg src, PimRowReg dest)
 {
   pimPerfMon perfMon("pimOpNot");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_NOT, objId, 0, dest, src}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_NOT, objId, dest, src);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1025,6 +1355,7 @@ pimSim::pimOpAnd(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   pimPerfMon perfMon("pimOpAnd");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_AND, objId, 0, dest, src1, src2}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_AND, objId, dest, src1, src2);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1034,6 +1365,7 @@ pimSim::pimOpOr(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   pimPerfMon perfMon("pimOpOr");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_OR, objId, 0, dest, src1, src2}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_OR, objId, dest, src1, src2);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1043,6 +1375,7 @@ pimSim::pimOpNand(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest
 {
   pimPerfMon perfMon("pimOpNand");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_NAND, objId, 0, dest, src1, src2}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_NAND, objId, dest, src1, src2);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1052,6 +1385,7 @@ pimSim::pimOpNor(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   pimPerfMon perfMon("pimOpNor");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_NOR, objId, 0, dest, src1, src2}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_NOR, objId, dest, src1, src2);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1061,6 +1395,7 @@ pimSim::pimOpXor(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest)
 {
   pimPerfMon perfMon("pimOpXor");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_XOR, objId, 0, dest, src1, src2}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_XOR, objId, dest, src1, src2);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1070,6 +1405,7 @@ pimSim::pimOpXnor(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg dest
 {
   pimPerfMon perfMon("pimOpXnor");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_XNOR, objId, 0, dest, src1, src2}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_XNOR, objId, dest, src1, src2);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1079,6 +1415,7 @@ pimSim::pimOpMaj(PimObjId objId, PimRowReg src1, PimRowReg src2, PimRowReg src3,
 {
   pimPerfMon perfMon("pimOpMaj");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_MAJ, objId, 0, dest, src1, src2, src3}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_MAJ, objId, dest, src1, src2, src3);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1088,6 +1425,7 @@ pimSim::pimOpSel(PimObjId objId, PimRowReg cond, PimRowReg src1, PimRowReg src2,
 {
   pimPerfMon perfMon("pimOpSel");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_SEL, objId, 0, dest, cond, src1, src2}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegOp>(PimCmdEnum::RREG_SEL, objId, dest, cond, src1, src2);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1097,6 +1435,7 @@ pimSim::pimOpRotateRH(PimObjId objId, PimRowReg src)
 {
   pimPerfMon perfMon("pimOpRotateRH");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_ROTATE_R, objId, 0, src}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegRotate>(PimCmdEnum::RREG_ROTATE_R, objId, src);
   return m_device->executeCmd(std::move(cmd));
 }
@@ -1106,21 +1445,76 @@ pimSim::pimOpRotateLH(PimObjId objId, PimRowReg src)
 {
   pimPerfMon perfMon("pimOpRotateLH");
   if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) { return m_device->recordMicroOp({PIM_MICRO_OP_ROTATE_L, objId, 0, src}); }
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdRRegRotate>(PimCmdEnum::RREG_ROTATE_L, objId, src);
   return m_device->executeCmd(std::move(cmd));
 }
 
 bool
-pimSim::pimOpAP(int numSrc, va_list args)
+pimSim::pimOpBatch(const PimMicroOp* ops, unsigned numOps)
 {
-  pimPerfMon perfMon("pimOpAP");
+  pimPerfMon perfMon("pimOpBatch");
+  if (!isValidDevice()) { return false; }
+  if (numOps == 0) { return true; }
+  if (!ops) { return false; }
+  if (m_device->isRecordingMicroKernel()) {
+    for (unsigned i = 0; i < numOps; ++i) {
+      if (!m_device->recordMicroOp(ops[i])) { return false; }
+    }
+    return true;
+  }
+  std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdOpBatch>(PimCmdEnum::OP_BATCH, ops, numOps);
+  return m_device->executeCmd(std::move(cmd));
+}
+
+bool
+pimSim::pimBeginMicroKernel(const std::vector<PimObjId>& params)
+{
+  pimPerfMon perfMon("pimBeginMicroKernel");
+  if (!isValidDevice()) { return false; }
+  return m_device->pimBeginMicroKernel(params);
+}
+
+PimMicroKernelId
+pimSim::pimEndMicroKernel(PimMicroKernelOptEnum opt)
+{
+  pimPerfMon perfMon("pimEndMicroKernel");
+  if (!isValidDevice()) { return -1; }
+  return m_device->pimEndMicroKernel(opt);
+}
+
+bool
+pimSim::pimRunMicroKernel(PimMicroKernelId kernelId, const std::vector<PimObjId>& objIds, unsigned ofstShift)
+{
+  pimPerfMon perfMon("pimRunMicroKernel");
+  if (!isValidDevice()) { return false; }
+  return m_device->pimRunMicroKernel(kernelId, objIds, ofstShift);
+}
+
+bool
+pimSim::pimDeleteMicroKernel(PimMicroKernelId kernelId)
+{
+  pimPerfMon perfMon("pimDeleteMicroKernel");
+  if (!isValidDevice()) { return false; }
+  return m_device->pimDeleteMicroKernel(kernelId);
+}
+
+bool
+pimSim::pimGetMicroKernelStats(PimMicroKernelId kernelId, PimMicroKernelStats* stats)
+{
+  pimPerfMon perfMon("pimGetMicroKernelStats");
   if (!isValidDevice()) { return false; }
+  return m_device->pimGetMicroKernelStats(kernelId, stats);
+}
 
-  std::vector<std::pair<PimObjId, unsigned>> srcRows;
-  for (int i = 0; i < numSrc; ++i) {
-    PimObjId objId = va_arg(args, PimObjId);
-    unsigned ofst = va_arg(args, unsigned);
-    srcRows.emplace_back(objId, ofst);
+bool
+pimSim::pimOpAP(const std::vector<std::pair<PimObjId, unsigned>>& srcRows)
+{
+  pimPerfMon perfMon("pimOpAP");
+  if (!isValidDevice()) { return false; }
+  if (m_device->isRecordingMicroKernel()) {
+    std::printf("PIM-Error: pimOpAP is not supported in micro-kernel recording\n");
+    return false;
   }
 
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdAnalogAAP>(PimCmdEnum::ROW_AP, srcRows);
@@ -1128,22 +1522,13 @@ pimSim::pimOpAP(int numSrc, va_list args)
 }
 
 bool
-pimSim::pimOpAAP(int numSrc, int numDest, va_list args)
+pimSim::pimOpAAP(const std::vector<std::pair<PimObjId, unsigned>>& srcRows, const std::vector<std::pair<PimObjId, unsigned>>& destRows)
 {
   pimPerfMon perfMon("pimOpAAP");
   if (!isValidDevice()) { return false; }
-
-  std::vector<std::pair<PimObjId, unsigned>> srcRows;
-  for (int i = 0; i < numSrc; ++i) {
-    PimObjId objId = va_arg(args, PimObjId);
-    int ofst = va_arg(args, unsigned);
-    srcRows.emplace_back(objId, ofst);
-  }
-  std::vector<std::pair<PimObjId, unsigned>> destRows;
-  for (int i = 0; i < numDest; ++i) {
-    PimObjId objId = va_arg(args, PimObjId);
-    int ofst = va_arg(args, unsigned);
-    destRows.emplace_back(objId, ofst);
+  if (m_device->isRecordingMicroKernel()) {
+    std::printf("PIM-Error: pimOpAAP is not supported in micro-kernel recording\n");
+    return false;
   }
 
   std::unique_ptr<pimCmd> cmd = std::make_unique<pimCmdAnalogAAP>(PimCmdEnum::ROW_AAP, srcRows, destRows);
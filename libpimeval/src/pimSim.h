@@ -13,18 +13,31 @@
 #include "pimParamsDram.h"
 #include "pimPerfEnergyBase.h"
 #include "pimStats.h"
+#include "pimStream.h"
 #include <cstdarg>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
 #include <memory>
+#include <vector>
+#include <functional>
 
 
 //! @class  pimSim
-//! @brief  PIM simulator singleton class
+//! @brief  PIM simulator. Each instance is a PIM context with its own device, config and stats
+//! APIs operate on the current context of the calling thread, which is the default context unless changed
 class pimSim
 {
 public:
   static pimSim* get();
+  static pimSim* getDefault();
   static void destroy();
 
+  // PIM contexts
+  static pimSim* createContext();
+  static bool deleteContext(pimSim* context);
+  static bool setCurrentContext(pimSim* context);
+
   // Device creation and deletion
   bool createDevice(PimDeviceEnum deviceType, unsigned numRanks, unsigned numBankPerRank, unsigned numSubarrayPerBank, unsigned numRows, unsigned numCols, unsigned bufferSize);
   bool createDeviceFromConfig(PimDeviceEnum deviceType, const char* configFileName);
@@ -48,21 +61,31 @@ public:
   unsigned getNumCores() const;
   unsigned getNumRows() const;
   unsigned getNumCols() const;
+  uint64_t getNumHostBytes(PimObjId objId, uint64_t idxBegin, uint64_t idxEnd) const;
 
-  void startKernelTimer() const;
+  void startKernelTimer(const std::string& tag = "") const;
   void endKernelTimer() const;
   void showStats() const;
   void resetStats() const;
-  pimStatsMgr* getStatsMgr() { return m_statsMgr.get(); }
+  bool getMicroOpStats(unsigned* numR, unsigned* numW, unsigned* numL) const;
+  bool getStatsSummary(PimStatsSummary* summary) const;
+  bool exportStats(const char* filePath, PimStatsFormatEnum format) const;
+  pimStatsMgr* getStatsMgr();
   const pimParamsDram& getParamsDram() const { assert(m_paramsDram); return *m_paramsDram; }
   pimPerfEnergyBase* getPerfEnergyModel();
 
   pimUtils::threadPool* getThreadPool() { return m_threadPool.get(); }
+  pimStreamMgr* getStreamMgr() const;
+
+  // Extra simulation targets
+  void updateStatsOfExtraTargets(pimCmd& cmd);
 
   // Resource allocation and deletion
   PimObjId pimAlloc(PimAllocEnum allocType, uint64_t numElements, PimDataType dataType);
   PimObjId pimAllocAssociated(PimObjId assocId, PimDataType dataType);
   PimObjId pimAllocBuffer(uint32_t numElements, PimDataType dataType);
+  PimObjId pimAllocCustomInt(PimAllocEnum allocType, uint64_t numElements, unsigned numBits, bool isSigned);
+  PimObjId pimAllocAssociatedCustomInt(PimObjId assocId, unsigned numBits, bool isSigned);
   bool pimFree(PimObjId obj);
   PimObjId pimCreateRangedRef(PimObjId refId, uint64_t idxBegin, uint64_t idxEnd);
   PimObjId pimCreateDualContactRef(PimObjId refId);
@@ -150,10 +173,16 @@ public:
   bool pimOpSel(PimObjId objId, PimRowReg cond, PimRowReg src1, PimRowReg src2, PimRowReg dest);
   bool pimOpRotateRH(PimObjId objId, PimRowReg src);
   bool pimOpRotateLH(PimObjId objId, PimRowReg src);
+  bool pimOpBatch(const PimMicroOp* ops, unsigned numOps);
+  bool pimBeginMicroKernel(const std::vector<PimObjId>& params);
+  PimMicroKernelId pimEndMicroKernel(PimMicroKernelOptEnum opt);
+  bool pimRunMicroKernel(PimMicroKernelId kernelId, const std::vector<PimObjId>& objIds, unsigned ofstShift);
+  bool pimDeleteMicroKernel(PimMicroKernelId kernelId);
+  bool pimGetMicroKernelStats(PimMicroKernelId kernelId, PimMicroKernelStats* stats);
 
   // SIMDRAM micro ops
-  bool pimOpAP(int numSrc, va_list args);
-  bool pimOpAAP(int numSrc, int numDest, va_list args);
+  bool pimOpAP(const std::vector<std::pair<PimObjId, unsigned>>& srcRows);
+  bool pimOpAAP(const std::vector<std::pair<PimObjId, unsigned>>& srcRows, const std::vector<std::pair<PimObjId, unsigned>>& destRows);
 
 private:
   pimSim();
@@ -161,9 +190,15 @@ private:
   pimSim(const pimSim&) = delete;
   pimSim operator=(const pimSim&) = delete;
   bool createDeviceCommon();
+  void createExtraTargets();
+  void syncAllocToExtraTargets(PimObjId objId, const std::function<PimObjId(pimDevice*)>& alloc);
+  std::vector<pimStatsTarget> getStatsTargets() const;
   void uninit();
 
-  static pimSim* s_instance;
+  static std::atomic<pimSim*> s_instance;
+  static std::mutex s_mutex;
+  static std::unordered_set<pimSim*> s_contexts;
+  static thread_local pimSim* s_current;
   pimSimConfig m_config;
 
   // support one device for now
@@ -171,7 +206,22 @@ private:
   std::unique_ptr<pimParamsDram> m_paramsDram;
   std::unique_ptr<pimStatsMgr> m_statsMgr;
   std::unique_ptr<pimUtils::threadPool> m_threadPool;
-
+  std::unique_ptr<pimStreamMgr> m_streamMgr;
+
+  //! @struct  pimSim::extraTarget
+  //! @brief  An extra simulation target which models perf and energy of all commands executed on the primary device
+  struct extraTarget {
+    std::unique_ptr<pimSimConfig> m_config;
+    std::unique_ptr<pimParamsDram> m_paramsDram;
+    std::unique_ptr<pimDevice> m_device;
+    std::unique_ptr<pimStatsMgr> m_statsMgr;
+    bool m_isValid = false;
+  };
+  std::vector<extraTarget> m_extraTargets;
+  std::atomic<bool> m_hasSkippedMicroOps = false;
+
+  // serialize PIM object allocation and deletion, while commands on disjoint objects run concurrently
+  std::mutex m_allocMutex;
 };
 
 #endif
@@ -7,6 +7,7 @@
 #include "pimSimConfig.h"
 #include "pimUtils.h"
 #include <algorithm>
+#include <cassert>
 #include <filesystem>
 #include <iomanip>
 #include <string>
@@ -58,6 +59,26 @@ pimSimConfig::show() const
 
   std::printf("PIM-Config: Number of Threads = %u\n", m_numThreads);
   std::printf("PIM-Config: Load Balanced = %s\n", m_loadBalanced ? "1" : "0");
+  if (!m_traceOutFile.empty()) {
+    std::printf("PIM-Config: API Trace File = %s, Payload = %s\n", m_traceOutFile.c_str(), m_tracePayload ? "1" : "0");
+  }
+  if (!m_statsOutFile.empty()) {
+    std::printf("PIM-Config: Stats Output File = %s\n", m_statsOutFile.c_str());
+  }
+  if (!m_chromeTraceFile.empty()) {
+    std::printf("PIM-Config: Chrome Trace File = %s\n", m_chromeTraceFile.c_str());
+  }
+  if (m_openPagePolicy) {
+    std::printf("PIM-Config: Row Buffer Policy = open\n");
+  }
+#ifdef DRAMSIM3_INTEG
+  std::printf("PIM-Config: DRAMsim3 Sample Interval = %u\n", m_dramSimSampleInterval);
+#endif
+  for (const auto& target : m_extraSimTargets) {
+    std::printf("PIM-Config: Extra Simulation Target = %s, Memory Config File: %s\n",
+              pimUtils::pimDeviceEnumToStr(target.m_simTarget).c_str(),
+              (target.m_memConfigFile.empty() ? "<DEFAULT>" : target.m_memConfigFile.c_str()));
+  }
   std::printf("----------------------------------------\n");
 }
 
@@ -91,6 +112,9 @@ pimSimConfig::deriveConfig(PimDeviceEnum deviceType,
   ok = ok & deriveNumThreads();
   ok = ok & deriveMiscEnvVars();
   ok = ok & deriveLoadBalance();
+  ok = ok & deriveExtraSimTargets();
+  ok = ok & deriveRowBufferPolicy();
+  ok = ok & deriveDramSimSampleInterval();
 
   // Show summary
   show();
@@ -240,36 +264,43 @@ pimSimConfig::deriveMemConfigFile()
   } else if (m_envParams.find(m_envVarMemConfig) != m_envParams.end()) {
     m_memConfigFile = m_envParams.at(m_envVarMemConfig);
   }
-  if (!m_memConfigFile.empty()) {
-    if (!std::filesystem::exists(m_memConfigFile)) {
+  return resolveMemConfigFile(m_memConfigFile, m_memoryProtocol);
+}
+
+//! @brief  Locate a memory config file and determine its memory protocol
+bool
+pimSimConfig::resolveMemConfigFile(std::string& memConfigFile, PimDeviceProtocolEnum& memoryProtocol) const
+{
+  if (!memConfigFile.empty()) {
+    if (!std::filesystem::exists(memConfigFile)) {
       // Try to find it in the same directory of sim config file
       std::string configFilePath = pimUtils::getDirectoryPath(m_simConfigFile);
-      if (std::filesystem::exists(configFilePath + "/" + m_memConfigFile)) {
-        m_memConfigFile = configFilePath + "/" + m_memConfigFile;
+      if (std::filesystem::exists(configFilePath + "/" + memConfigFile)) {
+        memConfigFile = configFilePath + "/" + memConfigFile;
       } else {
-        std::printf("PIM-Error: Cannot find memory config file: %s\n", m_memConfigFile.c_str());
+        std::printf("PIM-Error: Cannot find memory config file: %s\n", memConfigFile.c_str());
         return false;
       }
     }
 
     // Determine memory protocol from memory config file. This is not sim config file.
-    std::unordered_map<std::string, std::string> memParams = pimUtils::readParamsFromConfigFile(m_memConfigFile);
+    std::unordered_map<std::string, std::string> memParams = pimUtils::readParamsFromConfigFile(memConfigFile);
     if (memParams.find("protocol") != memParams.end()) {
       std::string protocol = memParams.at("protocol");
       if (protocol == "DDR3" || protocol == "DDR4" || protocol == "DDR5") {
-        m_memoryProtocol = PIM_DEVICE_PROTOCOL_DDR;
+        memoryProtocol = PIM_DEVICE_PROTOCOL_DDR;
       } else if (protocol == "LPDDR3" || protocol == "LPDDR4") {
-        m_memoryProtocol = PIM_DEVICE_PROTOCOL_LPDDR;
+        memoryProtocol = PIM_DEVICE_PROTOCOL_LPDDR;
       } else if (protocol == "HBM" || protocol == "HBM2") {
-        m_memoryProtocol = PIM_DEVICE_PROTOCOL_HBM;
+        memoryProtocol = PIM_DEVICE_PROTOCOL_HBM;
       } else if (protocol == "GDDR5" || protocol == "GDDR5X" || protocol == "GDDR6") {
-        m_memoryProtocol = PIM_DEVICE_PROTOCOL_GDDR;
+        memoryProtocol = PIM_DEVICE_PROTOCOL_GDDR;
       } else {
-        std::printf("PIM-Error: Unknown protocol %s in memory config file: %s\n", protocol.c_str(), m_memConfigFile.c_str());
+        std::printf("PIM-Error: Unknown protocol %s in memory config file: %s\n", protocol.c_str(), memConfigFile.c_str());
         return false;
       }
     } else {
-      std::printf("PIM-Error: Missing protocol parameter in memory config file: %s\n", m_memConfigFile.c_str());
+      std::printf("PIM-Error: Missing protocol parameter in memory config file: %s\n", memConfigFile.c_str());
       return false;
     }
   }
@@ -421,6 +452,24 @@ pimSimConfig::deriveMiscEnvVars()
     std::printf("PIM-Warning: Running analysis only mode. Ignoring computation for fast performance and energy analysis.\n");
   }
 
+  // API trace
+  m_traceOutFile = pimUtils::getOptionalParam(m_envParams, m_envVarTraceOut, hasVal);
+  m_tracePayload = false;  // off by default
+  valStr = pimUtils::getOptionalParam(m_envParams, m_envVarTracePayload, hasVal);
+  if (hasVal) {
+    if (valStr != "0" && valStr != "1") {
+      std::printf("PIM-Error: Incorrect environment variable: %s=%s\n", m_envVarTracePayload.c_str(), valStr.c_str());
+      return false;
+    }
+    m_tracePayload = (valStr == "1");
+  }
+
+  // Stats export
+  m_statsOutFile = pimUtils::getOptionalParam(m_envParams, m_envVarStatsOut, hasVal);
+
+  // Chrome trace
+  m_chromeTraceFile = pimUtils::getOptionalParam(m_envParams, m_envVarChromeTrace, hasVal);
+
   return true;
 }
 
@@ -452,3 +501,126 @@ pimSimConfig::deriveLoadBalance()
   return true;
 }
 
+//! @brief  Derive Params: Row buffer policy - Keep rows open across PIM commands in perf energy models
+bool
+pimSimConfig::deriveRowBufferPolicy()
+{
+  m_openPagePolicy = false;  // closed-page by default
+
+  // Check config file then env variable
+  bool hasVal = false;
+  std::string varName = m_cfgVarRowBufferPolicy;
+  std::string valStr = pimUtils::getOptionalParam(m_cfgParams, m_cfgVarRowBufferPolicy, hasVal);
+  if (!hasVal) {
+    varName = m_envVarRowBufferPolicy;
+    valStr = pimUtils::getOptionalParam(m_envParams, m_envVarRowBufferPolicy, hasVal);
+  }
+  if (hasVal) {
+    if (valStr != "closed" && valStr != "open") {
+      std::printf("PIM-Error: Incorrect PIMeval configuration: %s=%s\n", varName.c_str(), valStr.c_str());
+      return false;
+    }
+    m_openPagePolicy = (valStr == "open");
+  }
+  return true;
+}
+
+//! @brief  Derive Params: DRAMsim3 sample interval - Simulate every Nth PIM command with DRAMsim3
+bool
+pimSimConfig::deriveDramSimSampleInterval()
+{
+  m_dramSimSampleInterval = 1;  // simulate all commands by default
+
+  // Check config file then env variable
+  bool hasVal = false;
+  std::string varName = m_cfgVarDramSimSampleInterval;
+  std::string valStr = pimUtils::getOptionalParam(m_cfgParams, m_cfgVarDramSimSampleInterval, hasVal);
+  if (!hasVal) {
+    varName = m_envVarDramSimSampleInterval;
+    valStr = pimUtils::getOptionalParam(m_envParams, m_envVarDramSimSampleInterval, hasVal);
+  }
+  if (hasVal) {
+    unsigned val = 0;
+    if (!pimUtils::convertStringToUnsigned(valStr, val) || val == 0) {
+      std::printf("PIM-Error: Incorrect PIMeval configuration: %s=%s\n", varName.c_str(), valStr.c_str());
+      return false;
+    }
+    m_dramSimSampleInterval = val;
+  }
+  return true;
+}
+
+//! @brief  Derive Params: Extra simulation targets which are modeled along with the primary device
+bool
+pimSimConfig::deriveExtraSimTargets()
+{
+  m_extraSimTargets.clear();
+
+  // Check config file then env variable
+  bool hasVal = false;
+  std::string varName = m_cfgVarExtraSimTargets;
+  std::string valStr = pimUtils::getOptionalParam(m_cfgParams, m_cfgVarExtraSimTargets, hasVal);
+  if (!hasVal) {
+    varName = m_envVarExtraSimTargets;
+    valStr = pimUtils::getOptionalParam(m_envParams, m_envVarExtraSimTargets, hasVal);
+  }
+  if (!hasVal) {
+    return true;
+  }
+
+  // Parse a comma separated list of <PimDeviceEnum>[:<ini-file>]
+  size_t pos = 0;
+  while (pos <= valStr.size()) {
+    size_t end = valStr.find(',', pos);
+    if (end == std::string::npos) {
+      end = valStr.size();
+    }
+    std::string item = valStr.substr(pos, end - pos);
+    pos = end + 1;
+    pimUtils::trim(item);
+    if (item.empty()) {
+      continue;
+    }
+    extraSimTarget target;
+    std::string targetStr = item;
+    size_t colon = item.find(':');
+    if (colon != std::string::npos) {
+      targetStr = item.substr(0, colon);
+      target.m_memConfigFile = item.substr(colon + 1);
+      pimUtils::trim(targetStr);
+      pimUtils::trim(target.m_memConfigFile);
+    }
+    target.m_simTarget = pimUtils::strToPimDeviceEnum(targetStr);
+    if (target.m_simTarget == PIM_DEVICE_NONE || target.m_simTarget == PIM_FUNCTIONAL) {
+      std::printf("PIM-Error: Incorrect extra simulation target in %s: %s\n", varName.c_str(), targetStr.c_str());
+      return false;
+    }
+    // Use memory config of the primary device by default
+    if (target.m_memConfigFile.empty()) {
+      target.m_memConfigFile = m_memConfigFile;
+      target.m_memoryProtocol = m_memoryProtocol;
+    } else {
+      target.m_memoryProtocol = PIM_DEVICE_PROTOCOL_DDR;
+      if (!resolveMemConfigFile(target.m_memConfigFile, target.m_memoryProtocol)) {
+        return false;
+      }
+    }
+    m_extraSimTargets.push_back(target);
+  }
+  return true;
+}
+
+//! @brief  Get configuration of an extra simulation target. It is a functional device with the
+//!         extra simulation target and memory config, so that only perf and energy are modeled
+pimSimConfig
+pimSimConfig::getExtraSimTargetConfig(size_t index) const
+{
+  assert(index < m_extraSimTargets.size());
+  pimSimConfig config = *this;
+  config.m_deviceType = PIM_FUNCTIONAL;
+  config.m_simTarget = m_extraSimTargets[index].m_simTarget;
+  config.m_memConfigFile = m_extraSimTargets[index].m_memConfigFile;
+  config.m_memoryProtocol = m_extraSimTargets[index].m_memoryProtocol;
+  config.m_extraSimTargets.clear();
+  return config;
+}
@@ -28,6 +28,9 @@
 //!   num_col_per_subarray = <int>               // number of columns per subarray
 //!   max_num_threads = <int>                    // maximum number of threads used by simulation
 //!   should_load_balance = <0|1>                // distribute data evenly among all cores
+//!   extra_simulation_targets = <targets>       // extra targets modeled in the same run, see below
+//!   row_buffer_policy = <closed|open>          // row buffer policy of perf energy models
+//!   dramsim3_sample_interval = <int>           // simulate every Nth PIM command with DRAMsim3, see below
 //!
 //! Supported environment variables:
 //!   PIMEVAL_SIM_CONFIG <abs-path/cfg-file>     // PIMeval config file, e.g., abs-path/PIMeval_BitSimdV.cfg
@@ -42,6 +45,33 @@
 //!   PIMEVAL_ANALYSIS_MODE <0|1>                // PIMeval analysis mode
 //!   PIMEVAL_DEBUG <int>                        // PIMeval debug flags (see enum pimDebugFlags)
 //!   PIMEVAL_LOAD_BALANCE <0|1>                 // distribute data evenly among all cores
+//!   PIMEVAL_EXTRA_SIM_TARGETS <targets>        // extra targets modeled in the same run, see below
+//!   PIMEVAL_TRACE_OUT <trace-file>             // record PIM API calls to a binary trace file for replay
+//!   PIMEVAL_TRACE_PAYLOAD <0|1>                // include host data of host-to-device copies in the trace
+//!   PIMEVAL_STATS_OUT <stats-file>             // export stats at device deletion, as CSV if ending with .csv or JSON
+//!   PIMEVAL_CHROME_TRACE <json-file>           // record modeled and wall-clock timelines as Chrome trace events
+//!   PIMEVAL_ROW_BUFFER_POLICY <closed|open>    // row buffer policy of perf energy models
+//!   PIMEVAL_DRAMSIM3_SAMPLE_INTERVAL <int>     // simulate every Nth PIM command with DRAMsim3, see below
+//!
+//! Extra simulation targets:
+//! * A comma separated list of <PimDeviceEnum>[:<ini-file>], e.g., PIM_DEVICE_FULCRUM,PIM_DEVICE_AIM:HBM2_8Gb_x128.ini
+//! * Every PIM command is functionally simulated once on the primary device, and its performance and energy
+//!   are also modeled on each extra target, with target specific data layout and region placement
+//! * An extra target without a memory config file uses the same memory config as the primary device
+//!
+//! PIM API trace:
+//! * All successful PIM API calls are recorded with object IDs, allocation shapes, scalars and copy ranges
+//! * A trace can be replayed with pimReplayTrace or tools/trace-replay on any device config without the application
+//!
+//! Row buffer policy:
+//! * closed: Every PIM command activates its rows and precharges them afterwards (default)
+//! * open: Rows stay open after a PIM command, and the next command reading the same rows skips activation.
+//!   Modeled by bank-level, Fulcrum and Aquabolt targets
+//!
+//! DRAMsim3 cycle-level timing:
+//! * Requires `make dramsim3_integ` and a memory config file, which is the DRAMsim3 config file
+//! * Row accesses of PIM commands and data copies are simulated by DRAMsim3 alongside the analytical models
+//! * With a sample interval N, every Nth command is simulated, and the rest are extrapolated (default 1)
 //!
 //! Precedence rules (highest to lowest priority):
 //! * Config file: Either from -c command-line argument or from PIMEVAL_SIM_CONFIG
@@ -93,6 +123,14 @@ public:
   bool isAnalysisMode() const { return m_analysisMode; }
   unsigned getDebug() const { return m_debug; }
   bool isLoadBalanced() const { return m_loadBalanced; }
+  const std::string& getTraceOutFile() const { return m_traceOutFile; }
+  bool isTracePayloadOn() const { return m_tracePayload; }
+  const std::string& getStatsOutFile() const { return m_statsOutFile; }
+  const std::string& getChromeTraceFile() const { return m_chromeTraceFile; }
+  bool isOpenPagePolicy() const { return m_openPagePolicy; }
+  unsigned getDramSimSampleInterval() const { return m_dramSimSampleInterval; }
+  size_t getNumExtraSimTargets() const { return m_extraSimTargets.size(); }
+  pimSimConfig getExtraSimTargetConfig(size_t index) const;
 
   enum pimDebugFlags
   {
@@ -101,6 +139,7 @@ public:
     DEBUG_CMDS        = 0x0004,
     DEBUG_ALLOC       = 0x0008,
     DEBUG_PERF        = 0x0010,
+    DEBUG_HEATMAP     = 0x0020,
   };
 
 private:
@@ -125,6 +164,10 @@ private:
   bool deriveNumThreads();
   bool deriveMiscEnvVars();
   bool deriveLoadBalance();
+  bool deriveExtraSimTargets();
+  bool deriveRowBufferPolicy();
+  bool deriveDramSimSampleInterval();
+  bool resolveMemConfigFile(std::string& memConfigFile, PimDeviceProtocolEnum& memoryProtocol) const;
 
   bool parseConfigFromFile(const std::string& config, unsigned& numRanks, unsigned& numBankPerRank, unsigned& numSubarrayPerBank, unsigned& numRows, unsigned& numCols);
 
@@ -139,6 +182,9 @@ private:
   inline static const std::string m_cfgVarMaxNumThreads = "max_num_threads";
   inline static const std::string m_cfgVarLoadBalance = "should_load_balance";
   inline static const std::string m_cfgVarBufferSize = "buffer_size";
+  inline static const std::string m_cfgVarExtraSimTargets = "extra_simulation_targets";
+  inline static const std::string m_cfgVarRowBufferPolicy = "row_buffer_policy";
+  inline static const std::string m_cfgVarDramSimSampleInterval = "dramsim3_sample_interval";
 
   // Environment variables
   inline static const std::string m_envVarSimConfig = "PIMEVAL_SIM_CONFIG";
@@ -154,6 +200,13 @@ private:
   inline static const std::string m_envVarAnalysisMode = "PIMEVAL_ANALYSIS_MODE";
   inline static const std::string m_envVarDebug = "PIMEVAL_DEBUG";
   inline static const std::string m_envVarLoadBalance = "PIMEVAL_LOAD_BALANCE";
+  inline static const std::string m_envVarExtraSimTargets = "PIMEVAL_EXTRA_SIM_TARGETS";
+  inline static const std::string m_envVarTraceOut = "PIMEVAL_TRACE_OUT";
+  inline static const std::string m_envVarTracePayload = "PIMEVAL_TRACE_PAYLOAD";
+  inline static const std::string m_envVarStatsOut = "PIMEVAL_STATS_OUT";
+  inline static const std::string m_envVarChromeTrace = "PIMEVAL_CHROME_TRACE";
+  inline static const std::string m_envVarRowBufferPolicy = "PIMEVAL_ROW_BUFFER_POLICY";
+  inline static const std::string m_envVarDramSimSampleInterval = "PIMEVAL_DRAMSIM3_SAMPLE_INTERVAL";
 
   // Add env vars to this list for readEnvVars
   inline static const std::vector<std::string> m_envVarList = {
@@ -170,6 +223,13 @@ private:
     m_envVarDebug,
     m_envVarLoadBalance,
     m_envVarBufferSize,
+    m_envVarExtraSimTargets,
+    m_envVarTraceOut,
+    m_envVarTracePayload,
+    m_envVarStatsOut,
+    m_envVarChromeTrace,
+    m_envVarRowBufferPolicy,
+    m_envVarDramSimSampleInterval,
   };
 
   // Default values if not specified during init
@@ -198,6 +258,13 @@ private:
     m_analysisMode = false;
     m_debug = 0;
     m_loadBalanced = false;
+    m_traceOutFile.clear();
+    m_tracePayload = false;
+    m_statsOutFile.clear();
+    m_chromeTraceFile.clear();
+    m_openPagePolicy = false;
+    m_dramSimSampleInterval = 1;
+    m_extraSimTargets.clear();
     m_envParams.clear();
     m_cfgParams.clear();
     m_isInit = false;
@@ -219,6 +286,21 @@ private:
   bool m_analysisMode;
   unsigned m_debug;
   bool m_loadBalanced;
+  std::string m_traceOutFile;
+  bool m_tracePayload;
+  std::string m_statsOutFile;
+  std::string m_chromeTraceFile;
+  bool m_openPagePolicy;
+  unsigned m_dramSimSampleInterval;
+
+  //! @struct  pimSimConfig::extraSimTarget
+  //! @brief  An extra simulation target with its own memory config
+  struct extraSimTarget {
+    PimDeviceEnum m_simTarget;
+    std::string m_memConfigFile;
+    PimDeviceProtocolEnum m_memoryProtocol;
+  };
+  std::vector<extraSimTarget> m_extraSimTargets;
 
   // Store original parameters for extension purpose
   std::unordered_map<std::string, std::string> m_envParams;
@@ -5,31 +5,48 @@
 // See the LICENSE file in the root of this repository for more details.
 
 #include "pimStats.h"
+#include "pimChromeTrace.h"
+#include "pimCmd.h"
+#include "pimResMgr.h"
 #include "pimSim.h"
+#include "pimPerfEnergyBase.h"
 #include "pimUtils.h"
+#include <algorithm>         // for max
 #include <chrono>            // for chrono
+#include <cmath>             // for ceil
+#include <cinttypes>         // for PRIu64
 #include <cstdint>           // for uint64_t
-#include <cstdio>            // for printf
+#include <cstdio>            // for printf, snprintf
+#include <fstream>           // for ofstream
 #include <iomanip>           // for setw, fixed, setprecision
 
 
+thread_local pimStatsMgr::apiScope pimStatsMgr::s_apiScope;
+
 //! @brief  Show PIM stats
 void
 pimStatsMgr::showStats() const
 {
+  statsData stats = getMergedStats();
   std::printf("----------------------------------------\n");
   if (pimSim::get()->isDebug(pimSimConfig::DEBUG_API_CALLS)) {
-    showApiStats();
+    showApiStats(stats);
   }
   showDeviceParams();
-  showCopyStats();
-  showCmdStats();
+  showCopyStats(stats);
+  showCmdStats(stats);
+  showDramSimStats(stats);
+  showCoreOccupancyStats(stats);
+  if (pimSim::get()->isDebug(pimSimConfig::DEBUG_HEATMAP)) {
+    showCoreHeatmap(stats);
+  }
+  showRegionStats();
   std::printf("----------------------------------------\n");
 }
 
 //! @brief  Show API stats
 void
-pimStatsMgr::showApiStats() const
+pimStatsMgr::showApiStats(const statsData& stats) const
 {
   std::printf("Simulator API Stats:\n");
   std::printf(" %30s : %10s %14s\n", "PIM-API", "CNT", "Elapsed(ms)");
@@ -43,7 +60,7 @@ pimStatsMgr::showApiStats() const
   double msTotalElapsedAlloc = 0.0;
   double msTotalElapsedCopy = 0.0;
   double msTotalElapsedCompute = 0.0;
-  for (const auto& it : m_msElapsed) {
+  for (const auto& it : stats.m_msElapsed) {
     std::printf(" %30s : %10d %14f\n", it.first.c_str(), it.second.first, it.second.second);
     totCalls += it.second.first;
     msTotalElapsed += it.second.second;
@@ -91,6 +108,13 @@ pimStatsMgr::showDeviceParams() const
   std::printf(" %30s : %f\n", "Row Read (ns)", paramsDram.getNsRowRead());
   std::printf(" %30s : %f\n", "Row Write (ns)", paramsDram.getNsRowWrite());
   std::printf(" %30s : %f\n", "tCCD (ns)", paramsDram.getNsTCCD_S());
+  const pimPerfEnergyBase* perfEnergyModel = pimSim::get()->getPerfEnergyModel();
+  if (perfEnergyModel) {
+    std::printf(" %30s : %u, %u\n", "Channels, Ranks per Channel", perfEnergyModel->getNumChannels(), perfEnergyModel->getNumRanksPerChannel());
+  }
+  if (perfEnergyModel && perfEnergyModel->isOpenPagePolicy()) {
+    std::printf(" %30s : %s\n", "Row Buffer Policy", "open");
+  }
   if (pimSim::get()->isDebug(pimSimConfig::DEBUG_PERF)) {
     std::printf(" %30s : %f\n", "AAP (ns)", paramsDram.getNsAAP());
   }
@@ -98,15 +122,15 @@ pimStatsMgr::showDeviceParams() const
 
 //! @brief  Show data copy stats
 void
-pimStatsMgr::showCopyStats() const
+pimStatsMgr::showCopyStats(const statsData& stats) const
 {
   std::printf("Data Copy Stats:\n");
-  uint64_t bytesCopiedMainToDevice = m_bitsCopiedMainToDevice / 8;
-  uint64_t bytesCopiedDeviceToMain = m_bitsCopiedDeviceToMain / 8;
-  uint64_t bytesCopiedDeviceToDevice = m_bitsCopiedDeviceToDevice / 8;
+  uint64_t bytesCopiedMainToDevice = stats.m_bitsCopiedMainToDevice / 8;
+  uint64_t bytesCopiedDeviceToMain = stats.m_bitsCopiedDeviceToMain / 8;
+  uint64_t bytesCopiedDeviceToDevice = stats.m_bitsCopiedDeviceToDevice / 8;
   uint64_t totalBytes = bytesCopiedMainToDevice + bytesCopiedDeviceToMain;
-  double totalMsRuntime = m_elapsedTimeCopiedMainToDevice + m_elapsedTimeCopiedDeviceToMain + m_elapsedTimeCopiedDeviceToDevice;
-  double totalMjEnergy = m_mJCopiedMainToDevice + m_mJCopiedDeviceToMain + m_mJCopiedDeviceToDevice;
+  double totalMsRuntime = stats.m_elapsedTimeCopiedMainToDevice + stats.m_elapsedTimeCopiedDeviceToMain + stats.m_elapsedTimeCopiedDeviceToDevice;
+  double totalMjEnergy = stats.m_mJCopiedMainToDevice + stats.m_mJCopiedDeviceToMain + stats.m_mJCopiedDeviceToDevice;
   std::printf(" %45s : %llu bytes\n", "Host to Device", (unsigned long long)bytesCopiedMainToDevice);
   std::printf(" %45s : %llu bytes\n", "Device to Host", (unsigned long long)bytesCopiedDeviceToMain);
   std::printf(" %45s : %llu bytes\n", "Device to Device", (unsigned long long)bytesCopiedDeviceToDevice);
@@ -115,7 +139,7 @@ pimStatsMgr::showCopyStats() const
 
 //! @brief  Show PIM cmd and perf stats
 void
-pimStatsMgr::showCmdStats() const
+pimStatsMgr::showCmdStats(const statsData& stats) const
 {
   std::printf("PIM Command Stats:\n");
   std::printf(" %44s : %10s %14s %14s %14s %7s %7s %7s\n", "PIM-CMD", "CNT", "Runtime(ms)", "Energy(mJ)", "GOPS/W", "%R", "%W", "%L");
@@ -126,7 +150,7 @@ pimStatsMgr::showCmdStats() const
   double totalMsWrite = 0.0;
   double totalMsCompute = 0.0;
   uint64_t totalOp = 0;
-  for (const auto& it : m_cmdPerf) {
+  for (const auto& it : stats.m_cmdPerf) {
     double cmdRuntime = it.second.second.m_msRuntime;
     double percentRead = cmdRuntime == 0.0 ? 0.0 : (it.second.second.m_msRead * 100 / cmdRuntime);
     double percentWrite = cmdRuntime == 0.0 ? 0.0 : (it.second.second.m_msWrite * 100 / cmdRuntime);
@@ -143,50 +167,668 @@ pimStatsMgr::showCmdStats() const
     totalOp += it.second.second.m_totalOp;
   }
   std::printf(" %44s : %10d %14f %14f %14f %7.2f %7.2f %7.2f\n", "TOTAL ---------", totalCmd, totalMsRuntime, totalMjEnergy, (totalOp * 1.0 / totalMjEnergy * 1e-6), (totalMsRead / totalCmd), (totalMsWrite / totalCmd), (totalMsCompute / totalCmd) );
+  // commands on disjoint cores overlap on the modeled timeline
+  std::printf(" %44s : %10s %14f\n", "MAKESPAN ------", "", m_cmdTimeline.getMsCriticalPath());
+  // refreshes stall PIM commands, which is not included in the total above
+  uint64_t numRefresh = 0;
+  pimeval::perfEnergy refresh = getPerfEnergyForRefresh(totalMsRuntime, numRefresh);
+  std::printf(" %44s : %10" PRIu64 " %14f %14f\n", "REFRESH -------", numRefresh, refresh.m_msRuntime, refresh.m_mjEnergy);
   // analyze micro-ops
-  int numR = 0;
-  int numW = 0;
-  int numL = 0;
-  int numActivate = 0;
-  int numPrecharge = 0;
-  for (const auto& it : m_cmdPerf) {
+  unsigned numR = 0;
+  unsigned numW = 0;
+  unsigned numL = 0;
+  countMicroOps(stats, numR, numW, numL);
+  // each row read or write activates and precharges a row
+  unsigned numActivate = numR + numW;
+  unsigned numPrecharge = numR + numW;
+  if (numR > 0 || numW > 0 || numL > 0) {
+    std::printf(" %30s : %u, %u, %u\n", "Num Read, Write, Logic", numR, numW, numL);
+    std::printf(" %30s : %u, %u\n", "Num Activate, Precharge", numActivate, numPrecharge);
+  }
+}
+
+//! @brief  Show DRAMsim3 simulated runtime alongside modeled runtime. Runtime of commands which are not sampled
+//!         is extrapolated with the simulated to modeled ratio of sampled commands of the same type, or of all
+//!         sampled commands if none of the type is sampled
+void
+pimStatsMgr::showDramSimStats(const statsData& stats) const
+{
+  if (stats.m_dramSimCmds.empty()) {
+    return;
+  }
+  double sampledMsModeled = 0.0;
+  double sampledMsSimulated = 0.0;
+  for (const auto& [cmdName, item] : stats.m_dramSimCmds) {
+    sampledMsModeled += item.m_msModeledSampled;
+    sampledMsSimulated += item.m_msSimulated;
+  }
+  double sampledRatio = sampledMsModeled == 0.0 ? 0.0 : sampledMsSimulated / sampledMsModeled;
+  std::printf("DRAMsim3 Timing Stats:\n");
+  std::printf(" %44s : %10s %10s %14s %14s %10s\n", "PIM-CMD", "CNT", "Sampled", "Modeled(ms)", "DRAMsim3(ms)", "Ratio");
+  int totalCmd = 0;
+  int totalSampled = 0;
+  double totalMsModeled = 0.0;
+  double totalMsSimulated = 0.0;
+  for (const auto& [cmdName, item] : stats.m_dramSimCmds) {
+    double msSimulated = item.m_msModeled * sampledRatio;
+    if (item.m_msModeledSampled > 0.0) {
+      msSimulated = item.m_msSimulated * item.m_msModeled / item.m_msModeledSampled;
+    } else if (item.m_numSampled > 0) {
+      msSimulated = item.m_msSimulated * item.m_numCmds / item.m_numSampled;
+    }
+    double ratio = item.m_msModeled == 0.0 ? 0.0 : msSimulated / item.m_msModeled;
+    std::printf(" %44s : %10d %10d %14f %14f %10.4f\n", cmdName.c_str(), item.m_numCmds, item.m_numSampled, item.m_msModeled, msSimulated, ratio);
+    totalCmd += item.m_numCmds;
+    totalSampled += item.m_numSampled;
+    totalMsModeled += item.m_msModeled;
+    totalMsSimulated += msSimulated;
+  }
+  double totalRatio = totalMsModeled == 0.0 ? 0.0 : totalMsSimulated / totalMsModeled;
+  std::printf(" %44s : %10d %10d %14f %14f %10.4f\n", "TOTAL ---------", totalCmd, totalSampled, totalMsModeled, totalMsSimulated, totalRatio);
+}
+
+//! @brief  Show occupancy of PIM cores per command type, and modeled runtime lost to idle cores and padding
+void
+pimStatsMgr::showCoreOccupancyStats(const statsData& stats) const
+{
+  if (stats.m_coreOccupancy.empty()) {
+    return;
+  }
+  std::printf("PIM Core Occupancy Stats:\n");
+  std::printf(" %44s : %10s %8s %10s %8s %8s %8s %9s %14s %14s %14s  %s\n", "PIM-CMD", "CNT", "Cores", "ActCores",
+              "MinRgn", "MaxRgn", "MeanRgn", "%Padding", "Runtime(ms)", "IdleCore(ms)", "Padding(ms)", "Regions:Cores");
+  double totalMsRuntime = 0.0;
+  double totalMsIdleCores = 0.0;
+  double totalMsPadding = 0.0;
+  for (const auto& [cmdName, item] : stats.m_coreOccupancy) {
+    double meanActiveCores = item.m_numActiveCores * 1.0 / item.m_numCmds;
+    double meanRegions = item.m_numActiveCores == 0 ? 0.0 : item.m_numRegions * 1.0 / item.m_numActiveCores;
+    double percentPadding = item.m_numElementSlots == 0 ? 0.0 : (1.0 - item.m_numElements * 1.0 / item.m_numElementSlots) * 100;
+    std::string hist;
+    for (const auto& [numRegions, numCores] : item.m_regionsPerCoreHist) {
+      hist += (hist.empty() ? "" : " ") + std::to_string(numRegions) + ":" + std::to_string(numCores);
+    }
+    std::printf(" %44s : %10d %8u %10.1f %8u %8u %8.2f %9.2f %14f %14f %14f  %s\n", cmdName.c_str(), item.m_numCmds,
+                item.m_numCores, meanActiveCores, item.m_minRegionsPerCore, item.m_maxRegionsPerCore, meanRegions,
+                percentPadding, item.m_msRuntime, item.m_msIdleCores, item.m_msPadding, hist.c_str());
+    totalMsRuntime += item.m_msRuntime;
+    totalMsIdleCores += item.m_msIdleCores;
+    totalMsPadding += item.m_msPadding;
+  }
+  std::printf(" %44s : %10s %8s %10s %8s %8s %8s %9s %14f %14f %14f\n", "TOTAL ---------", "", "", "", "", "", "", "",
+              totalMsRuntime, totalMsIdleCores, totalMsPadding);
+}
+
+//! @brief  Show a heatmap of modeled runtime of each PIM core relative to the runtime of all commands
+void
+pimStatsMgr::showCoreHeatmap(const statsData& stats) const
+{
+  double msTotal = 0.0;
+  for (const auto& [cmdName, item] : stats.m_coreOccupancy) {
+    msTotal += item.m_msRuntime;
+  }
+  if (stats.m_coreMsActive.empty() || msTotal <= 0.0) {
+    return;
+  }
+  // a blank is an unused core, and levels from '.' to '@' are up to 100% utilization
+  static const std::string levels = ".:-=+*#%@";
+  const unsigned numCoresPerLine = 64;
+  std::printf("PIM Core Utilization Heatmap: (%u cores per line, ' ' = 0%%, '.' to '@' = up to 100%%)\n", numCoresPerLine);
+  for (size_t lineBegin = 0; lineBegin < stats.m_coreMsActive.size(); lineBegin += numCoresPerLine) {
+    std::string line;
+    size_t lineEnd = std::min(stats.m_coreMsActive.size(), lineBegin + numCoresPerLine);
+    for (size_t coreId = lineBegin; coreId < lineEnd; ++coreId) {
+      double utilization = std::min(1.0, stats.m_coreMsActive[coreId] / msTotal);
+      size_t level = static_cast<size_t>(std::ceil(utilization * levels.size()));
+      line += (level == 0 ? ' ' : levels[std::min(level, levels.size()) - 1]);
+    }
+    std::printf(" %10zu : |%s|\n", lineBegin, line.c_str());
+  }
+}
+
+//! @brief  Show named kernel timer regions as a tree, each with its command mix
+void
+pimStatsMgr::showRegionStats() const
+{
+  if (m_regionStats.empty()) {
+    return;
+  }
+  std::printf("Kernel Timer Region Stats:\n");
+  std::printf(" %-44s : %10s %14s %14s %14s %14s %14s %10s\n", "Region", "CNT", "Runtime(ms)", "CPU(ms)", "PIM(ms)", "Refresh(ms)", "Energy(mJ)", "#Cmds");
+  for (size_t regionIdx : getRegionTreeOrder()) {
+    const auto& [path, item] = m_regionStats[regionIdx];
+    std::string indent(2 * item.m_depth, ' ');
+    std::string name = indent + path.substr(path.find_last_of('/') + 1);
+    std::printf(" %-44s : %10d %14f %14f %14f %14f %14f %10d\n", name.c_str(), item.m_count, item.m_msRuntime, item.m_msCpu,
+                item.m_msPim, item.m_msRefresh, item.m_mjEnergy, item.m_numCmds);
+    for (const auto& [cmdName, cmdPerf] : item.m_cmdPerf) {
+      std::string cmdLabel = indent + "  - " + cmdName;
+      std::printf(" %-44s : %10d %14s %14s %14f %14s %14f\n", cmdLabel.c_str(), cmdPerf.first, "", "",
+                  cmdPerf.second.m_msRuntime, "", cmdPerf.second.m_mjEnergy);
+    }
+  }
+}
+
+//! @brief  Show runtime and energy of multiple simulation targets side by side.
+//!         Commands are matched by name without data layout suffix, as targets may use different layouts
+void
+pimStatsMgr::showMultiTargetStats(const std::vector<pimStatsTarget>& targets)
+{
+  // collect per-target runtime and energy of each command
+  std::map<std::string, std::vector<std::pair<double, double>>> cmdPerf;
+  size_t numTargets = targets.size();
+  std::vector<statsData> targetStats(numTargets);
+  for (size_t i = 0; i < numTargets; ++i) {
+    if (!targets[i].m_statsMgr) {
+      continue;
+    }
+    targetStats[i] = targets[i].m_statsMgr->getMergedStats();
+    for (const auto& it : targetStats[i].m_cmdPerf) {
+      std::string cmdName = it.first;
+      if (cmdName.size() > 2 && (cmdName.compare(cmdName.size() - 2, 2, ".v") == 0 || cmdName.compare(cmdName.size() - 2, 2, ".h") == 0)) {
+        cmdName.resize(cmdName.size() - 2);
+      }
+      auto& item = cmdPerf[cmdName];
+      item.resize(numTargets);
+      item[i].first += it.second.second.m_msRuntime;
+      item[i].second += it.second.second.m_mjEnergy;
+    }
+  }
+
+  std::printf("Multi-Target Stats:\n");
+  for (size_t i = 0; i < numTargets; ++i) {
+    std::printf(" %30s : %s%s\n", ("Target " + std::to_string(i)).c_str(), targets[i].m_name.c_str(),
+                (targets[i].m_statsMgr ? "" : " (disabled)"));
+  }
+  for (int metric = 0; metric < 2; ++metric) {
+    std::printf(" %30s :", (metric == 0 ? "Runtime(ms)" : "Energy(mJ)"));
+    for (size_t i = 0; i < numTargets; ++i) {
+      std::printf(" %14s", ("Target " + std::to_string(i)).c_str());
+    }
+    std::printf("\n");
+    std::vector<double> totalCmd(numTargets, 0.0);
+    for (const auto& it : cmdPerf) {
+      std::printf(" %30s :", it.first.c_str());
+      for (size_t i = 0; i < numTargets; ++i) {
+        double val = (metric == 0 ? it.second[i].first : it.second[i].second);
+        totalCmd[i] += val;
+        std::printf(" %14f", val);
+      }
+      std::printf("\n");
+    }
+    std::printf(" %30s :", "TOTAL ( Copy )");
+    std::vector<double> totalCopy(numTargets, 0.0);
+    for (size_t i = 0; i < numTargets; ++i) {
+      const statsData& stats = targetStats[i];
+      totalCopy[i] = (metric == 0
+          ? stats.m_elapsedTimeCopiedMainToDevice + stats.m_elapsedTimeCopiedDeviceToMain + stats.m_elapsedTimeCopiedDeviceToDevice
+          : stats.m_mJCopiedMainToDevice + stats.m_mJCopiedDeviceToMain + stats.m_mJCopiedDeviceToDevice);
+      std::printf(" %14f", totalCopy[i]);
+    }
+    std::printf("\n");
+    std::printf(" %30s :", "TOTAL (  Cmd )");
+    for (size_t i = 0; i < numTargets; ++i) {
+      std::printf(" %14f", totalCmd[i]);
+    }
+    std::printf("\n");
+    std::printf(" %30s :", "TOTAL ---------");
+    for (size_t i = 0; i < numTargets; ++i) {
+      std::printf(" %14f", totalCopy[i] + totalCmd[i]);
+    }
+    std::printf("\n");
+  }
+  std::printf("----------------------------------------\n");
+}
+
+//! @brief  Get number of row read, row write and logic micro ops since last stats reset
+void
+pimStatsMgr::getMicroOpStats(unsigned& numR, unsigned& numW, unsigned& numL) const
+{
+  countMicroOps(getMergedStats(), numR, numW, numL);
+}
+
+//! @brief  Count row read, row write and logic micro ops in stats
+void
+pimStatsMgr::countMicroOps(const statsData& stats, unsigned& numR, unsigned& numW, unsigned& numL)
+{
+  numR = 0;
+  numW = 0;
+  numL = 0;
+  for (const auto& it : stats.m_cmdPerf) {
     if (it.first == "row_r") {
       numR += it.second.first;
-      numActivate += it.second.first;
-      numPrecharge += it.second.first;
     } else if (it.first == "row_w") {
       numW += it.second.first;
-      numActivate += it.second.first;
-      numPrecharge += it.second.first;
     } else if (it.first.find("rreg.") == 0) {
       numL += it.second.first;
     }
   }
-  if (numR > 0 || numW > 0 || numL > 0) {
-    std::printf(" %30s : %d, %d, %d\n", "Num Read, Write, Logic", numR, numW, numL);
-    std::printf(" %30s : %d, %d\n", "Num Activate, Precharge", numActivate, numPrecharge);
+}
+
+//! @brief  Get summary of data copy and PIM cmd stats, with the same totals as showStats
+void
+pimStatsMgr::getStatsSummary(PimStatsSummary& summary) const
+{
+  statsData stats = getMergedStats();
+  summary = PimStatsSummary();
+  summary.numBytesCopied = (stats.m_bitsCopiedMainToDevice + stats.m_bitsCopiedDeviceToMain) / 8;
+  summary.copyMsRuntime = stats.m_elapsedTimeCopiedMainToDevice + stats.m_elapsedTimeCopiedDeviceToMain + stats.m_elapsedTimeCopiedDeviceToDevice;
+  summary.copyMjEnergy = stats.m_mJCopiedMainToDevice + stats.m_mJCopiedDeviceToMain + stats.m_mJCopiedDeviceToDevice;
+  for (const auto& it : stats.m_cmdPerf) {
+    summary.numCmds += it.second.first;
+    summary.cmdMsRuntime += it.second.second.m_msRuntime;
+    summary.cmdMjEnergy += it.second.second.m_mjEnergy;
   }
+  summary.cmdMsMakespan = m_cmdTimeline.getMsCriticalPath();
+  summary.criticalPathMsRuntime = m_timeline.getMsCriticalPath();
+  uint64_t numRefresh = 0;
+  pimeval::perfEnergy refresh = getPerfEnergyForRefresh(summary.cmdMsRuntime, numRefresh);
+  summary.refreshMsRuntime = refresh.m_msRuntime;
+  summary.refreshMjEnergy = refresh.m_mjEnergy;
+}
+
+//! @brief  Export stats to a JSON or CSV file, including runtime and energy of multiple simulation targets if any
+bool
+pimStatsMgr::exportStats(const std::string& filePath, PimStatsFormatEnum format,
+                         const std::vector<pimStatsTarget>& targets) const
+{
+  std::ofstream file(filePath);
+  if (!file.is_open()) {
+    std::printf("PIM-Error: Cannot open stats output file %s\n", filePath.c_str());
+    return false;
+  }
+  std::vector<statsRecord> records = getStatsRecords(targets);
+  if (format == PIM_STATS_CSV) {
+    writeStatsCsv(file, records);
+  } else {
+    writeStatsJson(file, records);
+  }
+  file.close();
+  if (file.fail()) {
+    std::printf("PIM-Error: Failed to write stats output file %s\n", filePath.c_str());
+    return false;
+  }
+  std::printf("PIM-Info: Exported stats to %s\n", filePath.c_str());
+  return true;
+}
+
+//! @brief  Collect stats for export, with the same metrics as shown by showStats
+std::vector<pimStatsMgr::statsRecord>
+pimStatsMgr::getStatsRecords(const std::vector<pimStatsTarget>& targets) const
+{
+  statsData stats = getMergedStats();
+  std::vector<statsRecord> records;
+
+  const pimParamsDram& paramsDram = pimSim::get()->getParamsDram();
+  statsRecord& device = records.emplace_back("device", "");
+  device.add("deviceType", pimUtils::pimDeviceEnumToStr(pimSim::get()->getDeviceType()));
+  device.add("simTarget", pimUtils::pimDeviceEnumToStr(pimSim::get()->getSimTarget()));
+  device.add("numRanks", static_cast<uint64_t>(pimSim::get()->getNumRanks()));
+  device.add("numBankPerRank", static_cast<uint64_t>(pimSim::get()->getNumBankPerRank()));
+  device.add("numSubarrayPerBank", static_cast<uint64_t>(pimSim::get()->getNumSubarrayPerBank()));
+  device.add("numRowPerSubarray", static_cast<uint64_t>(pimSim::get()->getNumRowPerSubarray()));
+  device.add("numColPerSubarray", static_cast<uint64_t>(pimSim::get()->getNumColPerSubarray()));
+  device.add("numCores", static_cast<uint64_t>(pimSim::get()->getNumCores()));
+  device.add("numRowsPerCore", static_cast<uint64_t>(pimSim::get()->getNumRows()));
+  device.add("numColsPerCore", static_cast<uint64_t>(pimSim::get()->getNumCols()));
+  device.add("typicalRankBW", paramsDram.getTypicalRankBW());
+  device.add("nsRowRead", paramsDram.getNsRowRead());
+  device.add("nsRowWrite", paramsDram.getNsRowWrite());
+  device.add("nsTCCD", paramsDram.getNsTCCD_S());
+  const pimPerfEnergyBase* perfEnergyModel = pimSim::get()->getPerfEnergyModel();
+  if (perfEnergyModel) {
+    device.add("numChannels", static_cast<uint64_t>(perfEnergyModel->getNumChannels()));
+    device.add("numRanksPerChannel", static_cast<uint64_t>(perfEnergyModel->getNumRanksPerChannel()));
+    device.add("rowBufferPolicy", std::string(perfEnergyModel->isOpenPagePolicy() ? "open" : "closed"));
+  }
+
+  for (const auto& [tag, elapsed] : stats.m_msElapsed) {
+    statsRecord& api = records.emplace_back("api", tag);
+    api.add("count", static_cast<uint64_t>(elapsed.first));
+    api.add("msElapsed", elapsed.second);
+  }
+
+  const std::tuple<const char*, uint64_t, double, double> copies[] = {
+    { "hostToDevice", stats.m_bitsCopiedMainToDevice, stats.m_elapsedTimeCopiedMainToDevice, stats.m_mJCopiedMainToDevice },
+    { "deviceToHost", stats.m_bitsCopiedDeviceToMain, stats.m_elapsedTimeCopiedDeviceToMain, stats.m_mJCopiedDeviceToMain },
+    { "deviceToDevice", stats.m_bitsCopiedDeviceToDevice, stats.m_elapsedTimeCopiedDeviceToDevice, stats.m_mJCopiedDeviceToDevice },
+  };
+  for (const auto& [name, numBits, msRuntime, mjEnergy] : copies) {
+    statsRecord& copy = records.emplace_back("copy", name);
+    copy.add("numBytes", numBits / 8);
+    copy.add("msRuntime", msRuntime);
+    copy.add("mjEnergy", mjEnergy);
+  }
+
+  for (const auto& [cmdName, cmdPerf] : stats.m_cmdPerf) {
+    statsRecord& cmd = records.emplace_back("cmd", cmdName);
+    cmd.add("count", static_cast<uint64_t>(cmdPerf.first));
+    cmd.add("msRuntime", cmdPerf.second.m_msRuntime);
+    cmd.add("mjEnergy", cmdPerf.second.m_mjEnergy);
+    cmd.add("msRead", cmdPerf.second.m_msRead);
+    cmd.add("msWrite", cmdPerf.second.m_msWrite);
+    cmd.add("msCompute", cmdPerf.second.m_msCompute);
+    cmd.add("totalOps", cmdPerf.second.m_totalOp);
+  }
+
+  for (const auto& [cmdName, item] : stats.m_dramSimCmds) {
+    statsRecord& dramSim = records.emplace_back("dramsim3", cmdName);
+    dramSim.add("count", static_cast<uint64_t>(item.m_numCmds));
+    dramSim.add("numSampled", static_cast<uint64_t>(item.m_numSampled));
+    dramSim.add("msModeled", item.m_msModeled);
+    dramSim.add("msModeledSampled", item.m_msModeledSampled);
+    dramSim.add("msSimulated", item.m_msSimulated);
+  }
+
+  for (const auto& [cmdName, item] : stats.m_coreOccupancy) {
+    statsRecord& occupancy = records.emplace_back("occupancy", cmdName);
+    occupancy.add("count", static_cast<uint64_t>(item.m_numCmds));
+    occupancy.add("numCores", static_cast<uint64_t>(item.m_numCores));
+    occupancy.add("meanActiveCores", item.m_numActiveCores * 1.0 / item.m_numCmds);
+    occupancy.add("minRegionsPerCore", static_cast<uint64_t>(item.m_minRegionsPerCore));
+    occupancy.add("maxRegionsPerCore", static_cast<uint64_t>(item.m_maxRegionsPerCore));
+    occupancy.add("meanRegionsPerCore", item.m_numActiveCores == 0 ? 0.0 : item.m_numRegions * 1.0 / item.m_numActiveCores);
+    occupancy.add("paddingWaste", item.m_numElementSlots == 0 ? 0.0 : 1.0 - item.m_numElements * 1.0 / item.m_numElementSlots);
+    occupancy.add("msRuntime", item.m_msRuntime);
+    occupancy.add("msIdleCores", item.m_msIdleCores);
+    occupancy.add("msPadding", item.m_msPadding);
+    for (const auto& [numRegions, numCores] : item.m_regionsPerCoreHist) {
+      occupancy.add("hist." + std::to_string(numRegions), numCores);
+    }
+  }
+  // one record per core is only exported along with the heatmap
+  if (pimSim::get()->isDebug(pimSimConfig::DEBUG_HEATMAP)) {
+    for (size_t coreId = 0; coreId < stats.m_coreMsActive.size(); ++coreId) {
+      statsRecord& core = records.emplace_back("core", std::to_string(coreId));
+      core.add("msActive", stats.m_coreMsActive[coreId]);
+    }
+  }
+
+  PimStatsSummary summary;
+  getStatsSummary(summary);
+  unsigned numR = 0;
+  unsigned numW = 0;
+  unsigned numL = 0;
+  countMicroOps(stats, numR, numW, numL);
+  uint64_t numRefresh = 0;
+  getPerfEnergyForRefresh(summary.cmdMsRuntime, numRefresh);
+  statsRecord& total = records.emplace_back("summary", "");
+  total.add("numBytesCopied", summary.numBytesCopied);
+  total.add("copyMsRuntime", summary.copyMsRuntime);
+  total.add("copyMjEnergy", summary.copyMjEnergy);
+  total.add("numCmds", summary.numCmds);
+  total.add("cmdMsRuntime", summary.cmdMsRuntime);
+  total.add("cmdMjEnergy", summary.cmdMjEnergy);
+  total.add("cmdMsMakespan", summary.cmdMsMakespan);
+  total.add("criticalPathMsRuntime", summary.criticalPathMsRuntime);
+  total.add("numRefresh", numRefresh);
+  total.add("refreshMsRuntime", summary.refreshMsRuntime);
+  total.add("refreshMjEnergy", summary.refreshMjEnergy);
+  total.add("numRowRead", static_cast<uint64_t>(numR));
+  total.add("numRowWrite", static_cast<uint64_t>(numW));
+  total.add("numLogic", static_cast<uint64_t>(numL));
+
+  // the primary device is target 0, and a disabled extra target has no runtime or energy
+  for (size_t i = 0; i < targets.size(); ++i) {
+    statsRecord& target = records.emplace_back("target", std::to_string(i));
+    target.add("simTarget", targets[i].m_name);
+    target.add("isValid", static_cast<uint64_t>(targets[i].m_statsMgr != nullptr));
+    if (!targets[i].m_statsMgr) {
+      continue;
+    }
+    PimStatsSummary targetSummary;
+    targets[i].m_statsMgr->getStatsSummary(targetSummary);
+    target.add("copyMsRuntime", targetSummary.copyMsRuntime);
+    target.add("copyMjEnergy", targetSummary.copyMjEnergy);
+    target.add("numCmds", targetSummary.numCmds);
+    target.add("cmdMsRuntime", targetSummary.cmdMsRuntime);
+    target.add("cmdMjEnergy", targetSummary.cmdMjEnergy);
+    target.add("hostDataBytes", targets[i].m_numHostDataBytes);
+  }
+
+  for (size_t i = 0; i < m_kernelStats.size(); ++i) {
+    const kernelStats& item = m_kernelStats[i];
+    statsRecord& kernel = records.emplace_back("kernel", std::to_string(i));
+    kernel.add("msRuntime", item.m_msRuntime);
+    kernel.add("msCpu", item.m_msCpu);
+    kernel.add("msPim", item.m_msPim);
+    kernel.add("msRefresh", item.m_msRefresh);
+    kernel.add("msTimelineRuntime", item.m_msTimelineRuntime);
+    kernel.add("msCriticalPath", item.m_msCriticalPath);
+  }
+  for (size_t regionIdx : getRegionTreeOrder()) {
+    const auto& [path, item] = m_regionStats[regionIdx];
+    statsRecord& region = records.emplace_back("region", path);
+    region.add("depth", static_cast<uint64_t>(item.m_depth));
+    region.add("count", static_cast<uint64_t>(item.m_count));
+    region.add("msRuntime", item.m_msRuntime);
+    region.add("msCpu", item.m_msCpu);
+    region.add("msPim", item.m_msPim);
+    region.add("msRefresh", item.m_msRefresh);
+    region.add("msCriticalPath", item.m_msCriticalPath);
+    region.add("mjEnergy", item.m_mjEnergy);
+    region.add("numCmds", static_cast<uint64_t>(item.m_numCmds));
+    for (const auto& [cmdName, cmdPerf] : item.m_cmdPerf) {
+      region.add("cmd." + cmdName + ".count", static_cast<uint64_t>(cmdPerf.first));
+      region.add("cmd." + cmdName + ".msRuntime", cmdPerf.second.m_msRuntime);
+      region.add("cmd." + cmdName + ".mjEnergy", cmdPerf.second.m_mjEnergy);
+    }
+  }
+  return records;
+}
+
+//! @brief  Write stats as a JSON object of sections. A section of named items maps names to metrics
+void
+pimStatsMgr::writeStatsJson(std::ostream& os, const std::vector<statsRecord>& records)
+{
+  auto quote = [](const std::string& str) {
+    std::string quoted = "\"";
+    for (char c : str) {
+      if (c == '"' || c == '\\') {
+        quoted += '\\';
+      }
+      quoted += c;
+    }
+    return quoted + "\"";
+  };
+  os << "{";
+  for (size_t i = 0; i < records.size(); ++i) {
+    const statsRecord& record = records[i];
+    bool isNewSection = (i == 0 || records[i - 1].m_section != record.m_section);
+    bool isLastInSection = (i + 1 == records.size() || records[i + 1].m_section != record.m_section);
+    if (isNewSection) {
+      os << (i == 0 ? "\n" : ",\n") << "  " << quote(record.m_section) << ": {";
+    } else {
+      os << ",";
+    }
+    std::string indent = "\n    ";
+    if (!record.m_name.empty()) {
+      os << "\n    " << quote(record.m_name) << ": {";
+      indent = "\n      ";
+    }
+    for (size_t j = 0; j < record.m_metrics.size(); ++j) {
+      const auto& [metric, val, isString] = record.m_metrics[j];
+      os << (j == 0 ? "" : ",") << indent << quote(metric) << ": " << (isString ? quote(val) : val);
+    }
+    if (!record.m_name.empty()) {
+      os << "\n    }";
+    }
+    if (isLastInSection) {
+      os << "\n  }";
+    }
+  }
+  os << "\n}\n";
+}
+
+//! @brief  Write stats as CSV with one row per metric
+void
+pimStatsMgr::writeStatsCsv(std::ostream& os, const std::vector<statsRecord>& records)
+{
+  auto quote = [](const std::string& str) {
+    if (str.find_first_of(",\"\n") == std::string::npos) {
+      return str;
+    }
+    std::string quoted = "\"";
+    for (char c : str) {
+      quoted += (c == '"' ? "\"\"" : std::string(1, c));
+    }
+    return quoted + "\"";
+  };
+  os << "section,name,metric,value\n";
+  for (const statsRecord& record : records) {
+    for (const auto& [metric, val, isString] : record.m_metrics) {
+      os << record.m_section << "," << quote(record.m_name) << "," << metric << "," << quote(val) << "\n";
+    }
+  }
+}
+
+//! @brief  Add a metric to a stats record
+void
+pimStatsMgr::statsRecord::add(const std::string& metric, double val)
+{
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.9g", val);
+  m_metrics.emplace_back(metric, buf, false);
+}
+
+//! @brief  Add a metric to a stats record
+void
+pimStatsMgr::statsRecord::add(const std::string& metric, uint64_t val)
+{
+  m_metrics.emplace_back(metric, std::to_string(val), false);
+}
+
+//! @brief  Add a metric to a stats record
+void
+pimStatsMgr::statsRecord::add(const std::string& metric, const std::string& val)
+{
+  m_metrics.emplace_back(metric, val, true);
+}
+
+//! @brief  Get stall runtime and energy of DRAM refreshes during modeled runtime of PIM commands
+pimeval::perfEnergy
+pimStatsMgr::getPerfEnergyForRefresh(double msRuntime, uint64_t& numRefresh)
+{
+  numRefresh = 0;
+  const pimPerfEnergyBase* perfEnergyModel = pimSim::get()->getPerfEnergyModel();
+  if (!perfEnergyModel) {
+    return pimeval::perfEnergy();
+  }
+  numRefresh = perfEnergyModel->getNumRefresh(msRuntime);
+  return perfEnergyModel->getPerfEnergyForRefresh(numRefresh);
 }
 
 //! @brief  Reset PIM stats
 void
 pimStatsMgr::resetStats()
 {
-  m_cmdPerf.clear();
-  m_msElapsed.clear();
-  m_bitsCopiedMainToDevice = 0;
-  m_bitsCopiedDeviceToMain = 0;
-  m_bitsCopiedDeviceToDevice = 0;
+  for (auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.m_mutex);
+    shard.m_data.m_cmdPerf.clear();
+    shard.m_data.m_msElapsed.clear();
+    shard.m_data.m_dramSimCmds.clear();
+    shard.m_data.m_coreOccupancy.clear();
+    shard.m_data.m_coreMsActive.clear();
+    shard.m_data.m_bitsCopiedMainToDevice = 0;
+    shard.m_data.m_bitsCopiedDeviceToMain = 0;
+    shard.m_data.m_bitsCopiedDeviceToDevice = 0;
+  }
+  m_timeline.reset();
+  m_cmdTimeline.reset();
+  m_kernelStats.clear();
+  m_regionStats.clear();
+  // running kernel timers count stats since the reset
+  for (timerRegion& region : m_timerRegions) {
+    region.m_statsStart = getMergedStats();
+    region.m_msTimelineStart = m_timeline.getMsEnd();
+    region.m_start = std::chrono::high_resolution_clock::now();
+    if (!region.m_path.empty()) {
+      getRegionStats(region.m_path);
+    }
+  }
 }
 
-//! @brief  Record estimated runtime and energy of a PIM command
+//! @brief  Get the stats shard of the calling thread
+pimStatsMgr::statsShard&
+pimStatsMgr::getShard()
+{
+  static std::atomic<unsigned> s_nextShardIdx = 0;
+  thread_local unsigned shardIdx = s_nextShardIdx++ % s_numShards;
+  return m_shards[shardIdx];
+}
+
+//! @brief  Merge stats of all shards
+pimStatsMgr::statsData
+pimStatsMgr::getMergedStats() const
+{
+  statsData stats;
+  for (auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.m_mutex);
+    stats.merge(shard.m_data);
+  }
+  return stats;
+}
+
+//! @brief  Accumulate stats of another shard
 void
-pimStatsMgr::recordCmd(const std::string& cmdName, pimeval::perfEnergy mPerfEnergy)
+pimStatsMgr::statsData::merge(const statsData& other)
 {
-  auto& item = m_cmdPerf[cmdName];
-  item.first++;
+  for (const auto& [cmdName, cmdPerf] : other.m_cmdPerf) {
+    auto& item = m_cmdPerf[cmdName];
+    item.first += cmdPerf.first;
+    item.second.m_msRuntime += cmdPerf.second.m_msRuntime;
+    item.second.m_mjEnergy += cmdPerf.second.m_mjEnergy;
+    item.second.m_msRead += cmdPerf.second.m_msRead;
+    item.second.m_msWrite += cmdPerf.second.m_msWrite;
+    item.second.m_msCompute += cmdPerf.second.m_msCompute;
+    item.second.m_totalOp += cmdPerf.second.m_totalOp;
+  }
+  for (const auto& [tag, elapsed] : other.m_msElapsed) {
+    auto& item = m_msElapsed[tag];
+    item.first += elapsed.first;
+    item.second += elapsed.second;
+  }
+  for (const auto& [cmdName, dramSimCmd] : other.m_dramSimCmds) {
+    auto& item = m_dramSimCmds[cmdName];
+    item.m_numCmds += dramSimCmd.m_numCmds;
+    item.m_numSampled += dramSimCmd.m_numSampled;
+    item.m_msModeled += dramSimCmd.m_msModeled;
+    item.m_msModeledSampled += dramSimCmd.m_msModeledSampled;
+    item.m_msSimulated += dramSimCmd.m_msSimulated;
+  }
+  for (const auto& [cmdName, occupancy] : other.m_coreOccupancy) {
+    m_coreOccupancy[cmdName].merge(occupancy);
+  }
+  if (m_coreMsActive.size() < other.m_coreMsActive.size()) {
+    m_coreMsActive.resize(other.m_coreMsActive.size(), 0.0);
+  }
+  for (size_t coreId = 0; coreId < other.m_coreMsActive.size(); ++coreId) {
+    m_coreMsActive[coreId] += other.m_coreMsActive[coreId];
+  }
+  m_bitsCopiedMainToDevice += other.m_bitsCopiedMainToDevice;
+  m_bitsCopiedDeviceToMain += other.m_bitsCopiedDeviceToMain;
+  m_bitsCopiedDeviceToDevice += other.m_bitsCopiedDeviceToDevice;
+  m_elapsedTimeCopiedMainToDevice += other.m_elapsedTimeCopiedMainToDevice;
+  m_elapsedTimeCopiedDeviceToMain += other.m_elapsedTimeCopiedDeviceToMain;
+  m_elapsedTimeCopiedDeviceToDevice += other.m_elapsedTimeCopiedDeviceToDevice;
+  m_mJCopiedMainToDevice += other.m_mJCopiedMainToDevice;
+  m_mJCopiedDeviceToMain += other.m_mJCopiedDeviceToMain;
+  m_mJCopiedDeviceToDevice += other.m_mJCopiedDeviceToDevice;
+  m_kernelMsElapsedSim += other.m_kernelMsElapsedSim;
+  m_kernelMsEstRuntime += other.m_kernelMsEstRuntime;
+}
+
+//! @brief  Record estimated runtime and energy of a PIM command, or the total of numCmds same commands
+void
+pimStatsMgr::recordCmd(const std::string& cmdName, pimeval::perfEnergy mPerfEnergy, int numCmds)
+{
+  statsShard& shard = getShard();
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  statsData& stats = shard.m_data;
+  auto& item = stats.m_cmdPerf[cmdName];
+  item.first += numCmds;
   item.second.m_msRuntime += mPerfEnergy.m_msRuntime;
-  m_curApiMsEstRuntime += mPerfEnergy.m_msRuntime;
+  addToCurApi(mPerfEnergy.m_msRuntime);
   item.second.m_mjEnergy += mPerfEnergy.m_mjEnergy;
   item.second.m_msRead += mPerfEnergy.m_msRead;
   item.second.m_msWrite += mPerfEnergy.m_msWrite;
@@ -198,84 +840,369 @@ pimStatsMgr::recordCmd(const std::string& cmdName, pimeval::perfEnergy mPerfEner
 void
 pimStatsMgr::recordCopyMainToDevice(uint64_t numBits, pimeval::perfEnergy mPerfEnergy)
 {
-  m_bitsCopiedMainToDevice += numBits;
-  m_elapsedTimeCopiedMainToDevice += mPerfEnergy.m_msRuntime;
-  m_curApiMsEstRuntime += mPerfEnergy.m_msRuntime;
-  m_mJCopiedMainToDevice += mPerfEnergy.m_mjEnergy;
+  statsShard& shard = getShard();
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  statsData& stats = shard.m_data;
+  stats.m_bitsCopiedMainToDevice += numBits;
+  stats.m_elapsedTimeCopiedMainToDevice += mPerfEnergy.m_msRuntime;
+  addToCurApi(mPerfEnergy.m_msRuntime);
+  stats.m_mJCopiedMainToDevice += mPerfEnergy.m_mjEnergy;
 }
 
 //! @brief  Record estimated runtime and energy of data copy
 void
 pimStatsMgr::recordCopyDeviceToMain(uint64_t numBits, pimeval::perfEnergy mPerfEnergy)
 {
-  m_bitsCopiedDeviceToMain += numBits;
-  m_elapsedTimeCopiedDeviceToMain += mPerfEnergy.m_msRuntime;
-  m_curApiMsEstRuntime += mPerfEnergy.m_msRuntime;
-  m_mJCopiedDeviceToMain += mPerfEnergy.m_mjEnergy;
+  statsShard& shard = getShard();
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  statsData& stats = shard.m_data;
+  stats.m_bitsCopiedDeviceToMain += numBits;
+  stats.m_elapsedTimeCopiedDeviceToMain += mPerfEnergy.m_msRuntime;
+  addToCurApi(mPerfEnergy.m_msRuntime);
+  stats.m_mJCopiedDeviceToMain += mPerfEnergy.m_mjEnergy;
 }
 
 //! @brief  Record estimated runtime and energy of data copy
 void
 pimStatsMgr::recordCopyDeviceToDevice(uint64_t numBits, pimeval::perfEnergy mPerfEnergy)
 {
-  m_bitsCopiedDeviceToDevice += numBits;
-  m_elapsedTimeCopiedDeviceToDevice += mPerfEnergy.m_msRuntime;
-  m_curApiMsEstRuntime += mPerfEnergy.m_msRuntime;
-  m_mJCopiedDeviceToDevice += mPerfEnergy.m_mjEnergy;
+  statsShard& shard = getShard();
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  statsData& stats = shard.m_data;
+  stats.m_bitsCopiedDeviceToDevice += numBits;
+  stats.m_elapsedTimeCopiedDeviceToDevice += mPerfEnergy.m_msRuntime;
+  addToCurApi(mPerfEnergy.m_msRuntime);
+  stats.m_mJCopiedDeviceToDevice += mPerfEnergy.m_mjEnergy;
+}
+
+//! @brief  Record modeled runtime of a PIM command or data copy, and its DRAMsim3 simulated runtime if sampled
+void
+pimStatsMgr::recordDramSimCmd(const std::string& cmdName, double msModeled, bool isSampled, double msSimulated)
+{
+  statsShard& shard = getShard();
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  dramSimStats& item = shard.m_data.m_dramSimCmds[cmdName];
+  item.m_numCmds++;
+  item.m_msModeled += msModeled;
+  if (isSampled) {
+    item.m_numSampled++;
+    item.m_msModeledSampled += msModeled;
+    item.m_msSimulated += msSimulated;
+  }
 }
 
-//! @brief  Preprocessing at the beginning of a PIM API scope
+//! @brief  Accumulate estimated runtime of the current PIM API call of the calling thread
 void
-pimStatsMgr::pimApiScopeStart()
+pimStatsMgr::addToCurApi(double msRuntime) const
 {
-  // Restart for current PIM API call
-  m_curApiMsEstRuntime = 0.0;
+  // skip stats of extra simulation targets
+  if (s_apiScope.m_statsMgr == this) {
+    s_apiScope.m_msEstRuntime += msRuntime;
+  }
+}
+
+//! @brief  Schedule an executed PIM command or data copy on modeled timelines
+void
+pimStatsMgr::scheduleCmd(const pimCmd& cmd, const pimResMgr& resMgr, double msRuntime)
+{
+  double msStart = m_timeline.schedule(cmd, resMgr, msRuntime);
+  m_cmdTimeline.schedule(cmd, resMgr, msRuntime);
+  recordCoreOccupancy(cmd, resMgr, msRuntime);
+  // extra simulation targets are not traced
+  if (msStart >= 0.0 && pimChromeTrace::isOn() && pimSim::get()->getStatsMgr() == this) {
+    pimChromeTrace::recordModeled(cmd, resMgr, msStart, msRuntime);
+  }
+  s_apiScope.m_msScheduled += msRuntime;
+}
+
+//! @brief  Record occupancy of PIM cores by a PIM command. The first destination object, or the first source object
+//!         if none, determines the cores and regions of a command. Host-device copies do not run on PIM cores
+void
+pimStatsMgr::recordCoreOccupancy(const pimCmd& cmd, const pimResMgr& resMgr, double msRuntime)
+{
+  if (cmd.getCmdType() == PimCmdEnum::COPY_H2D || cmd.getCmdType() == PimCmdEnum::COPY_D2H) {
+    return;
+  }
+  std::vector<PimObjId> srcObjIds;
+  std::vector<PimObjId> destObjIds;
+  cmd.getObjIds(srcObjIds, destObjIds);
+  destObjIds.insert(destObjIds.end(), srcObjIds.begin(), srcObjIds.end());
+  auto it = std::find_if(destObjIds.begin(), destObjIds.end(), [&resMgr](PimObjId objId) { return resMgr.isValidObjId(objId); });
+  if (it == destObjIds.end()) {
+    return;
+  }
+  const pimObjInfo& obj = resMgr.getObjInfo(*it);
+  unsigned numCores = obj.getNumCoreAvailable();
+  uint64_t maxElementsPerRegion = std::max(1u, obj.getMaxElementsPerRegion());
+  const pimPerfEnergyBase* perfEnergyModel = pimSim::get()->getPerfEnergyModel();
+  bool isBalanced = obj.isLoadBalanced() && perfEnergyModel && perfEnergyModel->isLoadBalanceModeled();
+
+  // number of regions per active core to number of cores, from the object layout unless load balanced
+  const std::map<unsigned, unsigned>* regionsPerCoreHist = &obj.getRegionsPerCoreHist();
+  std::map<unsigned, unsigned> balancedHist;
+  if (isBalanced) {
+    // elements are spread evenly over all cores as modeled, regardless of their placement,
+    // so some cores hold one more element than the others
+    uint64_t numElementsLo = obj.getNumElements() / numCores;
+    unsigned numCoresHi = obj.getNumElements() % numCores;
+    unsigned numRegionsLo = (numElementsLo + maxElementsPerRegion - 1) / maxElementsPerRegion;
+    unsigned numRegionsHi = (numElementsLo + maxElementsPerRegion) / maxElementsPerRegion;
+    if (numCoresHi > 0) {
+      balancedHist[numRegionsHi] += numCoresHi;
+    }
+    if (numRegionsLo > 0) {
+      balancedHist[numRegionsLo] += numCores - numCoresHi;
+    }
+    regionsPerCoreHist = &balancedHist;
+  }
+  if (regionsPerCoreHist->empty()) {
+    return;
+  }
+
+  // all cores run the passes of the core with most regions, and each pass processes regions of the max size
+  unsigned minRegions = regionsPerCoreHist->begin()->first;
+  unsigned numPass = std::max(obj.getMaxNumRegionsPerCore(), regionsPerCoreHist->rbegin()->first);
+  unsigned numActiveCores = 0;
+  uint64_t numRegionsTotal = 0;
+  for (const auto& [numRegions, numCoresWithRegions] : *regionsPerCoreHist) {
+    numRegionsTotal += static_cast<uint64_t>(numRegions) * numCoresWithRegions;
+    numActiveCores += numCoresWithRegions;
+  }
+  numActiveCores = std::min(numActiveCores, numCores);
+  uint64_t numElementSlots = numPass * maxElementsPerRegion * numActiveCores;
+  double activeFraction = numActiveCores * 1.0 / numCores;
+  double paddingFraction = numElementSlots == 0 ? 0.0 : 1.0 - std::min(1.0, obj.getNumElements() * 1.0 / numElementSlots);
+  bool isHeatmap = pimSim::get()->isDebug(pimSimConfig::DEBUG_HEATMAP);
+
+  statsShard& shard = getShard();
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  statsData& stats = shard.m_data;
+  coreOccupancy& item = stats.m_coreOccupancy[cmd.getName(obj)];
+  item.m_minRegionsPerCore = (item.m_numCmds == 0 ? minRegions : std::min(item.m_minRegionsPerCore, minRegions));
+  item.m_maxRegionsPerCore = std::max(item.m_maxRegionsPerCore, numPass);
+  item.m_numCmds++;
+  item.m_numCores = std::max(item.m_numCores, numCores);
+  item.m_numActiveCores += numActiveCores;
+  item.m_numRegions += numRegionsTotal;
+  item.m_numElements += obj.getNumElements();
+  item.m_numElementSlots += numElementSlots;
+  item.m_msRuntime += msRuntime;
+  item.m_msIdleCores += msRuntime * (1.0 - activeFraction);
+  item.m_msPadding += msRuntime * activeFraction * paddingFraction;
+  for (const auto& [numRegions, numCoresWithRegions] : *regionsPerCoreHist) {
+    item.m_regionsPerCoreHist[numRegions] += numCoresWithRegions;
+  }
+  if (numActiveCores < numCores) {
+    item.m_regionsPerCoreHist[0] += numCores - numActiveCores;
+  }
+
+  // per-core runtime is only tracked for the heatmap, as it costs work on every core of every command
+  if (isHeatmap) {
+    if (stats.m_coreMsActive.size() < numCores) {
+      stats.m_coreMsActive.resize(numCores, 0.0);
+    }
+    if (isBalanced) {
+      for (unsigned coreId = 0; coreId < numCores; ++coreId) {
+        uint64_t numElements = obj.getNumElements() / numCores + (coreId < obj.getNumElements() % numCores ? 1 : 0);
+        uint64_t numRegions = (numElements + maxElementsPerRegion - 1) / maxElementsPerRegion;
+        stats.m_coreMsActive[coreId] += msRuntime * numRegions / numPass;
+      }
+    } else {
+      for (const pimRegion& region : obj.getRegions()) {
+        if (region.getCoreId() >= 0 && static_cast<unsigned>(region.getCoreId()) < numCores) {
+          stats.m_coreMsActive[region.getCoreId()] += msRuntime / numPass;
+        }
+      }
+    }
+  }
+}
+
+//! @brief  Accumulate occupancy of PIM cores of another shard
+void
+pimStatsMgr::coreOccupancy::merge(const coreOccupancy& other)
+{
+  if (other.m_numCmds == 0) {
+    return;
+  }
+  m_minRegionsPerCore = (m_numCmds == 0 ? other.m_minRegionsPerCore : std::min(m_minRegionsPerCore, other.m_minRegionsPerCore));
+  m_maxRegionsPerCore = std::max(m_maxRegionsPerCore, other.m_maxRegionsPerCore);
+  m_numCmds += other.m_numCmds;
+  m_numCores = std::max(m_numCores, other.m_numCores);
+  m_numActiveCores += other.m_numActiveCores;
+  m_numRegions += other.m_numRegions;
+  m_numElements += other.m_numElements;
+  m_numElementSlots += other.m_numElementSlots;
+  m_msRuntime += other.m_msRuntime;
+  m_msIdleCores += other.m_msIdleCores;
+  m_msPadding += other.m_msPadding;
+  for (const auto& [numRegions, numCores] : other.m_regionsPerCoreHist) {
+    m_regionsPerCoreHist[numRegions] += numCores;
+  }
 }
 
 //! @brief  Postprocessing at the end of a PIM API scope
 void
-pimStatsMgr::pimApiScopeEnd(const std::string& tag, double elapsed)
+pimStatsMgr::pimApiScopeEnd(const std::string& tag, double elapsed, bool isOutermost)
 {
+  statsShard& shard = getShard();
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  statsData& stats = shard.m_data;
   // Record API stats
-  auto& item = m_msElapsed[tag];
+  auto& item = stats.m_msElapsed[tag];
   item.first++;
   item.second += elapsed;
+  if (!isOutermost) {
+    return;
+  }
+  double msEstRuntime = (s_apiScope.m_statsMgr == this ? s_apiScope.m_msEstRuntime : 0.0);
+  s_apiScope.m_msEstRuntimeTotal += msEstRuntime;
 
   // Update kernel stats
   if (m_isKernelTimerOn) {
-    m_kernelMsElapsedSim += elapsed;
-    m_kernelMsEstRuntime += m_curApiMsEstRuntime;
+    stats.m_kernelMsElapsedSim += elapsed;
+    stats.m_kernelMsEstRuntime += msEstRuntime;
   }
 }
 
-//! @brief  Start timer for a PIM kernel to measure CPU runtime and DRAM refresh
+//! @brief  Start timer for a PIM kernel to measure CPU runtime and DRAM refresh.
+//!         A timer started within another one is a nested region of it
 void
-pimStatsMgr::startKernelTimer()
+pimStatsMgr::startKernelTimer(const std::string& tag)
 {
-  if (m_isKernelTimerOn) {
-    std::printf("PIM-Warning: Kernel timer has already started\n");
-    return;
+  timerRegion region;
+  if (!m_timerRegions.empty()) {
+    const std::string& parentPath = m_timerRegions.back().m_path;
+    region.m_path = (parentPath.empty() ? "" : parentPath + "/") + (tag.empty() ? "kernel" : tag);
+  } else {
+    region.m_path = tag;
+    // the kernel starts after all previous copies and commands on the modeled timeline
+    m_timeline.synchronize();
+  }
+  std::printf("PIM-Info: Start kernel timer%s.\n", (region.m_path.empty() ? "" : " " + region.m_path).c_str());
+  if (!region.m_path.empty()) {
+    getRegionStats(region.m_path);
   }
-  std::printf("PIM-Info: Start kernel timer.\n");
   m_isKernelTimerOn = true;
-  m_kernelStart = std::chrono::high_resolution_clock::now();
+  region.m_statsStart = getMergedStats();
+  region.m_msTimelineStart = m_timeline.getMsEnd();
+  region.m_start = std::chrono::high_resolution_clock::now();
+  m_timerRegions.push_back(region);
 }
 
-//! @brief  End timer for a PIM kernel to measure CPU runtime and DRAM refresh
+//! @brief  End timer of the innermost kernel region to measure CPU runtime and DRAM refresh
 void
 pimStatsMgr::endKernelTimer()
 {
-  if (!m_isKernelTimerOn) {
+  if (m_timerRegions.empty()) {
     std::printf("PIM-Warning: Kernel timer has not started\n");
     return;
   }
   auto now = std::chrono::high_resolution_clock::now();
-  double kernelMsElapsedTotal = std::chrono::duration<double, std::milli>(now - m_kernelStart).count();
-  double kernelMsElapsedCpu = kernelMsElapsedTotal - m_kernelMsElapsedSim;
-  std::printf("PIM-Info: End kernel timer. Runtime = %14f ms, CPU = %14f ms, PIM = %14f ms\n",
-      kernelMsElapsedCpu + m_kernelMsEstRuntime, kernelMsElapsedCpu, m_kernelMsEstRuntime);
-  m_kernelStart = std::chrono::high_resolution_clock::time_point(); // reset
-  m_isKernelTimerOn = false;
+  timerRegion region = m_timerRegions.back();
+  m_timerRegions.pop_back();
+  bool isOutermost = m_timerRegions.empty();
+  m_isKernelTimerOn = !isOutermost;
+
+  statsData stats = getMergedStats();
+  const statsData& statsStart = region.m_statsStart;
+  double kernelMsElapsedTotal = std::chrono::duration<double, std::milli>(now - region.m_start).count();
+  double kernelMsElapsedSim = stats.m_kernelMsElapsedSim - statsStart.m_kernelMsElapsedSim;
+  double kernelMsEstRuntime = stats.m_kernelMsEstRuntime - statsStart.m_kernelMsEstRuntime;
+  double kernelMsElapsedCpu = kernelMsElapsedTotal - kernelMsElapsedSim;
+  // long kernels are stalled by DRAM refreshes
+  uint64_t numRefresh = 0;
+  double kernelMsRefresh = getPerfEnergyForRefresh(kernelMsEstRuntime, numRefresh).m_msRuntime;
+  std::string label = (region.m_path.empty() ? "" : " " + region.m_path);
+  std::printf("PIM-Info: End kernel timer%s. Runtime = %14f ms, CPU = %14f ms, PIM = %14f ms, Refresh = %14f ms\n",
+      label.c_str(), kernelMsElapsedCpu + kernelMsEstRuntime + kernelMsRefresh, kernelMsElapsedCpu, kernelMsEstRuntime, kernelMsRefresh);
+  double kernelMsCriticalPath = std::max(0.0, m_timeline.getMsEnd() - region.m_msTimelineStart);
+  if (isOutermost) {
+    double kernelMsCriticalPathRefresh = getPerfEnergyForRefresh(kernelMsCriticalPath, numRefresh).m_msRuntime;
+    std::printf("PIM-Info: Kernel timeline. Runtime = %14f ms, PIM Serialized = %14f ms, PIM Critical Path = %14f ms\n",
+        kernelMsElapsedCpu + kernelMsCriticalPath + kernelMsCriticalPathRefresh, kernelMsEstRuntime, kernelMsCriticalPath);
+    kernelStats kernel;
+    kernel.m_msRuntime = kernelMsElapsedCpu + kernelMsEstRuntime + kernelMsRefresh;
+    kernel.m_msCpu = kernelMsElapsedCpu;
+    kernel.m_msPim = kernelMsEstRuntime;
+    kernel.m_msRefresh = kernelMsRefresh;
+    kernel.m_msTimelineRuntime = kernelMsElapsedCpu + kernelMsCriticalPath + kernelMsCriticalPathRefresh;
+    kernel.m_msCriticalPath = kernelMsCriticalPath;
+    m_kernelStats.push_back(kernel);
+  }
+  if (region.m_path.empty()) {
+    return;
+  }
+
+  // accumulate stats of a named region over all of its runs
+  regionStats& item = getRegionStats(region.m_path);
+  item.m_count++;
+  item.m_msRuntime += kernelMsElapsedCpu + kernelMsEstRuntime + kernelMsRefresh;
+  item.m_msCpu += kernelMsElapsedCpu;
+  item.m_msPim += kernelMsEstRuntime;
+  item.m_msRefresh += kernelMsRefresh;
+  item.m_msCriticalPath += kernelMsCriticalPath;
+  item.m_mjEnergy += (stats.m_mJCopiedMainToDevice - statsStart.m_mJCopiedMainToDevice)
+                   + (stats.m_mJCopiedDeviceToMain - statsStart.m_mJCopiedDeviceToMain)
+                   + (stats.m_mJCopiedDeviceToDevice - statsStart.m_mJCopiedDeviceToDevice);
+  for (const auto& [cmdName, cmdPerf] : stats.m_cmdPerf) {
+    auto itStart = statsStart.m_cmdPerf.find(cmdName);
+    int numCmds = cmdPerf.first - (itStart != statsStart.m_cmdPerf.end() ? itStart->second.first : 0);
+    if (numCmds <= 0) {
+      continue;
+    }
+    double msRuntime = cmdPerf.second.m_msRuntime - (itStart != statsStart.m_cmdPerf.end() ? itStart->second.second.m_msRuntime : 0.0);
+    double mjEnergy = cmdPerf.second.m_mjEnergy - (itStart != statsStart.m_cmdPerf.end() ? itStart->second.second.m_mjEnergy : 0.0);
+    auto& cmdItem = item.m_cmdPerf[cmdName];
+    cmdItem.first += numCmds;
+    cmdItem.second.m_msRuntime += msRuntime;
+    cmdItem.second.m_mjEnergy += mjEnergy;
+    item.m_numCmds += numCmds;
+    item.m_mjEnergy += mjEnergy;
+  }
+}
+
+//! @brief  Get stats of a named kernel timer region. Its depth is the number of named regions it is nested in
+pimStatsMgr::regionStats&
+pimStatsMgr::getRegionStats(const std::string& path)
+{
+  auto it = std::find_if(m_regionStats.begin(), m_regionStats.end(),
+                         [&](const auto& item) { return item.first == path; });
+  if (it == m_regionStats.end()) {
+    it = m_regionStats.insert(m_regionStats.end(), { path, regionStats() });
+    it->second.m_depth = static_cast<unsigned>(std::count(path.begin(), path.end(), '/'));
+  }
+  return it->second;
+}
+
+//! @brief  Get indices of named kernel timer regions in depth-first order of the region tree.
+//!         Children of a region follow it in order of first start, regardless of when its siblings ran
+std::vector<size_t>
+pimStatsMgr::getRegionTreeOrder() const
+{
+  // a region started before its nested regions, so its parent is found among earlier regions
+  size_t numRegions = m_regionStats.size();
+  std::vector<std::vector<size_t>> children(numRegions + 1);  // the last one holds top-level regions
+  for (size_t regionIdx = 0; regionIdx < numRegions; ++regionIdx) {
+    const std::string& path = m_regionStats[regionIdx].first;
+    size_t pos = path.find_last_of('/');
+    size_t parentIdx = numRegions;
+    for (size_t idx = 0; pos != std::string::npos && idx < regionIdx; ++idx) {
+      if (m_regionStats[idx].first.compare(0, std::string::npos, path, 0, pos) == 0) {
+        parentIdx = idx;
+        break;
+      }
+    }
+    children[parentIdx].push_back(regionIdx);
+  }
+  std::vector<size_t> order;
+  std::vector<size_t> pending(children[numRegions].rbegin(), children[numRegions].rend());
+  while (!pending.empty()) {
+    size_t regionIdx = pending.back();
+    pending.pop_back();
+    order.push_back(regionIdx);
+    pending.insert(pending.end(), children[regionIdx].rbegin(), children[regionIdx].rend());
+  }
+  return order;
 }
 
 //! @brief pimPerfMon ctor
@@ -283,9 +1210,12 @@ pimPerfMon::pimPerfMon(const std::string& tag)
 {
   m_startTime = std::chrono::high_resolution_clock::now();
   m_tag = tag;
-  // assumption: pimPerfMon is not nested
-  if (pimSim::get()->getStatsMgr()) {
-    pimSim::get()->getStatsMgr()->pimApiScopeStart();
+  // APIs called by another API are not counted twice in kernel stats
+  m_isOutermost = (pimStatsMgr::s_apiScope.m_depth++ == 0);
+  if (m_isOutermost) {
+    // Restart for current PIM API call of the calling thread
+    pimStatsMgr::s_apiScope.m_statsMgr = pimSim::get()->getStatsMgr();
+    pimStatsMgr::s_apiScope.m_msEstRuntime = 0.0;
   }
 }
 
@@ -294,8 +1224,12 @@ pimPerfMon::~pimPerfMon()
 {
   auto now = std::chrono::high_resolution_clock::now();
   double elapsed = std::chrono::duration<double, std::milli>(now - m_startTime).count();
+  --pimStatsMgr::s_apiScope.m_depth;
+  if (pimChromeTrace::isOn()) {
+    pimChromeTrace::recordApi(m_tag, m_startTime, now);
+  }
   if (pimSim::get()->getStatsMgr()) {
-    pimSim::get()->getStatsMgr()->pimApiScopeEnd(m_tag, elapsed);
+    pimSim::get()->getStatsMgr()->pimApiScopeEnd(m_tag, elapsed, m_isOutermost);
   }
 }
 
@@ -9,11 +9,18 @@
 
 #include "pimParamsDram.h"
 #include "pimPerfEnergyBase.h"
+#include "pimTimeline.h"
 #include "libpimeval.h"
 #include <cstdint>
 #include <string>
 #include <map>
+#include <vector>
 #include <chrono>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <tuple>
 
 //! @class  pimPerfMon
 //! @brief  PIM performance monitor
@@ -26,56 +33,214 @@ public:
 private:
   std::chrono::time_point<std::chrono::high_resolution_clock> m_startTime;
   std::string m_tag;
+  bool m_isOutermost = false;
 };
 
+class pimStatsMgr;
+
+//! @struct  pimStatsTarget
+//! @brief  A simulation target for reporting stats. Stats manager is null if the target is disabled
+struct pimStatsTarget
+{
+  std::string m_name;
+  const pimStatsMgr* m_statsMgr = nullptr;
+  uint64_t m_numHostDataBytes = 0;  // host memory of PIM object data holders on this target
+};
 
 //! @class  pimStats
 //! @brief  PIM stats manager
+//! Stats are recorded into per-thread shards, so that PIM API calls from multiple host threads do not serialize
+//! on one lock. Shards are merged when stats are reported
 class pimStatsMgr
 {
 public:
   pimStatsMgr() {}
   ~pimStatsMgr() {}
 
-  void startKernelTimer();
+  void startKernelTimer(const std::string& tag = "");
   void endKernelTimer();
 
   void showStats() const;
   void resetStats();
+  void getMicroOpStats(unsigned& numR, unsigned& numW, unsigned& numL) const;
+  void getStatsSummary(PimStatsSummary& summary) const;
+  bool exportStats(const std::string& filePath, PimStatsFormatEnum format,
+                   const std::vector<pimStatsTarget>& targets = {}) const;
+  static void showMultiTargetStats(const std::vector<pimStatsTarget>& targets);
 
-  void recordCmd(const std::string& cmdName, pimeval::perfEnergy mPerfEnergy);
+  void recordCmd(const std::string& cmdName, pimeval::perfEnergy mPerfEnergy, int numCmds = 1);
   void recordCopyMainToDevice(uint64_t numBits, pimeval::perfEnergy mPerfEnergy);
   void recordCopyDeviceToMain(uint64_t numBits, pimeval::perfEnergy mPerfEnergy);
   void recordCopyDeviceToDevice(uint64_t numBits, pimeval::perfEnergy mPerfEnergy);
+  void recordDramSimCmd(const std::string& cmdName, double msModeled, bool isSampled, double msSimulated);
+
+  void scheduleCmd(const pimCmd& cmd, const pimResMgr& resMgr, double msRuntime);
+  void recordCoreOccupancy(const pimCmd& cmd, const pimResMgr& resMgr, double msRuntime);
+  //! @brief  Set bus turnaround time between host-device copies in different directions on the modeled timeline
+  void setBusTurnaround(double msReadToWrite, double msWriteToRead) { m_timeline.setBusTurnaround(msReadToWrite, msWriteToRead); }
+
+  //! @brief  Get total estimated runtime of PIM API calls issued by the calling thread
+  static double getThreadMsEstRuntime() { return s_apiScope.m_msEstRuntimeTotal; }
+  //! @brief  Get estimated runtime of the current PIM API call of the calling thread so far
+  static double getThreadMsCurApiRuntime() { return s_apiScope.m_msEstRuntime; }
+  //! @brief  Get total runtime scheduled on modeled timelines by the calling thread, to avoid scheduling nested commands twice
+  static double getThreadMsScheduled() { return s_apiScope.m_msScheduled; }
 
 private:
   friend class pimPerfMon;
-  void pimApiScopeStart();
-  void pimApiScopeEnd(const std::string& tag, double elapsed);
-
-  void showApiStats() const;
+  void pimApiScopeEnd(const std::string& tag, double elapsed, bool isOutermost);
+  void addToCurApi(double msRuntime) const;
+
+  //! @struct  pimStatsMgr::apiScope
+  //! @brief  PIM API scope of the calling thread. Only the outermost API call is tracked, e.g., pimFuse calling other APIs
+  struct apiScope {
+    const pimStatsMgr* m_statsMgr = nullptr;
+    unsigned m_depth = 0;
+    double m_msEstRuntime = 0.0;
+    double m_msEstRuntimeTotal = 0.0;
+    double m_msScheduled = 0.0;
+  };
+  static thread_local apiScope s_apiScope;
+
+  //! @struct  pimStatsMgr::dramSimStats
+  //! @brief  Modeled runtime of a PIM command type, and DRAMsim3 simulated runtime of its sampled commands
+  struct dramSimStats {
+    int m_numCmds = 0;
+    int m_numSampled = 0;
+    double m_msModeled = 0.0;
+    double m_msModeledSampled = 0.0;
+    double m_msSimulated = 0.0;
+  };
+
+  //! @struct  pimStatsMgr::coreOccupancy
+  //! @brief  Occupancy of PIM cores by a PIM command type, accumulated over its commands.
+  //!         Runtime of idle cores and padding is the modeled runtime lost compared to spreading elements evenly
+  //!         over full regions of all cores
+  struct coreOccupancy {
+    int m_numCmds = 0;
+    unsigned m_numCores = 0;
+    uint64_t m_numActiveCores = 0;
+    unsigned m_minRegionsPerCore = 0;  // of active cores
+    unsigned m_maxRegionsPerCore = 0;
+    uint64_t m_numRegions = 0;
+    uint64_t m_numElements = 0;
+    uint64_t m_numElementSlots = 0;  // element capacity of all passes on active cores
+    double m_msRuntime = 0.0;
+    double m_msIdleCores = 0.0;
+    double m_msPadding = 0.0;
+    std::map<unsigned, uint64_t> m_regionsPerCoreHist;  // number of regions per core to number of cores
+
+    void merge(const coreOccupancy& other);
+  };
+
+  //! @struct  pimStatsMgr::statsData
+  //! @brief  Stats recorded in one shard, or merged from all shards
+  struct statsData {
+    std::map<std::string, std::pair<int, pimeval::perfEnergy>> m_cmdPerf;
+    std::map<std::string, std::pair<int, double>> m_msElapsed;
+    std::map<std::string, dramSimStats> m_dramSimCmds;
+    std::map<std::string, coreOccupancy> m_coreOccupancy;
+    std::vector<double> m_coreMsActive;  // modeled runtime of each PIM core processing its regions, only with DEBUG_HEATMAP
+
+    uint64_t m_bitsCopiedMainToDevice = 0;
+    uint64_t m_bitsCopiedDeviceToMain = 0;
+    uint64_t m_bitsCopiedDeviceToDevice = 0;
+    double m_elapsedTimeCopiedMainToDevice = 0.0;
+    double m_elapsedTimeCopiedDeviceToMain = 0.0;
+    double m_elapsedTimeCopiedDeviceToDevice = 0.0;
+    double m_mJCopiedMainToDevice = 0.0;
+    double m_mJCopiedDeviceToMain = 0.0;
+    double m_mJCopiedDeviceToDevice = 0.0;
+
+    double m_kernelMsElapsedSim = 0.0;
+    double m_kernelMsEstRuntime = 0.0;
+
+    void merge(const statsData& other);
+  };
+
+  //! @struct  pimStatsMgr::kernelStats
+  //! @brief  Results of a kernel timer
+  struct kernelStats {
+    double m_msRuntime = 0.0;
+    double m_msCpu = 0.0;
+    double m_msPim = 0.0;
+    double m_msRefresh = 0.0;
+    double m_msTimelineRuntime = 0.0;
+    double m_msCriticalPath = 0.0;
+  };
+
+  //! @struct  pimStatsMgr::timerRegion
+  //! @brief  A running kernel timer, and stats at its start. Nested regions have paths of tags joined by '/'
+  struct timerRegion {
+    std::string m_path;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_start{};
+    double m_msTimelineStart = 0.0;
+    statsData m_statsStart;
+  };
+
+  //! @struct  pimStatsMgr::regionStats
+  //! @brief  Results of a named kernel timer region accumulated over its runs, including its nested regions
+  struct regionStats {
+    unsigned m_depth = 0;
+    int m_count = 0;
+    int m_numCmds = 0;
+    double m_msRuntime = 0.0;
+    double m_msCpu = 0.0;
+    double m_msPim = 0.0;
+    double m_msRefresh = 0.0;
+    double m_msCriticalPath = 0.0;
+    double m_mjEnergy = 0.0;
+    std::map<std::string, std::pair<int, pimeval::perfEnergy>> m_cmdPerf;
+  };
+
+  //! @struct  pimStatsMgr::statsRecord
+  //! @brief  Named metrics of one item in a section of exported stats. Values are formatted already
+  struct statsRecord {
+    std::string m_section;
+    std::string m_name;
+    std::vector<std::tuple<std::string, std::string, bool>> m_metrics;  // metric, value, is string
+
+    statsRecord(const std::string& section, const std::string& name) : m_section(section), m_name(name) {}
+    void add(const std::string& metric, double val);
+    void add(const std::string& metric, uint64_t val);
+    void add(const std::string& metric, const std::string& val);
+  };
+
+  //! @struct  pimStatsMgr::statsShard
+  //! @brief  A stats shard. Host threads are assigned to shards round-robin
+  struct statsShard {
+    std::mutex m_mutex;
+    statsData m_data;
+  };
+
+  statsShard& getShard();
+  statsData getMergedStats() const;
+
+  void showApiStats(const statsData& stats) const;
   void showDeviceParams() const;
-  void showCopyStats() const;
-  void showCmdStats() const;
-
-  std::map<std::string, std::pair<int, pimeval::perfEnergy>> m_cmdPerf;
-  std::map<std::string, std::pair<int, double>> m_msElapsed;
-
-  uint64_t m_bitsCopiedMainToDevice = 0;
-  uint64_t m_bitsCopiedDeviceToMain = 0;
-  uint64_t m_bitsCopiedDeviceToDevice = 0;
-  double m_elapsedTimeCopiedMainToDevice = 0.0;
-  double m_elapsedTimeCopiedDeviceToMain = 0.0;
-  double m_elapsedTimeCopiedDeviceToDevice = 0.0;
-  double m_mJCopiedMainToDevice = 0.0;
-  double m_mJCopiedDeviceToMain = 0.0;
-  double m_mJCopiedDeviceToDevice = 0.0;
-
-  bool m_isKernelTimerOn = false;
-  double m_curApiMsEstRuntime = 0.0;
-  double m_kernelMsElapsedSim = 0.0;
-  double m_kernelMsEstRuntime = 0.0;
-  std::chrono::time_point<std::chrono::high_resolution_clock> m_kernelStart{};
+  void showCopyStats(const statsData& stats) const;
+  void showCmdStats(const statsData& stats) const;
+  void showDramSimStats(const statsData& stats) const;
+  void showRegionStats() const;
+  void showCoreOccupancyStats(const statsData& stats) const;
+  void showCoreHeatmap(const statsData& stats) const;
+  regionStats& getRegionStats(const std::string& path);
+  std::vector<size_t> getRegionTreeOrder() const;
+  static void countMicroOps(const statsData& stats, unsigned& numR, unsigned& numW, unsigned& numL);
+  std::vector<statsRecord> getStatsRecords(const std::vector<pimStatsTarget>& targets) const;
+  static void writeStatsJson(std::ostream& os, const std::vector<statsRecord>& records);
+  static void writeStatsCsv(std::ostream& os, const std::vector<statsRecord>& records);
+  static pimeval::perfEnergy getPerfEnergyForRefresh(double msRuntime, uint64_t& numRefresh);
+
+  static constexpr unsigned s_numShards = 16;
+  mutable std::array<statsShard, s_numShards> m_shards;
+
+  std::atomic<bool> m_isKernelTimerOn = false;
+  std::vector<timerRegion> m_timerRegions;  // running kernel timers, innermost last
+  std::vector<kernelStats> m_kernelStats;
+  std::vector<std::pair<std::string, regionStats>> m_regionStats;  // in order of first start
+  pimTimeline m_timeline;
+  pimTimeline m_cmdTimeline{true};
 };
 
 #endif
@@ -0,0 +1,391 @@
+// File: pimStream.cpp
+// PIMeval Simulator - PIM Streams and Events for Asynchronous Execution
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "pimStream.h"
+#include "pimSim.h"
+#include "pimStats.h"
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+
+
+//! @brief  pimStreamMgr dtor. Pending tasks are finished before stream threads exit
+pimStreamMgr::~pimStreamMgr()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& [streamId, s] : m_streams) {
+      s->m_terminate = true;
+      s->m_taskCond.notify_all();
+    }
+  }
+  for (auto& [streamId, s] : m_streams) {
+    s->m_thread.join();
+  }
+}
+
+//! @brief  Create a stream and its background thread
+PimStreamId
+pimStreamMgr::createStream()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  PimStreamId streamId = m_nextStreamId++;
+  auto s = std::make_unique<stream>();
+  s->m_msModeled = m_msHost;
+  s->m_thread = std::thread(&pimStreamMgr::streamThread, this, streamId, s.get());
+  m_streams[streamId] = std::move(s);
+  return streamId;
+}
+
+//! @brief  Delete a stream after its pending tasks are done
+bool
+pimStreamMgr::deleteStream(PimStreamId streamId)
+{
+  bool ok = synchronizeStream(streamId);
+  std::unique_ptr<stream> s;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_streams.find(streamId);
+    if (it == m_streams.end()) {
+      return false;
+    }
+    s = std::move(it->second);
+    m_streams.erase(it);
+    s->m_terminate = true;
+    s->m_taskCond.notify_all();
+  }
+  s->m_thread.join();
+  m_doneCond.notify_all();
+  return ok;
+}
+
+//! @brief  Enqueue a task of PIM API calls to a stream
+bool
+pimStreamMgr::enqueue(PimStreamId streamId, taskEnum taskType, const std::function<bool()>& func)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_streams.find(streamId);
+  if (it == m_streams.end()) {
+    std::printf("PIM-Error: Invalid PIM stream ID %d\n", streamId);
+    return false;
+  }
+  stream& s = *it->second;
+  streamTask task;
+  task.m_type = taskType;
+  task.m_func = func;
+  issue(s, task);
+  return true;
+}
+
+//! @brief  Wait for all tasks issued to a stream. Return false if any of them failed since last synchronization
+bool
+pimStreamMgr::synchronizeStream(PimStreamId streamId)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  auto it = m_streams.find(streamId);
+  if (it == m_streams.end()) {
+    std::printf("PIM-Error: Invalid PIM stream ID %d\n", streamId);
+    return false;
+  }
+  stream& s = *it->second;
+  uint64_t issueIdx = s.m_lastIssueIdx;
+  m_doneCond.wait(lock, [&] { return isModeled(issueIdx); });
+  m_msHost = std::max(m_msHost, s.m_msModeled);
+  bool ok = !s.m_hasError;
+  s.m_hasError = false;
+  if (!ok) {
+    std::printf("PIM-Error: Async PIM API call failed on stream %d\n", streamId);
+  }
+  return ok;
+}
+
+//! @brief  Wait for all streams
+bool
+pimStreamMgr::synchronizeAll()
+{
+  std::vector<PimStreamId> streamIds;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [streamId, s] : m_streams) {
+      streamIds.push_back(streamId);
+    }
+  }
+  bool ok = true;
+  for (PimStreamId streamId : streamIds) {
+    ok &= synchronizeStream(streamId);
+  }
+  return ok;
+}
+
+//! @brief  Create an event
+PimEventId
+pimStreamMgr::createEvent()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  PimEventId eventId = m_nextEventId++;
+  m_events[eventId] = event();
+  return eventId;
+}
+
+//! @brief  Delete an event
+bool
+pimStreamMgr::deleteEvent(PimEventId eventId)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_events.erase(eventId) == 0) {
+    std::printf("PIM-Error: Invalid PIM event ID %d\n", eventId);
+    return false;
+  }
+  return true;
+}
+
+//! @brief  Record an event at the current position of a stream. An event can be recorded again
+bool
+pimStreamMgr::recordEvent(PimEventId eventId, PimStreamId streamId)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto itEvent = m_events.find(eventId);
+  if (itEvent == m_events.end()) {
+    std::printf("PIM-Error: Invalid PIM event ID %d\n", eventId);
+    return false;
+  }
+  auto itStream = m_streams.find(streamId);
+  if (itStream == m_streams.end()) {
+    std::printf("PIM-Error: Invalid PIM stream ID %d\n", streamId);
+    return false;
+  }
+  stream& s = *itStream->second;
+  streamTask task;
+  task.m_type = taskEnum::RECORD_EVENT;
+  task.m_eventId = eventId;
+  task.m_eventSeq = s.m_numIssued + 1;
+  issue(s, task);
+  itEvent->second.m_streamId = streamId;
+  itEvent->second.m_seq = task.m_eventSeq;
+  itEvent->second.m_issueIdx = task.m_issueIdx;
+  return true;
+}
+
+//! @brief  Wait for the most recent record of an event. An event that is never recorded is done
+bool
+pimStreamMgr::synchronizeEvent(PimEventId eventId)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  auto it = m_events.find(eventId);
+  if (it == m_events.end()) {
+    std::printf("PIM-Error: Invalid PIM event ID %d\n", eventId);
+    return false;
+  }
+  uint64_t issueIdx = it->second.m_issueIdx;
+  m_doneCond.wait(lock, [&] { return isModeled(issueIdx); });
+  it = m_events.find(eventId);
+  if (it != m_events.end()) {
+    m_msHost = std::max(m_msHost, it->second.m_msModeled);
+  }
+  return true;
+}
+
+//! @brief  Let later tasks of a stream wait for the most recent record of an event
+bool
+pimStreamMgr::streamWaitEvent(PimStreamId streamId, PimEventId eventId)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto itEvent = m_events.find(eventId);
+  if (itEvent == m_events.end()) {
+    std::printf("PIM-Error: Invalid PIM event ID %d\n", eventId);
+    return false;
+  }
+  auto itStream = m_streams.find(streamId);
+  if (itStream == m_streams.end()) {
+    std::printf("PIM-Error: Invalid PIM stream ID %d\n", streamId);
+    return false;
+  }
+  stream& s = *itStream->second;
+  streamTask task;
+  task.m_type = taskEnum::WAIT_EVENT;
+  task.m_eventId = eventId;
+  task.m_eventSeq = itEvent->second.m_seq;
+  task.m_waitStreamId = itEvent->second.m_streamId;
+  issue(s, task);
+  return true;
+}
+
+//! @brief  Get modeled runtime between two completed events
+bool
+pimStreamMgr::getEventElapsedTime(PimEventId startId, PimEventId endId, double* msRuntime)
+{
+  if (!msRuntime) {
+    std::printf("PIM-Error: Invalid null pointer as event elapsed time output\n");
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (PimEventId eventId : { startId, endId }) {
+    auto it = m_events.find(eventId);
+    if (it == m_events.end()) {
+      std::printf("PIM-Error: Invalid PIM event ID %d\n", eventId);
+      return false;
+    }
+    if (it->second.m_streamId == -1 || !isModeled(it->second.m_issueIdx)) {
+      std::printf("PIM-Error: PIM event %d has not been recorded or completed\n", eventId);
+      return false;
+    }
+  }
+  *msRuntime = m_events.at(endId).m_msModeled - m_events.at(startId).m_msModeled;
+  return true;
+}
+
+//! @brief  Show serialized and overlapped runtime of async tasks since last stats reset
+void
+pimStreamMgr::showStats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_numAsyncTasks == 0) {
+    return;
+  }
+  std::printf("Stream Stats:\n");
+  std::printf(" %45s : %llu\n", "Async Tasks", (unsigned long long)m_numAsyncTasks);
+  std::printf(" %45s : %14f ms Estimated Runtime\n", "Serialized", m_msSerialized);
+  std::printf(" %45s : %14f ms Estimated Runtime\n", "Overlapped", m_msOverlapped - m_msStatsBegin);
+  std::printf("----------------------------------------\n");
+}
+
+//! @brief  Reset stream stats. The modeled timeline continues from the latest modeled time
+void
+pimStreamMgr::resetStats()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_msStatsBegin = std::max(m_msOverlapped, m_msHost);
+  m_msOverlapped = m_msStatsBegin;
+  m_msSerialized = 0.0;
+  m_numAsyncTasks = 0;
+}
+
+//! @brief  Background thread of a stream. Run tasks in order until the stream is deleted
+void
+pimStreamMgr::streamThread(PimStreamId streamId, stream* s)
+{
+  // API calls of the stream operate on the PIM context which owns the stream
+  pimSim::setCurrentContext(m_context);
+  while (true) {
+    streamTask task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      s->m_taskCond.wait(lock, [s] { return s->m_terminate || !s->m_tasks.empty(); });
+      if (s->m_tasks.empty()) {
+        return;
+      }
+      task = std::move(s->m_tasks.front());
+      s->m_tasks.pop_front();
+      if (task.m_type == taskEnum::WAIT_EVENT) {
+        m_doneCond.wait(lock, [&] { return isDone(task.m_waitStreamId, task.m_eventSeq); });
+      }
+    }
+    bool ok = true;
+    double msRuntime = 0.0;
+    if (task.m_func) {
+      double msBegin = pimStatsMgr::getThreadMsEstRuntime();
+      ok = task.m_func();
+      msRuntime = pimStatsMgr::getThreadMsEstRuntime() - msBegin;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      s->m_hasError |= !ok;
+      ++s->m_numDone;
+      task.m_func = nullptr;
+      uint64_t issueIdx = task.m_issueIdx;
+      m_finished[issueIdx] = { streamId, std::move(task), msRuntime };
+      // schedule finished tasks in issue order
+      for (auto it = m_finished.begin(); it != m_finished.end() && it->first == m_numModeled + 1; it = m_finished.erase(it)) {
+        updateTimeline(it->second);
+        ++m_numModeled;
+      }
+    }
+    m_doneCond.notify_all();
+  }
+}
+
+//! @brief  Issue a task to a stream
+void
+pimStreamMgr::issue(stream& s, streamTask& task)
+{
+  task.m_issueIdx = ++m_numIssued;
+  task.m_msIssued = m_msHost;
+  s.m_lastIssueIdx = task.m_issueIdx;
+  ++s.m_numIssued;
+  s.m_tasks.push_back(task);
+  s.m_taskCond.notify_one();
+}
+
+//! @brief  Schedule a finished task on the modeled timeline
+void
+pimStreamMgr::updateTimeline(const finishedTask& finished)
+{
+  const streamTask& task = finished.m_task;
+  PimStreamId streamId = finished.m_streamId;
+  double msRuntime = finished.m_msRuntime;
+  // streams are deleted after all of their tasks are scheduled
+  stream& s = *m_streams.at(streamId);
+  switch (task.m_type) {
+  case taskEnum::COPY:
+  case taskEnum::COMPUTE:
+  {
+    std::map<double, double>& busy = (task.m_type == taskEnum::COPY ? m_channelBusy : m_deviceBusy);
+    double msReady = std::max(s.m_msModeled, task.m_msIssued);
+    s.m_msModeled = reserve(busy, msReady, msRuntime, m_msHost) + msRuntime;
+    m_msSerialized += msRuntime;
+    m_msOverlapped = std::max(m_msOverlapped, s.m_msModeled);
+    ++m_numAsyncTasks;
+    break;
+  }
+  case taskEnum::RECORD_EVENT:
+  {
+    auto it = m_events.find(task.m_eventId);
+    if (it != m_events.end() && it->second.m_issueIdx == task.m_issueIdx) {
+      it->second.m_msModeled = s.m_msModeled;
+    }
+    break;
+  }
+  case taskEnum::WAIT_EVENT:
+  {
+    auto it = m_events.find(task.m_eventId);
+    if (it != m_events.end()) {
+      s.m_msModeled = std::max(s.m_msModeled, it->second.m_msModeled);
+    }
+    break;
+  }
+  }
+}
+
+//! @brief  Reserve the earliest idle gap of a resource which fits a task ready at msReady. Return start time.
+//! Intervals ending before msPrune are dropped, as later tasks are never issued before the host time
+double
+pimStreamMgr::reserve(std::map<double, double>& busy, double msReady, double msRuntime, double msPrune)
+{
+  while (!busy.empty() && busy.begin()->second <= msPrune) {
+    busy.erase(busy.begin());
+  }
+  double msStart = msReady;
+  auto it = busy.upper_bound(msStart);
+  if (it != busy.begin() && std::prev(it)->second > msStart) {
+    msStart = std::prev(it)->second;
+  }
+  for (; it != busy.end() && it->first < msStart + msRuntime; ++it) {
+    msStart = std::max(msStart, it->second);
+  }
+  if (msRuntime > 0.0) {
+    busy[msStart] = msStart + msRuntime;
+  }
+  return msStart;
+}
+
+//! @brief  Check if a stream has finished the task with a sequence number. Deleted streams are done
+bool
+pimStreamMgr::isDone(PimStreamId streamId, uint64_t seq) const
+{
+  auto it = m_streams.find(streamId);
+  return it == m_streams.end() || it->second->m_numDone >= seq;
+}
+
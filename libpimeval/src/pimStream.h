@@ -0,0 +1,135 @@
+// File: pimStream.h
+// PIMeval Simulator - PIM Streams and Events for Asynchronous Execution
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#ifndef LAVA_PIM_STREAM_H
+#define LAVA_PIM_STREAM_H
+
+#include "libpimeval.h"
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+//! @class  pimStreamMgr
+//! @brief  Streams and events of a PIM context
+//! Each stream runs its tasks in order on a background thread with the PIM context as current context.
+//! A task runs one or more PIM API calls. Estimated runtime of tasks is scheduled on a modeled timeline:
+//! host-device copies on a shared memory channel, and computation on the PIM device. A task starts after
+//! its previous task on the same stream, at the earliest idle gap of the resource where it fits, so that copies
+//! and computation of different streams overlap. Finished tasks are scheduled in issue order, so that the modeled timeline
+//! does not depend on how background threads interleave
+class pimStreamMgr
+{
+public:
+  //! @enum   pimStreamMgr::taskEnum
+  //! @brief  Types of stream tasks
+  enum class taskEnum {
+    COPY,
+    COMPUTE,
+    RECORD_EVENT,
+    WAIT_EVENT,
+  };
+
+  pimStreamMgr(PimContext context) : m_context(context) {}
+  ~pimStreamMgr();
+
+  PimStreamId createStream();
+  bool deleteStream(PimStreamId streamId);
+  bool enqueue(PimStreamId streamId, taskEnum taskType, const std::function<bool()>& func);
+  bool synchronizeStream(PimStreamId streamId);
+  bool synchronizeAll();
+
+  PimEventId createEvent();
+  bool deleteEvent(PimEventId eventId);
+  bool recordEvent(PimEventId eventId, PimStreamId streamId);
+  bool synchronizeEvent(PimEventId eventId);
+  bool streamWaitEvent(PimStreamId streamId, PimEventId eventId);
+  bool getEventElapsedTime(PimEventId startId, PimEventId endId, double* msRuntime);
+
+  void showStats() const;
+  void resetStats();
+
+private:
+  //! @struct  pimStreamMgr::streamTask
+  //! @brief  A task in a stream queue
+  struct streamTask {
+    taskEnum m_type = taskEnum::COMPUTE;
+    std::function<bool()> m_func;
+    PimEventId m_eventId = -1;
+    uint64_t m_eventSeq = 0;
+    PimStreamId m_waitStreamId = -1;
+    uint64_t m_issueIdx = 0;
+    double m_msIssued = 0.0;
+  };
+
+  //! @struct  pimStreamMgr::finishedTask
+  //! @brief  A finished task waiting to be scheduled on the modeled timeline
+  struct finishedTask {
+    PimStreamId m_streamId = -1;
+    streamTask m_task;
+    double m_msRuntime = 0.0;
+  };
+
+  //! @struct  pimStreamMgr::stream
+  //! @brief  A stream with a task queue and a background thread
+  struct stream {
+    std::thread m_thread;
+    std::deque<streamTask> m_tasks;
+    std::condition_variable m_taskCond;
+    uint64_t m_numIssued = 0;
+    uint64_t m_numDone = 0;
+    uint64_t m_lastIssueIdx = 0;  // issue index of the last task, starting from 1
+    bool m_hasError = false;  // sticky until the stream is synchronized
+    bool m_terminate = false;
+    double m_msModeled = 0.0;
+  };
+
+  //! @struct  pimStreamMgr::event
+  //! @brief  An event marks a position in a stream
+  struct event {
+    PimStreamId m_streamId = -1;
+    uint64_t m_seq = 0;
+    uint64_t m_issueIdx = 0;
+    double m_msModeled = 0.0;
+  };
+
+  void streamThread(PimStreamId streamId, stream* s);
+  void issue(stream& s, streamTask& task);
+  void updateTimeline(const finishedTask& finished);
+  bool isDone(PimStreamId streamId, uint64_t seq) const;
+  bool isModeled(uint64_t issueIdx) const { return m_numModeled >= issueIdx; }
+  static double reserve(std::map<double, double>& busy, double msReady, double msRuntime, double msPrune);
+
+  PimContext m_context;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_doneCond;
+  std::unordered_map<PimStreamId, std::unique_ptr<stream>> m_streams;
+  std::unordered_map<PimEventId, event> m_events;
+  PimStreamId m_nextStreamId = 0;
+  PimEventId m_nextEventId = 0;
+
+  // modeled timeline
+  uint64_t m_numIssued = 0;
+  uint64_t m_numModeled = 0;
+  std::map<uint64_t, finishedTask> m_finished;
+  double m_msHost = 0.0;  // host waits for streams and events to be synchronized
+  std::map<double, double> m_channelBusy;  // busy intervals of the memory channel, begin to end
+  std::map<double, double> m_deviceBusy;  // busy intervals of the PIM device, begin to end
+  double m_msSerialized = 0.0;
+  double m_msOverlapped = 0.0;
+  double m_msStatsBegin = 0.0;
+  uint64_t m_numAsyncTasks = 0;
+};
+
+#endif
+
@@ -0,0 +1,186 @@
+// File: pimTimeline.cpp
+// PIMeval Simulator - Modeled Timeline of Data Copy and PIM Commands
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "pimTimeline.h"
+#include "pimCmd.h"
+#include "pimResMgr.h"
+#include <algorithm>
+#include <set>
+
+
+//! @brief  Schedule a PIM command or data copy with its estimated runtime. Return its start time, or -1 if not scheduled
+double
+pimTimeline::schedule(const pimCmd& cmd, const pimResMgr& resMgr, double msRuntime)
+{
+  std::vector<PimObjId> srcObjIds;
+  std::vector<PimObjId> destObjIds;
+  cmd.getObjIds(srcObjIds, destObjIds);
+  bool isHostCopy = (cmd.getCmdType() == PimCmdEnum::COPY_H2D || cmd.getCmdType() == PimCmdEnum::COPY_D2H);
+  if (isHostCopy && m_isCmdOnly) {
+    return -1.0;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<objState*> srcObjs;
+  std::vector<objState*> destObjs;
+  for (PimObjId objId : srcObjIds) {
+    if (objState* obj = getObjState(objId, resMgr)) {
+      srcObjs.push_back(obj);
+    }
+  }
+  for (PimObjId objId : destObjIds) {
+    if (objState* obj = getObjState(objId, resMgr)) {
+      destObjs.push_back(obj);
+    }
+  }
+
+  // items without PIM objects have unknown data access and wait for all previous items.
+  // A fused PIM program has no runtime of its own, as its commands are scheduled one by one
+  bool isBarrier = (srcObjs.empty() && destObjs.empty());
+  if (isBarrier && msRuntime == 0.0) {
+    return -1.0;
+  }
+  double msStart = (isBarrier ? m_msEnd : m_msFloor);
+  std::set<unsigned> coreSetIdxs;
+  for (const objState* obj : srcObjs) {
+    msStart = std::max(msStart, obj->m_msWritten);
+    coreSetIdxs.insert(obj->m_coreSetIdx);
+  }
+  for (const objState* obj : destObjs) {
+    msStart = std::max({ msStart, obj->m_msWritten, obj->m_msRead });
+    coreSetIdxs.insert(obj->m_coreSetIdx);
+  }
+  int hostCopy = (cmd.getCmdType() == PimCmdEnum::COPY_H2D ? 1 : -1);
+  if (isHostCopy) {
+    double msChannelReady = m_msChannelBusy;
+    if (m_lastHostCopy != 0 && m_lastHostCopy != hostCopy) {
+      msChannelReady += (hostCopy == 1 ? m_msReadToWrite : m_msWriteToRead);
+    }
+    msStart = std::max(msStart, msChannelReady);
+  } else {
+    for (unsigned idx : coreSetIdxs) {
+      for (PimCoreId coreId : m_coreSets[idx]) {
+        msStart = std::max(msStart, m_msCoreBusy[coreId]);
+      }
+    }
+  }
+
+  double msEnd = msStart + msRuntime;
+  if (isBarrier) {
+    m_msFloor = msEnd;
+  } else if (isHostCopy) {
+    m_msChannelBusy = msEnd;
+    m_lastHostCopy = hostCopy;
+  } else {
+    for (unsigned idx : coreSetIdxs) {
+      for (PimCoreId coreId : m_coreSets[idx]) {
+        m_msCoreBusy[coreId] = msEnd;
+      }
+    }
+  }
+  for (objState* obj : srcObjs) {
+    obj->m_msRead = std::max(obj->m_msRead, msEnd);
+  }
+  for (objState* obj : destObjs) {
+    obj->m_msWritten = msEnd;
+  }
+  m_msEnd = std::max(m_msEnd, msEnd);
+  m_msSerialized += msRuntime;
+  return msStart;
+}
+
+//! @brief  Set bus turnaround time between host-device copies in different directions
+void
+pimTimeline::setBusTurnaround(double msReadToWrite, double msWriteToRead)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_msReadToWrite = msReadToWrite;
+  m_msWriteToRead = msWriteToRead;
+}
+
+//! @brief  Synchronization point. Later items start after all previous items
+void
+pimTimeline::synchronize()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_msFloor = m_msEnd;
+}
+
+//! @brief  Reset timeline stats. The timeline continues from the latest end time
+void
+pimTimeline::reset()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_objStates.clear();
+  m_coreSetIdx.clear();
+  m_coreSets.clear();
+  m_msCoreBusy.clear();
+  m_msChannelBusy = m_msEnd;
+  m_msFloor = m_msEnd;
+  m_msBegin = m_msEnd;
+  m_msSerialized = 0.0;
+}
+
+//! @brief  Get total runtime of all items since last reset as if they run one after another
+double
+pimTimeline::getMsSerialized() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_msSerialized;
+}
+
+//! @brief  Get runtime of the critical path of all items since last reset
+double
+pimTimeline::getMsCriticalPath() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_msEnd - m_msBegin;
+}
+
+//! @brief  Get the latest end time of all items
+double
+pimTimeline::getMsEnd() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_msEnd;
+}
+
+//! @brief  Get modeled state of a PIM object. Dual contact references share the state of the referred object
+pimTimeline::objState*
+pimTimeline::getObjState(PimObjId objId, const pimResMgr& resMgr)
+{
+  if (objId < 0 || !resMgr.isValidObjId(objId)) {
+    return nullptr;
+  }
+  const pimObjInfo* objInfo = &resMgr.getObjInfo(objId);
+  if (objInfo->isDualContactRef() && resMgr.isValidObjId(objInfo->getRefObjId())) {
+    objId = objInfo->getRefObjId();
+    objInfo = &resMgr.getObjInfo(objId);
+  }
+  auto it = m_objStates.find(objId);
+  if (it != m_objStates.end()) {
+    return &it->second;
+  }
+  // object IDs are not reused, so cores of an object are looked up once
+  std::vector<PimCoreId> coreIds;
+  for (const pimRegion& region : objInfo->getRegions()) {
+    coreIds.push_back(region.getCoreId());
+  }
+  std::sort(coreIds.begin(), coreIds.end());
+  coreIds.erase(std::unique(coreIds.begin(), coreIds.end()), coreIds.end());
+  if (!coreIds.empty() && m_msCoreBusy.size() <= static_cast<size_t>(coreIds.back())) {
+    m_msCoreBusy.resize(coreIds.back() + 1, 0.0);
+  }
+  auto itCoreSet = m_coreSetIdx.find(coreIds);
+  if (itCoreSet == m_coreSetIdx.end()) {
+    itCoreSet = m_coreSetIdx.emplace(coreIds, m_coreSets.size()).first;
+    m_coreSets.push_back(coreIds);
+  }
+  objState& obj = m_objStates[objId];
+  obj.m_coreSetIdx = itCoreSet->second;
+  return &obj;
+}
+
@@ -0,0 +1,75 @@
+// File: pimTimeline.h
+// PIMeval Simulator - Modeled Timeline of Data Copy and PIM Commands
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#ifndef LAVA_PIM_TIMELINE_H
+#define LAVA_PIM_TIMELINE_H
+
+#include "libpimeval.h"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class pimCmd;
+class pimResMgr;
+
+
+//! @class  pimTimeline
+//! @brief  Schedule estimated runtime of data copy and PIM commands on modeled resources
+//! Host-device copies use the memory channel shared by all cores, and a copy in the other direction than the
+//! previous copy starts after the bus turnaround. PIM commands and device-to-device copies
+//! use the cores of their PIM objects. Each resource serves items in program order, so that copying the next
+//! tile before computing the current one overlaps them as in double buffering. An item starts when its
+//! resources are free and its PIM objects are ready: after the last write for a read, and after the last read
+//! and write for a write. Items without PIM objects wait for all previous items. The latest end time is the
+//! critical path runtime. Data dependencies through host memory are not tracked.
+//! A command-only timeline skips host-device copies, and its critical path is the makespan of PIM commands,
+//! where commands on disjoint cores overlap
+class pimTimeline
+{
+public:
+  pimTimeline(bool isCmdOnly = false) : m_isCmdOnly(isCmdOnly) {}
+  ~pimTimeline() {}
+
+  double schedule(const pimCmd& cmd, const pimResMgr& resMgr, double msRuntime);
+  void setBusTurnaround(double msReadToWrite, double msWriteToRead);
+  void synchronize();
+  void reset();
+
+  double getMsSerialized() const;
+  double getMsCriticalPath() const;
+  double getMsEnd() const;
+
+private:
+  //! @struct  pimTimeline::objState
+  //! @brief  Cores and modeled access time of a PIM object
+  struct objState {
+    unsigned m_coreSetIdx = 0;
+    double m_msWritten = 0.0;
+    double m_msRead = 0.0;
+  };
+
+  objState* getObjState(PimObjId objId, const pimResMgr& resMgr);
+
+  bool m_isCmdOnly = false;  // skip host-device copies to model PIM commands only
+  mutable std::mutex m_mutex;
+  std::unordered_map<PimObjId, objState> m_objStates;
+  std::map<std::vector<PimCoreId>, unsigned> m_coreSetIdx;  // objects of the same cores share a core set
+  std::vector<std::vector<PimCoreId>> m_coreSets;
+  std::vector<double> m_msCoreBusy;
+  double m_msChannelBusy = 0.0;
+  double m_msReadToWrite = 0.0;
+  double m_msWriteToRead = 0.0;
+  int m_lastHostCopy = 0;  // direction of the last host-device copy: 1 for host to device, -1 for device to host
+  double m_msFloor = 0.0;  // all resources and objects are ready after the last synchronization point
+  double m_msBegin = 0.0;
+  double m_msEnd = 0.0;
+  double m_msSerialized = 0.0;
+};
+
+#endif
+
@@ -0,0 +1,539 @@
+// File: pimTrace.cpp
+// PIMeval Simulator - PIM API Trace Recording and Replay
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "pimTrace.h"
+#include "pimSim.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+
+//! @brief  Open a trace file for recording. Keep the current trace file open if it is the same file
+bool
+pimTraceWriter::open(const std::string& fileName, bool withPayload, PimContext context)
+{
+  // keep the current trace, and do not start a new trace during replay
+  if ((s_file && s_fileName == fileName && s_context == context) || s_isPaused) {
+    return true;
+  }
+  if (s_file && s_context != context) {
+    std::printf("PIM-Warning: PIM API trace %s is being recorded by another PIM context\n", s_fileName.c_str());
+    return false;
+  }
+  close();
+  s_file = std::fopen(fileName.c_str(), "wb");
+  if (!s_file) {
+    std::printf("PIM-Error: Cannot open trace file %s for writing\n", fileName.c_str());
+    return false;
+  }
+  s_fileName = fileName;
+  s_withPayload = withPayload;
+  s_context = context;
+  std::fwrite(s_magic, 1, sizeof(s_magic), s_file);
+  uint8_t version[4] = { static_cast<uint8_t>(s_version), static_cast<uint8_t>(s_version >> 8),
+                         static_cast<uint8_t>(s_version >> 16), static_cast<uint8_t>(s_version >> 24) };
+  std::fwrite(version, 1, sizeof(version), s_file);
+  std::printf("PIM-Info: Recording PIM API trace to %s%s\n", fileName.c_str(), withPayload ? " with payload" : "");
+  return true;
+}
+
+//! @brief  Close the trace file
+void
+pimTraceWriter::close()
+{
+  if (s_file) {
+    std::fclose(s_file);
+    s_file = nullptr;
+  }
+  s_context = nullptr;
+  s_fileName.clear();
+  s_withPayload = false;
+}
+
+//! @brief  Check if API calls on the current PIM context are being recorded
+bool
+pimTraceWriter::isOn()
+{
+  return s_file != nullptr && !s_isPaused && s_context == pimSim::get();
+}
+
+//! @brief  Encode one trace record and write it to the trace file
+void
+pimTraceWriter::write(PimTraceApiEnum api, const uint64_t* args, size_t numArgs, const void* payload, uint64_t numBytes)
+{
+  auto appendVarint = [](uint64_t val) {
+    while (val >= 0x80) {
+      s_buffer.push_back(static_cast<uint8_t>(val | 0x80));
+      val >>= 7;
+    }
+    s_buffer.push_back(static_cast<uint8_t>(val));
+  };
+
+  if (!payload) {
+    numBytes = 0;
+  }
+  // API calls from multiple host threads are recorded in the order they complete
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_buffer.clear();
+  appendVarint(static_cast<uint64_t>(api));
+  appendVarint(numArgs);
+  for (size_t i = 0; i < numArgs; ++i) {
+    appendVarint(args[i]);
+  }
+  appendVarint(numBytes);
+  std::fwrite(s_buffer.data(), 1, s_buffer.size(), s_file);
+  if (numBytes > 0) {
+    std::fwrite(payload, 1, numBytes, s_file);
+  }
+  // make the trace usable even if the application does not exit normally
+  if (api == PimTraceApiEnum::DELETE_DEVICE) {
+    std::fflush(s_file);
+  }
+}
+
+//! @brief  Replay a trace file
+bool
+pimTraceReplayer::replay(const std::string& fileName)
+{
+  // in case the trace is still being recorded by this process
+  pimTraceWriter::flush();
+  if (!readFile(fileName)) {
+    return false;
+  }
+
+  // do not record the replay itself
+  pimTraceWriter::setPaused(true);
+  bool ok = true;
+  std::vector<uint64_t> args;
+  while (m_pos < m_trace.size()) {
+    uint64_t apiVal = 0;
+    uint64_t numArgs = 0;
+    ok = readVarint(apiVal) && readVarint(numArgs);
+    args.resize(numArgs);
+    for (uint64_t i = 0; ok && i < numArgs; ++i) {
+      ok = readVarint(args[i]);
+    }
+    uint64_t numBytes = 0;
+    ok = ok && readVarint(numBytes);
+    if (!ok || numBytes > m_trace.size() - m_pos || apiVal == 0 || apiVal >= static_cast<uint64_t>(PimTraceApiEnum::MAX_API)) {
+      std::printf("PIM-Error: Corrupted trace record %lu in trace file %s\n", m_numRecords, fileName.c_str());
+      ok = false;
+      break;
+    }
+    const uint8_t* payload = (numBytes > 0 ? m_trace.data() + m_pos : nullptr);
+    m_pos += numBytes;
+
+    PimTraceApiEnum api = static_cast<PimTraceApiEnum>(apiVal);
+    if (!replayRecord(api, args, payload, numBytes)) {
+      std::printf("PIM-Error: Failed to replay trace record %lu (api %lu)\n", m_numRecords, apiVal);
+      ok = false;
+      break;
+    }
+    ++m_numRecords;
+  }
+  pimTraceWriter::setPaused(false);
+
+  if (ok) {
+    std::printf("PIM-Info: Replayed %lu PIM API calls from trace file %s\n", m_numRecords, fileName.c_str());
+  }
+  return ok;
+}
+
+//! @brief  Read a trace file and check its header
+bool
+pimTraceReplayer::readFile(const std::string& fileName)
+{
+  std::ifstream file(fileName, std::ios::binary);
+  if (!file) {
+    std::printf("PIM-Error: Cannot open trace file %s\n", fileName.c_str());
+    return false;
+  }
+  m_trace.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  const size_t headerSize = sizeof(pimTraceWriter::s_magic) + 4;
+  if (m_trace.size() < headerSize || std::memcmp(m_trace.data(), pimTraceWriter::s_magic, sizeof(pimTraceWriter::s_magic)) != 0) {
+    std::printf("PIM-Error: %s is not a PIM API trace file\n", fileName.c_str());
+    return false;
+  }
+  const uint8_t* ver = m_trace.data() + sizeof(pimTraceWriter::s_magic);
+  uint32_t version = ver[0] | (ver[1] << 8) | (ver[2] << 16) | (static_cast<uint32_t>(ver[3]) << 24);
+  if (version != pimTraceWriter::s_version) {
+    std::printf("PIM-Error: Unsupported trace format version %u in trace file %s\n", version, fileName.c_str());
+    return false;
+  }
+  m_pos = headerSize;
+  return true;
+}
+
+//! @brief  Decode a LEB128 varint
+bool
+pimTraceReplayer::readVarint(uint64_t& val)
+{
+  val = 0;
+  for (unsigned shift = 0; shift < 64 && m_pos < m_trace.size(); shift += 7) {
+    uint8_t byte = m_trace[m_pos++];
+    val |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//! @brief  Map an object ID in trace to the object ID during replay. Return -1 if not found
+PimObjId
+pimTraceReplayer::mapObjId(uint64_t traceObjId) const
+{
+  auto it = m_objIdMap.find(static_cast<PimObjId>(traceObjId));
+  return it == m_objIdMap.end() ? -1 : it->second;
+}
+
+//! @brief  Map a micro-kernel ID in trace to the micro-kernel ID during replay. Return -1 if not found
+PimMicroKernelId
+pimTraceReplayer::mapKernelId(uint64_t traceKernelId) const
+{
+  auto it = m_kernelIdMap.find(static_cast<PimMicroKernelId>(traceKernelId));
+  return it == m_kernelIdMap.end() ? -1 : it->second;
+}
+
+//! @brief  Track a newly allocated object
+bool
+pimTraceReplayer::addObjId(uint64_t traceObjId, PimObjId objId)
+{
+  if (objId == -1) {
+    return false;
+  }
+  m_objIdMap[static_cast<PimObjId>(traceObjId)] = objId;
+  return true;
+}
+
+//! @brief  Get a host buffer of a given size, filled with recorded payload if available
+void*
+pimTraceReplayer::getHostBuffer(uint64_t numBytes, const uint8_t* payload, uint64_t payloadBytes)
+{
+  m_hostBuffer.assign(numBytes, 0);
+  if (payload && payloadBytes == numBytes) {
+    std::memcpy(m_hostBuffer.data(), payload, numBytes);
+  }
+  return m_hostBuffer.data();
+}
+
+//! @brief  Replay device creation. Use device type and config file overrides if specified,
+//!         otherwise use the recorded simulation target and dimensions
+bool
+pimTraceReplayer::replayCreateDevice(PimTraceApiEnum api, const std::vector<uint64_t>& args, const uint8_t* payload, uint64_t numBytes)
+{
+  if (args.size() != 8) {
+    return false;
+  }
+  m_objIdMap.clear();
+  m_kernelIdMap.clear();
+  PimDeviceEnum apiDeviceType = static_cast<PimDeviceEnum>(args[0]);
+  PimDeviceEnum simTarget = static_cast<PimDeviceEnum>(args[1]);
+  if (!m_configFile.empty()) {
+    PimDeviceEnum deviceType = (m_deviceType != PIM_DEVICE_NONE ? m_deviceType : PIM_FUNCTIONAL);
+    return pimCreateDeviceFromConfig(deviceType, m_configFile.c_str()) == PIM_OK;
+  }
+  if (api == PimTraceApiEnum::CREATE_DEVICE_FROM_CONFIG && payload && m_deviceType == PIM_DEVICE_NONE) {
+    std::string configFile(reinterpret_cast<const char*>(payload), numBytes);
+    if (std::ifstream(configFile).good()) {
+      return pimCreateDeviceFromConfig(apiDeviceType, configFile.c_str()) == PIM_OK;
+    }
+  }
+  PimDeviceEnum deviceType = (m_deviceType != PIM_DEVICE_NONE ? m_deviceType : simTarget);
+  return pimCreateDevice(deviceType, args[2], args[3], args[4], args[5], args[6], args[7]) == PIM_OK;
+}
+
+//! @brief  Replay one trace record through PIM APIs
+bool
+pimTraceReplayer::replayRecord(PimTraceApiEnum api, const std::vector<uint64_t>& args, const uint8_t* payload, uint64_t numBytes)
+{
+  // number of arguments of each API with a fixed argument list
+  static const std::unordered_map<PimTraceApiEnum, size_t> numFixedArgs = {
+    { PimTraceApiEnum::DELETE_DEVICE, 0 }, { PimTraceApiEnum::START_TIMER, 0 }, { PimTraceApiEnum::END_TIMER, 0 },
+    { PimTraceApiEnum::SHOW_STATS, 0 }, { PimTraceApiEnum::RESET_STATS, 0 },
+    { PimTraceApiEnum::ALLOC, 4 }, { PimTraceApiEnum::ALLOC_ASSOCIATED, 3 }, { PimTraceApiEnum::ALLOC_BUFFER, 3 },
+    { PimTraceApiEnum::ALLOC_CUSTOM_INT, 5 }, { PimTraceApiEnum::ALLOC_ASSOCIATED_CUSTOM_INT, 4 },
+    { PimTraceApiEnum::FREE, 1 }, { PimTraceApiEnum::CREATE_RANGED_REF, 4 }, { PimTraceApiEnum::CREATE_DUAL_CONTACT_REF, 2 },
+    { PimTraceApiEnum::COPY_H2D, 4 }, { PimTraceApiEnum::COPY_D2H, 4 },
+    { PimTraceApiEnum::COPY_H2D_WITH_TYPE, 5 }, { PimTraceApiEnum::COPY_D2H_WITH_TYPE, 5 },
+    { PimTraceApiEnum::COPY_D2D, 4 }, { PimTraceApiEnum::COPY_O2O, 2 }, { PimTraceApiEnum::CONVERT_TYPE, 2 },
+    { PimTraceApiEnum::BROADCAST_INT, 2 }, { PimTraceApiEnum::BROADCAST_UINT, 2 }, { PimTraceApiEnum::BROADCAST_FP, 2 },
+    { PimTraceApiEnum::ADD, 3 }, { PimTraceApiEnum::SUB, 3 }, { PimTraceApiEnum::MUL, 3 }, { PimTraceApiEnum::DIV, 3 },
+    { PimTraceApiEnum::ABS, 2 }, { PimTraceApiEnum::NOT, 2 }, { PimTraceApiEnum::AND, 3 }, { PimTraceApiEnum::OR, 3 },
+    { PimTraceApiEnum::XOR, 3 }, { PimTraceApiEnum::XNOR, 3 }, { PimTraceApiEnum::MIN, 3 }, { PimTraceApiEnum::MAX, 3 },
+    { PimTraceApiEnum::GT, 3 }, { PimTraceApiEnum::LT, 3 }, { PimTraceApiEnum::EQ, 3 }, { PimTraceApiEnum::NE, 3 },
+    { PimTraceApiEnum::ADD_SCALAR, 3 }, { PimTraceApiEnum::SUB_SCALAR, 3 }, { PimTraceApiEnum::MUL_SCALAR, 3 },
+    { PimTraceApiEnum::DIV_SCALAR, 3 }, { PimTraceApiEnum::AND_SCALAR, 3 }, { PimTraceApiEnum::OR_SCALAR, 3 },
+    { PimTraceApiEnum::XOR_SCALAR, 3 }, { PimTraceApiEnum::XNOR_SCALAR, 3 }, { PimTraceApiEnum::MIN_SCALAR, 3 },
+    { PimTraceApiEnum::MAX_SCALAR, 3 }, { PimTraceApiEnum::GT_SCALAR, 3 }, { PimTraceApiEnum::LT_SCALAR, 3 },
+    { PimTraceApiEnum::EQ_SCALAR, 3 }, { PimTraceApiEnum::NE_SCALAR, 3 },
+    { PimTraceApiEnum::SCALED_ADD, 4 }, { PimTraceApiEnum::POPCOUNT, 2 }, { PimTraceApiEnum::PREFIX_SUM, 2 },
+    { PimTraceApiEnum::MAC, 2 }, { PimTraceApiEnum::REDSUM, 3 }, { PimTraceApiEnum::REDMIN, 3 }, { PimTraceApiEnum::REDMAX, 3 },
+    { PimTraceApiEnum::BIT_SLICE_EXTRACT, 3 }, { PimTraceApiEnum::BIT_SLICE_INSERT, 3 },
+    { PimTraceApiEnum::COND_COPY, 3 }, { PimTraceApiEnum::COND_BROADCAST, 3 }, { PimTraceApiEnum::COND_SELECT, 4 },
+    { PimTraceApiEnum::COND_SELECT_SCALAR, 4 },
+    { PimTraceApiEnum::ROTATE_ELEM_R, 1 }, { PimTraceApiEnum::ROTATE_ELEM_L, 1 }, { PimTraceApiEnum::SHIFT_ELEM_R, 1 },
+    { PimTraceApiEnum::SHIFT_ELEM_L, 1 }, { PimTraceApiEnum::SHIFT_BITS_R, 3 }, { PimTraceApiEnum::SHIFT_BITS_L, 3 },
+    { PimTraceApiEnum::AES_SBOX, 2 }, { PimTraceApiEnum::AES_INVERSE_SBOX, 2 },
+    { PimTraceApiEnum::OP_READ_ROW_TO_SA, 2 }, { PimTraceApiEnum::OP_WRITE_SA_TO_ROW, 2 }, { PimTraceApiEnum::OP_TRA, 6 },
+    { PimTraceApiEnum::OP_MOVE, 3 }, { PimTraceApiEnum::OP_SET, 3 }, { PimTraceApiEnum::OP_NOT, 3 },
+    { PimTraceApiEnum::OP_AND, 4 }, { PimTraceApiEnum::OP_OR, 4 }, { PimTraceApiEnum::OP_NAND, 4 },
+    { PimTraceApiEnum::OP_NOR, 4 }, { PimTraceApiEnum::OP_XOR, 4 }, { PimTraceApiEnum::OP_XNOR, 4 },
+    { PimTraceApiEnum::OP_MAJ, 5 }, { PimTraceApiEnum::OP_SEL, 5 },
+    { PimTraceApiEnum::OP_ROTATE_RH, 2 }, { PimTraceApiEnum::OP_ROTATE_LH, 2 },
+    { PimTraceApiEnum::END_MICRO_KERNEL, 2 }, { PimTraceApiEnum::DELETE_MICRO_KERNEL, 1 },
+  };
+  auto it = numFixedArgs.find(api);
+  if (it != numFixedArgs.end() && args.size() != it->second) {
+    std::printf("PIM-Error: Unexpected number of arguments %lu in trace record\n", args.size());
+    return false;
+  }
+
+  // short names for argument decoding
+  auto obj = [&](size_t i) { return mapObjId(args.at(i)); };
+  auto reg = [&](size_t i) { return static_cast<PimRowReg>(args.at(i)); };
+  auto u32 = [&](size_t i) { return static_cast<unsigned>(args.at(i)); };
+  PimStatus status = PIM_ERROR;
+
+  switch (api) {
+  case PimTraceApiEnum::CREATE_DEVICE:
+  case PimTraceApiEnum::CREATE_DEVICE_FROM_CONFIG:
+    return replayCreateDevice(api, args, payload, numBytes);
+  case PimTraceApiEnum::DELETE_DEVICE:
+    if (m_keepDevice) {
+      return true;
+    }
+    m_objIdMap.clear();
+    m_kernelIdMap.clear();
+    status = pimDeleteDevice();
+    break;
+  case PimTraceApiEnum::START_TIMER:
+    // named timers have their tags as payloads
+    if (payload) {
+      pimStartTimer(std::string(reinterpret_cast<const char*>(payload), numBytes).c_str());
+    } else {
+      pimStartTimer();
+    }
+    return true;
+  case PimTraceApiEnum::END_TIMER: pimEndTimer(); return true;
+  case PimTraceApiEnum::SHOW_STATS: pimShowStats(); return true;
+  case PimTraceApiEnum::RESET_STATS: pimResetStats(); return true;
+
+  case PimTraceApiEnum::ALLOC:
+    return addObjId(args[3], pimAlloc(static_cast<PimAllocEnum>(args[0]), args[1], static_cast<PimDataType>(args[2])));
+  case PimTraceApiEnum::ALLOC_ASSOCIATED:
+    return addObjId(args[2], pimAllocAssociated(obj(0), static_cast<PimDataType>(args[1])));
+  case PimTraceApiEnum::ALLOC_BUFFER:
+    return addObjId(args[2], pimAllocBuffer(static_cast<uint32_t>(args[0]), static_cast<PimDataType>(args[1])));
+  case PimTraceApiEnum::ALLOC_CUSTOM_INT:
+    return addObjId(args[4], pimAllocCustomInt(static_cast<PimAllocEnum>(args[0]), args[1], u32(2), args[3] != 0));
+  case PimTraceApiEnum::ALLOC_ASSOCIATED_CUSTOM_INT:
+    return addObjId(args[3], pimAllocAssociatedCustomInt(obj(0), u32(1), args[2] != 0));
+  case PimTraceApiEnum::FREE:
+    status = pimFree(obj(0));
+    m_objIdMap.erase(static_cast<PimObjId>(args[0]));
+    break;
+  case PimTraceApiEnum::CREATE_RANGED_REF:
+    return addObjId(args[3], pimCreateRangedRef(obj(0), args[1], args[2]));
+  case PimTraceApiEnum::CREATE_DUAL_CONTACT_REF:
+    return addObjId(args[1], pimCreateDualContactRef(obj(0)));
+
+  case PimTraceApiEnum::COPY_H2D:
+    status = pimCopyHostToDevice(getHostBuffer(args[3], payload, numBytes), obj(0), args[1], args[2]);
+    break;
+  case PimTraceApiEnum::COPY_D2H:
+    status = pimCopyDeviceToHost(obj(0), getHostBuffer(args[3], nullptr, 0), args[1], args[2]);
+    break;
+  case PimTraceApiEnum::COPY_H2D_WITH_TYPE:
+    status = pimCopyHostToDeviceWithType(static_cast<PimCopyEnum>(args[0]), getHostBuffer(args[4], payload, numBytes), obj(1), args[2], args[3]);
+    break;
+  case PimTraceApiEnum::COPY_D2H_WITH_TYPE:
+    status = pimCopyDeviceToHostWithType(static_cast<PimCopyEnum>(args[0]), obj(1), getHostBuffer(args[4], nullptr, 0), args[2], args[3]);
+    break;
+  case PimTraceApiEnum::COPY_D2D: status = pimCopyDeviceToDevice(obj(0), obj(1), args[2], args[3]); break;
+  case PimTraceApiEnum::COPY_O2O: status = pimCopyObjectToObject(obj(0), obj(1)); break;
+  case PimTraceApiEnum::CONVERT_TYPE: status = pimConvertType(obj(0), obj(1)); break;
+
+  case PimTraceApiEnum::BROADCAST_INT: status = pimBroadcastInt(obj(0), static_cast<int64_t>(args[1])); break;
+  case PimTraceApiEnum::BROADCAST_UINT: status = pimBroadcastUInt(obj(0), args[1]); break;
+  case PimTraceApiEnum::BROADCAST_FP: {
+    float value = 0.0;
+    uint32_t bits = static_cast<uint32_t>(args[1]);
+    std::memcpy(&value, &bits, sizeof(value));
+    status = pimBroadcastFP(obj(0), value);
+    break;
+  }
+  case PimTraceApiEnum::ADD: status = pimAdd(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::SUB: status = pimSub(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::MUL: status = pimMul(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::DIV: status = pimDiv(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::ABS: status = pimAbs(obj(0), obj(1)); break;
+  case PimTraceApiEnum::NOT: status = pimNot(obj(0), obj(1)); break;
+  case PimTraceApiEnum::AND: status = pimAnd(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::OR: status = pimOr(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::XOR: status = pimXor(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::XNOR: status = pimXnor(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::MIN: status = pimMin(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::MAX: status = pimMax(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::GT: status = pimGT(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::LT: status = pimLT(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::EQ: status = pimEQ(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::NE: status = pimNE(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::ADD_SCALAR: status = pimAddScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::SUB_SCALAR: status = pimSubScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::MUL_SCALAR: status = pimMulScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::DIV_SCALAR: status = pimDivScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::AND_SCALAR: status = pimAndScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::OR_SCALAR: status = pimOrScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::XOR_SCALAR: status = pimXorScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::XNOR_SCALAR: status = pimXnorScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::MIN_SCALAR: status = pimMinScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::MAX_SCALAR: status = pimMaxScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::GT_SCALAR: status = pimGTScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::LT_SCALAR: status = pimLTScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::EQ_SCALAR: status = pimEQScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::NE_SCALAR: status = pimNEScalar(obj(0), obj(1), args[2]); break;
+  case PimTraceApiEnum::SCALED_ADD: status = pimScaledAdd(obj(0), obj(1), obj(2), args[3]); break;
+  case PimTraceApiEnum::POPCOUNT: status = pimPopCount(obj(0), obj(1)); break;
+  case PimTraceApiEnum::PREFIX_SUM: status = pimPrefixSum(obj(0), obj(1)); break;
+  case PimTraceApiEnum::MAC: {
+    // one result per PIM core, which depends on the replay device
+    PimDeviceProperties props;
+    if (pimGetDeviceProperties(&props) != PIM_OK) {
+      return false;
+    }
+    status = pimMAC(obj(0), obj(1), getHostBuffer(props.numPIMCores * sizeof(uint64_t), nullptr, 0));
+    break;
+  }
+  case PimTraceApiEnum::REDSUM:
+  case PimTraceApiEnum::REDMIN:
+  case PimTraceApiEnum::REDMAX: {
+    uint64_t result = 0;
+    if (api == PimTraceApiEnum::REDSUM) {
+      status = pimRedSum(obj(0), &result, args[1], args[2]);
+    } else if (api == PimTraceApiEnum::REDMIN) {
+      status = pimRedMin(obj(0), &result, args[1], args[2]);
+    } else {
+      status = pimRedMax(obj(0), &result, args[1], args[2]);
+    }
+    break;
+  }
+  case PimTraceApiEnum::BIT_SLICE_EXTRACT: status = pimBitSliceExtract(obj(0), obj(1), u32(2)); break;
+  case PimTraceApiEnum::BIT_SLICE_INSERT: status = pimBitSliceInsert(obj(0), obj(1), u32(2)); break;
+  case PimTraceApiEnum::COND_COPY: status = pimCondCopy(obj(0), obj(1), obj(2)); break;
+  case PimTraceApiEnum::COND_BROADCAST: status = pimCondBroadcast(obj(0), args[1], obj(2)); break;
+  case PimTraceApiEnum::COND_SELECT: status = pimCondSelect(obj(0), obj(1), obj(2), obj(3)); break;
+  case PimTraceApiEnum::COND_SELECT_SCALAR: status = pimCondSelectScalar(obj(0), obj(1), args[2], obj(3)); break;
+  case PimTraceApiEnum::ROTATE_ELEM_R: status = pimRotateElementsRight(obj(0)); break;
+  case PimTraceApiEnum::ROTATE_ELEM_L: status = pimRotateElementsLeft(obj(0)); break;
+  case PimTraceApiEnum::SHIFT_ELEM_R: status = pimShiftElementsRight(obj(0)); break;
+  case PimTraceApiEnum::SHIFT_ELEM_L: status = pimShiftElementsLeft(obj(0)); break;
+  case PimTraceApiEnum::SHIFT_BITS_R: status = pimShiftBitsRight(obj(0), obj(1), u32(2)); break;
+  case PimTraceApiEnum::SHIFT_BITS_L: status = pimShiftBitsLeft(obj(0), obj(1), u32(2)); break;
+  case PimTraceApiEnum::AES_SBOX:
+  case PimTraceApiEnum::AES_INVERSE_SBOX: {
+    std::vector<uint8_t> lut(payload, payload + numBytes);
+    status = (api == PimTraceApiEnum::AES_SBOX ? pimAesSbox(obj(0), obj(1), lut) : pimAesInverseSbox(obj(0), obj(1), lut));
+    break;
+  }
+
+  case PimTraceApiEnum::OP_READ_ROW_TO_SA: status = pimOpReadRowToSa(obj(0), u32(1)); break;
+  case PimTraceApiEnum::OP_WRITE_SA_TO_ROW: status = pimOpWriteSaToRow(obj(0), u32(1)); break;
+  case PimTraceApiEnum::OP_TRA: status = pimOpTRA(obj(0), u32(1), obj(2), u32(3), obj(4), u32(5)); break;
+  case PimTraceApiEnum::OP_MOVE: status = pimOpMove(obj(0), reg(1), reg(2)); break;
+  case PimTraceApiEnum::OP_SET: status = pimOpSet(obj(0), reg(1), args[2] != 0); break;
+  case PimTraceApiEnum::OP_NOT: status = pimOpNot(obj(0), reg(1), reg(2)); break;
+  case PimTraceApiEnum::OP_AND: status = pimOpAnd(obj(0), reg(1), reg(2), reg(3)); break;
+  case PimTraceApiEnum::OP_OR: status = pimOpOr(obj(0), reg(1), reg(2), reg(3)); break;
+  case PimTraceApiEnum::OP_NAND: status = pimOpNand(obj(0), reg(1), reg(2), reg(3)); break;
+  case PimTraceApiEnum::OP_NOR: status = pimOpNor(obj(0), reg(1), reg(2), reg(3)); break;
+  case PimTraceApiEnum::OP_XOR: status = pimOpXor(obj(0), reg(1), reg(2), reg(3)); break;
+  case PimTraceApiEnum::OP_XNOR: status = pimOpXnor(obj(0), reg(1), reg(2), reg(3)); break;
+  case PimTraceApiEnum::OP_MAJ: status = pimOpMaj(obj(0), reg(1), reg(2), reg(3), reg(4)); break;
+  case PimTraceApiEnum::OP_SEL: status = pimOpSel(obj(0), reg(1), reg(2), reg(3), reg(4)); break;
+  case PimTraceApiEnum::OP_ROTATE_RH: status = pimOpRotateRH(obj(0), reg(1)); break;
+  case PimTraceApiEnum::OP_ROTATE_LH: status = pimOpRotateLH(obj(0), reg(1)); break;
+  case PimTraceApiEnum::OP_BATCH: {
+    // each micro op is recorded as 8 arguments in PimMicroOp field order
+    if (args.size() % 8 != 0) {
+      return false;
+    }
+    std::vector<PimMicroOp> ops(args.size() / 8);
+    for (size_t i = 0; i < ops.size(); ++i) {
+      size_t j = i * 8;
+      ops[i].opType = static_cast<PimMicroOpEnum>(args[j]);
+      ops[i].objId = obj(j + 1);
+      ops[i].ofst = u32(j + 2);
+      ops[i].dest = reg(j + 3);
+      ops[i].src1 = reg(j + 4);
+      ops[i].src2 = reg(j + 5);
+      ops[i].src3 = reg(j + 6);
+      ops[i].val = (args[j + 7] != 0);
+    }
+    status = pimOpBatch(ops.data(), static_cast<unsigned>(ops.size()));
+    break;
+  }
+  case PimTraceApiEnum::BEGIN_MICRO_KERNEL: {
+    std::vector<PimObjId> params;
+    for (size_t i = 0; i < args.size(); ++i) {
+      params.push_back(obj(i));
+    }
+    status = pimBeginMicroKernel(params);
+    break;
+  }
+  case PimTraceApiEnum::END_MICRO_KERNEL: {
+    PimMicroKernelId kernelId = pimEndMicroKernel(static_cast<PimMicroKernelOptEnum>(args[0]));
+    if (kernelId == -1) {
+      return false;
+    }
+    m_kernelIdMap[static_cast<PimMicroKernelId>(args[1])] = kernelId;
+    return true;
+  }
+  case PimTraceApiEnum::RUN_MICRO_KERNEL: {
+    if (args.size() < 2) {
+      return false;
+    }
+    std::vector<PimObjId> objIds;
+    for (size_t i = 2; i < args.size(); ++i) {
+      objIds.push_back(obj(i));
+    }
+    status = pimRunMicroKernel(mapKernelId(args[0]), objIds, u32(1));
+    break;
+  }
+  case PimTraceApiEnum::DELETE_MICRO_KERNEL:
+    status = pimDeleteMicroKernel(mapKernelId(args[0]));
+    m_kernelIdMap.erase(static_cast<PimMicroKernelId>(args[0]));
+    break;
+  case PimTraceApiEnum::OP_AP:
+  case PimTraceApiEnum::OP_AAP: {
+    // AP: numSrc, rows; AAP: numSrc, numDest, rows. Each row is an (object ID, offset) pair
+    size_t numHeader = (api == PimTraceApiEnum::OP_AP ? 1 : 2);
+    if (args.size() < numHeader) {
+      return false;
+    }
+    size_t numSrc = args[0];
+    size_t numDest = (api == PimTraceApiEnum::OP_AP ? 0 : args[1]);
+    if (args.size() != numHeader + 2 * (numSrc + numDest)) {
+      return false;
+    }
+    std::vector<std::pair<PimObjId, unsigned>> srcRows;
+    std::vector<std::pair<PimObjId, unsigned>> destRows;
+    for (size_t i = 0; i < numSrc + numDest; ++i) {
+      size_t j = numHeader + i * 2;
+      (i < numSrc ? srcRows : destRows).emplace_back(obj(j), u32(j + 1));
+    }
+    bool ok = (api == PimTraceApiEnum::OP_AP ? pimSim::get()->pimOpAP(srcRows) : pimSim::get()->pimOpAAP(srcRows, destRows));
+    status = (ok ? PIM_OK : PIM_ERROR);
+    break;
+  }
+  default:
+    std::printf("PIM-Error: Unsupported API %u in trace record\n", static_cast<unsigned>(api));
+    return false;
+  }
+  return status == PIM_OK;
+}
+
@@ -0,0 +1,222 @@
+// File: pimTrace.h
+// PIMeval Simulator - PIM API Trace Recording and Replay
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#ifndef LAVA_PIM_TRACE_H
+#define LAVA_PIM_TRACE_H
+
+#include "libpimeval.h"
+#include "pimUtils.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <type_traits>
+#include <mutex>
+
+
+//! @enum   PimTraceApiEnum
+//! @brief  PIM APIs recorded in a binary trace
+enum class PimTraceApiEnum : uint16_t
+{
+  NONE = 0,
+  // Device and stats
+  CREATE_DEVICE,
+  CREATE_DEVICE_FROM_CONFIG,
+  DELETE_DEVICE,
+  START_TIMER,
+  END_TIMER,
+  SHOW_STATS,
+  RESET_STATS,
+  // Resource allocation
+  ALLOC,
+  ALLOC_ASSOCIATED,
+  ALLOC_BUFFER,
+  ALLOC_CUSTOM_INT,
+  ALLOC_ASSOCIATED_CUSTOM_INT,
+  FREE,
+  CREATE_RANGED_REF,
+  CREATE_DUAL_CONTACT_REF,
+  // Data transfer
+  COPY_H2D,
+  COPY_D2H,
+  COPY_H2D_WITH_TYPE,
+  COPY_D2H_WITH_TYPE,
+  COPY_D2D,
+  COPY_O2O,
+  CONVERT_TYPE,
+  // Computation
+  BROADCAST_INT,
+  BROADCAST_UINT,
+  BROADCAST_FP,
+  ADD,
+  SUB,
+  MUL,
+  DIV,
+  ABS,
+  NOT,
+  AND,
+  OR,
+  XOR,
+  XNOR,
+  MIN,
+  MAX,
+  GT,
+  LT,
+  EQ,
+  NE,
+  ADD_SCALAR,
+  SUB_SCALAR,
+  MUL_SCALAR,
+  DIV_SCALAR,
+  AND_SCALAR,
+  OR_SCALAR,
+  XOR_SCALAR,
+  XNOR_SCALAR,
+  MIN_SCALAR,
+  MAX_SCALAR,
+  GT_SCALAR,
+  LT_SCALAR,
+  EQ_SCALAR,
+  NE_SCALAR,
+  SCALED_ADD,
+  POPCOUNT,
+  PREFIX_SUM,
+  MAC,
+  REDSUM,
+  REDMIN,
+  REDMAX,
+  BIT_SLICE_EXTRACT,
+  BIT_SLICE_INSERT,
+  COND_COPY,
+  COND_BROADCAST,
+  COND_SELECT,
+  COND_SELECT_SCALAR,
+  ROTATE_ELEM_R,
+  ROTATE_ELEM_L,
+  SHIFT_ELEM_R,
+  SHIFT_ELEM_L,
+  SHIFT_BITS_R,
+  SHIFT_BITS_L,
+  AES_SBOX,
+  AES_INVERSE_SBOX,
+  // BitSIMD-V micro ops
+  OP_READ_ROW_TO_SA,
+  OP_WRITE_SA_TO_ROW,
+  OP_TRA,
+  OP_MOVE,
+  OP_SET,
+  OP_NOT,
+  OP_AND,
+  OP_OR,
+  OP_NAND,
+  OP_NOR,
+  OP_XOR,
+  OP_XNOR,
+  OP_MAJ,
+  OP_SEL,
+  OP_ROTATE_RH,
+  OP_ROTATE_LH,
+  OP_BATCH,
+  BEGIN_MICRO_KERNEL,
+  END_MICRO_KERNEL,
+  RUN_MICRO_KERNEL,
+  DELETE_MICRO_KERNEL,
+  // SIMDRAM micro ops
+  OP_AP,
+  OP_AAP,
+  MAX_API,
+};
+
+//! @class  pimTraceWriter
+//! @brief  Record successful PIM API calls to a compact binary trace
+//! Trace format:
+//! * Header: "PIMTRACE" followed by a 32-bit little-endian format version
+//! * Records: API enum, number of arguments, arguments, payload size and payload bytes, all as LEB128 varints
+//!   except payload bytes. Object IDs and micro-kernel IDs returned by APIs are recorded as the last argument.
+//!   Payloads are host data of host-to-device copies if enabled, config file names and AES LUTs
+//! The trace file stays open across PIM devices until a different trace file is requested.
+//! Only API calls on the PIM context that opened the trace are recorded
+class pimTraceWriter
+{
+public:
+  static bool open(const std::string& fileName, bool withPayload, PimContext context);
+  static void close();
+  static void flush() { if (s_file) { std::fflush(s_file); } }
+  static bool isOn();
+  static PimContext getContext() { return s_context; }
+  static bool isPayloadOn() { return s_withPayload; }
+  static void setPaused(bool val) { s_isPaused = val; }
+
+  //! @brief  Record an API call with scalar arguments
+  template <typename... Args> static void record(PimTraceApiEnum api, Args... args) {
+    if (!isOn()) { return; }
+    uint64_t vals[sizeof...(Args) + 1] = { toArg(args)... };
+    write(api, vals, sizeof...(Args), nullptr, 0);
+  }
+  //! @brief  Record an API call with a list of arguments and an optional payload
+  static void record(PimTraceApiEnum api, const std::vector<uint64_t>& args, const void* payload = nullptr, uint64_t numBytes = 0) {
+    if (!isOn()) { return; }
+    write(api, args.data(), args.size(), payload, numBytes);
+  }
+
+  template <typename T> static uint64_t toArg(T val) {
+    if constexpr (std::is_floating_point<T>::value) {
+      return pimUtils::castTypeToBits(val);
+    } else {
+      return static_cast<uint64_t>(val);
+    }
+  }
+
+  inline static const char s_magic[8] = { 'P', 'I', 'M', 'T', 'R', 'A', 'C', 'E' };
+  static constexpr uint32_t s_version = 1;
+
+private:
+  static void write(PimTraceApiEnum api, const uint64_t* args, size_t numArgs, const void* payload, uint64_t numBytes);
+
+  inline static std::FILE* s_file = nullptr;
+  inline static PimContext s_context = nullptr;
+  inline static std::string s_fileName;
+  inline static bool s_withPayload = false;
+  inline static bool s_isPaused = false;
+  inline static std::vector<uint8_t> s_buffer;
+  inline static std::mutex s_mutex;
+};
+
+//! @class  pimTraceReplayer
+//! @brief  Replay a binary PIM API trace through PIM APIs on a new device
+class pimTraceReplayer
+{
+public:
+  pimTraceReplayer(PimDeviceEnum deviceType, const std::string& configFile, bool keepDevice)
+    : m_deviceType(deviceType), m_configFile(configFile), m_keepDevice(keepDevice) {}
+  ~pimTraceReplayer() {}
+
+  bool replay(const std::string& fileName);
+
+private:
+  bool readFile(const std::string& fileName);
+  bool readVarint(uint64_t& val);
+  bool replayRecord(PimTraceApiEnum api, const std::vector<uint64_t>& args, const uint8_t* payload, uint64_t numBytes);
+  bool replayCreateDevice(PimTraceApiEnum api, const std::vector<uint64_t>& args, const uint8_t* payload, uint64_t numBytes);
+  PimObjId mapObjId(uint64_t traceObjId) const;
+  PimMicroKernelId mapKernelId(uint64_t traceKernelId) const;
+  bool addObjId(uint64_t traceObjId, PimObjId objId);
+  void* getHostBuffer(uint64_t numBytes, const uint8_t* payload, uint64_t payloadBytes);
+
+  PimDeviceEnum m_deviceType;
+  std::string m_configFile;
+  bool m_keepDevice;
+  std::vector<uint8_t> m_trace;
+  size_t m_pos = 0;
+  uint64_t m_numRecords = 0;
+  std::unordered_map<PimObjId, PimObjId> m_objIdMap;
+  std::unordered_map<PimMicroKernelId, PimMicroKernelId> m_kernelIdMap;
+  std::vector<uint8_t> m_hostBuffer;
+};
+
+#endif
+
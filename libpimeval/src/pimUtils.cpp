@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <cassert>
 #include <stdexcept>
+#include <tuple>
 
 
 //! @brief  Convert PimStatus enum to string
@@ -142,6 +143,24 @@ pimUtils::isUnsigned(PimDataType dataType)
   return dataType == PIM_BOOL || dataType == PIM_UINT8 || dataType == PIM_UINT16 || dataType == PIM_UINT32 || dataType == PIM_UINT64;
 }
 
+//! @brief  Get the narrowest standard integer type holding a custom bit-width integer
+//!         Return PIM_BOOL if the bit width is not in [1, 64]
+PimDataType
+pimUtils::getCustomIntContainerType(unsigned numBits, bool isSigned)
+{
+  if (numBits == 0 || numBits > 64) {
+    return PIM_BOOL;
+  }
+  if (numBits <= 8) {
+    return isSigned ? PIM_INT8 : PIM_UINT8;
+  } else if (numBits <= 16) {
+    return isSigned ? PIM_INT16 : PIM_UINT16;
+  } else if (numBits <= 32) {
+    return isSigned ? PIM_INT32 : PIM_UINT32;
+  }
+  return isSigned ? PIM_INT64 : PIM_UINT64;
+}
+
 //! @brief  Check if a PIM data type is floating point
 bool
 pimUtils::isFP(PimDataType dataType)
@@ -185,10 +204,25 @@ pimUtils::getDeviceDataLayout(PimDeviceEnum deviceType)
   return PimDataLayout::UNKNOWN;
 }
 
+//! @brief  Transpose a 64x64 bit matrix in place
+//!         Swap off-diagonal sub-blocks of size 32, 16, ..., 1 using word-level masks and shifts,
+//!         which takes 6 x 32 steps instead of 4096 single-bit moves
+void
+pimUtils::transposeBits64x64(uint64_t* block)
+{
+  uint64_t mask = 0x00000000FFFFFFFFULL;
+  for (unsigned j = 32; j != 0; j >>= 1, mask ^= (mask << j)) {
+    for (unsigned k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+      uint64_t t = ((block[k] >> j) ^ block[k | j]) & mask;
+      block[k] ^= t << j;
+      block[k | j] ^= t;
+    }
+  }
+}
+
 //! @brief  Thread pool ctor
 pimUtils::threadPool::threadPool(size_t numThreads)
-  : m_terminate(false),
-    m_workersRemaining(0)
+  : m_terminate(false)
 {
   // reserve one thread for main program
   for (size_t i = 1; i < numThreads; ++i) {
@@ -216,18 +250,19 @@ pimUtils::threadPool::~threadPool()
 void
 pimUtils::threadPool::doWork(const std::vector<pimUtils::threadWorker*>& workers)
 {
+  workBatch batch;
   {
     std::unique_lock<std::mutex> lock(m_mutex);
     for (auto& worker : workers) {
-      m_workers.push(worker);
+      m_workers.push(std::make_pair(worker, &batch));
     }
-    m_workersRemaining = workers.size();
+    batch.m_workersRemaining = workers.size();
   }
   m_cond.notify_all();
 
-  // Wait for all workers to be done
+  // Wait for all workers of this call to be done
   std::unique_lock<std::mutex> lock(m_mutex);
-  m_cond.wait(lock, [this] { return m_workersRemaining == 0; });
+  m_doneCond.wait(lock, [&batch] { return batch.m_workersRemaining == 0; });
 }
 
 //! @brief  Worker thread that process workers
@@ -236,21 +271,22 @@ pimUtils::threadPool::workerThread()
 {
   while (true) {
     threadWorker* worker;
+    workBatch* batch;
     {
       std::unique_lock<std::mutex> lock(m_mutex);
       m_cond.wait(lock, [this] { return m_terminate || !m_workers.empty(); });
       if (m_terminate && m_workers.empty()) {
         return;
       }
-      worker = m_workers.front();
+      std::tie(worker, batch) = m_workers.front();
       m_workers.pop();
     }
     worker->execute();
     {
       std::unique_lock<std::mutex> lock(m_mutex);
-      --m_workersRemaining;
+      --batch->m_workersRemaining;
     }
-    m_cond.notify_all();
+    m_doneCond.notify_all();
   }
 }
 
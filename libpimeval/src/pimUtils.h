@@ -22,6 +22,7 @@
 #include <type_traits>
 #include <cstring>
 #include <cstdint>
+#include <utility>
 
 
 //! @enum   PimBitWidth
@@ -56,6 +57,7 @@ namespace pimUtils
   bool isSigned(PimDataType dataType);
   bool isUnsigned(PimDataType dataType);
   bool isFP(PimDataType dataType);
+  PimDataType getCustomIntContainerType(unsigned numBits, bool isSigned);
   std::string pimProtocolEnumToStr(PimDeviceProtocolEnum protocol);
   PimDataLayout getDeviceDataLayout(PimDeviceEnum deviceType);
 
@@ -73,6 +75,20 @@ namespace pimUtils
     return bits;
   }
 
+  // Wrap raw bits to a custom bit width, with sign extension for signed integers.
+  // Input: Raw bits represented as uint64_t, and number of bits in [1, 64]
+  // Output: Lowest numBits bits, zero-extended or sign-extended to uint64_t
+  inline uint64_t wrapBits(uint64_t bits, unsigned numBits, bool isSigned) {
+    if (numBits >= 64) {
+      return bits;
+    }
+    bits &= (1ULL << numBits) - 1;
+    if (isSigned && ((bits >> (numBits - 1)) & 1)) {
+      bits |= ~((1ULL << numBits) - 1);
+    }
+    return bits;
+  }
+
   // Convert sign-extended bits into specific C++ type.
   // Input: Sign-extended bits represented as uint64_t
   // Output: A value in C++ data type T
@@ -95,6 +111,11 @@ namespace pimUtils
     return signExtBits;
   }
 
+  // Transpose a 64x64 bit matrix in place.
+  // Input: 64 words where bit c of word r is matrix element (r, c)
+  // Output: 64 words where bit r of word c is matrix element (r, c)
+  void transposeBits64x64(uint64_t* block);
+
   // Service APIs for file system, config files, env vars
   std::string& ltrim(std::string& s);
   std::string& rtrim(std::string& s);
@@ -155,6 +176,7 @@ namespace pimUtils
 
   //! @class  threadPool
   //! @brief  Thread pool that runs multiple workers in threads
+  //! Multiple host threads can call doWork concurrently. Each call waits for its own workers only
   class threadPool {
   public:
     threadPool(size_t numThreads);
@@ -163,12 +185,17 @@ namespace pimUtils
   private:
     void workerThread();
 
+    //! @brief  Number of unfinished workers of a doWork call
+    struct workBatch {
+      size_t m_workersRemaining = 0;
+    };
+
     std::vector<std::thread> m_threads;
-    std::queue<threadWorker*> m_workers;
+    std::queue<std::pair<threadWorker*, workBatch*>> m_workers;
     std::mutex m_mutex;
     std::condition_variable m_cond;
+    std::condition_variable m_doneCond;
     bool m_terminate;
-    std::atomic<size_t> m_workersRemaining;
   };
 
 }
@@ -266,6 +266,249 @@ bool testMicroOps()
   return true;
 }
 
+bool testMicroOpBatch()
+{
+  unsigned numElements = 1000;
+
+  std::vector<int> src1(numElements);
+  std::vector<int> src2(numElements);
+  std::vector<int> dest(numElements);
+
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_V1, numElements, PIM_INT32);
+  assert(obj1 != -1);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  assert(obj2 != -1);
+  PimObjId obj3 = pimAllocAssociated(obj1, PIM_INT32);
+  assert(obj3 != -1);
+
+  for (unsigned i = 0; i < numElements; ++i) {
+    src1[i] = i * 7 - 300;
+    src2[i] = i * 13 + 5;
+  }
+
+  PimStatus status = pimCopyHostToDevice((void*)src1.data(), obj1);
+  assert(status == PIM_OK);
+  status = pimCopyHostToDevice((void*)src2.data(), obj2);
+  assert(status == PIM_OK);
+
+  std::vector<PimMicroOp> ops;
+  auto addOp = [&](PimMicroOpEnum opType, PimObjId objId, unsigned ofst, PimRowReg dest,
+                   PimRowReg src1 = PIM_RREG_NONE, PimRowReg src2 = PIM_RREG_NONE, PimRowReg src3 = PIM_RREG_NONE) {
+    PimMicroOp op;
+    op.opType = opType;
+    op.objId = objId;
+    op.ofst = ofst;
+    op.dest = dest;
+    op.src1 = src1;
+    op.src2 = src2;
+    op.src3 = src3;
+    ops.push_back(op);
+  };
+
+  // bit-serial add in one batch: obj3 = obj1 + obj2, with carry in R1
+  addOp(PIM_MICRO_OP_SET, obj1, 0, PIM_RREG_R1);
+  for (unsigned i = 0; i < 32; ++i) {
+    addOp(PIM_MICRO_OP_READ_ROW_TO_SA, obj1, i, PIM_RREG_NONE);
+    addOp(PIM_MICRO_OP_MOV, obj1, 0, PIM_RREG_R2, PIM_RREG_SA);
+    addOp(PIM_MICRO_OP_READ_ROW_TO_SA, obj2, i, PIM_RREG_NONE);
+    addOp(PIM_MICRO_OP_XOR, obj1, 0, PIM_RREG_R3, PIM_RREG_SA, PIM_RREG_R2);
+    addOp(PIM_MICRO_OP_XOR, obj1, 0, PIM_RREG_R4, PIM_RREG_R3, PIM_RREG_R1);
+    addOp(PIM_MICRO_OP_MAJ, obj1, 0, PIM_RREG_R1, PIM_RREG_SA, PIM_RREG_R2, PIM_RREG_R1);
+    addOp(PIM_MICRO_OP_MOV, obj1, 0, PIM_RREG_SA, PIM_RREG_R4);
+    addOp(PIM_MICRO_OP_WRITE_SA_TO_ROW, obj3, i, PIM_RREG_NONE);
+  }
+  status = pimOpBatch(ops.data(), ops.size());
+  assert(status == PIM_OK);
+  status = pimCopyDeviceToHost(obj3, (void*)dest.data());
+  assert(status == PIM_OK);
+  for (unsigned i = 0; i < numElements; ++i) {
+    if (dest[i] != src1[i] + src2[i]) {
+      std::cout << "batched add failed" << std::endl;
+      return false;
+    }
+  }
+
+  // batched rotateR
+  ops.clear();
+  for (unsigned i = 0; i < 32; ++i) {
+    addOp(PIM_MICRO_OP_READ_ROW_TO_SA, obj1, i, PIM_RREG_NONE);
+    addOp(PIM_MICRO_OP_MOV, obj1, 0, PIM_RREG_R1, PIM_RREG_SA);
+    addOp(PIM_MICRO_OP_ROTATE_R, obj1, 0, PIM_RREG_R1);
+    addOp(PIM_MICRO_OP_MOV, obj1, 0, PIM_RREG_SA, PIM_RREG_R1);
+    addOp(PIM_MICRO_OP_WRITE_SA_TO_ROW, obj3, i, PIM_RREG_NONE);
+  }
+  status = pimOpBatch(ops.data(), ops.size());
+  assert(status == PIM_OK);
+  status = pimCopyDeviceToHost(obj3, (void*)dest.data());
+  assert(status == PIM_OK);
+  for (unsigned i = 1; i < numElements; ++i) {
+    if (dest[i] != src1[i - 1]) {
+      std::cout << "batched rotateR failed" << std::endl;
+      return false;
+    }
+  }
+  if (dest.front() != src1.back()) {
+    std::cout << "batched rotateR failed 2" << std::endl;
+    return false;
+  }
+
+  // missing src reg is rejected
+  ops.clear();
+  addOp(PIM_MICRO_OP_AND, obj1, 0, PIM_RREG_SA, PIM_RREG_R1);
+  status = pimOpBatch(ops.data(), ops.size());
+  if (status != PIM_ERROR) {
+    std::cout << "batch sanity check failed" << std::endl;
+    return false;
+  }
+
+  pimFree(obj1);
+  pimFree(obj2);
+  pimFree(obj3);
+  return true;
+}
+
+bool testMicroKernel()
+{
+  unsigned numElements = 1000;
+
+  std::vector<int> src1(numElements);
+  std::vector<int> src2(numElements);
+  std::vector<int> dest(numElements);
+
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_V1, numElements, PIM_INT32);
+  assert(obj1 != -1);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  assert(obj2 != -1);
+  PimObjId obj3 = pimAllocAssociated(obj1, PIM_INT32);
+  assert(obj3 != -1);
+
+  for (unsigned i = 0; i < numElements; ++i) {
+    src1[i] = i * 11 - 4000;
+    src2[i] = i * 3 + 17;
+  }
+
+  PimStatus status = pimCopyHostToDevice((void*)src1.data(), obj1);
+  assert(status == PIM_OK);
+  status = pimCopyHostToDevice((void*)src2.data(), obj2);
+  assert(status == PIM_OK);
+
+  // record one bit of a bit-serial add, with carry in R1
+  status = pimBeginMicroKernel({obj1, obj2, obj3});
+  assert(status == PIM_OK);
+  pimOpReadRowToSa(obj1, 0);
+  pimOpMove(obj1, PIM_RREG_SA, PIM_RREG_R2);
+  pimOpReadRowToSa(obj2, 0);
+  pimOpXor(obj1, PIM_RREG_SA, PIM_RREG_R2, PIM_RREG_R3);
+  pimOpXor(obj1, PIM_RREG_R3, PIM_RREG_R1, PIM_RREG_R4);
+  pimOpMaj(obj1, PIM_RREG_SA, PIM_RREG_R2, PIM_RREG_R1, PIM_RREG_R1);
+  pimOpMove(obj1, PIM_RREG_R4, PIM_RREG_SA);
+  pimOpWriteSaToRow(obj3, 0);
+  PimMicroKernelId kernelId = pimEndMicroKernel();
+  assert(kernelId != -1);
+
+  // replay the kernel for each bit: obj3 = obj1 + obj2
+  status = pimOpSet(obj1, PIM_RREG_R1, 0);
+  assert(status == PIM_OK);
+  for (unsigned i = 0; i < 32; ++i) {
+    status = pimRunMicroKernel(kernelId, {obj1, obj2, obj3}, i);
+    assert(status == PIM_OK);
+  }
+  status = pimCopyDeviceToHost(obj3, (void*)dest.data());
+  assert(status == PIM_OK);
+  for (unsigned i = 0; i < numElements; ++i) {
+    if (dest[i] != src1[i] + src2[i]) {
+      std::cout << "micro-kernel add failed" << std::endl;
+      return false;
+    }
+  }
+
+  // rebind parameters: obj2 = obj3 + obj2
+  status = pimOpSet(obj1, PIM_RREG_R1, 0);
+  assert(status == PIM_OK);
+  for (unsigned i = 0; i < 32; ++i) {
+    status = pimRunMicroKernel(kernelId, {obj3, obj2, obj2}, i);
+    assert(status == PIM_OK);
+  }
+  status = pimCopyDeviceToHost(obj2, (void*)dest.data());
+  assert(status == PIM_OK);
+  for (unsigned i = 0; i < numElements; ++i) {
+    if (dest[i] != src1[i] + src2[i] * 2) {
+      std::cout << "micro-kernel rebinding failed" << std::endl;
+      return false;
+    }
+  }
+
+  // out-of-range offset shift and wrong number of objects are rejected
+  if (pimRunMicroKernel(kernelId, {obj1, obj2, obj3}, 32) != PIM_ERROR ||
+      pimRunMicroKernel(kernelId, {obj1, obj2}) != PIM_ERROR) {
+    std::cout << "micro-kernel sanity check failed" << std::endl;
+    return false;
+  }
+
+  status = pimDeleteMicroKernel(kernelId);
+  assert(status == PIM_OK);
+  if (pimRunMicroKernel(kernelId, {obj1, obj2, obj3}) != PIM_ERROR) {
+    std::cout << "deleted micro-kernel is still valid" << std::endl;
+    return false;
+  }
+
+  // peephole optimization with a kernel-local object: obj3 = ~obj1 through a temporary
+  status = pimBeginMicroKernel({obj1, obj3});
+  assert(status == PIM_OK);
+  PimObjId tmp = pimAllocAssociated(obj1, PIM_INT32);
+  assert(tmp != -1);
+  for (unsigned i = 0; i < 32; ++i) {
+    pimOpReadRowToSa(obj1, i);
+    pimOpNot(obj1, PIM_RREG_SA, PIM_RREG_SA);
+    pimOpWriteSaToRow(tmp, i);
+    pimOpReadRowToSa(tmp, i);
+    pimOpMove(obj1, PIM_RREG_SA, PIM_RREG_R1);
+    pimOpMove(obj1, PIM_RREG_R1, PIM_RREG_SA);
+    pimOpWriteSaToRow(obj3, i);
+  }
+  pimFree(tmp);
+  kernelId = pimEndMicroKernel(PIM_MICRO_KERNEL_OPT_PEEPHOLE_SCRATCH);
+  assert(kernelId != -1);
+  PimMicroKernelStats stats;
+  status = pimGetMicroKernelStats(kernelId, &stats);
+  assert(status == PIM_OK);
+  if (stats.numRecordedRead != 64 || stats.numRecordedWrite != 64 || stats.numRecordedLogic != 96 ||
+      stats.numRead != 32 || stats.numWrite != 32 || stats.numLogic != 32) {
+    std::cout << "micro-kernel peephole optimization failed" << std::endl;
+    return false;
+  }
+  status = pimRunMicroKernel(kernelId, {obj1, obj3});
+  assert(status == PIM_OK);
+  status = pimCopyDeviceToHost(obj3, (void*)dest.data());
+  assert(status == PIM_OK);
+  for (unsigned i = 0; i < numElements; ++i) {
+    if (dest[i] != ~src1[i]) {
+      std::cout << "optimized micro-kernel failed" << std::endl;
+      return false;
+    }
+  }
+  // optimized micro-kernel requires distinct objects
+  if (pimRunMicroKernel(kernelId, {obj1, obj1}) != PIM_ERROR) {
+    std::cout << "optimized micro-kernel sanity check failed" << std::endl;
+    return false;
+  }
+  // a dual-contact ref aliases rows of its ref object
+  PimObjId objRef = pimCreateDualContactRef(obj1);
+  assert(objRef != -1);
+  if (pimRunMicroKernel(kernelId, {obj1, objRef}) != PIM_ERROR || pimRunMicroKernel(kernelId, {objRef, obj1}) != PIM_ERROR) {
+    std::cout << "optimized micro-kernel sanity check of refs failed" << std::endl;
+    return false;
+  }
+  pimFree(objRef);
+  status = pimDeleteMicroKernel(kernelId);
+  assert(status == PIM_OK);
+
+  pimFree(obj1);
+  pimFree(obj2);
+  pimFree(obj3);
+  return true;
+}
+
 int main()
 {
   std::cout << "PIM test: BitSIMD-V basic" << std::endl;
@@ -282,6 +525,18 @@ int main()
     return 1;
   }
 
+  ok = testMicroOpBatch();
+  if (!ok) {
+    std::cout << "Test failed!" << std::endl;
+    return 1;
+  }
+
+  ok = testMicroKernel();
+  if (!ok) {
+    std::cout << "Test failed!" << std::endl;
+    return 1;
+  }
+
   pimShowStats();
   std::cout << "All correct!" << std::endl;
   return 0;
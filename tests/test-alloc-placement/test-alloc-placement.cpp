@@ -0,0 +1,66 @@
+// Test: Test placement of PIM objects on least used cores
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+
+
+//! @brief  Small objects spread over least used cores, so that an object on all cores still fits afterwards
+bool testSpreadSmallObjects()
+{
+  // 4 cores of two subarrays with 2048 rows, and a vertical int32 object of 8192 elements takes 32 rows of one core
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BITSIMD_V, 1, 1, 8, 1024, 8192);
+  assert(status == PIM_OK);
+  uint64_t numElementsPerCore = 8192;
+  std::vector<PimObjId> smallObjs;
+  bool ok = true;
+  for (int i = 0; i < 48; ++i) {
+    PimObjId obj = pimAlloc(PIM_ALLOC_V, numElementsPerCore, PIM_INT32);
+    ok &= (obj != -1);
+    smallObjs.push_back(obj);
+  }
+  // 48 small objects take 384 rows of each core, while all on one core would take 1536 rows of it
+  PimObjId largeObj = pimAlloc(PIM_ALLOC_V, numElementsPerCore * 4 * 17, PIM_INT32);
+  if (largeObj == -1) {
+    std::printf("Error: Failed to allocate 544 rows on each core after allocating small objects\n");
+    ok = false;
+  }
+
+  // small objects on different cores hold their own data
+  for (size_t i = 0; i < smallObjs.size(); ++i) {
+    ok &= (pimBroadcastInt(smallObjs[i], static_cast<int64_t>(i)) == PIM_OK);
+  }
+  for (size_t i = 0; i < smallObjs.size(); ++i) {
+    std::vector<int32_t> dest(numElementsPerCore);
+    ok &= (pimCopyDeviceToHost(smallObjs[i], (void*)dest.data()) == PIM_OK);
+    ok &= (dest.front() == static_cast<int32_t>(i) && dest.back() == static_cast<int32_t>(i));
+  }
+
+  pimFree(largeObj);
+  for (PimObjId obj : smallObjs) {
+    pimFree(obj);
+  }
+  // freed rows are available again on all cores
+  largeObj = pimAlloc(PIM_ALLOC_V, numElementsPerCore * 4 * 64, PIM_INT32);
+  ok &= (largeObj != -1);
+  pimFree(largeObj);
+  pimDeleteDevice();
+  std::cout << "Spread Small Objects over Least Used Cores " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Placement of PIM objects on least used cores" << std::endl;
+
+  bool ok = testSpreadSmallObjects();
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
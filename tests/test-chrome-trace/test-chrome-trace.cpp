@@ -0,0 +1,133 @@
+// Test: Test Chrome trace of modeled and wall-clock execution
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+
+//! @brief  Run a vector addition on all cores, and independent additions on small objects of different cores
+bool runCmds(uint64_t numElements)
+{
+  std::vector<int32_t> src(numElements, 1), dest(numElements);
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  PimObjId small1 = pimAlloc(PIM_ALLOC_AUTO, 1, PIM_INT32);
+  PimObjId small2 = pimAlloc(PIM_ALLOC_AUTO, 1, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1 && small1 != -1 && small2 != -1);
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj1) == PIM_OK);
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj2) == PIM_OK);
+  ok &= (pimAdd(obj1, obj2, obj2) == PIM_OK);
+  ok &= (pimCopyDeviceToHost(obj2, (void*)dest.data()) == PIM_OK);
+  ok &= (pimMulScalar(small1, small1, 3) == PIM_OK);
+  ok &= (pimMulScalar(small2, small2, 3) == PIM_OK);
+  pimFree(obj1);
+  pimFree(obj2);
+  pimFree(small1);
+  pimFree(small2);
+  return ok;
+}
+
+//! @brief  Read a file as a string
+std::string readFile(const std::string& filePath)
+{
+  std::ifstream file(filePath);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return ss.str();
+}
+
+//! @brief  Check that a trace is a JSON array with balanced brackets outside of strings
+bool isJsonArray(const std::string& json)
+{
+  if (json.empty() || json.front() != '[' || json.find_last_not_of("\n") != json.size() - 2 || json[json.size() - 2] != ']') {
+    return false;
+  }
+  int depth = 0;
+  bool inString = false;
+  for (size_t i = 0; i < json.size(); ++i) {
+    char ch = json[i];
+    if (inString) {
+      if (ch == '\\') {
+        ++i;
+      } else if (ch == '"') {
+        inString = false;
+      }
+    } else if (ch == '"') {
+      inString = true;
+    } else if (ch == '[' || ch == '{') {
+      ++depth;
+    } else if (ch == ']' || ch == '}') {
+      if (--depth < 0) {
+        return false;
+      }
+    }
+  }
+  return depth == 0 && !inString;
+}
+
+//! @brief  Check that a trace contains all keys
+bool hasKeys(const std::string& json, const std::vector<std::string>& keys)
+{
+  bool ok = true;
+  for (const std::string& key : keys) {
+    if (json.find(key) == std::string::npos) {
+      std::printf("Error: Missing %s in Chrome trace\n", key.c_str());
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Chrome trace" << std::endl;
+
+  std::string traceFile = std::filesystem::temp_directory_path().string() + "/pimeval-test-chrome-trace.json";
+  std::filesystem::remove(traceFile);
+  setenv("PIMEVAL_CHROME_TRACE", traceFile.c_str(), 1);
+
+  // Modeled commands are on rank tracks, copies are on the host channel track, and API scopes are on host thread tracks
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BANK_LEVEL, 2, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  bool ok = runCmds(8192);
+  pimDeleteDevice();
+  std::string json = readFile(traceFile);
+  bool okDevice = isJsonArray(json);
+  okDevice &= hasKeys(json, { "\"name\":\"PIMeval Simulator\"", "\"name\":\"Modeled PIM Device 1 (PIM_DEVICE_BANK_LEVEL)\"",
+                              "\"name\":\"Host Channel\"", "\"name\":\"Rank 0\"", "\"name\":\"Rank 1\"", "\"name\":\"Host Thread 0\"",
+                              "\"name\":\"add.int32.h\",\"cat\":\"cmd\",\"ph\":\"X\",\"pid\":1",
+                              "\"name\":\"copy_h2d.int32.h\",\"cat\":\"copy\",\"ph\":\"X\",\"pid\":1,\"tid\":0",
+                              "\"name\":\"pimAdd\",\"cat\":\"api\",\"ph\":\"X\",\"pid\":0,\"tid\":0",
+                              "\"numElements\":8192", "\"numPass\":", "\"numRegions\":", "\"objIds\":[" });
+  // independent commands on different cores of a rank overlap on the modeled timeline
+  okDevice &= hasKeys(json, { "\"name\":\"Rank 0 (1)\"" });
+  std::cout << "Chrome Trace of a Device " << (okDevice ? "PASSED" : "FAILED") << std::endl;
+
+  // The trace continues with a new process for the next device
+  status = pimCreateDevice(PIM_DEVICE_FULCRUM, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  ok &= runCmds(4096);
+  pimDeleteDevice();
+  unsetenv("PIMEVAL_CHROME_TRACE");
+  json = readFile(traceFile);
+  bool okNextDevice = isJsonArray(json);
+  okNextDevice &= hasKeys(json, { "\"name\":\"Modeled PIM Device 1 (PIM_DEVICE_BANK_LEVEL)\"",
+                                  "\"name\":\"Modeled PIM Device 2 (PIM_DEVICE_FULCRUM)\"", "\"pid\":2" });
+  std::cout << "Chrome Trace of Multiple Devices " << (okNextDevice ? "PASSED" : "FAILED") << std::endl;
+
+  std::filesystem::remove(traceFile);
+  ok &= okDevice && okNextDevice;
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
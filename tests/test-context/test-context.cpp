@@ -0,0 +1,181 @@
+// Test: Test multiple independent PIM contexts in one process
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+
+
+//! @brief  Run vector add and reduction sum on the current context, and check results
+bool runVecAdd(PimDeviceEnum deviceType, uint64_t numElements, int32_t scale, PimStatsSummary& stats)
+{
+  PimStatus status = pimCreateDevice(deviceType, 1, 4, 4, 1024, 8192);
+  if (status != PIM_OK) {
+    return false;
+  }
+  std::vector<int32_t> src1(numElements);
+  std::vector<int32_t> src2(numElements);
+  std::vector<int32_t> dest(numElements);
+  int64_t expectedSum = 0;
+  for (uint64_t i = 0; i < numElements; ++i) {
+    src1[i] = static_cast<int32_t>(i % 1000) * scale;
+    src2[i] = static_cast<int32_t>(i % 7);
+    expectedSum += src1[i] + src2[i];
+  }
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1);
+  ok = ok && (pimCopyHostToDevice((void*)src1.data(), obj1) == PIM_OK);
+  ok = ok && (pimCopyHostToDevice((void*)src2.data(), obj2) == PIM_OK);
+  ok = ok && (pimAdd(obj1, obj2, obj1) == PIM_OK);
+  int64_t sum = 0;
+  ok = ok && (pimRedSum(obj1, &sum) == PIM_OK);
+  ok = ok && (pimCopyDeviceToHost(obj1, (void*)dest.data()) == PIM_OK);
+  ok = ok && (pimGetStatsSummary(&stats) == PIM_OK);
+  for (uint64_t i = 0; ok && i < numElements; ++i) {
+    ok = (dest[i] == src1[i] + src2[i]);
+  }
+  ok = ok && (sum == expectedSum);
+  pimFree(obj1);
+  pimFree(obj2);
+  pimDeleteDevice();
+  return ok;
+}
+
+//! @brief  Run independent simulations on different devices concurrently, one context per host thread
+bool testConcurrentContexts()
+{
+  const std::vector<PimDeviceEnum> deviceTypes = { PIM_DEVICE_BITSIMD_V, PIM_DEVICE_FULCRUM, PIM_DEVICE_BANK_LEVEL, PIM_DEVICE_BITSIMD_V };
+  const uint64_t numElements = 64 * 1024;
+
+  // reference stats from the default context
+  std::vector<PimStatsSummary> refStats(deviceTypes.size());
+  bool ok = true;
+  for (size_t i = 0; i < deviceTypes.size(); ++i) {
+    ok &= runVecAdd(deviceTypes[i], numElements, static_cast<int32_t>(i + 1), refStats[i]);
+  }
+
+  std::vector<PimStatsSummary> stats(deviceTypes.size());
+  std::vector<int> results(deviceTypes.size(), 0);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < deviceTypes.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      PimContext context = pimCreateContext();
+      bool threadOk = (context != nullptr && pimSetCurrentContext(context) == PIM_OK && pimGetCurrentContext() == context);
+      threadOk = threadOk && runVecAdd(deviceTypes[i], numElements, static_cast<int32_t>(i + 1), stats[i]);
+      threadOk = threadOk && (pimDeleteContext(context) == PIM_OK);
+      results[i] = threadOk ? 1 : 0;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < deviceTypes.size(); ++i) {
+    // each context models exactly the same as the default context
+    bool match = results[i] && stats[i].numCmds == refStats[i].numCmds && stats[i].numBytesCopied == refStats[i].numBytesCopied &&
+                 stats[i].cmdMsRuntime == refStats[i].cmdMsRuntime && stats[i].copyMsRuntime == refStats[i].copyMsRuntime;
+    if (!match) {
+      std::printf("Error: Context %zu result or stats mismatch\n", i);
+      ok = false;
+    }
+  }
+
+  std::cout << "Concurrent PIM Contexts " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Switch between contexts on one thread without affecting each other
+bool testSwitchContexts()
+{
+  bool ok = (pimCreateDevice(PIM_DEVICE_FULCRUM, 1, 2, 2, 1024, 8192) == PIM_OK);
+  PimContext defaultContext = pimGetCurrentContext();
+  PimContext context = pimCreateContext();
+  ok &= (pimSetCurrentContext(context) == PIM_OK);
+  // new context has no device yet
+  PimDeviceProperties props;
+  ok &= (pimGetDeviceProperties(&props) == PIM_ERROR);
+  ok &= (pimCreateDevice(PIM_DEVICE_BITSIMD_V, 1, 4, 4, 1024, 8192) == PIM_OK);
+  ok &= (pimGetDeviceProperties(&props) == PIM_OK && props.simTarget == PIM_DEVICE_BITSIMD_V);
+  ok &= (pimSetCurrentContext(nullptr) == PIM_OK && pimGetCurrentContext() == defaultContext);
+  ok &= (pimGetDeviceProperties(&props) == PIM_OK && props.simTarget == PIM_DEVICE_FULCRUM && props.numBankPerRank == 2);
+  ok &= (pimDeleteContext(context) == PIM_OK);
+  // invalid contexts are rejected
+  ok &= (pimDeleteContext(context) == PIM_ERROR);
+  ok &= (pimDeleteContext(defaultContext) == PIM_ERROR);
+  ok &= (pimSetCurrentContext(context) == PIM_ERROR);
+  ok &= (pimGetCurrentContext() == defaultContext);
+  pimDeleteDevice();
+
+  std::cout << "Switch PIM Contexts " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Copy data of a multi-core object inside a non-default context on another thread while the default context
+//!         is idle. Syncing data between simulated memory and host uses the thread pool of the owning context
+bool testCopyInContext()
+{
+  const uint64_t numElements = 64 * 1024;
+  const uint64_t idxBegin = 1000;
+  const uint64_t idxEnd = 50000;
+  PimDeviceProperties props;
+  bool ok = (pimGetDeviceProperties(&props) == PIM_ERROR);  // default context has no device
+  bool threadOk = false;
+  std::thread thread([&]() {
+    PimContext context = pimCreateContext();
+    threadOk = (context != nullptr && pimSetCurrentContext(context) == PIM_OK);
+    threadOk = threadOk && (pimCreateDevice(PIM_DEVICE_BITSIMD_V, 1, 4, 4, 1024, 8192) == PIM_OK);
+    std::vector<int32_t> src(numElements);
+    std::vector<int32_t> part(idxEnd - idxBegin);
+    std::vector<int32_t> dest(numElements);
+    for (uint64_t i = 0; i < numElements; ++i) {
+      src[i] = static_cast<int32_t>(i % 3000) - 1500;
+    }
+    PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+    PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+    threadOk = threadOk && (obj1 != -1 && obj2 != -1);
+    // data written by a PIM command is synced from simulated memory for a ranged copy
+    threadOk = threadOk && (pimCopyHostToDevice((void*)src.data(), obj1) == PIM_OK);
+    threadOk = threadOk && (pimAdd(obj1, obj1, obj2) == PIM_OK);
+    threadOk = threadOk && (pimCopyDeviceToHost(obj2, (void*)part.data(), idxBegin, idxEnd) == PIM_OK);
+    for (uint64_t i = idxBegin; threadOk && i < idxEnd; ++i) {
+      threadOk = (part[i - idxBegin] == 2 * src[i]);
+    }
+    // partial overwrite, then sync back to simulated memory for a PIM command
+    threadOk = threadOk && (pimCopyHostToDevice((void*)src.data(), obj2, idxBegin, idxEnd) == PIM_OK);
+    threadOk = threadOk && (pimSub(obj2, obj1, obj2) == PIM_OK);
+    threadOk = threadOk && (pimCopyDeviceToHost(obj2, (void*)dest.data()) == PIM_OK);
+    for (uint64_t i = 0; threadOk && i < numElements; ++i) {
+      int32_t expected = (i >= idxBegin && i < idxEnd ? src[i - idxBegin] - src[i] : src[i]);
+      threadOk = (dest[i] == expected);
+    }
+    pimFree(obj1);
+    pimFree(obj2);
+    pimDeleteDevice();
+    threadOk = threadOk && (pimDeleteContext(context) == PIM_OK);
+  });
+  thread.join();
+  ok &= threadOk;
+  ok &= (pimGetDeviceProperties(&props) == PIM_ERROR);
+
+  std::cout << "Copy in Non-default PIM Context " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Multiple independent PIM contexts" << std::endl;
+
+  bool ok = true;
+  ok &= testConcurrentContexts();
+  ok &= testSwitchContexts();
+  ok &= testCopyInContext();
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
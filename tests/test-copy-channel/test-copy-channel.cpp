@@ -0,0 +1,97 @@
+// Test: Test channel contention of data copy
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cinttypes>
+#include <cmath>
+
+
+//! @brief  Copy an object to device and back, and return copy runtime of each direction, and the bus turnaround
+//!         on the modeled timeline when a host-to-device copy follows a device-to-host copy, of another object
+//!         queued behind it, or of the same object waiting for its data
+bool runCopy(uint64_t numElements, double& msH2D, double& msD2H, double& msTurnaround, double& msTurnaroundDep)
+{
+  // 4 ranks of the default DDR4 memory config share 2 channels. Each rank has 4 cores, and each core
+  // takes 256 elements of an object in one row
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BANK_LEVEL, 4, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  std::vector<int32_t> src(numElements, 7), dest(numElements);
+  PimObjId obj = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj, PIM_INT32);
+  bool ok = (obj != -1 && obj2 != -1);
+
+  // copy runtime stats accumulate since device creation, while stats reset starts a new critical path.
+  // Each measurement on the critical path starts after a device-to-host copy, so that it starts in the same direction
+  PimStatsSummary stats;
+  pimResetStats();
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj) == PIM_OK);
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+  msH2D = stats.copyMsRuntime;
+  ok &= (pimCopyDeviceToHost(obj, (void*)dest.data()) == PIM_OK);
+  pimResetStats();
+  ok &= (pimCopyDeviceToHost(obj, (void*)dest.data()) == PIM_OK);
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+  msD2H = stats.criticalPathMsRuntime;
+  pimResetStats();
+  ok &= (pimCopyDeviceToHost(obj, (void*)dest.data()) == PIM_OK);
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj2) == PIM_OK);
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+  msTurnaround = stats.criticalPathMsRuntime - msD2H - msH2D;
+  ok &= (pimCopyDeviceToHost(obj, (void*)dest.data()) == PIM_OK);
+  pimResetStats();
+  ok &= (pimCopyDeviceToHost(obj, (void*)dest.data()) == PIM_OK);
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj) == PIM_OK);
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+  msTurnaroundDep = stats.criticalPathMsRuntime - msD2H - msH2D;
+
+  ok &= (dest == src);
+  pimFree(obj);
+  pimFree(obj2);
+  pimDeleteDevice();
+  return ok;
+}
+
+//! @brief  Data on cores of fewer channels take longer to copy
+bool testChannelContention()
+{
+  double msH2D[3] = {}, msD2H[3] = {}, msTurnaround[3] = {}, msTurnaroundDep[3] = {};
+  // objects on cores of one rank, two ranks of one channel, and all ranks of two channels
+  uint64_t numElements[3] = { 1024, 2048, 4096 };
+  bool ok = true;
+  for (int i = 0; i < 3; ++i) {
+    ok &= runCopy(numElements[i], msH2D[i], msD2H[i], msTurnaround[i], msTurnaroundDep[i]);
+    std::printf("Copy runtime of %" PRIu64 " elements: %f ms\n", numElements[i], msH2D[i]);
+  }
+  // ranks of a channel share its data bus, while two channels work in parallel
+  if (!(msH2D[1] > 1.9 * msH2D[0] && msH2D[2] < 1.1 * msH2D[1])) {
+    std::printf("Error: Copy runtime %f, %f, %f ms\n", msH2D[0], msH2D[1], msH2D[2]);
+    ok = false;
+  }
+  // the bus turns around from reads to writes on the modeled timeline, also for a copy waiting for its data
+  for (int i = 0; i < 3; ++i) {
+    if (!(msTurnaround[i] > 0.0 && std::fabs(msTurnaroundDep[i] - msTurnaround[i]) <= 1e-6 * msTurnaround[i])) {
+      std::printf("Error: Bus turnaround %f ms, %f ms of the same object, between device-to-host and host-to-device copies\n",
+                  msTurnaround[i], msTurnaroundDep[i]);
+      ok = false;
+    }
+  }
+  std::cout << "Channel Contention " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Channel contention of data copy" << std::endl;
+
+  bool ok = testChannelContention();
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
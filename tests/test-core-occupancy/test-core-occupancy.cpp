@@ -0,0 +1,148 @@
+// Test: Test per-core occupancy and load-imbalance stats
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <filesystem>
+
+
+//! @brief  Run a vector addition on a bank-level device with 4 cores of 256 int32 elements per region
+bool runVecAdd(uint64_t numElements, bool isLoadBalanced, const std::string& filePath, std::vector<std::string>& lines,
+               bool isHeatmap = true)
+{
+  setenv("PIMEVAL_LOAD_BALANCE", isLoadBalanced ? "1" : "0", 1);
+  setenv("PIMEVAL_DEBUG", isHeatmap ? "32" : "0", 1);  // show heatmap of cores
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BANK_LEVEL, 1, 4, 4, 1024, 8192);
+  unsetenv("PIMEVAL_LOAD_BALANCE");
+  unsetenv("PIMEVAL_DEBUG");
+  assert(status == PIM_OK);
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1);
+  ok &= (pimAdd(obj1, obj2, obj2) == PIM_OK);
+  pimShowStats();
+  ok &= (pimExportStats(filePath.c_str(), PIM_STATS_CSV) == PIM_OK);
+  pimFree(obj1);
+  pimFree(obj2);
+  pimDeleteDevice();
+
+  std::ifstream file(filePath);
+  std::string line;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  return ok;
+}
+
+//! @brief  Get the value of a metric in CSV stats, or NaN if not found
+double getValue(const std::vector<std::string>& lines, const std::string& key)
+{
+  for (const std::string& line : lines) {
+    if (line.rfind(key + ",", 0) == 0) {
+      return std::stod(line.substr(key.size() + 1));
+    }
+  }
+  std::printf("Error: Missing stats %s\n", key.c_str());
+  return std::nan("");
+}
+
+//! @brief  Check if two values are equal within a relative tolerance
+bool isClose(double a, double b)
+{
+  return std::abs(a - b) <= 1e-6 * std::max(std::abs(a), std::abs(b));
+}
+
+//! @brief  Without load balancing, elements fill regions of a few cores, leaving other cores idle
+bool testPlacement(const std::string& filePath)
+{
+  std::vector<std::string> lines;
+  bool ok = runVecAdd(600, false, filePath, lines);
+  double msRuntime = getValue(lines, "occupancy,add.int32.h,msRuntime");
+  ok &= (getValue(lines, "occupancy,add.int32.h,count") == 1 && getValue(lines, "occupancy,add.int32.h,numCores") == 4);
+  ok &= (getValue(lines, "occupancy,add.int32.h,meanActiveCores") == 3);
+  ok &= (getValue(lines, "occupancy,add.int32.h,hist.0") == 1 && getValue(lines, "occupancy,add.int32.h,hist.1") == 3);
+  ok &= isClose(getValue(lines, "occupancy,add.int32.h,paddingWaste"), 1.0 - 600.0 / 768);
+  ok &= (msRuntime > 0.0 && isClose(getValue(lines, "occupancy,add.int32.h,msIdleCores"), msRuntime * 0.25));
+  // runtime lost to idle cores and padding adds up to unused element slots of all cores
+  double msLost = getValue(lines, "occupancy,add.int32.h,msIdleCores") + getValue(lines, "occupancy,add.int32.h,msPadding");
+  ok &= isClose(msLost, msRuntime * (1.0 - 600.0 / 1024));
+  int numIdleCores = 0;
+  for (int coreId = 0; coreId < 4; ++coreId) {
+    numIdleCores += (getValue(lines, "core," + std::to_string(coreId) + ",msActive") == 0.0);
+  }
+  ok &= (numIdleCores == 1);
+  std::cout << "Core Occupancy without Load Balancing " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Cores with more regions than others run extra passes
+bool testImbalance(const std::string& filePath)
+{
+  std::vector<std::string> lines;
+  bool ok = runVecAdd(1100, false, filePath, lines);
+  ok &= (getValue(lines, "occupancy,add.int32.h,minRegionsPerCore") == 1 && getValue(lines, "occupancy,add.int32.h,maxRegionsPerCore") == 2);
+  ok &= isClose(getValue(lines, "occupancy,add.int32.h,meanRegionsPerCore"), 1.25);
+  ok &= isClose(getValue(lines, "occupancy,add.int32.h,paddingWaste"), 1.0 - 1100.0 / 2048);
+  ok &= (getValue(lines, "occupancy,add.int32.h,msIdleCores") == 0.0);
+  // a core with one region is busy for half of the runtime of two passes
+  double msRuntime = getValue(lines, "occupancy,add.int32.h,msRuntime");
+  double msActiveMin = msRuntime;
+  for (int coreId = 0; coreId < 4; ++coreId) {
+    msActiveMin = std::min(msActiveMin, getValue(lines, "core," + std::to_string(coreId) + ",msActive"));
+  }
+  ok &= isClose(msActiveMin, msRuntime * 0.5);
+  std::cout << "Core Occupancy of Imbalanced Regions " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  With load balancing, elements are modeled as spread over all cores, so unused slots are padding
+bool testLoadBalanced(const std::string& filePath)
+{
+  std::vector<std::string> lines;
+  bool ok = runVecAdd(600, true, filePath, lines);
+  double msRuntime = getValue(lines, "occupancy,add.int32.h,msRuntime");
+  ok &= (getValue(lines, "occupancy,add.int32.h,meanActiveCores") == 4 && getValue(lines, "occupancy,add.int32.h,hist.1") == 4);
+  ok &= (getValue(lines, "occupancy,add.int32.h,msIdleCores") == 0.0);
+  ok &= isClose(getValue(lines, "occupancy,add.int32.h,paddingWaste"), 1.0 - 600.0 / 1024);
+  ok &= isClose(getValue(lines, "occupancy,add.int32.h,msPadding"), msRuntime * (1.0 - 600.0 / 1024));
+  std::cout << "Core Occupancy with Load Balancing " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Per-core runtime is only tracked and exported along with the heatmap
+bool testWithoutHeatmap(const std::string& filePath)
+{
+  std::vector<std::string> lines;
+  bool ok = runVecAdd(1100, false, filePath, lines, false);
+  ok &= (getValue(lines, "occupancy,add.int32.h,hist.1") == 3 && getValue(lines, "occupancy,add.int32.h,hist.2") == 1);
+  for (const std::string& line : lines) {
+    ok &= (line.rfind("core,", 0) != 0);
+  }
+  std::cout << "Core Occupancy without Heatmap " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Core occupancy stats" << std::endl;
+
+  std::string filePath = std::filesystem::temp_directory_path().string() + "/pimeval-test-core-occupancy.csv";
+  bool ok = testPlacement(filePath);
+  ok &= testImbalance(filePath);
+  ok &= testLoadBalanced(filePath);
+  ok &= testWithoutHeatmap(filePath);
+
+  std::filesystem::remove(filePath);
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
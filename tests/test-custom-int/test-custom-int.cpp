@@ -0,0 +1,224 @@
+// Test: Test PIM custom bit-width integers
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+
+
+//! @brief  Wrap a value to a custom bit width, with sign extension for signed integers
+int64_t wrap(int64_t val, unsigned numBits, bool isSigned)
+{
+  uint64_t mask = (numBits >= 64 ? ~0ULL : ((1ULL << numBits) - 1));
+  uint64_t bits = static_cast<uint64_t>(val) & mask;
+  if (isSigned && numBits < 64 && ((bits >> (numBits - 1)) & 1)) {
+    bits |= ~mask;
+  }
+  return static_cast<int64_t>(bits);
+}
+
+//! @brief  Test signed 5-bit integers, using int8_t on host side
+bool testSignedInt5(PimDeviceEnum deviceType, uint64_t numElements)
+{
+  const unsigned numBits = 5;
+  std::vector<int8_t> src1(numElements);
+  std::vector<int8_t> src2(numElements);
+  std::vector<int8_t> dest(numElements);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    src1[i] = static_cast<int8_t>(i % 32 - 16);
+    src2[i] = static_cast<int8_t>((i * 7) % 40 - 20);  // some values out of 5-bit range
+  }
+
+  PimObjId obj1 = pimAllocCustomInt(PIM_ALLOC_AUTO, numElements, numBits, true);
+  PimObjId obj2 = pimAllocAssociatedCustomInt(obj1, numBits, true);
+  PimObjId obj3 = pimAllocAssociatedCustomInt(obj1, numBits, true);
+  PimObjId objBool = pimAllocAssociated(obj1, PIM_BOOL);
+  assert(obj1 != -1 && obj2 != -1 && obj3 != -1 && objBool != -1);
+
+  PimStatus status = pimCopyHostToDevice((void*)src1.data(), obj1);
+  assert(status == PIM_OK);
+  status = pimCopyHostToDevice((void*)src2.data(), obj2);
+  assert(status == PIM_OK);
+
+  bool ok = true;
+  // host values are wrapped at 5 bits
+  status = pimCopyDeviceToHost(obj2, (void*)dest.data());
+  assert(status == PIM_OK);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    if (dest[i] != wrap(src2[i], numBits, true)) {
+      std::printf("Error: int5 copy: src %d dest %d\n", src2[i], dest[i]);
+      ok = false;
+      break;
+    }
+  }
+
+  const std::vector<std::pair<std::string, PimStatus (*)(PimObjId, PimObjId, PimObjId)>> ops = {
+    { "add", pimAdd }, { "sub", pimSub }, { "mul", pimMul }, { "min", pimMin }, { "max", pimMax } };
+  for (const auto& [name, op] : ops) {
+    status = op(obj1, obj2, obj3);
+    assert(status == PIM_OK);
+    status = pimCopyDeviceToHost(obj3, (void*)dest.data());
+    assert(status == PIM_OK);
+    for (uint64_t i = 0; i < numElements; ++i) {
+      int64_t a = wrap(src1[i], numBits, true);
+      int64_t b = wrap(src2[i], numBits, true);
+      int64_t expected = 0;
+      if (name == "add") {
+        expected = a + b;
+      } else if (name == "sub") {
+        expected = a - b;
+      } else if (name == "mul") {
+        expected = a * b;
+      } else if (name == "min") {
+        expected = std::min(a, b);
+      } else {
+        expected = std::max(a, b);
+      }
+      if (dest[i] != wrap(expected, numBits, true)) {
+        std::printf("Error: int5 %s: %ld %ld -> %d, expected %ld\n", name.c_str(), a, b, dest[i], wrap(expected, numBits, true));
+        ok = false;
+        break;
+      }
+    }
+  }
+
+  // the sign bit is the highest of 5 bits
+  status = pimBitSliceExtract(obj1, objBool, numBits - 1);
+  assert(status == PIM_OK);
+  std::vector<uint8_t> signs(numElements);
+  status = pimCopyDeviceToHost(objBool, (void*)signs.data());
+  assert(status == PIM_OK);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    if (signs[i] != (src1[i] < 0 ? 1 : 0)) {
+      std::printf("Error: int5 sign bit: src %d sign %u\n", src1[i], signs[i]);
+      ok = false;
+      break;
+    }
+  }
+  // bit index beyond 5 bits is out of range
+  status = pimBitSliceExtract(obj1, objBool, numBits);
+  if (status != PIM_ERROR) {
+    std::printf("Error: int5 bit slice out of range is not rejected\n");
+    ok = false;
+  }
+
+  pimFree(obj1);
+  pimFree(obj2);
+  pimFree(obj3);
+  pimFree(objBool);
+  return ok;
+}
+
+//! @brief  Test unsigned 12-bit integers, using uint16_t on host side
+bool testUnsignedInt12(uint64_t numElements)
+{
+  const unsigned numBits = 12;
+  std::vector<uint16_t> src(numElements);
+  std::vector<uint16_t> dest(numElements);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    src[i] = static_cast<uint16_t>(i * 37);
+  }
+
+  PimObjId obj1 = pimAllocCustomInt(PIM_ALLOC_AUTO, numElements, numBits, false);
+  PimObjId obj2 = pimAllocAssociatedCustomInt(obj1, numBits, false);
+  assert(obj1 != -1 && obj2 != -1);
+
+  PimStatus status = pimCopyHostToDevice((void*)src.data(), obj1);
+  assert(status == PIM_OK);
+
+  bool ok = true;
+  status = pimMulScalar(obj1, obj2, 3);
+  assert(status == PIM_OK);
+  status = pimAddScalar(obj2, obj2, 100);
+  assert(status == PIM_OK);
+  status = pimCopyDeviceToHost(obj2, (void*)dest.data());
+  assert(status == PIM_OK);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    uint64_t expected = ((src[i] % 4096) * 3 + 100) % 4096;
+    if (dest[i] != expected) {
+      std::printf("Error: uint12 scaled add: src %u dest %u expected %lu\n", src[i], dest[i], expected);
+      ok = false;
+      break;
+    }
+  }
+
+  status = pimPopCount(obj1, obj2);
+  assert(status == PIM_OK);
+  status = pimCopyDeviceToHost(obj2, (void*)dest.data());
+  assert(status == PIM_OK);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    unsigned expected = __builtin_popcount(src[i] % 4096);
+    if (dest[i] != expected) {
+      std::printf("Error: uint12 popcount: src %u dest %u expected %u\n", src[i], dest[i], expected);
+      ok = false;
+      break;
+    }
+  }
+
+  pimFree(obj1);
+  pimFree(obj2);
+  return ok;
+}
+
+//! @brief  Test custom bit-width integers on a PIM device
+bool testCustomInt(PimDeviceEnum deviceType)
+{
+  unsigned numRanks = 1;
+  unsigned numBankPerRank = 1;
+  unsigned numSubarrayPerBank = 4;
+  unsigned numRows = 1024;
+  unsigned numCols = 8192;
+  uint64_t numElements = 16 * 1024;
+
+  PimStatus status = pimCreateDevice(deviceType, numRanks, numBankPerRank, numSubarrayPerBank, numRows, numCols);
+  assert(status == PIM_OK);
+
+  bool ok = true;
+  ok &= testSignedInt5(deviceType, numElements);
+  ok &= testUnsignedInt12(numElements);
+
+  // invalid bit widths
+  if (pimAllocCustomInt(PIM_ALLOC_AUTO, numElements, 0, false) != -1 ||
+      pimAllocCustomInt(PIM_ALLOC_AUTO, numElements, 65, false) != -1 ||
+      pimAllocCustomInt(PIM_ALLOC_AUTO, numElements, 1, true) != -1) {
+    std::printf("Error: Invalid custom integer bit width is not rejected\n");
+    ok = false;
+  }
+
+  pimShowStats();
+  pimResetStats();
+  pimDeleteDevice();
+
+  std::cout << "Custom Int Test on " << (deviceType == PIM_DEVICE_BITSIMD_V ? "BITSIMD_V" : "BITSIMD_H")
+            << (ok ? " PASSED" : " FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Custom bit-width integers are not supported on bit-parallel PIM devices
+bool testNonBitSerial()
+{
+  PimStatus status = pimCreateDevice(PIM_DEVICE_FULCRUM, 1, 1, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  bool ok = (pimAllocCustomInt(PIM_ALLOC_AUTO, 1024, 5, true) == -1);
+  pimDeleteDevice();
+  std::cout << "Custom Int Test on FULCRUM " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: PIM custom bit-width integers" << std::endl;
+
+  bool ok = true;
+  ok &= testCustomInt(PIM_DEVICE_BITSIMD_V);
+  ok &= testCustomInt(PIM_DEVICE_BITSIMD_H);
+  ok &= testNonBitSerial();
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
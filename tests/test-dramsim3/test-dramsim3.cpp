@@ -0,0 +1,156 @@
+// Test: Test DRAMsim3 cycle-level timing of PIM commands
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <filesystem>
+#ifdef DRAMSIM3_INTEG
+#include "memory_system.h"
+#endif
+
+
+//! @brief  DRAMsim3 config with 8 banks of 65536 rows
+const std::string memConfigFile = "../../configs/taco/DDR4_8Gb_x16_3200.ini";
+
+//! @brief  Create a bank-level device of 16 cores with 65536 rows each, so two cores share a DRAMsim3 bank
+void createDevice(unsigned sampleInterval = 1)
+{
+  setenv("PIMEVAL_MEM_CONFIG", memConfigFile.c_str(), 1);
+  setenv("PIMEVAL_DRAMSIM3_SAMPLE_INTERVAL", std::to_string(sampleInterval).c_str(), 1);
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BANK_LEVEL, 1, 16, 1, 65536, 1024);
+  unsetenv("PIMEVAL_MEM_CONFIG");
+  unsetenv("PIMEVAL_DRAMSIM3_SAMPLE_INTERVAL");
+  assert(status == PIM_OK);
+}
+
+//! @brief  Export stats of the current device and read all lines
+std::vector<std::string> exportStats(const std::string& filePath)
+{
+  std::vector<std::string> lines;
+  if (pimExportStats(filePath.c_str(), PIM_STATS_CSV) != PIM_OK) {
+    return lines;
+  }
+  std::ifstream file(filePath);
+  std::string line;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+//! @brief  Get the value of a metric in CSV stats, or NaN if not found
+double getValue(const std::vector<std::string>& lines, const std::string& key)
+{
+  for (const std::string& line : lines) {
+    if (line.rfind(key + ",", 0) == 0) {
+      return std::stod(line.substr(key.size() + 1));
+    }
+  }
+  std::printf("Error: Missing stats %s\n", key.c_str());
+  return std::nan("");
+}
+
+//! @brief  Get DRAMsim3 simulated runtime of a vector addition with a region of 32 int32 elements per core
+double simulateVecAdd(uint64_t numElements, const std::string& filePath)
+{
+  createDevice();
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  assert(obj1 != -1 && obj2 != -1);
+  pimAdd(obj1, obj2, obj2);
+  std::vector<std::string> lines = exportStats(filePath);
+  pimFree(obj1);
+  pimFree(obj2);
+  pimDeleteDevice();
+  return getValue(lines, "dramsim3,add,msSimulated");
+}
+
+//! @brief  Cores sharing a DRAMsim3 bank access different rows, rather than merging with each other
+bool testCoresSharingBank(const std::string& filePath)
+{
+  setenv("PIMEVAL_LOAD_BALANCE", "0", 1);
+  double msOneCore = simulateVecAdd(32, filePath);
+  double msTwoCores = simulateVecAdd(64, filePath);
+  unsetenv("PIMEVAL_LOAD_BALANCE");
+  bool ok = (msOneCore > 0.0 && msTwoCores > 1.5 * msOneCore);
+  std::cout << "DRAMsim3 Cores Sharing a Bank " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Writes of a data copy complete once drained to DRAM, not once buffered, so writing rows takes about
+//!         as long as reading rows of another object. This needs the write buffer drain patch of DRAMsim3
+bool testWriteDrain(const std::string& filePath)
+{
+#ifndef DRAMSIM3_WRITE_BUFFER_DRAIN
+  std::cout << "DRAMsim3 Write Drain SKIPPED without the write buffer drain patch" << std::endl;
+  return true;
+#endif
+  createDevice();
+  uint64_t numElements = 32 * 16;
+  std::vector<int32_t> src(numElements, 1);
+  std::vector<int32_t> dest(numElements);
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1);
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj1) == PIM_OK);
+  ok &= (pimCopyDeviceToHost(obj2, (void*)dest.data()) == PIM_OK);
+  std::vector<std::string> lines = exportStats(filePath);
+  pimFree(obj1);
+  pimFree(obj2);
+  pimDeleteDevice();
+  double msWrite = getValue(lines, "dramsim3,copy_h2d,msSimulated");
+  double msRead = getValue(lines, "dramsim3,copy_d2h,msSimulated");
+  ok &= (msRead > 0.0 && msWrite > 0.5 * msRead);
+  std::cout << "DRAMsim3 Write Drain " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  With a sample interval, every Nth command of each command type is simulated
+bool testSamplePerType(const std::string& filePath)
+{
+  createDevice(2);
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, 1024, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1);
+  for (int i = 0; i < 4; ++i) {
+    ok &= (pimAdd(obj1, obj2, obj2) == PIM_OK);
+    ok &= (pimSub(obj1, obj2, obj2) == PIM_OK);
+  }
+  std::vector<std::string> lines = exportStats(filePath);
+  pimFree(obj1);
+  pimFree(obj2);
+  pimDeleteDevice();
+  ok &= (getValue(lines, "dramsim3,add,count") == 4 && getValue(lines, "dramsim3,add,numSampled") == 2);
+  ok &= (getValue(lines, "dramsim3,sub,count") == 4 && getValue(lines, "dramsim3,sub,numSampled") == 2);
+  std::cout << "DRAMsim3 Sampling per Command Type " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: DRAMsim3 cycle-level timing" << std::endl;
+
+#ifdef DRAMSIM3_INTEG
+  std::string filePath = std::filesystem::temp_directory_path().string() + "/pimeval-test-dramsim3.csv";
+  bool ok = testCoresSharingBank(filePath);
+  ok &= testWriteDrain(filePath);
+  ok &= testSamplePerType(filePath);
+  std::filesystem::remove(filePath);
+#else
+  std::cout << "INFO: DRAMsim3 is not integrated. Build with make dramsim3_integ to run this test" << std::endl;
+  bool ok = true;
+#endif
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
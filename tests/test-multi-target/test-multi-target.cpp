@@ -0,0 +1,191 @@
+// Test: Test PIM multi-target perf evaluation
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+
+//! @brief  Run a few PIM APIs and check functional results
+bool testVecOps(uint64_t numElements)
+{
+  std::vector<int32_t> src1(numElements);
+  std::vector<int32_t> src2(numElements);
+  std::vector<int32_t> dest(numElements);
+  int64_t expectedSum = 0;
+  for (uint64_t i = 0; i < numElements; ++i) {
+    src1[i] = static_cast<int32_t>(i % 1000);
+    src2[i] = static_cast<int32_t>(i % 37) - 18;
+    expectedSum += src1[i] + src2[i];
+  }
+
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  PimObjId obj3 = pimAllocAssociated(obj1, PIM_INT32);
+  assert(obj1 != -1 && obj2 != -1 && obj3 != -1);
+  // reference is created on all targets with the same object ID
+  PimObjId objRef = pimCreateDualContactRef(obj3);
+  assert(objRef != -1);
+
+  PimStatus status = pimCopyHostToDevice((void*)src1.data(), obj1);
+  assert(status == PIM_OK);
+  status = pimCopyHostToDevice((void*)src2.data(), obj2);
+  assert(status == PIM_OK);
+  status = pimAdd(obj1, obj2, obj3);
+  assert(status == PIM_OK);
+  int64_t sum = 0;
+  status = pimRedSum(obj3, &sum);
+  assert(status == PIM_OK);
+  status = pimCopyDeviceToHost(obj3, (void*)dest.data());
+  assert(status == PIM_OK);
+
+  bool ok = (sum == expectedSum);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    if (dest[i] != src1[i] + src2[i]) {
+      std::printf("Error: add: %d + %d -> %d\n", src1[i], src2[i], dest[i]);
+      ok = false;
+      break;
+    }
+  }
+
+  pimFree(objRef);
+  pimFree(obj1);
+  pimFree(obj2);
+  pimFree(obj3);
+  return ok;
+}
+
+//! @brief  Export stats and get metrics of each simulation target. CSV rows of target stats are target,<index>,<metric>,<value>
+std::vector<std::vector<double>> getTargetStats(unsigned numTargets, const std::vector<std::string>& metrics)
+{
+  std::vector<std::vector<double>> targetStats(numTargets);
+  std::string filePath = std::filesystem::temp_directory_path().string() + "/pimeval-test-multi-target.csv";
+  if (pimExportStats(filePath.c_str(), PIM_STATS_CSV) != PIM_OK) {
+    return targetStats;
+  }
+  std::ifstream file(filePath);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.rfind("target,", 0) != 0) {
+      continue;
+    }
+    size_t pos1 = line.find(',', 7);
+    size_t pos2 = line.find(',', pos1 + 1);
+    unsigned idx = std::stoul(line.substr(7, pos1 - 7));
+    std::string metric = line.substr(pos1 + 1, pos2 - pos1 - 1);
+    for (const std::string& name : metrics) {
+      if (metric == name && idx < numTargets) {
+        targetStats[idx].push_back(std::stod(line.substr(pos2 + 1)));
+      }
+    }
+  }
+  file.close();
+  std::filesystem::remove(filePath);
+  return targetStats;
+}
+
+//! @brief  Check that exported stats have non-zero runtime and energy of commands and copies on each simulation target.
+//!         A functional primary device does not model perf
+bool checkTargetStats(unsigned numTargets, bool isPrimaryModeled)
+{
+  const std::vector<std::string> metrics = { "cmdMsRuntime", "cmdMjEnergy", "copyMsRuntime", "copyMjEnergy" };
+  std::vector<std::vector<double>> targetStats = getTargetStats(numTargets, metrics);
+
+  bool ok = true;
+  for (unsigned idx = 0; idx < numTargets; ++idx) {
+    if (targetStats[idx].size() != metrics.size()) {
+      std::printf("Error: Missing stats of target %u\n", idx);
+      ok = false;
+      continue;
+    }
+    for (size_t i = 0; i < metrics.size(); ++i) {
+      if (targetStats[idx][i] <= 0.0 && (idx > 0 || isPrimaryModeled)) {
+        std::printf("Error: Zero %s of target %u\n", metrics[i].c_str(), idx);
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+
+//! @brief  Check that only the primary device holds host data of PIM objects, as extra targets only model perf and energy
+bool testHostData(unsigned numTargets, uint64_t numElements)
+{
+  std::vector<int32_t> src(numElements, 1);
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  assert(obj1 != -1 && obj2 != -1);
+  PimStatus status = pimCopyHostToDevice((void*)src.data(), obj1);
+  assert(status == PIM_OK);
+  status = pimAdd(obj1, obj1, obj2);
+  assert(status == PIM_OK);
+  std::vector<std::vector<double>> targetStats = getTargetStats(numTargets, { "hostDataBytes" });
+  pimFree(obj1);
+  pimFree(obj2);
+
+  bool ok = true;
+  for (unsigned idx = 0; idx < numTargets; ++idx) {
+    if (targetStats[idx].size() != 1) {
+      std::printf("Error: Missing host data bytes of target %u\n", idx);
+      ok = false;
+      continue;
+    }
+    double minBytes = (idx == 0 ? static_cast<double>(numElements * sizeof(int32_t)) : 0.0);
+    double maxBytes = (idx == 0 ? static_cast<double>(2 * numElements * sizeof(int32_t)) : 0.0);
+    if (targetStats[idx][0] < minBytes || targetStats[idx][0] > maxBytes) {
+      std::printf("Error: Target %u holds %.0f bytes of host data\n", idx, targetStats[idx][0]);
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+//! @brief  Model a bit-serial device along with extra simulation targets
+bool testMultiTarget(PimDeviceEnum deviceType, const char* extraTargets, unsigned numExtraTargets)
+{
+  setenv("PIMEVAL_EXTRA_SIM_TARGETS", extraTargets, 1);
+  PimStatus status = pimCreateDevice(deviceType, 1, 4, 8, 1024, 8192);
+  assert(status == PIM_OK);
+
+  bool ok = testVecOps(64 * 1024);
+  ok &= checkTargetStats(numExtraTargets + 1, deviceType != PIM_FUNCTIONAL);
+  ok &= testHostData(numExtraTargets + 1, 64 * 1024);
+
+  pimShowStats();
+  pimResetStats();
+  pimDeleteDevice();
+  unsetenv("PIMEVAL_EXTRA_SIM_TARGETS");
+
+  std::cout << "Multi-Target Test with " << extraTargets << (ok ? " PASSED" : " FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: PIM multi-target perf evaluation" << std::endl;
+
+  bool ok = true;
+  ok &= testMultiTarget(PIM_DEVICE_BITSIMD_V, "PIM_DEVICE_FULCRUM,PIM_DEVICE_BANK_LEVEL,PIM_DEVICE_AQUABOLT", 3);
+  ok &= testMultiTarget(PIM_FUNCTIONAL, "PIM_DEVICE_BITSIMD_V, PIM_DEVICE_FULCRUM", 2);
+
+  // incorrect extra simulation target
+  setenv("PIMEVAL_EXTRA_SIM_TARGETS", "PIM_DEVICE_UNKNOWN", 1);
+  if (pimCreateDevice(PIM_DEVICE_BITSIMD_V, 1, 4, 8, 1024, 8192) == PIM_OK) {
+    std::printf("Error: Incorrect extra simulation target is not rejected\n");
+    pimDeleteDevice();
+    ok = false;
+  }
+  unsetenv("PIMEVAL_EXTRA_SIM_TARGETS");
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
@@ -0,0 +1,74 @@
+// Test: Test DRAM refresh modeling
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+
+
+//! @brief  Run repeated vector additions and return stats
+bool runVecAdd(uint64_t numElements, unsigned numIterations, PimStatsSummary& stats)
+{
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BANK_LEVEL, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  std::vector<int32_t> src(numElements, 1), dest(numElements);
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1);
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj1) == PIM_OK);
+  ok &= (pimBroadcastInt(obj2, 0) == PIM_OK);
+  pimResetStats();
+
+  pimStartTimer();
+  for (unsigned i = 0; ok && i < numIterations; ++i) {
+    ok &= (pimAdd(obj1, obj2, obj2) == PIM_OK);
+  }
+  pimEndTimer();
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+
+  ok &= (pimCopyDeviceToHost(obj2, (void*)dest.data()) == PIM_OK);
+  for (uint64_t i = 0; ok && i < numElements; ++i) {
+    ok = (dest[i] == static_cast<int32_t>(numIterations));
+  }
+  pimFree(obj1);
+  pimFree(obj2);
+  pimDeleteDevice();
+  return ok;
+}
+
+//! @brief  Long kernels are stalled by refreshes, while a short command is not
+bool testRefresh()
+{
+  PimStatsSummary statsShort, statsLong;
+  bool ok = runVecAdd(256, 1, statsShort);
+  ok &= runVecAdd(256 * 1024, 64, statsLong);
+  if (statsShort.refreshMsRuntime != 0.0 || statsShort.refreshMjEnergy != 0.0) {
+    std::printf("Error: Refresh %f ms %f mJ for a short command of %f ms\n",
+                statsShort.refreshMsRuntime, statsShort.refreshMjEnergy, statsShort.cmdMsRuntime);
+    ok = false;
+  }
+  // all-bank refresh takes a few percent of DRAM time
+  double ratio = statsLong.refreshMsRuntime / statsLong.cmdMsRuntime;
+  if (!(ratio > 0.01 && ratio < 0.1 && statsLong.refreshMjEnergy > 0.0)) {
+    std::printf("Error: Refresh %f ms %f mJ for commands of %f ms\n",
+                statsLong.refreshMsRuntime, statsLong.refreshMjEnergy, statsLong.cmdMsRuntime);
+    ok = false;
+  }
+  std::cout << "Refresh Stall " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: DRAM refresh modeling" << std::endl;
+
+  bool ok = testRefresh();
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
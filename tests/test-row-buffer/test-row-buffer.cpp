@@ -0,0 +1,97 @@
+// Test: Test row buffer policy of perf energy models
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+
+//! @brief  Run a gemv-like column update with either row buffer policy, and return command stats
+bool runColumnUpdate(PimDeviceEnum deviceType, uint64_t numElements, bool isOpenPage, bool isCopyBetween, PimStatsSummary& stats)
+{
+  if (isOpenPage) {
+    setenv("PIMEVAL_ROW_BUFFER_POLICY", "open", 1);
+  }
+  PimStatus status = pimCreateDevice(deviceType, 1, 4, 4, 1024, 8192);
+  unsetenv("PIMEVAL_ROW_BUFFER_POLICY");
+  assert(status == PIM_OK);
+
+  std::vector<int32_t> src(numElements), dest(numElements);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    src[i] = static_cast<int32_t>(i % 100);
+  }
+  PimObjId objSrc = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId objTmp = pimAllocAssociated(objSrc, PIM_INT32);
+  PimObjId objDest = pimAllocAssociated(objSrc, PIM_INT32);
+  bool ok = (objSrc != -1 && objTmp != -1 && objDest != -1);
+  ok &= (pimCopyHostToDevice((void*)src.data(), objSrc) == PIM_OK);
+  ok &= (pimBroadcastInt(objDest, 1) == PIM_OK);
+  pimResetStats();
+
+  // the add reads the rows of objTmp that are still open after the scalar multiplication
+  ok &= (pimMulScalar(objSrc, objTmp, 3) == PIM_OK);
+  if (isCopyBetween) {
+    ok &= (pimCopyHostToDevice((void*)src.data(), objSrc) == PIM_OK);
+  }
+  ok &= (pimAdd(objTmp, objDest, objDest) == PIM_OK);
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+
+  ok &= (pimCopyDeviceToHost(objDest, (void*)dest.data()) == PIM_OK);
+  for (uint64_t i = 0; ok && i < numElements; ++i) {
+    ok = (dest[i] == src[i] * 3 + 1);
+  }
+  pimFree(objSrc);
+  pimFree(objTmp);
+  pimFree(objDest);
+  pimDeleteDevice();
+  return ok;
+}
+
+//! @brief  Consecutive commands on the same rows save activations with open-page policy only
+bool testOpenPage(PimDeviceEnum deviceType, const std::string& name)
+{
+  // small objects take one region of each of their cores
+  PimStatsSummary statsClosed, statsOpen, statsOpenCopy;
+  bool ok = runColumnUpdate(deviceType, 256, false, false, statsClosed);
+  ok &= runColumnUpdate(deviceType, 256, true, false, statsOpen);
+  ok &= runColumnUpdate(deviceType, 256, true, true, statsOpenCopy);
+  if (!(statsOpen.cmdMsRuntime < statsClosed.cmdMsRuntime && statsOpen.cmdMjEnergy < statsClosed.cmdMjEnergy)) {
+    std::printf("Error: Open-page %f ms %f mJ, closed-page %f ms %f mJ\n", statsOpen.cmdMsRuntime,
+                statsOpen.cmdMjEnergy, statsClosed.cmdMsRuntime, statsClosed.cmdMjEnergy);
+    ok = false;
+  }
+  // data transfer between host and device closes all rows
+  if (statsOpenCopy.cmdMsRuntime != statsClosed.cmdMsRuntime) {
+    std::printf("Error: Open-page with copy %f ms, closed-page %f ms\n", statsOpenCopy.cmdMsRuntime, statsClosed.cmdMsRuntime);
+    ok = false;
+  }
+  // with multiple regions per core, the last region accessed is not the first region read next
+  PimStatsSummary statsClosedLarge, statsOpenLarge;
+  ok &= runColumnUpdate(deviceType, 64 * 1024, false, false, statsClosedLarge);
+  ok &= runColumnUpdate(deviceType, 64 * 1024, true, false, statsOpenLarge);
+  if (statsOpenLarge.cmdMsRuntime != statsClosedLarge.cmdMsRuntime) {
+    std::printf("Error: Open-page with multiple passes %f ms, closed-page %f ms\n", statsOpenLarge.cmdMsRuntime, statsClosedLarge.cmdMsRuntime);
+    ok = false;
+  }
+  std::cout << name << " Row Buffer Policy " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Row buffer policy of perf energy models" << std::endl;
+
+  bool ok = true;
+  ok &= testOpenPage(PIM_DEVICE_BANK_LEVEL, "Bank-Level");
+  ok &= testOpenPage(PIM_DEVICE_FULCRUM, "Fulcrum");
+  ok &= testOpenPage(PIM_DEVICE_AQUABOLT, "Aquabolt");
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
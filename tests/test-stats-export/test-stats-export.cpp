@@ -0,0 +1,154 @@
+// Test: Test exporting stats to JSON and CSV files
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <filesystem>
+
+
+//! @brief  Run a vector addition within a kernel timer
+bool runVecAdd(uint64_t numElements)
+{
+  std::vector<int32_t> src(numElements, 1), dest(numElements);
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1);
+  pimStartTimer();
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj1) == PIM_OK);
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj2) == PIM_OK);
+  ok &= (pimAdd(obj1, obj2, obj2) == PIM_OK);
+  ok &= (pimAdd(obj1, obj2, obj2) == PIM_OK);
+  ok &= (pimCopyDeviceToHost(obj2, (void*)dest.data()) == PIM_OK);
+  pimEndTimer();
+  pimFree(obj1);
+  pimFree(obj2);
+  return ok;
+}
+
+//! @brief  Read all lines of a file
+std::vector<std::string> readLines(const std::string& filePath)
+{
+  std::vector<std::string> lines;
+  std::ifstream file(filePath);
+  std::string line;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+//! @brief  Find the value of a metric in CSV stats
+bool findCsvValue(const std::vector<std::string>& lines, const std::string& key, std::string& val)
+{
+  for (const std::string& line : lines) {
+    if (line.rfind(key + ",", 0) == 0) {
+      val = line.substr(key.size() + 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+//! @brief  CSV stats have one row per metric, consistent with the stats summary
+bool testCsv(const std::string& filePath)
+{
+  PimStatsSummary summary;
+  bool ok = (pimGetStatsSummary(&summary) == PIM_OK);
+  ok &= (pimExportStats(filePath.c_str(), PIM_STATS_CSV) == PIM_OK);
+  std::vector<std::string> lines = readLines(filePath);
+  ok &= (!lines.empty() && lines[0] == "section,name,metric,value");
+
+  std::string val;
+  ok &= (findCsvValue(lines, "cmd,add.int32.h,count", val) && val == "2");
+  ok &= (findCsvValue(lines, "copy,hostToDevice,numBytes", val) && val == "16384");
+  ok &= (findCsvValue(lines, "device,,simTarget", val) && val == "PIM_DEVICE_BANK_LEVEL");
+  ok &= (findCsvValue(lines, "summary,,numCmds", val) && std::stoull(val) == summary.numCmds);
+  ok &= (findCsvValue(lines, "summary,,cmdMsRuntime", val) && std::abs(std::stod(val) - summary.cmdMsRuntime) <= 1e-6 * summary.cmdMsRuntime);
+  ok &= (findCsvValue(lines, "kernel,0,msPim", val) && std::stod(val) > 0.0);
+  // R/W/compute splits add up to the runtime of a command
+  std::string msRuntime, msRead, msWrite, msCompute;
+  ok &= findCsvValue(lines, "cmd,add.int32.h,msRuntime", msRuntime);
+  ok &= findCsvValue(lines, "cmd,add.int32.h,msRead", msRead);
+  ok &= findCsvValue(lines, "cmd,add.int32.h,msWrite", msWrite);
+  ok &= findCsvValue(lines, "cmd,add.int32.h,msCompute", msCompute);
+  if (ok) {
+    double msTotal = std::stod(msRead) + std::stod(msWrite) + std::stod(msCompute);
+    ok &= (std::abs(msTotal - std::stod(msRuntime)) <= 1e-6 * std::stod(msRuntime));
+  }
+  ok &= (findCsvValue(lines, "cmd,add.int32.h,totalOps", val) && std::stoull(val) > 0);
+  std::cout << "CSV Stats Export " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  JSON stats have a section object for each kind of stats
+bool testJson(const std::string& filePath)
+{
+  bool ok = (pimExportStats(filePath.c_str()) == PIM_OK);
+  std::ifstream file(filePath);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  std::string json = ss.str();
+  for (const char* key : { "\"device\": {", "\"api\": {", "\"copy\": {", "\"cmd\": {", "\"summary\": {", "\"kernel\": {",
+                           "\"add.int32.h\": {", "\"simTarget\": \"PIM_DEVICE_BANK_LEVEL\"", "\"count\": 2" }) {
+    if (json.find(key) == std::string::npos) {
+      std::printf("Error: Missing %s in JSON stats\n", key);
+      ok = false;
+    }
+  }
+  ok &= (json.front() == '{' && json.find_last_of('}') == json.size() - 2);
+  // invalid file path
+  ok &= (pimExportStats("/nonexistent-dir/stats.json") == PIM_ERROR);
+  std::cout << "JSON Stats Export " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Stats are exported at device deletion with env var PIMEVAL_STATS_OUT
+bool testEnvVar(const std::string& filePath)
+{
+  std::filesystem::remove(filePath);
+  setenv("PIMEVAL_STATS_OUT", filePath.c_str(), 1);
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BANK_LEVEL, 1, 4, 4, 1024, 8192);
+  unsetenv("PIMEVAL_STATS_OUT");
+  assert(status == PIM_OK);
+  bool ok = runVecAdd(1024);
+  pimDeleteDevice();
+  std::vector<std::string> lines = readLines(filePath);
+  std::string val;
+  ok &= (!lines.empty() && lines[0] == "section,name,metric,value");
+  ok &= (findCsvValue(lines, "cmd,add.int32.h,count", val) && val == "2");
+  std::cout << "Stats Export at Device Deletion " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Stats export" << std::endl;
+
+  std::string tempDir = std::filesystem::temp_directory_path().string();
+  std::string csvFile = tempDir + "/pimeval-test-stats-export.csv";
+  std::string jsonFile = tempDir + "/pimeval-test-stats-export.json";
+
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BANK_LEVEL, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  bool ok = runVecAdd(2048);
+  ok &= testCsv(csvFile);
+  ok &= testJson(jsonFile);
+  pimDeleteDevice();
+  ok &= testEnvVar(csvFile);
+
+  std::filesystem::remove(csvFile);
+  std::filesystem::remove(jsonFile);
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
@@ -0,0 +1,182 @@
+// Test: Test async API calls with PIM streams and events
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+
+
+//! @brief  Vector add in tiles. Double buffer tiles on two streams if requested, or run all APIs synchronously
+bool runTiledVecAdd(bool useStreams, uint64_t numTiles, uint64_t tileSize, PimStatsSummary& stats)
+{
+  PimStatus status = pimCreateDevice(PIM_DEVICE_FULCRUM, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  std::vector<int32_t> src1(numTiles * tileSize);
+  std::vector<int32_t> src2(numTiles * tileSize);
+  std::vector<int32_t> dest(numTiles * tileSize);
+  for (uint64_t i = 0; i < src1.size(); ++i) {
+    src1[i] = static_cast<int32_t>(i);
+    src2[i] = static_cast<int32_t>(i % 17) * 3;
+  }
+
+  // one set of tile buffers per stream
+  const unsigned numStreams = 2;
+  std::vector<PimStreamId> streams(numStreams, -1);
+  std::vector<PimObjId> obj1(numStreams), obj2(numStreams);
+  bool ok = true;
+  for (unsigned s = 0; s < numStreams; ++s) {
+    obj1[s] = pimAlloc(PIM_ALLOC_AUTO, tileSize, PIM_INT32);
+    obj2[s] = pimAllocAssociated(obj1[s], PIM_INT32);
+    ok &= (obj1[s] != -1 && obj2[s] != -1);
+    if (useStreams) {
+      streams[s] = pimCreateStream();
+      ok &= (streams[s] != -1);
+    }
+  }
+  PimEventId start = pimCreateEvent();
+  PimEventId end = pimCreateEvent();
+  ok &= (start != -1 && end != -1);
+  if (useStreams) {
+    ok &= (pimRecordEvent(start, streams[0]) == PIM_OK);
+    ok &= (pimStreamWaitEvent(streams[1], start) == PIM_OK);
+  }
+
+  for (uint64_t tile = 0; ok && tile < numTiles; ++tile) {
+    unsigned s = tile % numStreams;
+    uint64_t ofst = tile * tileSize;
+    if (useStreams) {
+      PimProg prog;
+      prog.add(pimAdd, obj1[s], obj2[s], obj1[s]);
+      ok &= (pimCopyHostToDeviceAsync((void*)(src1.data() + ofst), obj1[s], streams[s]) == PIM_OK);
+      ok &= (pimCopyHostToDeviceAsync((void*)(src2.data() + ofst), obj2[s], streams[s]) == PIM_OK);
+      ok &= (pimLaunchAsync(prog, streams[s]) == PIM_OK);
+      ok &= (pimCopyDeviceToHostAsync(obj1[s], (void*)(dest.data() + ofst), streams[s]) == PIM_OK);
+    } else {
+      ok &= (pimCopyHostToDevice((void*)(src1.data() + ofst), obj1[s]) == PIM_OK);
+      ok &= (pimCopyHostToDevice((void*)(src2.data() + ofst), obj2[s]) == PIM_OK);
+      ok &= (pimAdd(obj1[s], obj2[s], obj1[s]) == PIM_OK);
+      ok &= (pimCopyDeviceToHost(obj1[s], (void*)(dest.data() + ofst)) == PIM_OK);
+    }
+  }
+
+  if (useStreams) {
+    // join both streams into the end event
+    PimEventId done = pimCreateEvent();
+    ok &= (pimRecordEvent(done, streams[1]) == PIM_OK);
+    ok &= (pimStreamWaitEvent(streams[0], done) == PIM_OK);
+    ok &= (pimRecordEvent(end, streams[0]) == PIM_OK);
+    ok &= (pimEventSynchronize(end) == PIM_OK);
+    ok &= (pimDeviceSynchronize() == PIM_OK);
+    double msOverlapped = 0.0;
+    ok &= (pimGetEventElapsedTime(start, end, &msOverlapped) == PIM_OK);
+    ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+    // copies of one stream overlap with computation of the other
+    double msSerialized = stats.copyMsRuntime + stats.cmdMsRuntime;
+    if (!(msOverlapped > 0.0 && msOverlapped < msSerialized)) {
+      std::printf("Error: Overlapped runtime %f ms, serialized runtime %f ms\n", msOverlapped, msSerialized);
+      ok = false;
+    }
+    pimDeleteEvent(done);
+    for (unsigned s = 0; s < numStreams; ++s) {
+      ok &= (pimDeleteStream(streams[s]) == PIM_OK);
+    }
+  } else {
+    ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+  }
+  pimShowStats();
+
+  for (uint64_t i = 0; ok && i < dest.size(); ++i) {
+    ok = (dest[i] == src1[i] + src2[i]);
+  }
+  pimDeleteEvent(start);
+  pimDeleteEvent(end);
+  for (unsigned s = 0; s < numStreams; ++s) {
+    pimFree(obj1[s]);
+    pimFree(obj2[s]);
+  }
+  pimDeleteDevice();
+  return ok;
+}
+
+//! @brief  Double buffering with streams computes the same results and stats as synchronous APIs
+bool testDoubleBuffering()
+{
+  PimStatsSummary refStats, stats;
+  bool ok = runTiledVecAdd(false, 16, 64 * 1024, refStats);
+  ok &= runTiledVecAdd(true, 16, 64 * 1024, stats);
+  ok &= (stats.numCmds == refStats.numCmds && stats.numBytesCopied == refStats.numBytesCopied);
+  std::cout << "Double Buffering with Streams " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Async API calls on one stream wait for an event on another stream, and errors are reported at synchronization
+bool testEventsAndErrors()
+{
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BITSIMD_V, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  uint64_t numElements = 4096;
+  std::vector<int32_t> src(numElements);
+  std::vector<int32_t> dest(numElements);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    src[i] = static_cast<int32_t>(i) - 1000;
+  }
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  PimStreamId producer = pimCreateStream();
+  PimStreamId consumer = pimCreateStream();
+  PimEventId ready = pimCreateEvent();
+  bool ok = (obj1 != -1 && obj2 != -1 && producer != -1 && consumer != -1 && ready != -1);
+
+  // the consumer is issued first, but waits for data from the producer
+  ok &= (pimStreamWaitEvent(consumer, ready) == PIM_OK);
+  PimProg prog;
+  prog.add(pimMulScalar, obj1, obj2, static_cast<uint64_t>(3));
+  prog.add(pimAbs, obj2, obj2);
+  ok &= (pimRecordEvent(ready, producer) == PIM_OK);
+  ok &= (pimCopyHostToDeviceAsync((void*)src.data(), obj1, producer) == PIM_OK);
+  // re-record after the copy, as the consumer waits for the most recent record at the time of the wait
+  ok &= (pimRecordEvent(ready, producer) == PIM_OK);
+  ok &= (pimStreamWaitEvent(consumer, ready) == PIM_OK);
+  ok &= (pimLaunchAsync(prog, consumer) == PIM_OK);
+  ok &= (pimCopyDeviceToHostAsync(obj2, (void*)dest.data(), consumer) == PIM_OK);
+  ok &= (pimStreamSynchronize(consumer) == PIM_OK);
+  for (uint64_t i = 0; ok && i < numElements; ++i) {
+    ok = (dest[i] == (src[i] * 3 < 0 ? -src[i] * 3 : src[i] * 3));
+  }
+
+  // invalid stream and event IDs are rejected when issued
+  ok &= (pimCopyHostToDeviceAsync((void*)src.data(), obj1, 12345) == PIM_ERROR);
+  ok &= (pimRecordEvent(12345, producer) == PIM_ERROR);
+  // failed async API calls are reported once by the next synchronization
+  ok &= (pimCopyHostToDeviceAsync(nullptr, obj1, producer) == PIM_OK);
+  ok &= (pimStreamSynchronize(producer) == PIM_ERROR);
+  ok &= (pimStreamSynchronize(producer) == PIM_OK);
+
+  ok &= (pimDeleteEvent(ready) == PIM_OK);
+  ok &= (pimDeleteStream(producer) == PIM_OK);
+  ok &= (pimDeleteStream(consumer) == PIM_OK);
+  ok &= (pimDeleteStream(consumer) == PIM_ERROR);
+  pimFree(obj1);
+  pimFree(obj2);
+  pimDeleteDevice();
+
+  std::cout << "Stream Events and Errors " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Async API calls with PIM streams and events" << std::endl;
+
+  bool ok = true;
+  ok &= testDoubleBuffering();
+  ok &= testEventsAndErrors();
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
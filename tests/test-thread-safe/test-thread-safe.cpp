@@ -0,0 +1,119 @@
+// Test: Test concurrent API calls from multiple host threads
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+
+
+//! @brief  Allocate private objects, run a few commands on them, and check results. Repeat for a number of iterations
+bool runWorker(unsigned workerId, uint64_t numElements, unsigned numIterations)
+{
+  std::vector<int32_t> src1(numElements);
+  std::vector<int32_t> src2(numElements);
+  std::vector<int32_t> dest(numElements);
+  bool ok = true;
+  for (unsigned iter = 0; ok && iter < numIterations; ++iter) {
+    int32_t scale = static_cast<int32_t>(workerId * numIterations + iter + 1);
+    int64_t expectedSum = 0;
+    for (uint64_t i = 0; i < numElements; ++i) {
+      src1[i] = static_cast<int32_t>(i % 1000) * scale;
+      src2[i] = static_cast<int32_t>(i % 7);
+      expectedSum += src1[i] + src2[i];
+    }
+    PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+    PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+    PimObjId obj3 = pimAllocAssociated(obj1, PIM_INT32);
+    ok = (obj1 != -1 && obj2 != -1 && obj3 != -1);
+    ok = ok && (pimCopyHostToDevice((void*)src1.data(), obj1) == PIM_OK);
+    ok = ok && (pimCopyHostToDevice((void*)src2.data(), obj2) == PIM_OK);
+    ok = ok && (pimAdd(obj1, obj2, obj3) == PIM_OK);
+    int64_t sum = 0;
+    ok = ok && (pimRedSum(obj3, &sum) == PIM_OK);
+    ok = ok && (pimCopyObjectToObject(obj3, obj1) == PIM_OK);
+    ok = ok && (pimCopyDeviceToHost(obj1, (void*)dest.data()) == PIM_OK);
+    for (uint64_t i = 0; ok && i < numElements; ++i) {
+      ok = (dest[i] == src1[i] + src2[i]);
+    }
+    ok = ok && (sum == expectedSum);
+    pimFree(obj1);
+    pimFree(obj2);
+    pimFree(obj3);
+  }
+  return ok;
+}
+
+//! @brief  Run the same work sequentially and from concurrent host threads on one device, and compare stats
+bool testConcurrentThreads(PimDeviceEnum deviceType, const char* name)
+{
+  const unsigned numWorkers = 8;
+  const unsigned numIterations = 10;
+  const uint64_t numElements = 16 * 1024;
+
+  PimStatus status = pimCreateDevice(deviceType, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  bool ok = true;
+  for (unsigned i = 0; i < numWorkers; ++i) {
+    ok &= runWorker(i, numElements, numIterations);
+  }
+  PimStatsSummary refStats;
+  ok &= (pimGetStatsSummary(&refStats) == PIM_OK);
+  pimDeleteDevice();
+
+  status = pimCreateDevice(deviceType, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+
+  std::vector<int> results(numWorkers, 0);
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < numWorkers; ++i) {
+    threads.emplace_back([&, i]() {
+      results[i] = runWorker(i, numElements, numIterations) ? 1 : 0;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (unsigned i = 0; i < numWorkers; ++i) {
+    ok &= (results[i] == 1);
+  }
+
+  // stats from all threads are accumulated, so the totals match the sequential run
+  PimStatsSummary stats;
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+  auto isClose = [](double a, double b) { return std::fabs(a - b) <= 1e-9 * std::fmax(1.0, std::fabs(b)); };
+  if (stats.numCmds != refStats.numCmds || stats.numBytesCopied != refStats.numBytesCopied
+      || !isClose(stats.cmdMsRuntime, refStats.cmdMsRuntime) || !isClose(stats.copyMsRuntime, refStats.copyMsRuntime)) {
+    std::printf("Error: Concurrent stats %llu cmds %llu bytes, expected %llu cmds %llu bytes\n",
+                (unsigned long long)stats.numCmds, (unsigned long long)stats.numBytesCopied,
+                (unsigned long long)refStats.numCmds, (unsigned long long)refStats.numBytesCopied);
+    ok = false;
+  }
+  pimDeleteDevice();
+
+  std::cout << "Concurrent Threads on " << name << " " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Concurrent API calls from multiple host threads" << std::endl;
+
+  // let concurrent API calls share the simulator thread pool
+  setenv("PIMEVAL_MAX_NUM_THREADS", "4", 0);
+
+  bool ok = true;
+  ok &= testConcurrentThreads(PIM_DEVICE_BITSIMD_V, "BITSIMD_V");
+  ok &= testConcurrentThreads(PIM_DEVICE_FULCRUM, "FULCRUM");
+  ok &= testConcurrentThreads(PIM_DEVICE_BANK_LEVEL, "BANK_LEVEL");
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
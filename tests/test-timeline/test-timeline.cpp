@@ -0,0 +1,159 @@
+// Test: Test modeled timeline of data copy and PIM commands
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+
+
+//! @brief  Vector add in tiles, with tiles alternating between numBuffers sets of PIM objects
+bool runTiledVecAdd(unsigned numBuffers, uint64_t numTiles, uint64_t tileSize, PimStatsSummary& stats)
+{
+  PimStatus status = pimCreateDevice(PIM_DEVICE_FULCRUM, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  std::vector<int32_t> src1(numTiles * tileSize);
+  std::vector<int32_t> src2(numTiles * tileSize);
+  std::vector<int32_t> dest(numTiles * tileSize);
+  for (uint64_t i = 0; i < src1.size(); ++i) {
+    src1[i] = static_cast<int32_t>(i);
+    src2[i] = static_cast<int32_t>(i % 13) * 5;
+  }
+  std::vector<PimObjId> obj1(numBuffers), obj2(numBuffers);
+  bool ok = true;
+  for (unsigned b = 0; b < numBuffers; ++b) {
+    obj1[b] = pimAlloc(PIM_ALLOC_AUTO, tileSize, PIM_INT32);
+    obj2[b] = pimAllocAssociated(obj1[b], PIM_INT32);
+    ok &= (obj1[b] != -1 && obj2[b] != -1);
+  }
+
+  // with two or more buffers, copy the next tile to device before computing the current tile
+  auto copyIn = [&](uint64_t tile) {
+    unsigned b = tile % numBuffers;
+    uint64_t ofst = tile * tileSize;
+    ok &= (pimCopyHostToDevice((void*)(src1.data() + ofst), obj1[b]) == PIM_OK);
+    ok &= (pimCopyHostToDevice((void*)(src2.data() + ofst), obj2[b]) == PIM_OK);
+  };
+  bool isPrefetch = (numBuffers > 1);
+  pimStartTimer();
+  if (isPrefetch) {
+    copyIn(0);
+  }
+  for (uint64_t tile = 0; ok && tile < numTiles; ++tile) {
+    unsigned b = tile % numBuffers;
+    uint64_t ofst = tile * tileSize;
+    if (!isPrefetch) {
+      copyIn(tile);
+    } else if (tile + 1 < numTiles) {
+      copyIn(tile + 1);
+    }
+    ok &= (pimAdd(obj1[b], obj2[b], obj1[b]) == PIM_OK);
+    ok &= (pimCopyDeviceToHost(obj1[b], (void*)(dest.data() + ofst)) == PIM_OK);
+  }
+  pimEndTimer();
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+
+  for (uint64_t i = 0; ok && i < dest.size(); ++i) {
+    ok = (dest[i] == src1[i] + src2[i]);
+  }
+  for (unsigned b = 0; b < numBuffers; ++b) {
+    pimFree(obj1[b]);
+    pimFree(obj2[b]);
+  }
+  pimDeleteDevice();
+  return ok;
+}
+
+//! @brief  Copies of a tile overlap with computation of another tile in a different buffer
+bool testDoubleBuffering()
+{
+  PimStatsSummary stats;
+  bool ok = runTiledVecAdd(2, 16, 64 * 1024, stats);
+  double msSerialized = stats.copyMsRuntime + stats.cmdMsRuntime;
+  double msLowerBound = std::max(stats.copyMsRuntime, stats.cmdMsRuntime);
+  if (!(stats.criticalPathMsRuntime < msSerialized && stats.criticalPathMsRuntime >= msLowerBound)) {
+    std::printf("Error: Critical path %f ms, serialized %f ms, lower bound %f ms\n",
+                stats.criticalPathMsRuntime, msSerialized, msLowerBound);
+    ok = false;
+  }
+  std::cout << "Double Buffering Timeline " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Reusing the same buffer serializes all copies and commands through data dependencies.
+//!         Copying the next tile to device after copying the previous tile back also turns the bus around
+bool testSingleBuffering()
+{
+  PimStatsSummary stats;
+  bool ok = runTiledVecAdd(1, 2, 64 * 1024, stats);
+  double msTurnaround = stats.criticalPathMsRuntime - (stats.copyMsRuntime + stats.cmdMsRuntime);
+  ok &= runTiledVecAdd(1, 16, 64 * 1024, stats);
+  double msSerialized = stats.copyMsRuntime + stats.cmdMsRuntime + 15 * msTurnaround;
+  if (!(msTurnaround > 0.0) || std::fabs(stats.criticalPathMsRuntime - msSerialized) > 1e-9 * msSerialized) {
+    std::printf("Error: Critical path %f ms, serialized %f ms with bus turnaround %f ms\n",
+                stats.criticalPathMsRuntime, msSerialized, msTurnaround);
+    ok = false;
+  }
+  // stats reset starts a new critical path
+  pimCreateDevice(PIM_DEVICE_FULCRUM, 1, 4, 4, 1024, 8192);
+  PimObjId obj = pimAlloc(PIM_ALLOC_AUTO, 1024, PIM_INT32);
+  ok &= (obj != -1 && pimBroadcastInt(obj, 1) == PIM_OK);
+  pimResetStats();
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK && stats.criticalPathMsRuntime == 0.0);
+  pimFree(obj);
+  pimDeleteDevice();
+  std::cout << "Single Buffering Timeline " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Commands on small objects placed on different cores overlap, while commands on the same object do not
+bool testDisjointCores()
+{
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BITSIMD_V, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  // each object fits in one core, and allocation prefers least used cores
+  uint64_t numElements = 8192;
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1);
+  ok &= (pimBroadcastInt(obj1, 3) == PIM_OK && pimBroadcastInt(obj2, 5) == PIM_OK);
+  pimResetStats();
+
+  PimStatsSummary stats;
+  ok &= (pimAdd(obj1, obj1, obj1) == PIM_OK);
+  ok &= (pimAdd(obj2, obj2, obj2) == PIM_OK);
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+  if (std::fabs(stats.cmdMsMakespan * 2 - stats.cmdMsRuntime) > 1e-9 * stats.cmdMsRuntime) {
+    std::printf("Error: Makespan %f ms, serialized %f ms on disjoint cores\n", stats.cmdMsMakespan, stats.cmdMsRuntime);
+    ok = false;
+  }
+  ok &= (pimMul(obj1, obj1, obj1) == PIM_OK);
+  ok &= (pimAdd(obj1, obj1, obj1) == PIM_OK);
+  ok &= (pimGetStatsSummary(&stats) == PIM_OK);
+  ok &= (stats.cmdMsMakespan > 0.5 * stats.cmdMsRuntime && stats.cmdMsMakespan < stats.cmdMsRuntime);
+  pimShowStats();
+
+  pimFree(obj1);
+  pimFree(obj2);
+  pimDeleteDevice();
+  std::cout << "Disjoint Cores Makespan " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Modeled timeline of data copy and PIM commands" << std::endl;
+
+  bool ok = true;
+  ok &= testDoubleBuffering();
+  ok &= testSingleBuffering();
+  ok &= testDisjointCores();
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
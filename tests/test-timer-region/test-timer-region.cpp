@@ -0,0 +1,172 @@
+// Test: Test named and nested kernel timer regions
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+#include <filesystem>
+
+
+//! @brief  Read CSV stats of named kernel timer regions as "name,metric" to value
+bool getRegionStats(const std::string& filePath, std::vector<std::pair<std::string, std::string>>& regionStats)
+{
+  if (pimExportStats(filePath.c_str(), PIM_STATS_CSV) != PIM_OK) {
+    return false;
+  }
+  std::ifstream file(filePath);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.rfind("region,", 0) == 0) {
+      size_t pos = line.find_last_of(',');
+      regionStats.emplace_back(line.substr(7, pos - 7), line.substr(pos + 1));
+    }
+  }
+  return true;
+}
+
+//! @brief  Get the value of a region metric, or NaN if not found
+double getValue(const std::vector<std::pair<std::string, std::string>>& regionStats, const std::string& key)
+{
+  for (const auto& [name, val] : regionStats) {
+    if (name == key) {
+      return std::stod(val);
+    }
+  }
+  std::printf("Error: Missing region stats %s\n", key.c_str());
+  return std::nan("");
+}
+
+//! @brief  Check if two values are equal within a relative tolerance
+bool isClose(double a, double b)
+{
+  return std::abs(a - b) <= 1e-6 * std::max(std::abs(a), std::abs(b));
+}
+
+//! @brief  Nested regions accumulate runtime, energy and command mix per tag path over all of their runs
+bool testNestedRegions(const std::string& filePath)
+{
+  uint64_t numElements = 4096;
+  std::vector<int32_t> src(numElements, 1), dest(numElements);
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  bool ok = (obj1 != -1 && obj2 != -1);
+
+  pimStartTimer("model");
+  ok &= (pimCopyHostToDevice((void*)src.data(), obj1) == PIM_OK);
+  for (int layer = 0; layer < 2; ++layer) {
+    pimStartTimer("conv");
+    ok &= (pimAdd(obj1, obj1, obj2) == PIM_OK);
+    ok &= (pimMul(obj1, obj2, obj2) == PIM_OK);
+    pimEndTimer();
+    pimStartTimer("relu");
+    ok &= (pimMaxScalar(obj2, obj2, 0) == PIM_OK);
+    pimEndTimer();
+  }
+  ok &= (pimCopyDeviceToHost(obj2, (void*)dest.data()) == PIM_OK);
+  pimEndTimer();
+  pimFree(obj1);
+  pimFree(obj2);
+
+  std::vector<std::pair<std::string, std::string>> stats;
+  ok &= getRegionStats(filePath, stats);
+  ok &= (getValue(stats, "model,count") == 1 && getValue(stats, "model/conv,count") == 2 && getValue(stats, "model/relu,count") == 2);
+  ok &= (getValue(stats, "model,depth") == 0 && getValue(stats, "model/conv,depth") == 1);
+  ok &= (getValue(stats, "model/conv,cmd.add.int32.h.count") == 2 && getValue(stats, "model/conv,cmd.mul.int32.h.count") == 2);
+  ok &= (getValue(stats, "model/relu,cmd.max_scalar.int32.h.count") == 2 && getValue(stats, "model/relu,numCmds") == 2);
+  ok &= (getValue(stats, "model,numCmds") == 6);
+  // an outer region includes its nested regions and data copies in between
+  double msPimConv = getValue(stats, "model/conv,msPim");
+  double msPimRelu = getValue(stats, "model/relu,msPim");
+  double msPimModel = getValue(stats, "model,msPim");
+  ok &= (msPimConv > 0.0 && msPimRelu > 0.0 && msPimModel > msPimConv + msPimRelu);
+  ok &= isClose(getValue(stats, "model/conv,mjEnergy"),
+                getValue(stats, "model/conv,cmd.add.int32.h.mjEnergy") + getValue(stats, "model/conv,cmd.mul.int32.h.mjEnergy"));
+  ok &= (getValue(stats, "model,mjEnergy") > getValue(stats, "model/conv,mjEnergy") + getValue(stats, "model/relu,mjEnergy"));
+  std::cout << "Nested Timer Regions " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Named regions within an anonymous kernel timer are at the top of the tree, and stats reset clears regions
+bool testAnonymousKernel(const std::string& filePath)
+{
+  pimResetStats();
+  uint64_t numElements = 1024;
+  PimObjId obj = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  bool ok = (obj != -1);
+  pimStartTimer();
+  pimStartTimer("round");
+  ok &= (pimAddScalar(obj, obj, 1) == PIM_OK);
+  pimEndTimer();
+  pimEndTimer();
+  // ending a timer that has not started is a no-op
+  pimEndTimer();
+  pimFree(obj);
+
+  std::vector<std::pair<std::string, std::string>> stats;
+  ok &= getRegionStats(filePath, stats);
+  ok &= (getValue(stats, "round,count") == 1 && getValue(stats, "round,depth") == 0);
+  ok &= (getValue(stats, "round,cmd.add_scalar.int32.h.count") == 1);
+  for (const auto& [name, val] : stats) {
+    ok &= (name.rfind("model", 0) != 0);
+  }
+  std::cout << "Timer Regions in Anonymous Kernel " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Regions are reported as a tree, with nested regions under their parent in order of first start
+bool testTreeOrder(const std::string& filePath)
+{
+  pimResetStats();
+  uint64_t numElements = 1024;
+  PimObjId obj = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  bool ok = (obj != -1);
+  const std::vector<std::pair<std::string, std::string>> runs = { {"A", "x"}, {"B", "y"}, {"A", "z"} };
+  for (const auto& [outer, inner] : runs) {
+    pimStartTimer(outer.c_str());
+    pimStartTimer(inner.c_str());
+    ok &= (pimAddScalar(obj, obj, 1) == PIM_OK);
+    pimEndTimer();
+    pimEndTimer();
+  }
+  pimFree(obj);
+
+  std::vector<std::pair<std::string, std::string>> stats;
+  ok &= getRegionStats(filePath, stats);
+  std::vector<std::string> paths;
+  for (const auto& [name, val] : stats) {
+    if (name.size() > 6 && name.compare(name.size() - 6, 6, ",count") == 0) {
+      paths.push_back(name.substr(0, name.size() - 6));
+    }
+  }
+  ok &= (paths == std::vector<std::string>{ "A", "A/x", "A/z", "B", "B/y" });
+  ok &= (getValue(stats, "A,count") == 2 && getValue(stats, "A/z,count") == 1 && getValue(stats, "A/z,depth") == 1);
+  pimShowStats();
+  std::cout << "Timer Region Tree Order " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: Named kernel timer regions" << std::endl;
+
+  std::string filePath = std::filesystem::temp_directory_path().string() + "/pimeval-test-timer-region.csv";
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BANK_LEVEL, 1, 4, 4, 1024, 8192);
+  assert(status == PIM_OK);
+  bool ok = testNestedRegions(filePath);
+  pimShowStats();
+  ok &= testAnonymousKernel(filePath);
+  ok &= testTreeOrder(filePath);
+  pimDeleteDevice();
+
+  std::filesystem::remove(filePath);
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
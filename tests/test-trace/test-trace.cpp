@@ -0,0 +1,154 @@
+// Test: Test PIM API trace recording and replay
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+
+//! @brief  Run a small workload on a BitSIMD-V device while recording a trace. Keep the device if requested
+void recordWorkload(const char* traceFile, bool keepDevice, unsigned& numR, unsigned& numW, unsigned& numL)
+{
+  setenv("PIMEVAL_TRACE_OUT", traceFile, 1);
+  setenv("PIMEVAL_TRACE_PAYLOAD", "1", 1);
+
+  uint64_t numElements = 4096;
+  PimStatus status = pimCreateDevice(PIM_DEVICE_BITSIMD_V, 1, 1, 4, 1024, 8192);
+  assert(status == PIM_OK);
+
+  std::vector<int32_t> src(numElements);
+  std::vector<int32_t> dest(numElements);
+  for (uint64_t i = 0; i < numElements; ++i) {
+    src[i] = static_cast<int32_t>(i);
+  }
+  PimObjId obj1 = pimAlloc(PIM_ALLOC_AUTO, numElements, PIM_INT32);
+  PimObjId obj2 = pimAllocAssociated(obj1, PIM_INT32);
+  PimObjId obj3 = pimAllocAssociated(obj1, PIM_INT32);
+  assert(obj1 != -1 && obj2 != -1 && obj3 != -1);
+
+  status = pimCopyHostToDevice((void*)src.data(), obj1);
+  assert(status == PIM_OK);
+  status = pimCopyHostToDevice((void*)src.data(), obj2, 0, numElements / 2);
+  assert(status == PIM_OK);
+  status = pimAdd(obj1, obj2, obj3);
+  assert(status == PIM_OK);
+  status = pimMulScalar(obj3, obj3, 3);
+  assert(status == PIM_OK);
+  status = pimBroadcastFP(obj2, 1.5f);
+  assert(status == PIM_OK);
+  int64_t sum = 0;
+  status = pimRedSum(obj3, &sum);
+  assert(status == PIM_OK);
+  status = pimCopyDeviceToHost(obj3, (void*)dest.data());
+  assert(status == PIM_OK);
+
+  // micro ops and micro-kernel
+  status = pimOpReadRowToSa(obj1, 0);
+  assert(status == PIM_OK);
+  status = pimOpNot(obj1, PIM_RREG_SA, PIM_RREG_R1);
+  assert(status == PIM_OK);
+  status = pimBeginMicroKernel({obj1, obj3});
+  assert(status == PIM_OK);
+  for (unsigned i = 0; i < 32; ++i) {
+    pimOpReadRowToSa(obj1, i);
+    pimOpWriteSaToRow(obj3, i);
+  }
+  PimMicroKernelId kernelId = pimEndMicroKernel(PIM_MICRO_KERNEL_OPT_PEEPHOLE);
+  assert(kernelId != -1);
+  status = pimRunMicroKernel(kernelId, {obj2, obj3});
+  assert(status == PIM_OK);
+  status = pimDeleteMicroKernel(kernelId);
+  assert(status == PIM_OK);
+
+  pimFree(obj1);
+  pimFree(obj2);
+  pimFree(obj3);
+
+  status = pimGetMicroOpStats(&numR, &numW, &numL);
+  assert(status == PIM_OK);
+  pimShowStats();
+  if (!keepDevice) {
+    pimDeleteDevice();
+  }
+  unsetenv("PIMEVAL_TRACE_OUT");
+  unsetenv("PIMEVAL_TRACE_PAYLOAD");
+}
+
+//! @brief  Replay a trace on the recorded device, and compare micro op stats
+bool testReplaySameDevice()
+{
+  const char* traceFile = "test-trace-bitsimd.trace";
+  unsigned numR = 0, numW = 0, numL = 0;
+  recordWorkload(traceFile, true, numR, numW, numL);
+
+  bool ok = (pimReplayTrace(traceFile) == PIM_OK);
+  unsigned numReplayR = 0, numReplayW = 0, numReplayL = 0;
+  PimDeviceProperties props;
+  ok = ok && (pimGetMicroOpStats(&numReplayR, &numReplayW, &numReplayL) == PIM_OK);
+  ok = ok && (pimGetDeviceProperties(&props) == PIM_OK);
+  if (!ok || numReplayR != numR || numReplayW != numW || numReplayL != numL || props.simTarget != PIM_DEVICE_BITSIMD_V) {
+    std::printf("Error: Replay micro ops R/W/L = %u/%u/%u, expected %u/%u/%u\n",
+                numReplayR, numReplayW, numReplayL, numR, numW, numL);
+    ok = false;
+  }
+  pimDeleteDevice();
+  std::remove(traceFile);
+
+  std::cout << "Trace Replay on BITSIMD_V " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Replay a trace with high-level APIs only on a different device in analysis mode
+bool testReplayOtherDevice()
+{
+  const char* traceFile = "test-trace-fulcrum.trace";
+  unsigned numR = 0, numW = 0, numL = 0;
+  recordWorkload(traceFile, false, numR, numW, numL);
+
+  // BitSIMD micro ops are not supported by Fulcrum
+  setenv("PIMEVAL_ANALYSIS_MODE", "1", 1);
+  bool ok = (pimReplayTrace(traceFile, PIM_DEVICE_FULCRUM) == PIM_ERROR);
+  pimDeleteDevice();
+  // Another bit-serial device supports all recorded APIs
+  ok &= (pimReplayTrace(traceFile, PIM_DEVICE_BITSIMD_V_AP) == PIM_OK);
+  unsetenv("PIMEVAL_ANALYSIS_MODE");
+  std::remove(traceFile);
+
+  std::cout << "Trace Replay on other devices " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+//! @brief  Invalid trace files are rejected
+bool testInvalidTrace()
+{
+  const char* traceFile = "test-trace-invalid.trace";
+  bool ok = (pimReplayTrace(traceFile) == PIM_ERROR);
+  FILE* file = std::fopen(traceFile, "wb");
+  assert(file);
+  std::fputs("NOTATRACE", file);
+  std::fclose(file);
+  ok &= (pimReplayTrace(traceFile) == PIM_ERROR);
+  std::remove(traceFile);
+
+  std::cout << "Invalid Trace " << (ok ? "PASSED" : "FAILED") << std::endl;
+  return ok;
+}
+
+int main()
+{
+  std::cout << "PIM Regression Test: PIM API trace recording and replay" << std::endl;
+
+  bool ok = true;
+  ok &= testReplaySameDevice();
+  ok &= testReplayOtherDevice();
+  ok &= testInvalidTrace();
+
+  std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
@@ -0,0 +1,121 @@
+// Tool: Replay a PIM API trace recorded with PIMEVAL_TRACE_OUT
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+
+
+// Params ---------------------------------------------------------------------
+typedef struct Params
+{
+  char *traceFile;
+  char *configFile;
+  PimDeviceEnum deviceType;
+} Params;
+
+void usage()
+{
+  fprintf(stderr,
+          "\nUsage:  ./trace-replay.out [options]"
+          "\n"
+          "\n    -i    trace file recorded with PIMEVAL_TRACE_OUT=<trace-file>"
+          "\n    -c    PIMeval config file to replay the trace with (default=recorded device config)"
+          "\n    -d    device type to replay the trace with, e.g., PIM_DEVICE_FULCRUM (default=recorded simulation target)"
+          "\n"
+          "\nReplay runs in analysis mode unless PIMEVAL_ANALYSIS_MODE is set in the environment."
+          "\nOther PIMEVAL_* environment variables are applied as usual."
+          "\n");
+}
+
+//! @brief  Convert a device type string to PimDeviceEnum
+PimDeviceEnum strToDeviceType(const std::string& str)
+{
+  static const std::vector<std::pair<std::string, PimDeviceEnum>> deviceTypes = {
+    { "PIM_FUNCTIONAL", PIM_FUNCTIONAL },
+    { "PIM_DEVICE_BITSIMD_V", PIM_DEVICE_BITSIMD_V },
+    { "PIM_DEVICE_BITSIMD_V_NAND", PIM_DEVICE_BITSIMD_V_NAND },
+    { "PIM_DEVICE_BITSIMD_V_MAJ", PIM_DEVICE_BITSIMD_V_MAJ },
+    { "PIM_DEVICE_BITSIMD_V_AP", PIM_DEVICE_BITSIMD_V_AP },
+    { "PIM_DEVICE_DRISA_NOR", PIM_DEVICE_DRISA_NOR },
+    { "PIM_DEVICE_DRISA_MIXED", PIM_DEVICE_DRISA_MIXED },
+    { "PIM_DEVICE_SIMDRAM", PIM_DEVICE_SIMDRAM },
+    { "PIM_DEVICE_BITSIMD_H", PIM_DEVICE_BITSIMD_H },
+    { "PIM_DEVICE_FULCRUM", PIM_DEVICE_FULCRUM },
+    { "PIM_DEVICE_BANK_LEVEL", PIM_DEVICE_BANK_LEVEL },
+    { "PIM_DEVICE_AQUABOLT", PIM_DEVICE_AQUABOLT },
+    { "PIM_DEVICE_AIM", PIM_DEVICE_AIM },
+  };
+  for (const auto& [name, deviceType] : deviceTypes) {
+    if (name == str) {
+      return deviceType;
+    }
+  }
+  return PIM_DEVICE_NONE;
+}
+
+struct Params getInputParams(int argc, char **argv)
+{
+  struct Params p;
+  p.traceFile = nullptr;
+  p.configFile = nullptr;
+  p.deviceType = PIM_DEVICE_NONE;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "hi:c:d:")) >= 0)
+  {
+    switch (opt)
+    {
+    case 'h':
+      usage();
+      exit(0);
+      break;
+    case 'i':
+      p.traceFile = optarg;
+      break;
+    case 'c':
+      p.configFile = optarg;
+      break;
+    case 'd':
+      p.deviceType = strToDeviceType(optarg);
+      if (p.deviceType == PIM_DEVICE_NONE) {
+        fprintf(stderr, "\nUnknown device type %s\n", optarg);
+        usage();
+        exit(1);
+      }
+      break;
+    default:
+      fprintf(stderr, "\nUnrecognized option!\n");
+      usage();
+      exit(1);
+    }
+  }
+  return p;
+}
+
+int main(int argc, char* argv[])
+{
+  struct Params params = getInputParams(argc, argv);
+  if (!params.traceFile) {
+    fprintf(stderr, "\nPlease specify a trace file with -i\n");
+    usage();
+    return 1;
+  }
+
+  // skip computation by default since host data is not always recorded
+  setenv("PIMEVAL_ANALYSIS_MODE", "1", 0);
+
+  PimStatus status = pimReplayTrace(params.traceFile, params.deviceType, params.configFile);
+  if (status != PIM_OK) {
+    std::cout << "Failed to replay trace file " << params.traceFile << std::endl;
+    return 1;
+  }
+  return 0;
+}
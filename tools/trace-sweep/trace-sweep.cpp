@@ -0,0 +1,437 @@
+// Tool: Evaluate a PIM API trace over a sweep of PIMeval configurations in parallel
+// Copyright (c) 2024 University of Virginia
+// This file is licensed under the MIT License.
+// See the LICENSE file in the root of this repository for more details.
+
+#include "libpimeval.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <thread>
+#include <algorithm>
+#include <filesystem>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <getopt.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+
+
+// Params ---------------------------------------------------------------------
+typedef struct Params
+{
+  char *traceFile;
+  char *sweepFile;
+  char *outputFile;
+  char *logDir;
+  unsigned numJobs;
+} Params;
+
+void usage()
+{
+  fprintf(stderr,
+          "\nUsage:  ./trace-sweep.out [options]"
+          "\n"
+          "\n    -i    trace file recorded with PIMEVAL_TRACE_OUT=<trace-file>"
+          "\n    -s    sweep spec file"
+          "\n    -o    output file, .csv or .json (default=CSV to stdout)"
+          "\n    -j    number of configurations evaluated in parallel (default=number of CPU cores)"
+          "\n    -l    directory for per-configuration simulator logs (default=discard logs)"
+          "\n"
+          "\nSweep spec file contains one parameter per line with comma separated values, e.g.,"
+          "\n    simulation_target = PIM_DEVICE_BITSIMD_V, PIM_DEVICE_FULCRUM"
+          "\n    num_ranks = 1, 4, 16"
+          "\nSupported parameters: simulation_target, memory_config_file, num_ranks, num_bank_per_rank,"
+          "\nnum_subarray_per_bank, num_row_per_subarray, num_col_per_subarray, max_num_threads."
+          "\nAll combinations of parameter values are evaluated, each in a separate simulator process."
+          "\nParameters not in the sweep spec use the recorded device config or PIMEVAL_* environment variables."
+          "\nReplay runs in analysis mode unless PIMEVAL_ANALYSIS_MODE is set in the environment."
+          "\n");
+}
+
+//! @brief  Convert a device type string to PimDeviceEnum
+PimDeviceEnum strToDeviceType(const std::string& str)
+{
+  static const std::vector<std::pair<std::string, PimDeviceEnum>> deviceTypes = {
+    { "PIM_FUNCTIONAL", PIM_FUNCTIONAL },
+    { "PIM_DEVICE_BITSIMD_V", PIM_DEVICE_BITSIMD_V },
+    { "PIM_DEVICE_BITSIMD_V_NAND", PIM_DEVICE_BITSIMD_V_NAND },
+    { "PIM_DEVICE_BITSIMD_V_MAJ", PIM_DEVICE_BITSIMD_V_MAJ },
+    { "PIM_DEVICE_BITSIMD_V_AP", PIM_DEVICE_BITSIMD_V_AP },
+    { "PIM_DEVICE_DRISA_NOR", PIM_DEVICE_DRISA_NOR },
+    { "PIM_DEVICE_DRISA_MIXED", PIM_DEVICE_DRISA_MIXED },
+    { "PIM_DEVICE_SIMDRAM", PIM_DEVICE_SIMDRAM },
+    { "PIM_DEVICE_BITSIMD_H", PIM_DEVICE_BITSIMD_H },
+    { "PIM_DEVICE_FULCRUM", PIM_DEVICE_FULCRUM },
+    { "PIM_DEVICE_BANK_LEVEL", PIM_DEVICE_BANK_LEVEL },
+    { "PIM_DEVICE_AQUABOLT", PIM_DEVICE_AQUABOLT },
+    { "PIM_DEVICE_AIM", PIM_DEVICE_AIM },
+  };
+  for (const auto& [name, deviceType] : deviceTypes) {
+    if (name == str) {
+      return deviceType;
+    }
+  }
+  return PIM_DEVICE_NONE;
+}
+
+struct Params getInputParams(int argc, char **argv)
+{
+  struct Params p;
+  p.traceFile = nullptr;
+  p.sweepFile = nullptr;
+  p.outputFile = nullptr;
+  p.logDir = nullptr;
+  p.numJobs = std::max(1u, std::thread::hardware_concurrency());
+
+  int opt;
+  while ((opt = getopt(argc, argv, "hi:s:o:j:l:")) >= 0)
+  {
+    switch (opt)
+    {
+    case 'h':
+      usage();
+      exit(0);
+      break;
+    case 'i':
+      p.traceFile = optarg;
+      break;
+    case 's':
+      p.sweepFile = optarg;
+      break;
+    case 'o':
+      p.outputFile = optarg;
+      break;
+    case 'j':
+      p.numJobs = std::max(1, atoi(optarg));
+      break;
+    case 'l':
+      p.logDir = optarg;
+      break;
+    default:
+      fprintf(stderr, "\nUnrecognized option!\n");
+      usage();
+      exit(1);
+    }
+  }
+  return p;
+}
+
+// Sweep spec -----------------------------------------------------------------
+
+//! @brief  Sweep parameters and the PIMEVAL_* environment variables they map to
+static const std::vector<std::pair<std::string, std::string>> g_sweepParams = {
+  { "simulation_target", "" },  // replay device type
+  { "memory_config_file", "PIMEVAL_MEM_CONFIG" },
+  { "num_ranks", "PIMEVAL_NUM_RANKS" },
+  { "num_bank_per_rank", "PIMEVAL_NUM_BANK_PER_RANK" },
+  { "num_subarray_per_bank", "PIMEVAL_NUM_SUBARRAY_PER_BANK" },
+  { "num_row_per_subarray", "PIMEVAL_NUM_ROW_PER_SUBARRAY" },
+  { "num_col_per_subarray", "PIMEVAL_NUM_COL_PER_SUBARRAY" },
+  { "max_num_threads", "PIMEVAL_MAX_NUM_THREADS" },
+};
+
+//! @brief  Trim leading and trailing white spaces
+std::string trim(const std::string& str)
+{
+  size_t begin = str.find_first_not_of(" \t\r\n");
+  if (begin == std::string::npos) {
+    return "";
+  }
+  size_t end = str.find_last_not_of(" \t\r\n");
+  return str.substr(begin, end - begin + 1);
+}
+
+//! @brief  Parse a sweep spec file into a list of parameters and their values
+bool parseSweepSpec(const std::string& fileName, std::vector<std::pair<std::string, std::vector<std::string>>>& spec)
+{
+  std::ifstream file(fileName);
+  if (!file.is_open()) {
+    std::cerr << "Error: Cannot open sweep spec file " << fileName << std::endl;
+    return false;
+  }
+  std::filesystem::path specDir = std::filesystem::path(fileName).parent_path();
+  std::string line;
+  int lineNum = 0;
+  while (std::getline(file, line)) {
+    ++lineNum;
+    line = trim(line.substr(0, line.find('#')));
+    if (line.empty()) {
+      continue;
+    }
+    size_t pos = line.find('=');
+    std::string key = (pos == std::string::npos ? "" : trim(line.substr(0, pos)));
+    auto it = std::find_if(g_sweepParams.begin(), g_sweepParams.end(), [&](const auto& p) { return p.first == key; });
+    if (it == g_sweepParams.end()) {
+      std::cerr << "Error: Unknown sweep parameter at line " << lineNum << ": " << line << std::endl;
+      return false;
+    }
+    if (std::any_of(spec.begin(), spec.end(), [&](const auto& p) { return p.first == key; })) {
+      std::cerr << "Error: Duplicated sweep parameter " << key << " at line " << lineNum << std::endl;
+      return false;
+    }
+    std::vector<std::string> vals;
+    std::stringstream ss(line.substr(pos + 1));
+    std::string val;
+    while (std::getline(ss, val, ',')) {
+      val = trim(val);
+      if (val.empty()) {
+        continue;
+      }
+      if (key == "simulation_target" && strToDeviceType(val) == PIM_DEVICE_NONE) {
+        std::cerr << "Error: Unknown simulation target " << val << " at line " << lineNum << std::endl;
+        return false;
+      }
+      // resolve memory config files relative to the sweep spec file if not found from current directory
+      if (key == "memory_config_file" && !std::filesystem::exists(val) && std::filesystem::exists(specDir / val)) {
+        val = std::filesystem::absolute(specDir / val).lexically_normal().string();
+      }
+      vals.push_back(val);
+    }
+    if (vals.empty()) {
+      std::cerr << "Error: No values for sweep parameter " << key << " at line " << lineNum << std::endl;
+      return false;
+    }
+    spec.emplace_back(key, vals);
+  }
+  return true;
+}
+
+//! @brief  Expand a sweep spec into all combinations of parameter values
+std::vector<std::vector<std::string>> expandSweepSpec(const std::vector<std::pair<std::string, std::vector<std::string>>>& spec)
+{
+  std::vector<std::vector<std::string>> configs(1);
+  for (const auto& [key, vals] : spec) {
+    std::vector<std::vector<std::string>> expanded;
+    for (const auto& config : configs) {
+      for (const auto& val : vals) {
+        expanded.push_back(config);
+        expanded.back().push_back(val);
+      }
+    }
+    configs.swap(expanded);
+  }
+  return configs;
+}
+
+// Sweep runner ---------------------------------------------------------------
+
+//! @brief  Result of one configuration, sent from a worker process through a pipe
+struct SweepResult
+{
+  bool ok = false;
+  PimDeviceProperties props;
+  PimStatsSummary stats;
+};
+
+//! @brief  Replay the trace with one configuration. Runs in a forked worker process
+SweepResult runConfig(const Params& params, const std::vector<std::pair<std::string, std::vector<std::string>>>& spec,
+                      const std::vector<std::string>& config)
+{
+  PimDeviceEnum deviceType = PIM_DEVICE_NONE;
+  for (size_t i = 0; i < spec.size(); ++i) {
+    const std::string& key = spec[i].first;
+    if (key == "simulation_target") {
+      deviceType = strToDeviceType(config[i]);
+      continue;
+    }
+    auto it = std::find_if(g_sweepParams.begin(), g_sweepParams.end(), [&](const auto& p) { return p.first == key; });
+    setenv(it->second.c_str(), config[i].c_str(), 1);
+  }
+
+  SweepResult result;
+  result.ok = (pimReplayTrace(params.traceFile, deviceType, nullptr, true) == PIM_OK);
+  result.ok = result.ok && (pimGetDeviceProperties(&result.props) == PIM_OK);
+  result.ok = result.ok && (pimGetStatsSummary(&result.stats) == PIM_OK);
+  pimDeleteDevice();
+  return result;
+}
+
+//! @brief  Evaluate all configurations with up to numJobs worker processes
+//! The simulator is a process-wide singleton, so each configuration runs in its own forked process
+std::vector<SweepResult> runSweep(const Params& params, const std::vector<std::pair<std::string, std::vector<std::string>>>& spec,
+                                  const std::vector<std::vector<std::string>>& configs)
+{
+  std::vector<SweepResult> results(configs.size());
+  std::map<pid_t, std::pair<size_t, int>> running;  // pid -> config index, read end of pipe
+  size_t next = 0;
+  while (next < configs.size() || !running.empty()) {
+    // launch workers
+    while (next < configs.size() && running.size() < params.numJobs) {
+      int fds[2];
+      if (pipe(fds) != 0) {
+        std::cerr << "Error: Failed to create pipe" << std::endl;
+        exit(1);
+      }
+      std::fflush(stdout);
+      std::fflush(stderr);
+      pid_t pid = fork();
+      if (pid < 0) {
+        std::cerr << "Error: Failed to fork worker process" << std::endl;
+        exit(1);
+      }
+      if (pid == 0) {
+        close(fds[0]);
+        std::string logFile = "/dev/null";
+        if (params.logDir) {
+          logFile = std::string(params.logDir) + "/config-" + std::to_string(next) + ".log";
+        }
+        int logFd = open(logFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (logFd >= 0) {
+          dup2(logFd, STDOUT_FILENO);
+          dup2(logFd, STDERR_FILENO);
+          close(logFd);
+        }
+        SweepResult result = runConfig(params, spec, configs[next]);
+        std::fflush(stdout);
+        ssize_t numBytes = write(fds[1], &result, sizeof(result));
+        close(fds[1]);
+        _exit(numBytes == sizeof(result) ? 0 : 1);
+      }
+      close(fds[1]);
+      running[pid] = std::make_pair(next, fds[0]);
+      ++next;
+    }
+    // collect a finished worker
+    int wstatus = 0;
+    pid_t pid = wait(&wstatus);
+    auto it = running.find(pid);
+    if (it == running.end()) {
+      continue;
+    }
+    auto [idx, fd] = it->second;
+    SweepResult result;
+    if (read(fd, &result, sizeof(result)) == sizeof(result) && WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0) {
+      results[idx] = result;
+    }
+    close(fd);
+    running.erase(it);
+    std::cerr << "Finished config " << idx << (results[idx].ok ? "" : " (failed)") << " ("
+              << (configs.size() - next + running.size()) << " remaining)" << std::endl;
+  }
+  return results;
+}
+
+// Output ---------------------------------------------------------------------
+
+//! @brief  Write sweep results as a CSV or JSON table
+void writeResults(std::ostream& os, bool isJson, const std::vector<std::pair<std::string, std::vector<std::string>>>& spec,
+                  const std::vector<std::vector<std::string>>& configs, const std::vector<SweepResult>& results)
+{
+  const std::vector<std::string> statNames = {
+    "status", "num_ranks_used", "num_bank_per_rank_used", "num_subarray_per_bank_used",
+    "num_row_per_subarray_used", "num_col_per_subarray_used", "bytes_copied", "copy_runtime_ms", "copy_energy_mj",
+    "num_cmds", "cmd_runtime_ms", "cmd_energy_mj", "total_runtime_ms", "total_energy_mj" };
+
+  if (isJson) {
+    os << "[\n";
+  } else {
+    os << "config";
+    for (const auto& [key, vals] : spec) {
+      os << "," << key;
+    }
+    for (const auto& name : statNames) {
+      os << "," << name;
+    }
+    os << "\n";
+  }
+
+  for (size_t i = 0; i < configs.size(); ++i) {
+    const SweepResult& r = results[i];
+    std::vector<std::string> stats = { r.ok ? "ok" : "failed" };
+    if (r.ok) {
+      std::vector<double> vals = {
+        (double)r.props.numRanks, (double)r.props.numBankPerRank, (double)r.props.numSubarrayPerBank,
+        (double)r.props.numRowPerSubarray, (double)r.props.numColPerSubarray, (double)r.stats.numBytesCopied,
+        r.stats.copyMsRuntime, r.stats.copyMjEnergy, (double)r.stats.numCmds, r.stats.cmdMsRuntime, r.stats.cmdMjEnergy,
+        r.stats.copyMsRuntime + r.stats.cmdMsRuntime, r.stats.copyMjEnergy + r.stats.cmdMjEnergy };
+      for (double val : vals) {
+        std::ostringstream ss;
+        ss.precision(10);
+        ss << val;
+        stats.push_back(ss.str());
+      }
+    }
+
+    if (isJson) {
+      os << "  { \"config\": " << i;
+      for (size_t j = 0; j < spec.size(); ++j) {
+        os << ", \"" << spec[j].first << "\": \"" << configs[i][j] << "\"";
+      }
+      os << ", \"status\": \"" << stats[0] << "\"";
+      for (size_t j = 1; j < stats.size(); ++j) {
+        os << ", \"" << statNames[j] << "\": " << stats[j];
+      }
+      os << " }" << (i + 1 < configs.size() ? "," : "") << "\n";
+    } else {
+      os << i;
+      for (const auto& val : configs[i]) {
+        os << "," << val;
+      }
+      for (size_t j = 0; j < statNames.size(); ++j) {
+        os << "," << (j < stats.size() ? stats[j] : "");
+      }
+      os << "\n";
+    }
+  }
+
+  if (isJson) {
+    os << "]\n";
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  struct Params params = getInputParams(argc, argv);
+  if (!params.traceFile || !params.sweepFile) {
+    fprintf(stderr, "\nPlease specify a trace file with -i and a sweep spec file with -s\n");
+    usage();
+    return 1;
+  }
+  if (access(params.traceFile, R_OK) != 0) {
+    fprintf(stderr, "\nCannot read trace file %s\n", params.traceFile);
+    return 1;
+  }
+
+  std::vector<std::pair<std::string, std::vector<std::string>>> spec;
+  if (!parseSweepSpec(params.sweepFile, spec)) {
+    return 1;
+  }
+  std::vector<std::vector<std::string>> configs = expandSweepSpec(spec);
+  std::cerr << "Evaluating " << configs.size() << " configurations with " << params.numJobs << " parallel jobs" << std::endl;
+
+  // skip computation by default since host data is not always recorded
+  setenv("PIMEVAL_ANALYSIS_MODE", "1", 0);
+  // configurations already run in parallel
+  setenv("PIMEVAL_MAX_NUM_THREADS", "1", 0);
+  // do not record a new trace while replaying
+  unsetenv("PIMEVAL_TRACE_OUT");
+  if (params.logDir) {
+    std::filesystem::create_directories(params.logDir);
+  }
+
+  std::vector<SweepResult> results = runSweep(params, spec, configs);
+
+  std::string outputFile = params.outputFile ? params.outputFile : "";
+  bool isJson = (outputFile.size() >= 5 && outputFile.substr(outputFile.size() - 5) == ".json");
+  if (outputFile.empty()) {
+    writeResults(std::cout, isJson, spec, configs, results);
+  } else {
+    std::ofstream os(outputFile);
+    if (!os.is_open()) {
+      std::cerr << "Error: Cannot open output file " << outputFile << std::endl;
+      return 1;
+    }
+    writeResults(os, isJson, spec, configs, results);
+    std::cerr << "Results written to " << outputFile << std::endl;
+  }
+
+  bool allOk = std::all_of(results.begin(), results.end(), [](const SweepResult& r) { return r.ok; });
+  return allOk ? 0 : 1;
+}